@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `name` = 'mmap benchmark';
+INSERT INTO `command` (`name`, `security`, `help`) VALUES
+('mmap benchmark', 3, 'Syntax: .mmap benchmark to compare regular and hierarchical paths to fixed destinations up to 2000 yards around the player');
@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `name` = 'debug conditions';
+INSERT INTO `command` (`name`, `security`, `help`) VALUES
+('debug conditions', 3, 'Syntax: .debug conditions [$iterations]\r\n\r\nEvaluates every loaded condition list $iterations times (10 by default) against you and your selected target and shows the average time per evaluation.');
@@ -25,6 +25,7 @@ namespace MMAP
 {
     static char const* const MAP_FILE_NAME_FORMAT = "{}/mmaps/{:03}.mmap";
     static char const* const TILE_FILE_NAME_FORMAT = "{}/mmaps/{:03}{:02}{:02}.mmtile";
+    static char const* const GRAPH_FILE_NAME_FORMAT = "{}/mmaps/{:03}.mmgraph";
 
     // ######################## MMapMgr ########################
     MMapMgr::~MMapMgr()
@@ -116,6 +117,17 @@ namespace MMAP
 
         // store inside our map list
         MMapData* mmap_data = new MMapData(mesh);
+
+        // the tile graph is optional, without it long paths are built the old way
+        std::unique_ptr<TileGraph> tileGraph = std::make_unique<TileGraph>();
+        std::string graphFileName = Acore::StringFormat(GRAPH_FILE_NAME_FORMAT, sConfigMgr->GetOption<std::string>("DataDir", "."), mapId);
+        if (tileGraph->Load(graphFileName))
+        {
+            LOG_DEBUG("maps", "MMAP:loadMapData: Loaded {:03}.mmgraph with {} nodes and {} edges", mapId, tileGraph->GetNodeCount(), tileGraph->GetEdgeCount());
+            mmap_data->tileGraph = std::move(tileGraph);
+        }
+
+        std::unique_lock<std::shared_mutex> lock(navMeshLock);
         itr->second = mmap_data;
         return true;
     }
@@ -188,6 +200,7 @@ namespace MMAP
         dtTileRef tileRef = 0;
 
         // memory allocated for data is now managed by detour, and will be deallocated when the tile is removed
+        std::unique_lock<std::shared_mutex> lock(navMeshLock);
         if (dtStatusSucceed(mmap->navMesh->addTile(data, fileHeader.size, DT_TILE_FREE_DATA, 0, &tileRef)))
         {
             mmap->loadedTileRefs.insert(std::pair<uint32, dtTileRef>(packedGridPos, tileRef));
@@ -227,6 +240,7 @@ namespace MMAP
         dtTileRef tileRef = mmap->loadedTileRefs[packedGridPos];
 
         // unload, and mark as non loaded
+        std::unique_lock<std::shared_mutex> lock(navMeshLock);
         if (dtStatusFailed(mmap->navMesh->removeTile(tileRef, nullptr, nullptr)))
         {
             // this is technically a memory leak
@@ -253,6 +267,7 @@ namespace MMAP
         }
 
         // unload all tiles from given map
+        std::unique_lock<std::shared_mutex> lock(navMeshLock);
         MMapData* mmap = itr->second;
         for (auto& i : mmap->loadedTileRefs)
         {
@@ -315,6 +330,17 @@ namespace MMAP
         return itr->second->navMesh;
     }
 
+    TileGraph const* MMapMgr::GetTileGraph(uint32 mapId)
+    {
+        MMapDataSet::const_iterator itr = GetMMapData(mapId);
+        if (itr == loadedMMaps.end())
+        {
+            return nullptr;
+        }
+
+        return itr->second->tileGraph.get();
+    }
+
     dtNavMeshQuery const* MMapMgr::GetNavMeshQuery(uint32 mapId, uint32 instanceId)
     {
         MMapDataSet::const_iterator itr = GetMMapData(mapId);
@@ -22,6 +22,9 @@
 #include "DetourAlloc.h"
 #include "DetourExtended.h"
 #include "DetourNavMesh.h"
+#include "MMapTileGraph.h"
+#include <memory>
+#include <shared_mutex>
 #include <unordered_map>
 #include <vector>
 
@@ -64,6 +67,7 @@ namespace MMAP
         NavMeshQuerySet navMeshQueries; // instanceId to query
         dtNavMesh* navMesh;
         MMapTileSet loadedTileRefs; // maps [map grid coords] to [dtTile]
+        std::unique_ptr<TileGraph> tileGraph; // optional, from MMM.mmgraph
     };
 
     typedef std::unordered_map<uint32, MMapData*> MMapDataSet;
@@ -85,6 +89,12 @@ namespace MMAP
         // the returned [dtNavMeshQuery const*] is NOT threadsafe
         dtNavMeshQuery const* GetNavMeshQuery(uint32 mapId, uint32 instanceId);
         dtNavMesh const* GetNavMesh(uint32 mapId);
+        // tile connectivity of the whole map, nullptr if the map has no .mmgraph file
+        TileGraph const* GetTileGraph(uint32 mapId);
+
+        // tiles are only added and removed while holding this exclusively, threads querying
+        // a navmesh outside of its map update (PathfindingService) hold it shared
+        [[nodiscard]] std::shared_mutex& GetNavMeshLock() { return navMeshLock; }
 
         [[nodiscard]] uint32 getLoadedTilesCount() const { return loadedTiles; }
         [[nodiscard]] uint32 getLoadedMapsCount() const { return loadedMMaps.size(); }
@@ -97,6 +107,7 @@ namespace MMAP
         MMapDataSet loadedMMaps;
         uint32 loadedTiles{0};
         bool thread_safe_environment{true};
+        std::shared_mutex navMeshLock;
     };
 }
 
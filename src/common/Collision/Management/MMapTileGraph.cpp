@@ -0,0 +1,401 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MMapTileGraph.h"
+#include "DetourCommon.h"
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cstdio>
+#include <numeric>
+#include <queue>
+
+namespace MMAP
+{
+    namespace
+    {
+        void PolyCenter(dtMeshTile const* tile, dtPoly const* poly, float* center)
+        {
+            dtVset(center, 0.0f, 0.0f, 0.0f);
+            for (uint8 i = 0; i < poly->vertCount; ++i)
+                dtVadd(center, center, &tile->verts[poly->verts[i] * 3]);
+
+            dtVscale(center, center, 1.0f / poly->vertCount);
+        }
+
+        uint32 FindRoot(std::vector<uint32>& parent, uint32 i)
+        {
+            while (parent[i] != i)
+            {
+                parent[i] = parent[parent[i]];
+                i = parent[i];
+            }
+
+            return i;
+        }
+    }
+
+    void TileGraph::Build(dtNavMesh const& navMesh)
+    {
+        _tiles.clear();
+        _nodes.clear();
+        _edges.clear();
+
+        // split every tile into islands of polygons connected by internal links
+        for (int32 i = 0; i < navMesh.getMaxTiles(); ++i)
+        {
+            dtMeshTile const* tile = navMesh.getTile(i);
+            if (!tile || !tile->header || !tile->dataSize)
+                continue;
+
+            uint32 const polyCount = uint32(tile->header->polyCount);
+            uint32 const tileIndex = navMesh.decodePolyIdTile(navMesh.getPolyRefBase(tile));
+
+            std::vector<uint32> parent(polyCount);
+            std::iota(parent.begin(), parent.end(), 0);
+
+            for (uint32 p = 0; p < polyCount; ++p)
+            {
+                dtPoly const* poly = &tile->polys[p];
+                for (uint32 l = poly->firstLink; l != DT_NULL_LINK; l = tile->links[l].next)
+                {
+                    dtPolyRef const ref = tile->links[l].ref;
+                    if (!ref || navMesh.decodePolyIdTile(ref) != tileIndex)
+                        continue;
+
+                    uint32 const a = FindRoot(parent, p);
+                    uint32 const b = FindRoot(parent, navMesh.decodePolyIdPoly(ref));
+                    if (a != b)
+                        parent[std::max(a, b)] = std::min(a, b);
+                }
+            }
+
+            TileEntry& entry = _tiles[PackTileId(tile->header->x, tile->header->y)];
+            entry.FirstNode = uint32(_nodes.size());
+            entry.PolyNodes.resize(polyCount);
+
+            std::vector<std::array<float, 3>> sums;
+            std::vector<uint32> rootNodes(polyCount, 0xFFFFFFFF);
+            for (uint32 p = 0; p < polyCount; ++p)
+            {
+                uint32 const root = FindRoot(parent, p);
+                if (rootNodes[root] == 0xFFFFFFFF)
+                {
+                    rootNodes[root] = entry.NodeCount++;
+                    _nodes.push_back({ PackTileId(tile->header->x, tile->header->y), 0, { 0.0f, 0.0f, 0.0f } });
+                    sums.push_back({ 0.0f, 0.0f, 0.0f });
+                }
+
+                uint32 const node = rootNodes[root];
+                entry.PolyNodes[p] = uint16(node);
+
+                float center[3];
+                PolyCenter(tile, &tile->polys[p], center);
+                dtVadd(sums[node].data(), sums[node].data(), center);
+                ++_nodes[entry.FirstNode + node].PolyCount;
+            }
+
+            // the average of a concave island can lie outside of it, use the polygon center closest to it
+            std::vector<float> bestDist(entry.NodeCount, FLT_MAX);
+            for (uint32 p = 0; p < polyCount; ++p)
+            {
+                uint32 const node = entry.PolyNodes[p];
+                TileGraphNode& graphNode = _nodes[entry.FirstNode + node];
+
+                float average[3];
+                dtVscale(average, sums[node].data(), 1.0f / graphNode.PolyCount);
+
+                float center[3];
+                PolyCenter(tile, &tile->polys[p], center);
+                float const dist = dtVdistSqr(center, average);
+                if (dist < bestDist[node])
+                {
+                    bestDist[node] = dist;
+                    dtVcopy(graphNode.Center, center);
+                }
+            }
+        }
+
+        // collect every external link as a candidate portal between two islands
+        std::unordered_map<uint64, std::vector<std::array<float, 3>>> portals;
+        for (int32 i = 0; i < navMesh.getMaxTiles(); ++i)
+        {
+            dtMeshTile const* tile = navMesh.getTile(i);
+            if (!tile || !tile->header || !tile->dataSize)
+                continue;
+
+            uint32 const tileIndex = navMesh.decodePolyIdTile(navMesh.getPolyRefBase(tile));
+            TileEntry const& entry = _tiles[PackTileId(tile->header->x, tile->header->y)];
+
+            for (int32 p = 0; p < tile->header->polyCount; ++p)
+            {
+                dtPoly const* poly = &tile->polys[p];
+                if (poly->getType() == DT_POLYTYPE_OFFMESH_CONNECTION)
+                    continue;
+
+                for (uint32 l = poly->firstLink; l != DT_NULL_LINK; l = tile->links[l].next)
+                {
+                    dtLink const& link = tile->links[l];
+                    if (!link.ref || navMesh.decodePolyIdTile(link.ref) == tileIndex)
+                        continue;
+
+                    int32 const to = GetNode(navMesh, link.ref);
+                    if (to < 0)
+                        continue;
+
+                    // external links only cover the part of the edge shared with the neighbour polygon
+                    float const* va = &tile->verts[poly->verts[link.edge] * 3];
+                    float const* vb = &tile->verts[poly->verts[(link.edge + 1) % poly->vertCount] * 3];
+                    float const t = (link.bmin + link.bmax) * 0.5f / 255.0f;
+
+                    std::array<float, 3> portal;
+                    dtVlerp(portal.data(), va, vb, t);
+
+                    uint64 const from = entry.FirstNode + entry.PolyNodes[p];
+                    portals[from << 32 | uint32(to)].push_back(portal);
+                }
+            }
+        }
+
+        _edges.reserve(portals.size());
+        for (auto const& [key, candidates] : portals)
+        {
+            float average[3] = { 0.0f, 0.0f, 0.0f };
+            for (std::array<float, 3> const& portal : candidates)
+                dtVadd(average, average, portal.data());
+
+            dtVscale(average, average, 1.0f / candidates.size());
+
+            TileGraphEdge edge;
+            edge.From = uint32(key >> 32);
+            edge.To = uint32(key);
+
+            float bestDist = FLT_MAX;
+            for (std::array<float, 3> const& portal : candidates)
+            {
+                float const dist = dtVdistSqr(portal.data(), average);
+                if (dist < bestDist)
+                {
+                    bestDist = dist;
+                    dtVcopy(edge.Portal, portal.data());
+                }
+            }
+
+            edge.Cost = dtVdist(_nodes[edge.From].Center, edge.Portal) + dtVdist(edge.Portal, _nodes[edge.To].Center);
+            _edges.push_back(edge);
+        }
+
+        BuildEdgeIndex();
+    }
+
+    void TileGraph::BuildEdgeIndex()
+    {
+        std::sort(_edges.begin(), _edges.end(), [](TileGraphEdge const& left, TileGraphEdge const& right)
+        {
+            return left.From != right.From ? left.From < right.From : left.To < right.To;
+        });
+
+        _firstEdge.assign(_nodes.size() + 1, 0);
+        for (TileGraphEdge const& edge : _edges)
+            ++_firstEdge[edge.From + 1];
+
+        for (std::size_t i = 1; i < _firstEdge.size(); ++i)
+            _firstEdge[i] += _firstEdge[i - 1];
+    }
+
+    bool TileGraph::Save(std::string const& fileName) const
+    {
+        FILE* file = fopen(fileName.c_str(), "wb");
+        if (!file)
+            return false;
+
+        MmapGraphFileHeader header;
+        header.tileCount = uint32(_tiles.size());
+        header.nodeCount = uint32(_nodes.size());
+        header.edgeCount = uint32(_edges.size());
+        fwrite(&header, sizeof(header), 1, file);
+
+        for (auto const& [tileId, entry] : _tiles)
+        {
+            uint32 const polyCount = uint32(entry.PolyNodes.size());
+            fwrite(&tileId, sizeof(tileId), 1, file);
+            fwrite(&entry.FirstNode, sizeof(entry.FirstNode), 1, file);
+            fwrite(&entry.NodeCount, sizeof(entry.NodeCount), 1, file);
+            fwrite(&polyCount, sizeof(polyCount), 1, file);
+            fwrite(entry.PolyNodes.data(), sizeof(uint16), polyCount, file);
+        }
+
+        fwrite(_nodes.data(), sizeof(TileGraphNode), _nodes.size(), file);
+        fwrite(_edges.data(), sizeof(TileGraphEdge), _edges.size(), file);
+
+        bool const success = !ferror(file);
+        fclose(file);
+        return success;
+    }
+
+    bool TileGraph::Load(std::string const& fileName)
+    {
+        FILE* file = fopen(fileName.c_str(), "rb");
+        if (!file)
+            return false;
+
+        auto fail = [&]()
+        {
+            fclose(file);
+            _tiles.clear();
+            _nodes.clear();
+            _edges.clear();
+            _firstEdge.clear();
+            return false;
+        };
+
+        MmapGraphFileHeader header;
+        if (fread(&header, sizeof(header), 1, file) != 1 || header.graphMagic != MMAP_GRAPH_MAGIC || header.graphVersion != MMAP_GRAPH_VERSION)
+            return fail();
+
+        for (uint32 i = 0; i < header.tileCount; ++i)
+        {
+            uint32 tileId, polyCount;
+            TileEntry entry;
+            if (fread(&tileId, sizeof(tileId), 1, file) != 1 ||
+                fread(&entry.FirstNode, sizeof(entry.FirstNode), 1, file) != 1 ||
+                fread(&entry.NodeCount, sizeof(entry.NodeCount), 1, file) != 1 ||
+                fread(&polyCount, sizeof(polyCount), 1, file) != 1)
+                return fail();
+
+            entry.PolyNodes.resize(polyCount);
+            if (fread(entry.PolyNodes.data(), sizeof(uint16), polyCount, file) != polyCount)
+                return fail();
+
+            if (entry.FirstNode + entry.NodeCount > header.nodeCount)
+                return fail();
+
+            _tiles[tileId] = std::move(entry);
+        }
+
+        _nodes.resize(header.nodeCount);
+        _edges.resize(header.edgeCount);
+        if (fread(_nodes.data(), sizeof(TileGraphNode), _nodes.size(), file) != _nodes.size() ||
+            fread(_edges.data(), sizeof(TileGraphEdge), _edges.size(), file) != _edges.size())
+            return fail();
+
+        for (TileGraphEdge const& edge : _edges)
+            if (edge.From >= header.nodeCount || edge.To >= header.nodeCount)
+                return fail();
+
+        fclose(file);
+        BuildEdgeIndex();
+        return true;
+    }
+
+    int32 TileGraph::GetNode(dtNavMesh const& navMesh, dtPolyRef polyRef) const
+    {
+        dtMeshTile const* tile = nullptr;
+        dtPoly const* poly = nullptr;
+        if (dtStatusFailed(navMesh.getTileAndPolyByRef(polyRef, &tile, &poly)))
+            return -1;
+
+        auto itr = _tiles.find(PackTileId(tile->header->x, tile->header->y));
+        if (itr == _tiles.end())
+            return -1;
+
+        uint32 const polyIndex = navMesh.decodePolyIdPoly(polyRef);
+        if (polyIndex >= itr->second.PolyNodes.size())
+            return -1;
+
+        return int32(itr->second.FirstNode + itr->second.PolyNodes[polyIndex]);
+    }
+
+    int32 TileGraph::GetLargestNodeAt(dtNavMesh const& navMesh, float const* pos) const
+    {
+        int32 tx, ty;
+        navMesh.calcTileLoc(pos, &tx, &ty);
+
+        auto itr = _tiles.find(PackTileId(tx, ty));
+        if (itr == _tiles.end() || !itr->second.NodeCount)
+            return -1;
+
+        uint32 best = itr->second.FirstNode;
+        for (uint32 node = best + 1; node < itr->second.FirstNode + itr->second.NodeCount; ++node)
+            if (_nodes[node].PolyCount > _nodes[best].PolyCount)
+                best = node;
+
+        return int32(best);
+    }
+
+    bool TileGraph::FindRoute(uint32 startNode, uint32 endNode, std::vector<G3D::Vector3>& portals) const
+    {
+        portals.clear();
+        if (startNode >= _nodes.size() || endNode >= _nodes.size())
+            return false;
+
+        if (startNode == endNode)
+            return true;
+
+        using OpenEntry = std::pair<float /*estimated cost*/, uint32 /*node*/>;
+        std::priority_queue<OpenEntry, std::vector<OpenEntry>, std::greater<OpenEntry>> open;
+        std::unordered_map<uint32 /*node*/, float> costs;
+        std::unordered_map<uint32 /*node*/, uint32 /*edge*/> cameFrom;
+
+        float const* goal = _nodes[endNode].Center;
+        costs[startNode] = 0.0f;
+        open.emplace(dtVdist(_nodes[startNode].Center, goal), startNode);
+
+        while (!open.empty())
+        {
+            auto [estimate, node] = open.top();
+            open.pop();
+
+            float const cost = costs[node];
+            if (estimate > cost + dtVdist(_nodes[node].Center, goal) + 0.01f)
+                continue; // outdated entry
+
+            if (node == endNode)
+            {
+                for (uint32 current = endNode; current != startNode;)
+                {
+                    TileGraphEdge const& edge = _edges[cameFrom[current]];
+                    portals.emplace_back(edge.Portal[0], edge.Portal[1], edge.Portal[2]);
+                    current = edge.From;
+                }
+
+                std::reverse(portals.begin(), portals.end());
+                return true;
+            }
+
+            for (uint32 e = _firstEdge[node]; e < _firstEdge[node + 1]; ++e)
+            {
+                TileGraphEdge const& edge = _edges[e];
+                float const newCost = cost + edge.Cost;
+
+                auto [itr, inserted] = costs.try_emplace(edge.To, newCost);
+                if (!inserted)
+                {
+                    if (newCost >= itr->second)
+                        continue;
+
+                    itr->second = newCost;
+                }
+
+                cameFrom[edge.To] = e;
+                open.emplace(newCost + dtVdist(_nodes[edge.To].Center, goal), edge.To);
+            }
+        }
+
+        return false;
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MMAP_TILE_GRAPH_H
+#define _MMAP_TILE_GRAPH_H
+
+#include "Define.h"
+#include "DetourNavMesh.h"
+#include <G3D/Vector3.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define MMAP_GRAPH_MAGIC 0x4d4d4752   // 'MMGR'
+#define MMAP_GRAPH_VERSION 1
+
+namespace MMAP
+{
+    struct MmapGraphFileHeader
+    {
+        uint32 graphMagic{MMAP_GRAPH_MAGIC};
+        uint32 graphVersion{MMAP_GRAPH_VERSION};
+        uint32 tileCount{0};
+        uint32 nodeCount{0};
+        uint32 edgeCount{0};
+    };
+
+    /// Island of polygons inside one navmesh tile that are connected to each other
+    struct TileGraphNode
+    {
+        uint32 TileId;
+        uint32 PolyCount;
+        float Center[3];        // detour coordinates
+    };
+
+    /// Connection between islands of neighbour tiles, through the portal edge closest to the middle of their border
+    struct TileGraphEdge
+    {
+        uint32 From;
+        uint32 To;
+        float Portal[3];        // detour coordinates
+        float Cost;
+    };
+
+    /**
+     * Coarse connectivity of a whole map navmesh, written by mmaps_generator as mmaps/MMM.mmgraph.
+     *
+     * Long paths search this graph first and then run detour between consecutive portals, so they
+     * only ever need small searches over the tiles that are loaded at that moment.
+     */
+    class TileGraph
+    {
+    public:
+        static uint32 PackTileId(int32 x, int32 y) { return uint32(x << 16 | y); }
+
+        /// Builds the graph from a navmesh that has every tile of the map loaded
+        void Build(dtNavMesh const& navMesh);
+        bool Save(std::string const& fileName) const;
+        bool Load(std::string const& fileName);
+
+        /// Node of the island a polygon belongs to, -1 if the tile is unknown
+        [[nodiscard]] int32 GetNode(dtNavMesh const& navMesh, dtPolyRef polyRef) const;
+        /// Largest island of the tile containing a position, for destinations in tiles that are not loaded
+        [[nodiscard]] int32 GetLargestNodeAt(dtNavMesh const& navMesh, float const* pos) const;
+
+        /// A* over the islands, returns the portals to pass in detour coordinates
+        bool FindRoute(uint32 startNode, uint32 endNode, std::vector<G3D::Vector3>& portals) const;
+
+        [[nodiscard]] std::size_t GetNodeCount() const { return _nodes.size(); }
+        [[nodiscard]] std::size_t GetEdgeCount() const { return _edges.size(); }
+
+    private:
+        struct TileEntry
+        {
+            uint32 FirstNode = 0;
+            uint32 NodeCount = 0;
+            std::vector<uint16> PolyNodes;  // node offset inside the tile for every polygon
+        };
+
+        void BuildEdgeIndex();
+
+        std::unordered_map<uint32 /*tileId*/, TileEntry> _tiles;
+        std::vector<TileGraphNode> _nodes;
+        std::vector<TileGraphEdge> _edges;      // sorted by From
+        std::vector<uint32> _firstEdge;         // per node, plus one past the end
+    };
+}
+
+#endif
@@ -28,8 +28,19 @@
 #include "StringConvert.h"
 #include "Timer.h"
 #include "Tokenize.h"
+#include <algorithm>
 #include <chrono>
 
+LogCategory::LogCategory(std::string_view type) : _type(type), _level(LOG_LEVEL_DISABLED)
+{
+    sLog->RegisterCategory(this);
+}
+
+LogCategory::~LogCategory()
+{
+    sLog->UnregisterCategory(this);
+}
+
 Log::Log() : AppenderId(0), highestLogLevel(LOG_LEVEL_FATAL)
 {
     m_logsTimestamp = "_" + GetTimestampStr();
@@ -307,6 +318,8 @@ bool Log::SetLogLevel(std::string const& name, int32 newLeveli, bool isLogger /*
         {
             highestLogLevel = newLevel;
         }
+
+        UpdateCategories();
     }
     else
     {
@@ -334,14 +347,11 @@ void Log::Close()
 {
     loggers.clear();
     appenders.clear();
+    UpdateCategories();
 }
 
 bool Log::ShouldLog(std::string const& type, LogLevel level) const
 {
-    /// @todo: Use cache to store "Type.sub1.sub2": "Type" equivalence, should
-    // Speed up in cases where requesting "Type.sub1.sub2" but only configured
-    // Logger "Type"
-
     // Don't even look for a logger if the LogLevel is higher than the highest log levels across all loggers
     if (level > highestLogLevel)
     {
@@ -358,6 +368,40 @@ bool Log::ShouldLog(std::string const& type, LogLevel level) const
     return logLevel != LOG_LEVEL_DISABLED && logLevel >= level;
 }
 
+LogLevel Log::GetEffectiveLogLevel(std::string const& type) const
+{
+    Logger const* logger = GetLoggerByType(type);
+    if (!logger)
+    {
+        return LOG_LEVEL_DISABLED;
+    }
+
+    // same result as ShouldLog for every level
+    return std::min(logger->getLogLevel(), highestLogLevel);
+}
+
+void Log::RegisterCategory(LogCategory* category)
+{
+    std::lock_guard<std::mutex> guard(_categoriesLock);
+    category->_level.store(GetEffectiveLogLevel(category->_type), std::memory_order_relaxed);
+    _categories.push_back(category);
+}
+
+void Log::UnregisterCategory(LogCategory* category)
+{
+    std::lock_guard<std::mutex> guard(_categoriesLock);
+    _categories.erase(std::remove(_categories.begin(), _categories.end(), category), _categories.end());
+}
+
+void Log::UpdateCategories()
+{
+    std::lock_guard<std::mutex> guard(_categoriesLock);
+    for (LogCategory* category : _categories)
+    {
+        category->_level.store(GetEffectiveLogLevel(category->_type), std::memory_order_relaxed);
+    }
+}
+
 Log* Log::instance()
 {
     static Log instance;
@@ -398,4 +442,5 @@ void Log::LoadFromConfig()
 
     ReadAppendersFromConfig();
     ReadLoggersFromConfig();
+    UpdateCategories();
 }
@@ -22,6 +22,10 @@
 #include "Define.h"
 #include "LogCommon.h"
 #include "StringFormat.h"
+#include <atomic>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -45,8 +49,41 @@ Appender* CreateAppender(uint8 id, std::string const& name, LogLevel level, Appe
     return new AppenderImpl(id, name, level, flags, extraArgs);
 }
 
+/**
+ * Log type resolved once to the level of the logger it ends up at.
+ *
+ * The LOG_* macros keep one static instance per call site with a literal type, so a dropped message costs a single
+ * relaxed load instead of building a std::string and walking the logger map. Log refreshes the level of every
+ * category whenever the loggers change (config reload, SetLogLevel).
+ */
+class LogCategory
+{
+public:
+    explicit LogCategory(std::string_view type);
+    ~LogCategory();
+
+    LogCategory(LogCategory const&) = delete;
+    LogCategory& operator=(LogCategory const&) = delete;
+
+    [[nodiscard]] bool ShouldLog(LogLevel level) const
+    {
+        LogLevel effectiveLevel = _level.load(std::memory_order_relaxed);
+        return effectiveLevel != LOG_LEVEL_DISABLED && effectiveLevel >= level;
+    }
+
+    [[nodiscard]] std::string const& GetType() const { return _type; }
+
+private:
+    friend class Log;
+
+    std::string const _type;
+    std::atomic<LogLevel> _level;
+};
+
 class Log
 {
+friend class LogCategory;
+
 typedef std::unordered_map<std::string, Logger> LoggerMap;
 
 private:
@@ -100,6 +137,10 @@ private:
     void write(std::unique_ptr<LogMessage>&& msg) const;
 
     [[nodiscard]] Logger const* GetLoggerByType(std::string const& type) const;
+    [[nodiscard]] LogLevel GetEffectiveLogLevel(std::string const& type) const;
+    void RegisterCategory(LogCategory* category);
+    void UnregisterCategory(LogCategory* category);
+    void UpdateCategories();
     Appender* GetAppenderByName(std::string_view name);
     uint8 NextAppenderId();
     void CreateAppenderFromConfig(std::string const& name);
@@ -121,6 +162,9 @@ private:
 
     Acore::Asio::IoContext* _ioContext;
     Acore::Asio::Strand* _strand;
+
+    std::mutex _categoriesLock;
+    std::vector<LogCategory*> _categories;
 };
 
 #define sLog Log::instance()
@@ -141,11 +185,18 @@ private:
 #ifdef PERFORMANCE_PROFILING
 #define LOG_MESSAGE_BODY(filterType__, level__, ...) ((void)0)
 #else
-#define LOG_MESSAGE_BODY(filterType__, level__, ...)                        \
-        do                                                              \
-        {                                                               \
-            if (sLog->ShouldLog(filterType__, level__))                 \
-                LOG_EXCEPTION_FREE(filterType__, level__, __VA_ARGS__); \
+// literal types are resolved once per call site, types built at runtime are looked up on every call
+#define LOG_MESSAGE_BODY(filterType__, level__, ...)                                                \
+        do                                                                                      \
+        {                                                                                       \
+            if constexpr (std::is_array_v<std::remove_reference_t<decltype(filterType__)>>)     \
+            {                                                                                   \
+                static LogCategory logCategory__(filterType__);                                 \
+                if (logCategory__.ShouldLog(level__))                                           \
+                    LOG_EXCEPTION_FREE(logCategory__.GetType(), level__, __VA_ARGS__);          \
+            }                                                                                   \
+            else if (sLog->ShouldLog(filterType__, level__))                                    \
+                LOG_EXCEPTION_FREE(filterType__, level__, __VA_ARGS__);                         \
         } while (0)
 #endif
 
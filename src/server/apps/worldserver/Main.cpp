@@ -31,6 +31,8 @@
 #include "DatabaseEnv.h"
 #include "DatabaseLoader.h"
 #include "GitRevision.h"
+#include "GridPreloader.h"
+#include "GridTerrainStore.h"
 #include "IoContext.h"
 #include "MapMgr.h"
 #include "Metric.h"
@@ -39,6 +41,8 @@
 #include "MySQLThreading.h"
 #include "OpenSSLCrypto.h"
 #include "OutdoorPvPMgr.h"
+#include "PathfindingService.h"
+#include "Player.h"
 #include "ProcessPriority.h"
 #include "RASession.h"
 #include "RealmList.h"
@@ -47,6 +51,7 @@
 #include "ScriptMgr.h"
 #include "SecretMgr.h"
 #include "SharedDefines.h"
+#include "SpellAllocator.h"
 #include "SteadyTimer.h"
 #include "World.h"
 #include "WorldSessionMgr.h"
@@ -290,6 +295,70 @@ int main(int argc, char** argv)
         METRIC_VALUE("db_queue_login", uint64(LoginDatabase.QueueSize()));
         METRIC_VALUE("db_queue_character", uint64(CharacterDatabase.QueueSize()));
         METRIC_VALUE("db_queue_world", uint64(WorldDatabase.QueueSize()));
+
+        for (std::size_t lane = 0; lane < CharacterDatabase.GetLaneCount(); ++lane)
+            METRIC_VALUE("db_queue_lane", uint64(CharacterDatabase.QueueSize(lane)), METRIC_TAG("db", "character"), METRIC_TAG("lane", std::to_string(lane)));
+        for (std::size_t lane = 0; lane < LoginDatabase.GetLaneCount(); ++lane)
+            METRIC_VALUE("db_queue_lane", uint64(LoginDatabase.QueueSize(lane)), METRIC_TAG("db", "login"), METRIC_TAG("lane", std::to_string(lane)));
+        for (std::size_t lane = 0; lane < WorldDatabase.GetLaneCount(); ++lane)
+            METRIC_VALUE("db_queue_lane", uint64(WorldDatabase.QueueSize(lane)), METRIC_TAG("db", "world"), METRIC_TAG("lane", std::to_string(lane)));
+
+        uint64 transactionStatements;
+        uint64 transactionRoundTrips;
+        CharacterDatabase.GetTransactionStats(transactionStatements, transactionRoundTrips);
+        METRIC_VALUE("db_transaction_statements", transactionStatements, METRIC_TAG("db", "character"));
+        METRIC_VALUE("db_transaction_round_trips", transactionRoundTrips, METRIC_TAG("db", "character"));
+        LoginDatabase.GetTransactionStats(transactionStatements, transactionRoundTrips);
+        METRIC_VALUE("db_transaction_statements", transactionStatements, METRIC_TAG("db", "login"));
+        METRIC_VALUE("db_transaction_round_trips", transactionRoundTrips, METRIC_TAG("db", "login"));
+        WorldDatabase.GetTransactionStats(transactionStatements, transactionRoundTrips);
+        METRIC_VALUE("db_transaction_statements", transactionStatements, METRIC_TAG("db", "world"));
+        METRIC_VALUE("db_transaction_round_trips", transactionRoundTrips, METRIC_TAG("db", "world"));
+
+        uint64 characterSaves;
+        uint64 characterSaveStatements;
+        Player::GetSaveStats(characterSaves, characterSaveStatements);
+        METRIC_VALUE("character_saves", characterSaves);
+        METRIC_VALUE("character_save_statements", characterSaveStatements);
+
+        METRIC_VALUE("headless_packets_avoided", WorldSession::GetHeadlessPacketsAvoided());
+        METRIC_VALUE("grid_loads_prefetched", sGridPreloader->GetPrefetchedLoads());
+        METRIC_VALUE("grid_loads_sync", sGridPreloader->GetSyncLoads());
+        METRIC_VALUE("pathfinding_queue_depth", uint64(sPathfindingService->GetQueueSize()));
+        METRIC_VALUE("pathfinding_latency", std::chrono::nanoseconds(sPathfindingService->TakeAverageLatency()));
+
+        uint32 terrainGrids;
+        uint64 terrainMappedBytes;
+        sGridTerrainStore->GetStats(terrainGrids, terrainMappedBytes);
+        METRIC_VALUE("terrain_grids", terrainGrids);
+        METRIC_VALUE("terrain_mapped_bytes", terrainMappedBytes);
+
+        std::vector<std::shared_ptr<PacketCompressionStats const>> compressionStats = SharedWorldPacket::GetCompressionStats();
+        for (std::size_t i = 0; i < compressionStats.size(); ++i)
+        {
+            std::string thread = std::to_string(i);
+            METRIC_VALUE("packet_compression_packets", compressionStats[i]->Packets.load(), METRIC_TAG("thread", thread));
+            METRIC_VALUE("packet_compression_skipped", compressionStats[i]->SkippedPackets.load(), METRIC_TAG("thread", thread));
+            METRIC_VALUE("packet_compression_bytes_in", compressionStats[i]->BytesIn.load(), METRIC_TAG("thread", thread));
+            METRIC_VALUE("packet_compression_bytes_out", compressionStats[i]->BytesOut.load(), METRIC_TAG("thread", thread));
+            METRIC_VALUE("packet_compression_time", std::chrono::nanoseconds(compressionStats[i]->Time.load()), METRIC_TAG("thread", thread));
+        }
+
+        std::vector<std::shared_ptr<SpellAllocationStats const>> spellAllocationStats = SpellAllocator::GetStats();
+        for (uint8 kind = 0; kind < MAX_SPELL_ALLOCATION_KINDS; ++kind)
+        {
+            uint64 pooled = 0;
+            uint64 heap = 0;
+            for (std::shared_ptr<SpellAllocationStats const> const& stats : spellAllocationStats)
+            {
+                pooled += stats->Pooled[kind].load();
+                heap += stats->Heap[kind].load();
+            }
+
+            std::string kindName = SpellAllocator::GetKindName(SpellAllocationKind(kind));
+            METRIC_VALUE("spell_allocations_pooled", pooled, METRIC_TAG("kind", kindName));
+            METRIC_VALUE("spell_allocations_heap", heap, METRIC_TAG("kind", kindName));
+        }
     });
 
     METRIC_EVENT("events", "Worldserver started", "");
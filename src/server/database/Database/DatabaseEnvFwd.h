@@ -18,6 +18,7 @@
 #ifndef DatabaseEnvFwd_h__
 #define DatabaseEnvFwd_h__
 
+#include "Define.h"
 #include <future>
 
 struct QueryResultFieldMetadata;
@@ -99,6 +100,20 @@ using PlayerbotsDatabaseQueryHolder = SQLQueryHolder<PlayerbotsDatabaseConnectio
 
 class SQLQueryHolderCallback;
 
+/// Async work on rows owned by one character is keyed by the character guid. Rows shared by several characters
+/// are keyed by their own entity, moved out of the guid range so they never share a key with a character.
+enum class DatabaseShardKeyType : uint8
+{
+    Character = 0,
+    Guild     = 1,
+    Auction   = 2
+};
+
+inline uint64 MakeDatabaseShardKey(DatabaseShardKeyType type, uint32 id)
+{
+    return (uint64(type) << 32) | id;
+}
+
 // mysql
 struct MySQLHandle;
 struct MySQLResult;
@@ -56,6 +56,8 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
         uint8 const synchThreads = sConfigMgr->GetOption<uint8>(name + "Database.SynchThreads", 1);
 
         pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        pool.SetBatchSize(sConfigMgr->GetOption<uint32>(name + "Database.BatchSize", 32));
+        pool.SetShardedQueues(sConfigMgr->GetOption<bool>(name + "Database.ShardedQueues", false));
 
         if (uint32 error = pool.Open())
         {
@@ -31,6 +31,7 @@
 #include "SQLOperation.h"
 #include "Transaction.h"
 #include "WorldDatabase.h"
+#include <algorithm>
 #include <limits>
 #include <mysqld_error.h>
 #include <sstream>
@@ -57,9 +58,10 @@ class PingOperation : public SQLOperation
 
 template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool() :
-    _queue(new ProducerConsumerQueue<SQLOperation*>()),
     _async_threads(0),
-    _synch_threads(0)
+    _synch_threads(0),
+    _batchSize(1),
+    _shardedQueues(false)
 {
     WPFatal(mysql_thread_safe(), "Used MySQL library isn't thread-safe.");
 
@@ -75,7 +77,8 @@ DatabaseWorkerPool<T>::DatabaseWorkerPool() :
 template <class T>
 DatabaseWorkerPool<T>::~DatabaseWorkerPool()
 {
-    _queue->Cancel();
+    for (auto const& queue : _queues)
+        queue->Cancel();
 }
 
 template <class T>
@@ -87,11 +90,31 @@ void DatabaseWorkerPool<T>::SetConnectionInfo(std::string_view infoString, uint8
     _synch_threads = synchThreads;
 }
 
+template <class T>
+void DatabaseWorkerPool<T>::SetBatchSize(uint32 batchSize)
+{
+    _batchSize = std::max<uint32>(batchSize, 1);
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::SetShardedQueues(bool sharded)
+{
+    _shardedQueues = sharded;
+}
+
 template <class T>
 uint32 DatabaseWorkerPool<T>::Open()
 {
     WPFatal(_connectionInfo.get(), "Connection info was not set!");
 
+    //! Sharded: one lane per asynchronous connection, otherwise a single queue shared by all of them
+    if (_queues.empty())
+    {
+        std::size_t const lanes = _shardedQueues ? std::max<uint8>(_async_threads, 1) : 1;
+        for (std::size_t i = 0; i < lanes; ++i)
+            _queues.push_back(std::make_unique<ProducerConsumerQueue<SQLOperation*>>());
+    }
+
     LOG_INFO("sql.driver", "Opening DatabasePool '{}'. Asynchronous connections: {}, synchronous connections: {}.",
         GetDatabaseName(), _async_threads, _synch_threads);
 
@@ -116,11 +139,12 @@ uint32 DatabaseWorkerPool<T>::Open()
 template <class T>
 void DatabaseWorkerPool<T>::Close()
 {
-    LOG_INFO("sql.driver", "Closing down DatabasePool '{}'. Waiting for {} queries to finish...", GetDatabaseName(), _queue->Size());
+    LOG_INFO("sql.driver", "Closing down DatabasePool '{}'. Waiting for {} queries to finish...", GetDatabaseName(), QueueSize());
 
-    // Gracefully close async query queue, worker threads will block when the destructor
+    // Gracefully close async query queues, worker threads will block when the destructor
     // is called from the .clear() functions below until the queue is empty
-    _queue->Shutdown();
+    for (auto const& queue : _queues)
+        queue->Shutdown();
 
     //! Closes the actualy MySQL connection.
     _connections[IDX_ASYNC].clear();
@@ -228,22 +252,22 @@ QueryCallback DatabaseWorkerPool<T>::AsyncQuery(std::string_view sql)
 }
 
 template <class T>
-QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
+QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt, uint64 shardKey)
 {
     PreparedStatementTask* task = new PreparedStatementTask(stmt, true);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     PreparedQueryResultFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, shardKey);
     return QueryCallback(std::move(result));
 }
 
 template <class T>
-SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder)
+SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, uint64 shardKey)
 {
     SQLQueryHolderTask* task = new SQLQueryHolderTask(holder);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
     QueryResultHolderFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, shardKey);
     return { std::move(holder), std::move(result) };
 }
 
@@ -254,7 +278,7 @@ SQLTransaction<T> DatabaseWorkerPool<T>::BeginTransaction()
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
+void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction, uint64 shardKey)
 {
 #ifdef ACORE_DEBUG
     //! Only analyze transaction weaknesses in Debug mode.
@@ -273,11 +297,28 @@ void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction)
     }
 #endif // ACORE_DEBUG
 
-    Enqueue(new TransactionTask(transaction));
+    Enqueue(new TransactionTask(transaction), shardKey);
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::CommitTransaction(SQLTransaction<T> transaction, uint64 shardKey, uint64 otherShardKey)
+{
+    std::size_t lane = GetLane(shardKey);
+    std::size_t otherLane = GetLane(otherShardKey);
+    if (lane == otherLane)
+    {
+        CommitTransaction(std::move(transaction), shardKey);
+        return;
+    }
+
+    //! Runs on the lower lane, the higher one waits for it. Waits only ever point to lower lanes, so they can't deadlock.
+    TransactionWithResultTask* task = new TransactionWithResultTask(std::move(transaction));
+    _queues[std::max(lane, otherLane)]->Push(new TransactionBarrierTask(task->GetFuture()));
+    _queues[std::min(lane, otherLane)]->Push(task);
 }
 
 template <class T>
-TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction<T> transaction)
+TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction<T> transaction, uint64 shardKey)
 {
 #ifdef ACORE_DEBUG
     //! Only analyze transaction weaknesses in Debug mode.
@@ -298,7 +339,7 @@ TransactionCallback DatabaseWorkerPool<T>::AsyncCommitTransaction(SQLTransaction
 
     TransactionWithResultTask* task = new TransactionWithResultTask(transaction);
     TransactionFuture result = task->GetFuture();
-    Enqueue(task);
+    Enqueue(task, shardKey);
     return TransactionCallback(std::move(result));
 }
 
@@ -367,11 +408,11 @@ void DatabaseWorkerPool<T>::KeepAlive()
 
     //! Assuming all worker threads are free, every worker thread will receive 1 ping operation request
     //! If one or more worker threads are busy, the ping operations will not be split evenly, but this doesn't matter
-    //! as the sole purpose is to prevent connections from idling.
+    //! as the sole purpose is to prevent connections from idling. Sharded pools ping every lane.
     auto const count = _connections[IDX_ASYNC].size();
 
     for (uint8 i = 0; i < count; ++i)
-        Enqueue(new PingOperation);
+        _queues[i % _queues.size()]->Push(new PingOperation);
 }
 
 /**
@@ -429,7 +470,7 @@ uint32 DatabaseWorkerPool<T>::OpenConnections(InternalIndex type, uint8 numConne
             switch (type)
             {
             case IDX_ASYNC:
-                return std::make_unique<T>(_queue.get(), *_connectionInfo);
+                return std::make_unique<T>(_queues[_connections[IDX_ASYNC].size() % _queues.size()].get(), *_connectionInfo);
             case IDX_SYNCH:
                 return std::make_unique<T>(*_connectionInfo);
             default:
@@ -437,10 +478,14 @@ uint32 DatabaseWorkerPool<T>::OpenConnections(InternalIndex type, uint8 numConne
             }
         }();
 
+        connection->SetBatchSize(_batchSize);
+
         if (uint32 error = connection->Open())
         {
             // Failed to open a connection or invalid version, abort and cleanup
-            _queue->Cancel();
+            for (auto const& queue : _queues)
+                queue->Cancel();
+
             _connections[type].clear();
             return error;
         }
@@ -470,15 +515,53 @@ unsigned long DatabaseWorkerPool<T>::EscapeString(char* to, char const* from, un
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op)
+void DatabaseWorkerPool<T>::Enqueue(SQLOperation* op, uint64 shardKey)
 {
-    _queue->Push(op);
+    _queues[GetLane(shardKey)]->Push(op);
+}
+
+template <class T>
+std::size_t DatabaseWorkerPool<T>::GetLane(uint64 shardKey) const
+{
+    //! Lane 0 is the global lane, keyed operations are spread over the others so slow global work doesn't hold them up
+    if (!shardKey || _queues.size() < 2)
+        return 0;
+
+    return 1 + shardKey % (_queues.size() - 1);
 }
 
 template <class T>
 std::size_t DatabaseWorkerPool<T>::QueueSize() const
 {
-    return _queue->Size();
+    std::size_t size = 0;
+    for (auto const& queue : _queues)
+        size += queue->Size();
+
+    return size;
+}
+
+template <class T>
+std::size_t DatabaseWorkerPool<T>::QueueSize(std::size_t lane) const
+{
+    return lane < _queues.size() ? _queues[lane]->Size() : 0;
+}
+
+template <class T>
+void DatabaseWorkerPool<T>::GetTransactionStats(uint64& statements, uint64& roundTrips) const
+{
+    statements = 0;
+    roundTrips = 0;
+
+    for (auto const& connections : _connections)
+    {
+        for (auto const& connection : connections)
+        {
+            uint64 connectionStatements, connectionRoundTrips;
+            connection->GetTransactionStats(connectionStatements, connectionRoundTrips);
+            statements += connectionStatements;
+            roundTrips += connectionRoundTrips;
+        }
+    }
 }
 
 template <class T>
@@ -526,10 +609,10 @@ void DatabaseWorkerPool<T>::Execute(std::string_view sql)
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt)
+void DatabaseWorkerPool<T>::Execute(PreparedStatement<T>* stmt, uint64 shardKey)
 {
     PreparedStatementTask* task = new PreparedStatementTask(stmt);
-    Enqueue(task);
+    Enqueue(task, shardKey);
 }
 
 template <class T>
@@ -564,10 +647,10 @@ void DatabaseWorkerPool<T>::ExecuteOrAppend(SQLTransaction<T>& trans, std::strin
 }
 
 template <class T>
-void DatabaseWorkerPool<T>::ExecuteOrAppend(SQLTransaction<T>& trans, PreparedStatement<T>* stmt)
+void DatabaseWorkerPool<T>::ExecuteOrAppend(SQLTransaction<T>& trans, PreparedStatement<T>* stmt, uint64 shardKey)
 {
     if (!trans)
-        Execute(stmt);
+        Execute(stmt, shardKey);
     else
         trans->Append(stmt);
 }
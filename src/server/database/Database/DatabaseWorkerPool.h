@@ -62,6 +62,15 @@ public:
 
     void SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads);
 
+    //! Max rows merged into one multi-row INSERT/REPLACE when a transaction holds a run of the same statement, 1 disables it.
+    //! Must be set before Open().
+    void SetBatchSize(uint32 batchSize);
+
+    //! Gives every asynchronous connection its own queue (lane). Operations without shard key go to lane 0, keyed
+    //! ones to a lane picked from the key, keeping the operations of one account or character in order.
+    //! Must be set before Open().
+    void SetShardedQueues(bool sharded);
+
     uint32 Open();
     void Close();
 
@@ -94,7 +103,8 @@ public:
 
     //! Enqueues a one-way SQL operation in prepared statement format that will be executed asynchronously.
     //! Statement must be prepared with CONNECTION_ASYNC flag.
-    void Execute(PreparedStatement<T>* stmt);
+    //! Operations with the same non-zero shard key (account or character guid) run in order on the same lane of a sharded pool.
+    void Execute(PreparedStatement<T>* stmt, uint64 shardKey = 0);
 
     /**
         Direct synchronous one-way statement methods.
@@ -154,13 +164,13 @@ public:
     //! Enqueues a query in prepared format that will set the value of the PreparedQueryResultFuture return object as soon as the query is executed.
     //! The return value is then processed in ProcessQueryCallback methods.
     //! Statement must be prepared with CONNECTION_ASYNC flag.
-    QueryCallback AsyncQuery(PreparedStatement<T>* stmt);
+    QueryCallback AsyncQuery(PreparedStatement<T>* stmt, uint64 shardKey = 0);
 
     //! Enqueues a vector of SQL operations (can be both adhoc and prepared) that will set the value of the QueryResultHolderFuture
     //! return object as soon as the query is executed.
     //! The return value is then processed in ProcessQueryCallback methods.
     //! Any prepared statements added to this holder need to be prepared with the CONNECTION_ASYNC flag.
-    SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder);
+    SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, uint64 shardKey = 0);
 
     /**
         Transaction context methods.
@@ -171,11 +181,15 @@ public:
 
     //! Enqueues a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
     //! were appended to the transaction will be respected during execution.
-    void CommitTransaction(SQLTransaction<T> transaction);
+    void CommitTransaction(SQLTransaction<T> transaction, uint64 shardKey = 0);
+
+    //! Same as above for transactions writing the data of two accounts or characters (trades). The transaction
+    //! stays in order with the operations of both keys, it runs on one of their lanes while holding the other.
+    void CommitTransaction(SQLTransaction<T> transaction, uint64 shardKey, uint64 otherShardKey);
 
     //! Enqueues a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
     //! were appended to the transaction will be respected during execution.
-    TransactionCallback AsyncCommitTransaction(SQLTransaction<T> transaction);
+    TransactionCallback AsyncCommitTransaction(SQLTransaction<T> transaction, uint64 shardKey = 0);
 
     //! Directly executes a collection of one-way SQL operations (can be both adhoc and prepared). The order in which these operations
     //! were appended to the transaction will be respected during execution.
@@ -187,7 +201,7 @@ public:
 
     //! Method used to execute prepared statements in a diverse context.
     //! Will be wrapped in a transaction if valid object is present, otherwise executed standalone.
-    void ExecuteOrAppend(SQLTransaction<T>& trans, PreparedStatement<T>* stmt);
+    void ExecuteOrAppend(SQLTransaction<T>& trans, PreparedStatement<T>* stmt, uint64 shardKey = 0);
 
     /**
         Other
@@ -214,13 +228,19 @@ public:
     }
 
     [[nodiscard]] std::size_t QueueSize() const;
+    [[nodiscard]] std::size_t QueueSize(std::size_t lane) const;
+    [[nodiscard]] std::size_t GetLaneCount() const { return _queues.size(); }
+
+    //! Statements executed inside transactions and the queries actually sent for them, over all connections
+    void GetTransactionStats(uint64& statements, uint64& roundTrips) const;
 
 private:
     uint32 OpenConnections(InternalIndex type, uint8 numConnections);
 
     unsigned long EscapeString(char* to, char const* from, unsigned long length);
 
-    void Enqueue(SQLOperation* op);
+    void Enqueue(SQLOperation* op, uint64 shardKey = 0);
+    [[nodiscard]] std::size_t GetLane(uint64 shardKey) const;
 
     //! Gets a free connection in the synchronous connection pool.
     //! Caller MUST call t->Unlock() after touching the MySQL context to prevent deadlocks.
@@ -228,12 +248,14 @@ private:
 
     [[nodiscard]] std::string_view GetDatabaseName() const;
 
-    //! Queue shared by async worker threads.
-    std::unique_ptr<ProducerConsumerQueue<SQLOperation*>> _queue;
+    //! Queues of the async worker threads, a single one shared by all of them unless sharded.
+    std::vector<std::unique_ptr<ProducerConsumerQueue<SQLOperation*>>> _queues;
     std::array<std::vector<std::unique_ptr<T>>, IDX_SIZE> _connections;
     std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
     std::vector<uint8> _preparedStatementSize;
     uint8 _async_threads, _synch_threads;
+    uint32 _batchSize;
+    bool _shardedQueues;
 #ifdef ACORE_DEBUG
     static inline thread_local bool _warnSyncQueries = false;
 #endif
@@ -101,20 +101,6 @@ namespace
         return false;
     }
 
-    inline Optional<std::string_view> GetCleanAliasName(std::string_view alias)
-    {
-        if (alias.empty())
-            return {};
-
-        auto pos = alias.find_first_of('(');
-        if (pos == std::string_view::npos)
-            return {};
-
-        alias.remove_suffix(alias.length() - pos);
-
-        return { alias };
-    }
-
     template<typename T>
     inline bool IsCorrectAlias(DatabaseFieldTypes type, std::string_view alias)
     {
@@ -226,13 +212,11 @@ T Field::GetData() const
     // Check -1 for *_dbc db tables
     if constexpr (std::is_same_v<T, uint32>)
     {
-        std::string_view tableName{ meta->TableName };
-
-        if (!tableName.empty() && tableName.size() > 4)
+        if (meta->DbcTable)
         {
             auto signedResult = Acore::StringTo<int32>(std::string_view(data.value, data.length));
 
-            if (signedResult && !result && tableName.substr(tableName.length() - 4) == "_dbc")
+            if (signedResult && !result)
             {
                 LOG_DEBUG("sql.sql", "> Found incorrect value '{}' for type '{}' in _dbc table.", data.value, typeid(T).name());
                 LOG_DEBUG("sql.sql", "> Table name '{}'. Field name '{}'. Try return int32 value", meta->TableName, meta->Name);
@@ -241,21 +225,21 @@ T Field::GetData() const
         }
     }
 
-    if (auto alias = GetCleanAliasName(meta->Alias))
+    if (std::string_view alias = meta->AggregateName; !alias.empty())
     {
-        if ((StringEqualI(*alias, "min") || StringEqualI(*alias, "max")) && !IsCorrectAlias<T>(meta->Type, *alias))
+        if ((StringEqualI(alias, "min") || StringEqualI(alias, "max")) && !IsCorrectAlias<T>(meta->Type, alias))
         {
             LogWrongType(__FUNCTION__, typeid(T).name());
         }
 
-        if ((StringEqualI(*alias, "sum") || StringEqualI(*alias, "avg")) && !IsCorrectAlias<T>(meta->Type, *alias))
+        if ((StringEqualI(alias, "sum") || StringEqualI(alias, "avg")) && !IsCorrectAlias<T>(meta->Type, alias))
         {
             LogWrongType(__FUNCTION__, typeid(T).name());
             LOG_WARN("sql.sql", "> Please use GetData<double>()");
             return GetData<double>();
         }
 
-        if (StringEqualI(*alias, "count") && !IsCorrectAlias<T>(meta->Type, *alias))
+        if (StringEqualI(alias, "count") && !IsCorrectAlias<T>(meta->Type, alias))
         {
             LogWrongType(__FUNCTION__, typeid(T).name());
             LOG_WARN("sql.sql", "> Please use GetData<uint64>()");
@@ -53,15 +53,18 @@ enum class DatabaseFieldTypes : uint8
     Binary
 };
 
+/// Names point into the MYSQL_FIELD array of the result, which lives as long as the result set itself
 struct QueryResultFieldMetadata
 {
-    std::string TableName{};
-    std::string TableAlias{};
-    std::string Name{};
-    std::string Alias{};
-    std::string TypeName{};
+    std::string_view TableName{};
+    std::string_view TableAlias{};
+    std::string_view Name{};
+    std::string_view Alias{};
+    std::string_view AggregateName{};   // "count" for an alias "count(*)", empty if the column is no aggregate
+    char const* TypeName = "";
     uint32 Index = 0;
     DatabaseFieldTypes Type = DatabaseFieldTypes::Null;
+    bool DbcTable = false;              // table name ends with _dbc
 };
 
 /**
@@ -26,10 +26,63 @@
 #include "Timer.h"
 #include "Tokenize.h"
 #include "Transaction.h"
+#include <algorithm>
+#include <cctype>
 #include <errmsg.h>
 #include <mysql.h>
 #include <mysqld_error.h>
 
+namespace
+{
+    /// Placeholder limit of a single prepared statement on the MySQL server
+    constexpr std::size_t MAX_BATCH_PARAMETERS = 65535;
+
+    bool StartsWithNoCase(std::string_view str, std::string_view prefix)
+    {
+        if (str.size() < prefix.size())
+            return false;
+
+        for (std::size_t i = 0; i < prefix.size(); ++i)
+            if (std::toupper(static_cast<unsigned char>(str[i])) != prefix[i])
+                return false;
+
+        return true;
+    }
+}
+
+bool MySQLConnection::SplitRowTuple(std::string_view sql, uint32 paramCount, std::string_view& head, std::string_view& tuple)
+{
+    while (!sql.empty() && std::isspace(static_cast<unsigned char>(sql.front())))
+        sql.remove_prefix(1);
+
+    while (!sql.empty() && (std::isspace(static_cast<unsigned char>(sql.back())) || sql.back() == ';'))
+        sql.remove_suffix(1);
+
+    if (!StartsWithNoCase(sql, "INSERT ") && !StartsWithNoCase(sql, "REPLACE "))
+        return false;
+
+    if (sql.empty() || sql.back() != ')')
+        return false;
+
+    std::size_t open = sql.rfind('(');
+    if (open == std::string_view::npos)
+        return false;
+
+    tuple = sql.substr(open);
+    if (tuple.find_first_of("'\"`") != std::string_view::npos || std::count(tuple.begin(), tuple.end(), ')') != 1)
+        return false;
+
+    if (std::size_t(std::count(tuple.begin(), tuple.end(), '?')) != paramCount)
+        return false;
+
+    head = sql.substr(0, open);
+    std::string_view keyword = head;
+    while (!keyword.empty() && std::isspace(static_cast<unsigned char>(keyword.back())))
+        keyword.remove_suffix(1);
+
+    return keyword.size() >= 6 && StartsWithNoCase(keyword.substr(keyword.size() - 6), "VALUES");
+}
+
 MySQLConnectionInfo::MySQLConnectionInfo(std::string_view infoString)
 {
     std::vector<std::string_view> tokens = Acore::Tokenize(infoString, ';', true);
@@ -53,7 +106,10 @@ MySQLConnection::MySQLConnection(MySQLConnectionInfo& connInfo) :
     m_Mysql(nullptr),
     m_queue(nullptr),
     m_connectionInfo(connInfo),
-    m_connectionFlags(CONNECTION_SYNCH) { }
+    m_connectionFlags(CONNECTION_SYNCH),
+    m_batchSize(1),
+    m_transactionStatements(0),
+    m_transactionRoundTrips(0) { }
 
 MySQLConnection::MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, MySQLConnectionInfo& connInfo) :
     m_reconnecting(false),
@@ -61,7 +117,10 @@ MySQLConnection::MySQLConnection(ProducerConsumerQueue<SQLOperation*>* queue, My
     m_Mysql(nullptr),
     m_queue(queue),
     m_connectionInfo(connInfo),
-    m_connectionFlags(CONNECTION_ASYNC)
+    m_connectionFlags(CONNECTION_ASYNC),
+    m_batchSize(1),
+    m_transactionStatements(0),
+    m_transactionRoundTrips(0)
 {
     m_worker = std::make_unique<DatabaseWorker>(m_queue, this);
 }
@@ -76,6 +135,7 @@ void MySQLConnection::Close()
     // Stop the worker thread before the statements are cleared
     m_worker.reset();
     m_stmts.clear();
+    m_batchStmts.clear();
 
     if (m_Mysql)
     {
@@ -168,6 +228,8 @@ uint32 MySQLConnection::Open()
 
 bool MySQLConnection::PrepareStatements()
 {
+    m_batchStmts.clear();
+    m_batchable.clear();
     DoPrepareStatements();
     return !m_prepareError;
 }
@@ -200,16 +262,21 @@ bool MySQLConnection::Execute(std::string_view sql)
 }
 
 bool MySQLConnection::Execute(PreparedStatementBase* stmt)
+{
+    return Execute(&stmt, 1);
+}
+
+bool MySQLConnection::Execute(PreparedStatementBase* const* stmts, uint32 count)
 {
     if (!m_Mysql)
         return false;
 
-    uint32 index = stmt->GetIndex();
+    uint32 index = stmts[0]->GetIndex();
 
-    MySQLPreparedStatement* m_mStmt = GetPreparedStatement(index);
+    MySQLPreparedStatement* m_mStmt = count > 1 ? GetBatchStatement(index, count) : GetPreparedStatement(index);
     ASSERT(m_mStmt); // Can only be null if preparation failed, server side error or bad query
 
-    m_mStmt->BindParameters(stmt);
+    m_mStmt->BindParameters(stmts, count);
 
     MYSQL_STMT* msql_STMT = m_mStmt->GetSTMT();
     MYSQL_BIND* msql_BIND = m_mStmt->GetBind();
@@ -226,7 +293,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
         LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
 
         if (_HandleMySQLErrno(lErrno, mysql_stmt_error(msql_STMT)))  // If it returns true, an error was handled successfully (i.e. reconnection)
-            return Execute(stmt);       // Try again
+            return Execute(stmts, count);       // Try again
 
         m_mStmt->ClearParameters();
         return false;
@@ -238,7 +305,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
         LOG_ERROR("sql.sql", "SQL(p): {}\n [ERROR]: [{}] {}", m_mStmt->getQueryString(), lErrno, mysql_stmt_error(msql_STMT));
 
         if (_HandleMySQLErrno(lErrno, mysql_stmt_error(msql_STMT)))  // If it returns true, an error was handled successfully (i.e. reconnection)
-            return Execute(stmt);       // Try again
+            return Execute(stmts, count);       // Try again
 
         m_mStmt->ClearParameters();
         return false;
@@ -387,8 +454,9 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
 
     BeginTransaction();
 
-    for (auto const& data : queries)
+    for (std::size_t i = 0; i < queries.size(); ++i)
     {
+        SQLElementData const& data = queries[i];
         switch (data.type)
         {
             case SQL_ELEMENT_PREPARED:
@@ -407,13 +475,36 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
 
                 ASSERT(stmt);
 
-                if (!Execute(stmt))
+                // collect the run of the same statement following this one, it can be sent as multi-row statements
+                m_batchRun.clear();
+                m_batchRun.push_back(stmt);
+                while (m_batchSize > 1 && i + 1 < queries.size() && queries[i + 1].type == SQL_ELEMENT_PREPARED)
                 {
-                    LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", queries.size());
-                    int errorCode = GetLastError();
-                    RollbackTransaction();
-                    return errorCode;
+                    PreparedStatementBase* next = std::get<PreparedStatementBase*>(queries[i + 1].element);
+                    if (next->GetIndex() != stmt->GetIndex())
+                        break;
+
+                    m_batchRun.push_back(next);
+                    ++i;
+                }
+
+                for (std::size_t done = 0; done < m_batchRun.size();)
+                {
+                    uint32 rows = GetBatchRows(stmt->GetIndex(), m_batchRun.size() - done);
+                    ++m_transactionRoundTrips;
+
+                    if (!Execute(&m_batchRun[done], rows))
+                    {
+                        LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", queries.size());
+                        int errorCode = GetLastError();
+                        RollbackTransaction();
+                        return errorCode;
+                    }
+
+                    done += rows;
                 }
+
+                m_transactionStatements += m_batchRun.size();
             }
             break;
             case SQL_ELEMENT_RAW:
@@ -432,6 +523,8 @@ int MySQLConnection::ExecuteTransaction(std::shared_ptr<TransactionBase> transac
 
                 ASSERT(!sql.empty());
 
+                ++m_transactionStatements;
+                ++m_transactionRoundTrips;
                 if (!Execute(sql))
                 {
                     LOG_WARN("sql.sql", "Transaction aborted. {} queries not executed.", queries.size());
@@ -534,6 +627,91 @@ void MySQLConnection::PrepareStatement(uint32 index, std::string_view sql, Conne
     }
 }
 
+MySQLPreparedStatement* MySQLConnection::GetBatchStatement(uint32 index, uint32 rows)
+{
+    uint64 key = (uint64(index) << 32) | rows;
+    auto itr = m_batchStmts.find(key);
+    if (itr != m_batchStmts.end())
+        return itr->second.get();
+
+    MySQLPreparedStatement* single = GetPreparedStatement(index);
+    if (!single)
+        return nullptr;
+
+    std::string_view head;
+    std::string_view tuple;
+    if (!SplitRowTuple(single->m_queryString, single->GetParameterCount(), head, tuple))
+        return nullptr;
+
+    std::string sql(head);
+    sql.reserve(head.size() + (tuple.size() + 2) * rows);
+    sql += tuple;
+    for (uint32 i = 1; i < rows; ++i)
+    {
+        sql += ", ";
+        sql += tuple;
+    }
+
+    MYSQL_STMT* stmt = mysql_stmt_init(m_Mysql);
+    if (!stmt)
+        return nullptr;
+
+    if (mysql_stmt_prepare(stmt, sql.c_str(), static_cast<unsigned long>(sql.size())))
+    {
+        LOG_ERROR("sql.sql", "In mysql_stmt_prepare() id: {} ({} rows), sql: \"{}\"", index, rows, sql);
+        LOG_ERROR("sql.sql", "{}", mysql_stmt_error(stmt));
+        mysql_stmt_close(stmt);
+        return nullptr;
+    }
+
+    return m_batchStmts.emplace(key, std::make_unique<MySQLPreparedStatement>(reinterpret_cast<MySQLStmt*>(stmt), sql)).first->second.get();
+}
+
+uint32 MySQLConnection::GetBatchRows(uint32 index, std::size_t remaining)
+{
+    enum : uint8 { BATCH_UNCHECKED, BATCH_ALLOWED, BATCH_DISABLED };
+
+    if (m_batchSize < 2 || remaining < 2)
+        return 1;
+
+    if (m_batchable.size() <= index)
+        m_batchable.resize(m_stmts.size(), BATCH_UNCHECKED);
+
+    if (m_batchable[index] == BATCH_DISABLED)
+        return 1;
+
+    MySQLPreparedStatement* single = GetPreparedStatement(index);
+    if (!single || !single->GetParameterCount())
+    {
+        m_batchable[index] = BATCH_DISABLED;
+        return 1;
+    }
+
+    // powers of two only, that keeps the amount of prepared variants per statement at log2(batch size)
+    std::size_t limit = std::min<std::size_t>({ remaining, m_batchSize, MAX_BATCH_PARAMETERS / single->GetParameterCount() });
+    uint32 rows = 1;
+    while (rows * 2 <= limit)
+        rows *= 2;
+
+    if (rows < 2)
+        return 1;
+
+    if (!GetBatchStatement(index, rows))
+    {
+        m_batchable[index] = BATCH_DISABLED;
+        return 1;
+    }
+
+    m_batchable[index] = BATCH_ALLOWED;
+    return rows;
+}
+
+void MySQLConnection::GetTransactionStats(uint64& statements, uint64& roundTrips) const
+{
+    statements = m_transactionStatements.load(std::memory_order_relaxed);
+    roundTrips = m_transactionRoundTrips.load(std::memory_order_relaxed);
+}
+
 PreparedResultSet* MySQLConnection::Query(PreparedStatementBase* stmt)
 {
     MySQLPreparedStatement* mysqlStmt = nullptr;
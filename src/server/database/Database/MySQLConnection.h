@@ -20,9 +20,12 @@
 
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
+#include <atomic>
 #include <map>
 #include <mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 template <typename T>
@@ -70,6 +73,11 @@ public:
 
     bool Execute(std::string_view sql);
     bool Execute(PreparedStatementBase* stmt);
+    bool Execute(PreparedStatementBase* const* stmts, uint32 count);         //! Runs count statements of the same index as one multi-row statement
+
+    /// Splits "INSERT/REPLACE ... VALUES (?, ...)" into the part up to VALUES and the row tuple. Statements carrying
+    /// anything after the tuple (ON DUPLICATE KEY UPDATE, INSERT ... SELECT) or literals in it can't be repeated per row.
+    static bool SplitRowTuple(std::string_view sql, uint32 paramCount, std::string_view& head, std::string_view& tuple);
     ResultSet* Query(std::string_view sql);
     PreparedResultSet* Query(PreparedStatementBase* stmt);
     bool _Query(std::string_view sql, MySQLResult** pResult, MySQLField** pFields, uint64* pRowCount, uint32* pFieldCount);
@@ -84,6 +92,10 @@ public:
 
     uint32 GetLastError();
 
+    /// Max rows merged into one INSERT/REPLACE when a transaction holds a run of the same statement, 1 disables batching
+    void SetBatchSize(uint32 batchSize) { m_batchSize = batchSize; }
+    void GetTransactionStats(uint64& statements, uint64& roundTrips) const;
+
 protected:
     /// Tries to acquire lock. If lock is acquired by another thread
     /// the calling parent will just try another connection
@@ -96,6 +108,8 @@ protected:
     [[nodiscard]] std::string GetServerInfo() const;
     MySQLPreparedStatement* GetPreparedStatement(uint32 index);
     void PrepareStatement(uint32 index, std::string_view sql, ConnectionFlags flags);
+    MySQLPreparedStatement* GetBatchStatement(uint32 index, uint32 rows);
+    uint32 GetBatchRows(uint32 index, std::size_t remaining);
 
     virtual void DoPrepareStatements() = 0;
     virtual bool _HandleMySQLErrno(uint32 errNo, char const* err = "", uint8 attempts = 5);
@@ -114,6 +128,13 @@ private:
     ConnectionFlags m_connectionFlags;                  //! Connection flags (for preparing relevant statements)
     std::mutex m_Mutex;
 
+    std::unordered_map<uint64, std::unique_ptr<MySQLPreparedStatement>> m_batchStmts;  //! Multi-row variants of m_stmts, prepared on first use
+    std::vector<uint8> m_batchable;                     //! Per statement index: unchecked, batchable or not
+    std::vector<PreparedStatementBase*> m_batchRun;     //! Statements of the run being executed
+    uint32 m_batchSize;
+    std::atomic<uint64> m_transactionStatements;        //! Statements executed inside transactions
+    std::atomic<uint64> m_transactionRoundTrips;        //! Queries sent to the server for them
+
     MySQLConnection(MySQLConnection const& right) = delete;
     MySQLConnection& operator=(MySQLConnection const& right) = delete;
 };
@@ -67,22 +67,30 @@ MySQLPreparedStatement::~MySQLPreparedStatement()
 
 void MySQLPreparedStatement::BindParameters(PreparedStatementBase* stmt)
 {
-    m_stmt = stmt;     // Cross reference them for debug output
+    BindParameters(&stmt, 1);
+}
+
+void MySQLPreparedStatement::BindParameters(PreparedStatementBase* const* stmts, uint32 count)
+{
+    m_stmt = stmts[0];     // Cross reference them for debug output
 
-    uint8 pos = 0;
-    for (PreparedStatementData const& data : stmt->GetParameters())
+    uint32 pos = 0;
+    for (uint32 i = 0; i < count; ++i)
     {
-        std::visit([&](auto&& param)
+        for (PreparedStatementData const& data : stmts[i]->GetParameters())
         {
-            SetParameter(pos, param);
-        }, data.data);
+            std::visit([&](auto&& param)
+            {
+                SetParameter(pos, param);
+            }, data.data);
 
-        ++pos;
+            ++pos;
+        }
     }
 
 #ifdef _DEBUG
     if (pos < m_paramCount)
-        LOG_WARN("sql.sql", "[WARNING]: BindParameters() for statement {} did not bind all allocated parameters", stmt->GetIndex());
+        LOG_WARN("sql.sql", "[WARNING]: BindParameters() for statement {} did not bind all allocated parameters", m_stmt->GetIndex());
 #endif
 }
 
@@ -98,16 +106,16 @@ void MySQLPreparedStatement::ClearParameters()
     }
 }
 
-static bool ParamenterIndexAssertFail(uint32 stmtIndex, uint8 index, uint32 paramCount)
+static bool ParamenterIndexAssertFail(uint32 stmtIndex, uint32 index, uint32 paramCount)
 {
     LOG_ERROR("sql.driver", "Attempted to bind parameter {}{} on a PreparedStatement {} (statement has only {} parameters)",
-        uint32(index) + 1, (index == 1 ? "st" : (index == 2 ? "nd" : (index == 3 ? "rd" : "nd"))), stmtIndex, paramCount);
+        index + 1, (index == 1 ? "st" : (index == 2 ? "nd" : (index == 3 ? "rd" : "nd"))), stmtIndex, paramCount);
 
     return false;
 }
 
 //- Bind on mysql level
-void MySQLPreparedStatement::AssertValidIndex(uint8 index)
+void MySQLPreparedStatement::AssertValidIndex(uint32 index)
 {
     ASSERT(index < m_paramCount || ParamenterIndexAssertFail(m_stmt->GetIndex(), index, m_paramCount));
 
@@ -116,7 +124,7 @@ void MySQLPreparedStatement::AssertValidIndex(uint8 index)
 }
 
 template<typename T>
-void MySQLPreparedStatement::SetParameter(const uint8 index, T value)
+void MySQLPreparedStatement::SetParameter(const uint32 index, T value)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -133,12 +141,12 @@ void MySQLPreparedStatement::SetParameter(const uint8 index, T value)
     memcpy(param->buffer, &value, len);
 }
 
-void MySQLPreparedStatement::SetParameter(const uint8 index, bool value)
+void MySQLPreparedStatement::SetParameter(const uint32 index, bool value)
 {
     SetParameter(index, uint8(value ? 1 : 0));
 }
 
-void MySQLPreparedStatement::SetParameter(const uint8 index, std::nullptr_t /*value*/)
+void MySQLPreparedStatement::SetParameter(const uint32 index, std::nullptr_t /*value*/)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -152,7 +160,7 @@ void MySQLPreparedStatement::SetParameter(const uint8 index, std::nullptr_t /*va
     param->length = nullptr;
 }
 
-void MySQLPreparedStatement::SetParameter(uint8 index, std::string const& value)
+void MySQLPreparedStatement::SetParameter(uint32 index, std::string const& value)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -169,7 +177,7 @@ void MySQLPreparedStatement::SetParameter(uint8 index, std::string const& value)
     memcpy(param->buffer, value.c_str(), len);
 }
 
-void MySQLPreparedStatement::SetParameter(uint8 index, std::vector<uint8> const& value)
+void MySQLPreparedStatement::SetParameter(uint32 index, std::vector<uint8> const& value)
 {
     AssertValidIndex(index);
     m_paramsSet[index] = true;
@@ -41,22 +41,25 @@ public:
 
     void BindParameters(PreparedStatementBase* stmt);
 
+    //- Binds the parameters of count statements one after another, for multi-row statements
+    void BindParameters(PreparedStatementBase* const* stmts, uint32 count);
+
     uint32 GetParameterCount() const { return m_paramCount; }
 
 protected:
-    void SetParameter(const uint8 index, bool value);
-    void SetParameter(const uint8 index, std::nullptr_t /*value*/);
-    void SetParameter(const uint8 index, std::string const& value);
-    void SetParameter(const uint8 index, std::vector<uint8> const& value);
+    void SetParameter(const uint32 index, bool value);
+    void SetParameter(const uint32 index, std::nullptr_t /*value*/);
+    void SetParameter(const uint32 index, std::string const& value);
+    void SetParameter(const uint32 index, std::vector<uint8> const& value);
 
     template<typename T>
-    void SetParameter(const uint8 index, T value);
+    void SetParameter(const uint32 index, T value);
 
     MySQLStmt* GetSTMT() { return m_Mstmt; }
     MySQLBind* GetBind() { return m_bind; }
     PreparedStatementBase* m_stmt;
     void ClearParameters();
-    void AssertValidIndex(const uint8 index);
+    void AssertValidIndex(const uint32 index);
     std::string getQueryString() const;
 
 private:
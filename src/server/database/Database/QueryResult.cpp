@@ -118,7 +118,7 @@ namespace
         return DatabaseFieldTypes::Null;
     }
 
-    static std::string FieldTypeToString(enum_field_types type)
+    static char const* FieldTypeToString(enum_field_types type)
     {
         switch (type)
         {
@@ -152,15 +152,26 @@ namespace
         }
     }
 
+    std::string_view GetAggregateName(std::string_view alias)
+    {
+        auto pos = alias.find_first_of('(');
+        if (pos == std::string_view::npos)
+            return {};
+
+        return alias.substr(0, pos);
+    }
+
     void InitializeDatabaseFieldMetadata(QueryResultFieldMetadata* meta, MySQLField const* field, uint32 fieldIndex)
     {
         meta->TableName = field->org_table;
         meta->TableAlias = field->table;
         meta->Name = field->org_name;
         meta->Alias = field->name;
+        meta->AggregateName = GetAggregateName(meta->Alias);
         meta->TypeName = FieldTypeToString(field->type);
         meta->Index = fieldIndex;
         meta->Type = MysqlTypeToFieldType(field->type);
+        meta->DbcTable = meta->TableName.size() > 4 && meta->TableName.substr(meta->TableName.size() - 4) == "_dbc";
     }
 }
 
@@ -249,6 +260,7 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
     m_rowCount(rowCount),
     m_rowPosition(0),
     m_fieldCount(fieldCount),
+    m_rowSize(0),
     m_rBind(nullptr),
     m_stmt(stmt),
     m_metadataResult(result)
@@ -279,6 +291,8 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
     {
         LOG_WARN("sql.sql", "{}:mysql_stmt_store_result, cannot bind result from MySQL server. Error: {}", __FUNCTION__, mysql_stmt_error(m_stmt));
         delete[] m_rBind;
+        m_rBind = nullptr;
+        m_rowCount = 0;
         delete[] m_isNull;
         delete[] m_length;
         return;
@@ -289,12 +303,11 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
     //- This is where we prepare the buffer based on metadata
     MySQLField* field = reinterpret_cast<MySQLField*>(mysql_fetch_fields(m_metadataResult));
     m_fieldMetadata.resize(m_fieldCount);
-    std::size_t rowSize = 0;
 
     for (uint32 i = 0; i < m_fieldCount; ++i)
     {
         uint32 size = SizeForType(&field[i]);
-        rowSize += size;
+        m_rowSize += size;
 
         InitializeDatabaseFieldMetadata(&m_fieldMetadata[i], &field[i], i);
 
@@ -306,7 +319,9 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
         m_rBind[i].is_unsigned = field[i].flags & UNSIGNED_FLAG;
     }
 
-    char* dataBuffer = new char[rowSize * m_rowCount];
+    //- Every row gets the same layout in a single buffer, so the value of a column is always at
+    // column offset + row * row size and rows are never copied out of it
+    char* dataBuffer = new char[m_rowSize * m_rowCount];
     for (uint32 i = 0, offset = 0; i < m_fieldCount; ++i)
     {
         m_rBind[i].buffer = dataBuffer + offset;
@@ -319,24 +334,23 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
         LOG_WARN("sql.sql", "{}:mysql_stmt_bind_result, cannot bind result from MySQL server. Error: {}", __FUNCTION__, mysql_stmt_error(m_stmt));
         mysql_stmt_free_result(m_stmt);
         CleanUp();
+        m_rowCount = 0;
         delete[] m_isNull;
         delete[] m_length;
         return;
     }
 
-    m_rows.resize(uint32(m_rowCount) * m_fieldCount);
+    m_lengths.resize(uint32(m_rowCount) * m_fieldCount);
 
     while (_NextRow())
     {
         for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
         {
-            m_rows[uint32(m_rowPosition) * m_fieldCount + fIndex].SetMetadata(&m_fieldMetadata[fIndex]);
-
             unsigned long buffer_length = m_rBind[fIndex].buffer_length;
             unsigned long fetched_length = *m_rBind[fIndex].length;
+            void* buffer = m_stmt->bind[fIndex].buffer;
             if (!*m_rBind[fIndex].is_null)
             {
-                void* buffer = m_stmt->bind[fIndex].buffer;
                 switch (m_rBind[fIndex].buffer_type)
                 {
                 case MYSQL_TYPE_TINY_BLOB:
@@ -357,15 +371,13 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
                     break;
                 }
 
-                m_rows[uint32(m_rowPosition) * m_fieldCount + fIndex].SetByteValue((char const*)buffer, fetched_length);
-
-                // move buffer pointer to next part
-                m_stmt->bind[fIndex].buffer = (char*)buffer + rowSize;
+                m_lengths[uint32(m_rowPosition) * m_fieldCount + fIndex] = fetched_length;
             }
             else
-            {
-                m_rows[uint32(m_rowPosition) * m_fieldCount + fIndex].SetByteValue(nullptr, *m_rBind[fIndex].length);
-            }
+                m_lengths[uint32(m_rowPosition) * m_fieldCount + fIndex] = NULL_FIELD_LENGTH;
+
+            // move buffer pointer to next part, null values keep their slot
+            m_stmt->bind[fIndex].buffer = (char*)buffer + m_rowSize;
         }
 
         m_rowPosition++;
@@ -373,6 +385,14 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
 
     m_rowPosition = 0;
 
+    //- Only one row of fields exists, it is pointed at the buffer of the current row on each NextRow
+    m_currentRow.resize(m_fieldCount);
+    for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
+        m_currentRow[fIndex].SetMetadata(&m_fieldMetadata[fIndex]);
+
+    if (m_rowCount)
+        SetCurrentRow();
+
     /// All data is buffered, let go of mysql c api structures
     mysql_stmt_free_result(m_stmt);
 }
@@ -389,9 +409,24 @@ bool PreparedResultSet::NextRow()
     if (++m_rowPosition >= m_rowCount)
         return false;
 
+    SetCurrentRow();
     return true;
 }
 
+void PreparedResultSet::SetCurrentRow()
+{
+    uint32 const* lengths = &m_lengths[uint32(m_rowPosition) * m_fieldCount];
+    std::size_t rowOffset = std::size_t(m_rowPosition) * m_rowSize;
+
+    for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
+    {
+        if (lengths[fIndex] != NULL_FIELD_LENGTH)
+            m_currentRow[fIndex].SetByteValue(static_cast<char const*>(m_rBind[fIndex].buffer) + rowOffset, lengths[fIndex]);
+        else
+            m_currentRow[fIndex].SetByteValue(nullptr, 0);
+    }
+}
+
 bool PreparedResultSet::_NextRow()
 {
     /// Only called in low-level code, namely the constructor
@@ -406,20 +441,23 @@ bool PreparedResultSet::_NextRow()
 Field* PreparedResultSet::Fetch() const
 {
     ASSERT(m_rowPosition < m_rowCount);
-    return const_cast<Field*>(&m_rows[uint32(m_rowPosition) * m_fieldCount]);
+    return const_cast<Field*>(m_currentRow.data());
 }
 
 Field const& PreparedResultSet::operator[](std::size_t index) const
 {
     ASSERT(m_rowPosition < m_rowCount);
     ASSERT(index < m_fieldCount);
-    return m_rows[uint32(m_rowPosition) * m_fieldCount + index];
+    return m_currentRow[index];
 }
 
 void PreparedResultSet::CleanUp()
 {
     if (m_metadataResult)
+    {
         mysql_free_result(m_metadataResult);
+        m_metadataResult = nullptr;
+    }
 
     if (m_rBind)
     {
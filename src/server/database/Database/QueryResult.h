@@ -118,7 +118,7 @@ public:
         std::apply([this](Ts&... args)
         {
             uint8 index{ 0 };
-            ((args = m_rows[uint32(m_rowPosition) * m_fieldCount + index].Get<Ts>(), index++), ...);
+            ((args = m_currentRow[index].Get<Ts>(), index++), ...);
         }, theTuple);
 
         return theTuple;
@@ -128,19 +128,24 @@ public:
     static auto end()   { return ResultIterator<PreparedResultSet>(nullptr); }
 
 protected:
+    static constexpr uint32 NULL_FIELD_LENGTH = 0xFFFFFFFF;
+
     std::vector<QueryResultFieldMetadata> m_fieldMetadata;
-    std::vector<Field> m_rows;
+    std::vector<uint32> m_lengths;      ///< Value length of every row and column, NULL_FIELD_LENGTH for null values
+    std::vector<Field> m_currentRow;    ///< Views into the result buffer for the row at m_rowPosition
     uint64 m_rowCount;
     uint64 m_rowPosition;
     uint32 m_fieldCount;
+    std::size_t m_rowSize;
 
 private:
-    MySQLBind* m_rBind;
+    MySQLBind* m_rBind;               ///< m_rBind[i].buffer is column i of the first row in the result buffer
     MySQLStmt* m_stmt;
     MySQLResult* m_metadataResult;    ///< Field metadata, returned by mysql_stmt_result_metadata
 
     void CleanUp();
     bool _NextRow();
+    void SetCurrentRow();
 
     void AssertRows(std::size_t sizeRows);
 
@@ -179,6 +179,13 @@ bool TransactionWithResultTask::Execute()
     return false;
 }
 
+bool TransactionBarrierTask::Execute()
+{
+    // also returns when the transaction was dropped unexecuted at shutdown
+    m_future.wait();
+    return true;
+}
+
 bool TransactionCallback::InvokeIfReady()
 {
     if (m_future.valid() && m_future.wait_for(0s) == std::future_status::ready)
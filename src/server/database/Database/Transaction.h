@@ -105,6 +105,18 @@ protected:
     TransactionPromise m_result;
 };
 
+/*! Holds the lane it was queued on until a transaction queued on another lane has been executed */
+class AC_DATABASE_API TransactionBarrierTask : public SQLOperation
+{
+public:
+    TransactionBarrierTask(TransactionFuture&& future) : m_future(std::move(future)) { }
+
+protected:
+    bool Execute() override;
+
+    TransactionFuture m_future;
+};
+
 class AC_DATABASE_API TransactionCallback
 {
 public:
@@ -110,7 +110,7 @@ public:
 private:
     void LoadConditions();
     void CheckConditions(uint32 diff);
-    ConditionList conditions;
+    ConditionSpan conditions;
     uint32 m_ConditionsTimer;
     bool m_DoDismiss;
     uint32 m_DismissTimer;
@@ -255,7 +255,7 @@ private:
 
     // Xinef: Vehicle conditions
     void CheckConditions(const uint32 diff);
-    ConditionList conditions;
+    ConditionSpan conditions;
     uint32 m_ConditionsTimer;
 };
 
@@ -60,6 +60,7 @@ SmartScript::SmartScript()
     mCurrentPriority = 0;
     mEventSortingRequired = false;
     _allowPhaseReset = true;
+    mEventIndexOffsets.fill(0);
 }
 
 SmartScript::~SmartScript()
@@ -115,7 +116,7 @@ void SmartScript::OnReset()
     ResetBaseObject();
     for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
     {
-        if (!((*i).event.event_flags & SMART_EVENT_FLAG_DONT_RESET))
+        if (!((*i).data->event.event_flags & SMART_EVENT_FLAG_DONT_RESET))
         {
             InitTimer((*i));
             (*i).runOnce = false;
@@ -134,46 +135,56 @@ void SmartScript::OnReset()
 
 void SmartScript::ProcessEventsFor(SMART_EVENT e, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
 {
-    for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
-    {
-        SMART_EVENT eventType = SMART_EVENT((*i).GetEventType());
-        if (eventType == SMART_EVENT_LINK)//special handling
-            continue;
+    if (e == SMART_EVENT_LINK || e >= SMART_EVENT_AC_END)//special handling
+        return;
 
-        if (eventType == e)
+    for (uint32 index = mEventIndexOffsets[e]; index < mEventIndexOffsets[e + 1]; ++index)
+    {
+        SmartScriptHolder& holder = mEvents[mEventIndex[index]];
+        ConditionSpan conds = GetConditions(holder);
+        if (!conds.empty())
         {
-            ConditionList conds = sConditionMgr->GetConditionsForSmartEvent((*i).entryOrGuid, (*i).event_id, (*i).source_type);
             ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
+            if (!sConditionMgr->IsObjectMeetToConditions(info, conds))
+                continue;
+        }
 
-            if (sConditionMgr->IsObjectMeetToConditions(info, conds))
-            {
-                ASSERT(executionStack.empty());
-                executionStack.emplace_back(SmartScriptFrame{ *i, unit, var0, var1, bvar, spell, gob });
-                while (!executionStack.empty())
-                {
-                    auto [stack_holder , stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob] = executionStack.back();
-                    executionStack.pop_back();
-                    ProcessEvent(stack_holder, stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob);
-                }
-            }
+        ASSERT(executionStack.empty());
+        executionStack.emplace_back(SmartScriptFrame{ holder, unit, var0, var1, bvar, spell, gob });
+        while (!executionStack.empty())
+        {
+            auto [stack_holder , stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob] = executionStack.back();
+            executionStack.pop_back();
+            ProcessEvent(stack_holder, stack_unit, stack_var0, stack_var1, stack_bvar, stack_spell, stack_gob);
         }
     }
 }
 
+ConditionSpan SmartScript::GetConditions(SmartScriptHolder& e)
+{
+    if (e.conditionsLoadCount != sConditionMgr->GetLoadCount())
+    {
+        e.conditions = sConditionMgr->GetConditionsForSmartEvent(e.data->entryOrGuid, e.data->event_id, e.data->source_type);
+        e.conditionsLoadCount = sConditionMgr->GetLoadCount();
+    }
+
+    return e.conditions;
+}
+
 void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
 {
     e.runOnce = true;//used for repeat check
 
     //calc random
-    if (e.event.event_chance < 100 && e.event.event_chance && !(e.event.event_flags & SMART_EVENT_FLAG_TEMP_IGNORE_CHANCE_ROLL))
+    if (e.data->event.event_chance < 100 && e.data->event.event_chance && !e.ignoreChanceRoll)
     {
         uint32 rnd = urand(1, 100);
-        if (e.event.event_chance <= rnd)
+        if (e.data->event.event_chance <= rnd)
             return;
     }
 
-    // Remove SMART_EVENT_FLAG_TEMP_IGNORE_CHANCE_ROLL flag after processing roll chances as it's not needed anymore
-    e.event.event_flags &= ~SMART_EVENT_FLAG_TEMP_IGNORE_CHANCE_ROLL;
+    // Clear the ignored chance roll after processing roll chances as it's not needed anymore
+    e.ignoreChanceRoll = false;
 
     if (unit)
         mLastInvoker = unit->GetGUID();
@@ -183,7 +194,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
     if (WorldObject* tempInvoker = GetLastInvoker())
         LOG_DEBUG("sql.sql", "SmartScript::ProcessAction: Invoker: {} ({})", tempInvoker->GetName(), tempInvoker->GetGUID().ToString());
 
-    bool isControlled = e.action.moveToPos.controlled > 0;
+    bool isControlled = e.data->action.moveToPos.controlled > 0;
 
     ObjectVector targets;
     WorldObject* invoker = nullptr;
@@ -198,14 +209,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
     {
         case SMART_ACTION_TALK:
         {
-            Creature* talker = e.target.type == 0 ? me : nullptr;
+            Creature* talker = e.data->target.type == 0 ? me : nullptr;
             WorldObject* talkTarget = nullptr;
 
             for (WorldObject* target : targets)
             {
                 if (IsCreature((target)) && !target->ToCreature()->IsPet()) // Prevented sending text to pets.
                 {
-                    if (e.action.talk.useTalkTarget)
+                    if (e.data->action.talk.useTalkTarget)
                     {
                         talker = me;
                         talkTarget = target->ToCreature();
@@ -228,17 +239,17 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!talker)
                 break;
 
-            if (!sCreatureTextMgr->TextExist(talker->GetEntry(), uint8(e.action.talk.textGroupID)))
+            if (!sCreatureTextMgr->TextExist(talker->GetEntry(), uint8(e.data->action.talk.textGroupID)))
             {
-                LOG_ERROR("sql.sql", "SmartScript::ProcessAction: SMART_ACTION_TALK: EntryOrGuid {} SourceType {} EventType {} TargetType {} using non-existent Text id {} for talker {}, ignored.", e.entryOrGuid, e.GetScriptType(), e.GetEventType(), e.GetTargetType(), e.action.talk.textGroupID, talker->GetEntry());
+                LOG_ERROR("sql.sql", "SmartScript::ProcessAction: SMART_ACTION_TALK: EntryOrGuid {} SourceType {} EventType {} TargetType {} using non-existent Text id {} for talker {}, ignored.", e.data->entryOrGuid, e.GetScriptType(), e.GetEventType(), e.GetTargetType(), e.data->action.talk.textGroupID, talker->GetEntry());
                 break;
             }
 
             mTalkerEntry = talker->GetEntry();
-            mLastTextID = e.action.talk.textGroupID;
-            mTextTimer = e.action.talk.duration;
+            mLastTextID = e.data->action.talk.textGroupID;
+            mTextTimer = e.data->action.talk.duration;
             mUseTextTimer = true;
-            sCreatureTextMgr->SendChat(talker, uint8(e.action.talk.textGroupID), talkTarget);
+            sCreatureTextMgr->SendChat(talker, uint8(e.data->action.talk.textGroupID), talkTarget);
             LOG_DEBUG("sql.sql", "SmartScript::ProcessAction: SMART_ACTION_TALK: talker: {} ({}), textId: {}", talker->GetName(), talker->GetGUID().ToString(), mLastTextID);
             break;
         }
@@ -247,15 +258,15 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             for (WorldObject* target : targets)
             {
                 if (IsCreature(target))
-                    sCreatureTextMgr->SendChat(target->ToCreature(), uint8(e.action.simpleTalk.textGroupID), IsPlayer(GetLastInvoker()) ? GetLastInvoker() : 0);
+                    sCreatureTextMgr->SendChat(target->ToCreature(), uint8(e.data->action.simpleTalk.textGroupID), IsPlayer(GetLastInvoker()) ? GetLastInvoker() : 0);
                 else if (IsPlayer(target) && me)
                 {
                     WorldObject* templastInvoker = GetLastInvoker();
-                    sCreatureTextMgr->SendChat(me, uint8(e.action.simpleTalk.textGroupID), IsPlayer(templastInvoker) ? templastInvoker : 0, CHAT_MSG_ADDON, LANG_ADDON, TEXT_RANGE_NORMAL, 0, TEAM_NEUTRAL, false, target->ToPlayer());
+                    sCreatureTextMgr->SendChat(me, uint8(e.data->action.simpleTalk.textGroupID), IsPlayer(templastInvoker) ? templastInvoker : 0, CHAT_MSG_ADDON, LANG_ADDON, TEXT_RANGE_NORMAL, 0, TEAM_NEUTRAL, false, target->ToPlayer());
                 }
 
                 LOG_DEBUG("sql.sql", "SmartScript::ProcessAction:: SMART_ACTION_SIMPLE_TALK: talker: {} ({}), textGroupId: {}",
-                               target->GetName(), target->GetGUID().ToString(), uint8(e.action.simpleTalk.textGroupID));
+                               target->GetName(), target->GetGUID().ToString(), uint8(e.data->action.simpleTalk.textGroupID));
             }
             break;
         }
@@ -265,9 +276,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    target->ToUnit()->HandleEmoteCommand(e.action.emote.emote);
+                    target->ToUnit()->HandleEmoteCommand(e.data->action.emote.emote);
                     LOG_DEBUG("sql.sql", "SmartScript::ProcessAction:: SMART_ACTION_PLAY_EMOTE: target: {} ({}), emote: {}",
-                                   target->GetName(), target->GetGUID().ToString(), e.action.emote.emote);
+                                   target->GetName(), target->GetGUID().ToString(), e.data->action.emote.emote);
                 }
             }
             break;
@@ -278,12 +289,12 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    if (e.action.sound.distance == 1)
-                        target->PlayDistanceSound(e.action.sound.sound, e.action.sound.onlySelf ? target->ToPlayer() : nullptr);
+                    if (e.data->action.sound.distance == 1)
+                        target->PlayDistanceSound(e.data->action.sound.sound, e.data->action.sound.onlySelf ? target->ToPlayer() : nullptr);
                     else
-                        target->PlayDirectSound(e.action.sound.sound, e.action.sound.onlySelf ? target->ToPlayer() : nullptr);
+                        target->PlayDirectSound(e.data->action.sound.sound, e.data->action.sound.onlySelf ? target->ToPlayer() : nullptr);
                     LOG_DEBUG("sql.sql", "SmartScript::ProcessAction:: SMART_ACTION_SOUND: target: {} ({}), sound: {}, onlyself: {}",
-                                   target->GetName(), target->GetGUID().ToString(), e.action.sound.sound, e.action.sound.onlySelf);
+                                   target->GetName(), target->GetGUID().ToString(), e.data->action.sound.sound, e.data->action.sound.onlySelf);
                 }
             }
             break;
@@ -291,10 +302,10 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         case SMART_ACTION_RANDOM_SOUND:
         {
             uint32 sounds[4];
-            sounds[0] = e.action.randomSound.sound1;
-            sounds[1] = e.action.randomSound.sound2;
-            sounds[2] = e.action.randomSound.sound3;
-            sounds[3] = e.action.randomSound.sound4;
+            sounds[0] = e.data->action.randomSound.sound1;
+            sounds[1] = e.data->action.randomSound.sound2;
+            sounds[2] = e.data->action.randomSound.sound3;
+            sounds[3] = e.data->action.randomSound.sound4;
             uint32 temp[4];
             uint32 count = 0;
             for (unsigned int sound : sounds)
@@ -316,9 +327,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (IsUnit(target))
                 {
                     uint32 sound = temp[urand(0, count - 1)];
-                    target->PlayDirectSound(sound, e.action.randomSound.onlySelf ? target->ToPlayer() : nullptr);
+                    target->PlayDirectSound(sound, e.data->action.randomSound.onlySelf ? target->ToPlayer() : nullptr);
                     LOG_DEBUG("sql.sql", "SmartScript::ProcessAction:: SMART_ACTION_RANDOM_SOUND: target: {} ({}), sound: {}, onlyself: {}",
-                              target->GetName(), target->GetGUID().ToString(), sound, e.action.randomSound.onlySelf);
+                              target->GetName(), target->GetGUID().ToString(), sound, e.data->action.randomSound.onlySelf);
                 }
             }
 
@@ -328,7 +339,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             ObjectVector targets;
 
-            if (e.action.music.type > 0)
+            if (e.data->action.music.type > 0)
             {
                 if (me && me->FindMap())
                 {
@@ -341,7 +352,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                             {
                                 if (player->GetZoneId() == me->GetZoneId())
                                 {
-                                    if (e.action.music.type > 1)
+                                    if (e.data->action.music.type > 1)
                                     {
                                         if (player->GetAreaId() == me->GetAreaId())
                                             targets.push_back(player);
@@ -362,9 +373,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 {
                     if (IsUnit(target))
                     {
-                        target->SendPlayMusic(e.action.music.sound, e.action.music.onlySelf > 0);
+                        target->SendPlayMusic(e.data->action.music.sound, e.data->action.music.onlySelf > 0);
                         LOG_DEBUG("sql.sql", "SmartScript::ProcessAction:: SMART_ACTION_MUSIC: target: {} ({}), sound: {}, onlySelf: {}, type: {}",
-                                  target->GetName(), target->GetGUID().ToString(), e.action.music.sound, e.action.music.onlySelf, e.action.music.type);
+                                  target->GetName(), target->GetGUID().ToString(), e.data->action.music.sound, e.data->action.music.onlySelf, e.data->action.music.type);
                     }
                 }
             }
@@ -374,7 +385,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             ObjectVector targets;
 
-            if (e.action.randomMusic.type > 0)
+            if (e.data->action.randomMusic.type > 0)
             {
                 if (me && me->FindMap())
                 {
@@ -387,7 +398,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                             {
                                 if (player->GetZoneId() == me->GetZoneId())
                                 {
-                                    if (e.action.randomMusic.type > 1)
+                                    if (e.data->action.randomMusic.type > 1)
                                     {
                                         if (player->GetAreaId() == me->GetAreaId())
                                             targets.push_back(player);
@@ -406,10 +417,10 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 break;
 
             uint32 sounds[4];
-            sounds[0] = e.action.randomMusic.sound1;
-            sounds[1] = e.action.randomMusic.sound2;
-            sounds[2] = e.action.randomMusic.sound3;
-            sounds[3] = e.action.randomMusic.sound4;
+            sounds[0] = e.data->action.randomMusic.sound1;
+            sounds[1] = e.data->action.randomMusic.sound2;
+            sounds[2] = e.data->action.randomMusic.sound3;
+            sounds[3] = e.data->action.randomMusic.sound4;
             uint32 temp[4];
             uint32 count = 0;
             for (unsigned int sound : sounds)
@@ -431,9 +442,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (IsUnit(target))
                 {
                     uint32 sound = temp[urand(0, count - 1)];
-                    target->SendPlayMusic(sound, e.action.randomMusic.onlySelf > 0);
+                    target->SendPlayMusic(sound, e.data->action.randomMusic.onlySelf > 0);
                     LOG_DEBUG("sql.sql", "SmartScript::ProcessAction:: SMART_ACTION_RANDOM_MUSIC: target: {} ({}), sound: {}, onlyself: {}, type: {}",
-                                   target->GetName(), target->GetGUID().ToString(), sound, e.action.randomMusic.onlySelf, e.action.randomMusic.type);
+                                   target->GetName(), target->GetGUID().ToString(), sound, e.data->action.randomMusic.onlySelf, e.data->action.randomMusic.type);
                 }
             }
 
@@ -445,11 +456,11 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsCreature(target))
                 {
-                    if (e.action.faction.factionID)
+                    if (e.data->action.faction.factionID)
                     {
-                        target->ToCreature()->SetFaction(e.action.faction.factionID);
+                        target->ToCreature()->SetFaction(e.data->action.faction.factionID);
                         LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_SET_FACTION: Creature entry {}, GuidLow {} set faction to {}",
-                                  target->GetEntry(), target->GetGUID().ToString(), e.action.faction.factionID);
+                                  target->GetEntry(), target->GetGUID().ToString(), e.data->action.faction.factionID);
                     }
                     else
                     {
@@ -474,12 +485,12 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsCreature(target))
                     continue;
 
-                if (e.action.morphOrMount.creature || e.action.morphOrMount.model)
+                if (e.data->action.morphOrMount.creature || e.data->action.morphOrMount.model)
                 {
                     //set model based on entry from creature_template
-                    if (e.action.morphOrMount.creature)
+                    if (e.data->action.morphOrMount.creature)
                     {
-                        if (CreatureTemplate const* ci = sObjectMgr->GetCreatureTemplate(e.action.morphOrMount.creature))
+                        if (CreatureTemplate const* ci = sObjectMgr->GetCreatureTemplate(e.data->action.morphOrMount.creature))
                         {
                             CreatureModel const* model = ObjectMgr::ChooseDisplayId(ci);
                             target->ToCreature()->SetDisplayId(model->CreatureDisplayID, model->DisplayScale);
@@ -490,9 +501,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                         //if no param1, then use value from param2 (modelId)
                     else
                     {
-                        target->ToCreature()->SetDisplayId(e.action.morphOrMount.model);
+                        target->ToCreature()->SetDisplayId(e.data->action.morphOrMount.model);
                         LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_MORPH_TO_ENTRY_OR_MODEL: Creature entry {}, GuidLow {} set displayid to {}",
-                                  target->GetEntry(), target->GetGUID().ToString(), e.action.morphOrMount.model);
+                                  target->GetEntry(), target->GetGUID().ToString(), e.data->action.morphOrMount.model);
                     }
                 }
                 else
@@ -510,9 +521,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsPlayer(target))
                 {
-                    target->ToPlayer()->FailQuest(e.action.quest.quest);
+                    target->ToPlayer()->FailQuest(e.data->action.quest.quest);
                     LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_FAIL_QUEST: Player guidLow {} fails quest {}",
-                              target->GetGUID().ToString(), e.action.quest.quest);
+                              target->GetGUID().ToString(), e.data->action.quest.quest);
                 }
             }
             break;
@@ -523,9 +534,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (Player* player = target->ToPlayer())
                 {
-                    if (Quest const* q = sObjectMgr->GetQuestTemplate(e.action.questOffer.questID))
+                    if (Quest const* q = sObjectMgr->GetQuestTemplate(e.data->action.questOffer.questID))
                     {
-                        if (me && e.action.questOffer.directAdd == 0)
+                        if (me && e.data->action.questOffer.directAdd == 0)
                         {
                             if (player->CanTakeQuest(q, true))
                             {
@@ -534,7 +545,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                                     PlayerMenu menu(session);
                                     menu.SendQuestGiverQuestDetails(q, me->GetGUID(), true);
                                     LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_OFFER_QUEST: Player guidLow {} - offering quest {}",
-                                              player->GetGUID().ToString(), e.action.questOffer.questID);
+                                              player->GetGUID().ToString(), e.data->action.questOffer.questID);
                                 }
                             }
                         }
@@ -542,7 +553,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                         {
                             player->AddQuestAndCheckCompletion(q, nullptr);
                             LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_OFFER_QUEST: Player guidLow {} - quest {} added",
-                                      player->GetGUID().ToString(), e.action.questOffer.questID);
+                                      player->GetGUID().ToString(), e.data->action.questOffer.questID);
                         }
                     }
                 }
@@ -556,14 +567,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsCreature(target))
                     continue;
 
-                target->ToCreature()->SetReactState(ReactStates(e.action.react.state));
+                target->ToCreature()->SetReactState(ReactStates(e.data->action.react.state));
             }
             break;
         }
         case SMART_ACTION_RANDOM_EMOTE:
         {
             std::vector<uint32> emotes;
-            std::copy_if(e.action.randomEmote.emotes.begin(), e.action.randomEmote.emotes.end(),
+            std::copy_if(e.data->action.randomEmote.emotes.begin(), e.data->action.randomEmote.emotes.end(),
                          std::back_inserter(emotes), [](uint32 emote) { return emote != 0; });
 
             for (WorldObject* target : targets)
@@ -588,9 +599,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (Unit* target = ObjectAccessor::GetUnit(*me, (*i)->getUnitGuid()))
                 {
-                    me->GetThreatMgr().ModifyThreatByPercent(target, e.action.threatPCT.threatINC ? (int32)e.action.threatPCT.threatINC : -(int32)e.action.threatPCT.threatDEC);
+                    me->GetThreatMgr().ModifyThreatByPercent(target, e.data->action.threatPCT.threatINC ? (int32)e.data->action.threatPCT.threatINC : -(int32)e.data->action.threatPCT.threatDEC);
                     LOG_DEBUG("sql.sql", "SmartScript::ProcessAction:: SMART_ACTION_THREAT_ALL_PCT: Creature {} modify threat for unit {}, value {}",
-                                   me->GetGUID().ToString(), target->GetGUID().ToString(), e.action.threatPCT.threatINC ? (int32)e.action.threatPCT.threatINC : -(int32)e.action.threatPCT.threatDEC);
+                                   me->GetGUID().ToString(), target->GetGUID().ToString(), e.data->action.threatPCT.threatINC ? (int32)e.data->action.threatPCT.threatINC : -(int32)e.data->action.threatPCT.threatDEC);
                 }
             }
             break;
@@ -604,9 +615,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    me->GetThreatMgr().ModifyThreatByPercent(target->ToUnit(), e.action.threatPCT.threatINC ? (int32)e.action.threatPCT.threatINC : -(int32)e.action.threatPCT.threatDEC);
+                    me->GetThreatMgr().ModifyThreatByPercent(target->ToUnit(), e.data->action.threatPCT.threatINC ? (int32)e.data->action.threatPCT.threatINC : -(int32)e.data->action.threatPCT.threatDEC);
                     LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_THREAT_SINGLE_PCT: Creature guidLow {} modify threat for unit {}, value {}",
-                              me->GetGUID().ToString(), target->GetGUID().ToString(), e.action.threatPCT.threatINC ? (int32)e.action.threatPCT.threatINC : -(int32)e.action.threatPCT.threatDEC);
+                              me->GetGUID().ToString(), target->GetGUID().ToString(), e.data->action.threatPCT.threatINC ? (int32)e.data->action.threatPCT.threatINC : -(int32)e.data->action.threatPCT.threatDEC);
                 }
             }
             break;
@@ -620,14 +631,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (Vehicle* vehicle = target->ToUnit()->GetVehicleKit())
                         for (auto & Seat : vehicle->Seats)
                             if (Player* player = ObjectAccessor::GetPlayer(*target, Seat.second.Passenger.Guid))
-                                player->AreaExploredOrEventHappens(e.action.quest.quest);
+                                player->AreaExploredOrEventHappens(e.data->action.quest.quest);
 
                 if (IsPlayer(target))
                 {
-                    target->ToPlayer()->AreaExploredOrEventHappens(e.action.quest.quest);
+                    target->ToPlayer()->AreaExploredOrEventHappens(e.data->action.quest.quest);
 
                     LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_CALL_AREAEXPLOREDOREVENTHAPPENS: Player guidLow {} credited quest {}",
-                              target->GetGUID().ToString(), e.action.quest.quest);
+                              target->GetGUID().ToString(), e.data->action.quest.quest);
                 }
             }
             break;
@@ -642,8 +653,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (e.GetScriptType() == SMART_SCRIPT_TYPE_AREATRIGGER)
                 caster = unit->SummonTrigger(unit->GetPositionX(), unit->GetPositionY(), unit->GetPositionZ(), unit->GetOrientation(), 5000);
 
-            if (e.action.cast.targetsLimit)
-                Acore::Containers::RandomResize(targets, e.action.cast.targetsLimit);
+            if (e.data->action.cast.targetsLimit)
+                Acore::Containers::RandomResize(targets, e.data->action.cast.targetsLimit);
 
             bool failedSpellCast = false, successfulSpellCast = false;
 
@@ -651,35 +662,35 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 // may be nullptr
                 if (go)
-                    go->CastSpell(target->ToUnit(), e.action.cast.spell);
+                    go->CastSpell(target->ToUnit(), e.data->action.cast.spell);
 
                 if (!IsUnit(target))
                     continue;
 
                 if (caster && caster != me) // Areatrigger cast
                 {
-                    caster->CastSpell(target->ToUnit(), e.action.cast.spell, (e.action.cast.castFlags & SMARTCAST_TRIGGERED));
+                    caster->CastSpell(target->ToUnit(), e.data->action.cast.spell, (e.data->action.cast.castFlags & SMARTCAST_TRIGGERED));
                 }
                 else if (me)
                 {
                     // If target has the aura, skip
-                    if ((e.action.cast.castFlags & SMARTCAST_AURA_NOT_PRESENT) && target->ToUnit()->HasAura(e.action.cast.spell))
+                    if ((e.data->action.cast.castFlags & SMARTCAST_AURA_NOT_PRESENT) && target->ToUnit()->HasAura(e.data->action.cast.spell))
                         continue;
 
                     // If the threatlist is a singleton, cancel
-                    if (e.action.cast.castFlags & SMARTCAST_THREATLIST_NOT_SINGLE)
+                    if (e.data->action.cast.castFlags & SMARTCAST_THREATLIST_NOT_SINGLE)
                         if (me->GetThreatMgr().GetThreatListSize() <= 1)
                             break;
 
                     // If target does not use mana, skip
-                    if ((e.action.cast.castFlags & SMARTCAST_TARGET_POWER_MANA) && !target->ToUnit()->GetPower(POWER_MANA))
+                    if ((e.data->action.cast.castFlags & SMARTCAST_TARGET_POWER_MANA) && !target->ToUnit()->GetPower(POWER_MANA))
                         continue;
 
                     // Interrupts current spellcast
-                    if (e.action.cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS)
+                    if (e.data->action.cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS)
                         me->InterruptNonMeleeSpells(false);
 
-                    SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(e.action.cast.spell);
+                    SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(e.data->action.cast.spell);
                     float distanceToTarget = me->GetDistance(target->ToUnit());
                     float spellMaxRange = me->GetSpellMaxRangeForTarget(target->ToUnit(), spellInfo);
                     float spellMinRange = me->GetSpellMinRangeForTarget(target->ToUnit(), spellInfo);
@@ -729,18 +740,18 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     }
 
                     TriggerCastFlags triggerFlags = TRIGGERED_NONE;
-                    if (e.action.cast.castFlags & SMARTCAST_TRIGGERED)
+                    if (e.data->action.cast.castFlags & SMARTCAST_TRIGGERED)
                     {
-                        if (e.action.cast.triggerFlags)
-                            triggerFlags = TriggerCastFlags(e.action.cast.triggerFlags);
+                        if (e.data->action.cast.triggerFlags)
+                            triggerFlags = TriggerCastFlags(e.data->action.cast.triggerFlags);
                         else
                             triggerFlags = TRIGGERED_FULL_MASK;
                     }
 
-                    SpellCastResult result = me->CastSpell(target->ToUnit(), e.action.cast.spell, triggerFlags);
+                    SpellCastResult result = me->CastSpell(target->ToUnit(), e.data->action.cast.spell, triggerFlags);
                     bool spellCastFailed = (result != SPELL_CAST_OK && result != SPELL_FAILED_SPELL_IN_PROGRESS);
 
-                    if (e.action.cast.castFlags & SMARTCAST_COMBAT_MOVE)
+                    if (e.data->action.cast.castFlags & SMARTCAST_COMBAT_MOVE)
                     {
                         if (!me->isMoving()) // Don't try to reposition while we are moving
                         {
@@ -760,7 +771,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                         successfulSpellCast = true;
 
                     LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_CAST: Unit {} casts spell {} on target {} with castflags {}",
-                              me->GetGUID().ToString(), e.action.cast.spell, target->GetGUID().ToString(), e.action.cast.castFlags);
+                              me->GetGUID().ToString(), e.data->action.cast.spell, target->GetGUID().ToString(), e.data->action.cast.castFlags);
                 }
             }
 
@@ -779,15 +790,15 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (targets.empty())
                 break;
 
-            if (e.action.cast.targetsLimit)
-                Acore::Containers::RandomResize(targets, e.action.cast.targetsLimit);
+            if (e.data->action.cast.targetsLimit)
+                Acore::Containers::RandomResize(targets, e.data->action.cast.targetsLimit);
 
             TriggerCastFlags triggerFlags = TRIGGERED_NONE;
-            if (e.action.cast.castFlags & SMARTCAST_TRIGGERED)
+            if (e.data->action.cast.castFlags & SMARTCAST_TRIGGERED)
             {
-                if (e.action.cast.triggerFlags)
+                if (e.data->action.cast.triggerFlags)
                 {
-                    triggerFlags = TriggerCastFlags(e.action.cast.triggerFlags);
+                    triggerFlags = TriggerCastFlags(e.data->action.cast.triggerFlags);
                 }
                 else
                 {
@@ -801,14 +812,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!uTarget)
                     continue;
 
-                if (!(e.action.cast.castFlags & SMARTCAST_AURA_NOT_PRESENT) || !uTarget->HasAura(e.action.cast.spell))
+                if (!(e.data->action.cast.castFlags & SMARTCAST_AURA_NOT_PRESENT) || !uTarget->HasAura(e.data->action.cast.spell))
                 {
-                    if (e.action.cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS)
+                    if (e.data->action.cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS)
                     {
                         uTarget->InterruptNonMeleeSpells(false);
                     }
 
-                    uTarget->CastSpell(uTarget, e.action.cast.spell, triggerFlags);
+                    uTarget->CastSpell(uTarget, e.data->action.cast.spell, triggerFlags);
                 }
             }
             break;
@@ -823,8 +834,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (targets.empty())
                 break;
 
-            if (e.action.cast.targetsLimit)
-                Acore::Containers::RandomResize(targets, e.action.cast.targetsLimit);
+            if (e.data->action.cast.targetsLimit)
+                Acore::Containers::RandomResize(targets, e.data->action.cast.targetsLimit);
 
             for (WorldObject* target : targets)
             {
@@ -834,19 +845,19 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsUnit(tempLastInvoker))
                     continue;
 
-                if (!(e.action.cast.castFlags & SMARTCAST_AURA_NOT_PRESENT) || !target->ToUnit()->HasAura(e.action.cast.spell))
+                if (!(e.data->action.cast.castFlags & SMARTCAST_AURA_NOT_PRESENT) || !target->ToUnit()->HasAura(e.data->action.cast.spell))
                 {
-                    if (e.action.cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS)
+                    if (e.data->action.cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS)
                     {
                         tempLastInvoker->ToUnit()->InterruptNonMeleeSpells(false);
                     }
 
                     TriggerCastFlags triggerFlags = TRIGGERED_NONE;
-                    if (e.action.cast.castFlags & SMARTCAST_TRIGGERED)
+                    if (e.data->action.cast.castFlags & SMARTCAST_TRIGGERED)
                     {
-                        if (e.action.cast.triggerFlags)
+                        if (e.data->action.cast.triggerFlags)
                         {
-                            triggerFlags = TriggerCastFlags(e.action.cast.triggerFlags);
+                            triggerFlags = TriggerCastFlags(e.data->action.cast.triggerFlags);
                         }
                         else
                         {
@@ -854,14 +865,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                         }
                     }
 
-                    tempLastInvoker->ToUnit()->CastSpell(target->ToUnit(), e.action.cast.spell, triggerFlags);
+                    tempLastInvoker->ToUnit()->CastSpell(target->ToUnit(), e.data->action.cast.spell, triggerFlags);
                     LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_INVOKER_CAST: Invoker {} casts spell {} on target {} with castflags {}",
-                              tempLastInvoker->GetGUID().ToString(), e.action.cast.spell, target->GetGUID().ToString(), e.action.cast.castFlags);
+                              tempLastInvoker->GetGUID().ToString(), e.data->action.cast.spell, target->GetGUID().ToString(), e.data->action.cast.castFlags);
                 }
                 else
                 {
                     LOG_DEBUG("scripts.ai", "Spell {} not cast because it has flag SMARTCAST_AURA_NOT_PRESENT and the target {} already has the aura",
-                              e.action.cast.spell, target->GetGUID().ToString());
+                              e.data->action.cast.spell, target->GetGUID().ToString());
                 }
             }
             break;
@@ -872,9 +883,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    target->ToUnit()->AddAura(e.action.cast.spell, target->ToUnit());
+                    target->ToUnit()->AddAura(e.data->action.cast.spell, target->ToUnit());
                     LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_ADD_AURA: Adding aura {} to unit {}",
-                              e.action.cast.spell, target->GetGUID().ToString());
+                              e.data->action.cast.spell, target->GetGUID().ToString());
                 }
             }
             break;
@@ -893,7 +904,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                         go->SetLootState(GO_READY);
                     }
 
-                    go->UseDoorOrButton(0, !!e.action.activateObject.alternative, unit);
+                    go->UseDoorOrButton(0, !!e.data->action.activateObject.alternative, unit);
                     LOG_DEBUG("sql.sql", "SmartScript::ProcessAction:: SMART_ACTION_ACTIVATE_GOBJECT. Gameobject {} activated", go->GetGUID().ToString());
                 }
             }
@@ -919,9 +930,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    target->ToUnit()->SetUInt32Value(UNIT_NPC_EMOTESTATE, e.action.emote.emote);
+                    target->ToUnit()->SetUInt32Value(UNIT_NPC_EMOTESTATE, e.data->action.emote.emote);
                     LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_SET_EMOTE_STATE. Unit {} set emotestate to {}",
-                              target->GetGUID().ToString(), e.action.emote.emote);
+                              target->GetGUID().ToString(), e.data->action.emote.emote);
                 }
             }
             break;
@@ -932,17 +943,17 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    if (!e.action.unitFlag.type)
+                    if (!e.data->action.unitFlag.type)
                     {
-                        target->ToUnit()->SetFlag(UNIT_FIELD_FLAGS, e.action.unitFlag.flag);
+                        target->ToUnit()->SetFlag(UNIT_FIELD_FLAGS, e.data->action.unitFlag.flag);
                         LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_SET_UNIT_FLAG. Unit {} added flag {} to UNIT_FIELD_FLAGS",
-                                  target->GetGUID().ToString(), e.action.unitFlag.flag);
+                                  target->GetGUID().ToString(), e.data->action.unitFlag.flag);
                     }
                     else
                     {
-                        target->ToUnit()->SetFlag(UNIT_FIELD_FLAGS_2, e.action.unitFlag.flag);
+                        target->ToUnit()->SetFlag(UNIT_FIELD_FLAGS_2, e.data->action.unitFlag.flag);
                         LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_SET_UNIT_FLAG. Unit {} added flag {} to UNIT_FIELD_FLAGS_2",
-                                  target->GetGUID().ToString(), e.action.unitFlag.flag);
+                                  target->GetGUID().ToString(), e.data->action.unitFlag.flag);
                     }
                 }
             }
@@ -954,17 +965,17 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    if (!e.action.unitFlag.type)
+                    if (!e.data->action.unitFlag.type)
                     {
-                        target->ToUnit()->RemoveFlag(UNIT_FIELD_FLAGS, e.action.unitFlag.flag);
+                        target->ToUnit()->RemoveFlag(UNIT_FIELD_FLAGS, e.data->action.unitFlag.flag);
                         LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_REMOVE_UNIT_FLAG. Unit {} removed flag {} to UNIT_FIELD_FLAGS",
-                                  target->GetGUID().ToString(), e.action.unitFlag.flag);
+                                  target->GetGUID().ToString(), e.data->action.unitFlag.flag);
                     }
                     else
                     {
-                        target->ToUnit()->RemoveFlag(UNIT_FIELD_FLAGS_2, e.action.unitFlag.flag);
+                        target->ToUnit()->RemoveFlag(UNIT_FIELD_FLAGS_2, e.data->action.unitFlag.flag);
                         LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction:: SMART_ACTION_REMOVE_UNIT_FLAG. Unit {} removed flag {} to UNIT_FIELD_FLAGS_2",
-                                  target->GetGUID().ToString(), e.action.unitFlag.flag);
+                                  target->GetGUID().ToString(), e.data->action.unitFlag.flag);
                     }
                 }
             }
@@ -975,9 +986,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            CAST_AI(SmartAI, me->AI())->SetAutoAttack(e.action.autoAttack.attack);
+            CAST_AI(SmartAI, me->AI())->SetAutoAttack(e.data->action.autoAttack.attack);
             LOG_DEBUG("sql.sql", "SmartScript::ProcessAction:: SMART_ACTION_AUTO_ATTACK: Creature: {} bool on = {}",
-                           me->GetGUID().ToString(), e.action.autoAttack.attack);
+                           me->GetGUID().ToString(), e.data->action.autoAttack.attack);
             break;
         }
         case SMART_ACTION_ALLOW_COMBAT_MOVEMENT:
@@ -985,10 +996,10 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            bool move = e.action.combatMove.move;
+            bool move = e.data->action.combatMove.move;
             CAST_AI(SmartAI, me->AI())->SetCombatMove(move);
             LOG_DEBUG("sql.sql", "SmartScript::ProcessAction:: SMART_ACTION_ALLOW_COMBAT_MOVEMENT: Creature {} bool on = {}",
-                           me->GetGUID().ToString(), e.action.combatMove.move);
+                           me->GetGUID().ToString(), e.data->action.combatMove.move);
             break;
         }
         case SMART_ACTION_SET_EVENT_PHASE:
@@ -996,9 +1007,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!GetBaseObject())
                 break;
 
-            SetPhase(e.action.setEventPhase.phase);
+            SetPhase(e.data->action.setEventPhase.phase);
             LOG_DEBUG("sql.sql", "SmartScript::ProcessAction:: SMART_ACTION_SET_EVENT_PHASE: Creature {} set event phase {}",
-                           GetBaseObject()->GetGUID().ToString(), e.action.setEventPhase.phase);
+                           GetBaseObject()->GetGUID().ToString(), e.data->action.setEventPhase.phase);
             break;
         }
         case SMART_ACTION_INC_EVENT_PHASE:
@@ -1006,10 +1017,10 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!GetBaseObject())
                 break;
 
-            IncPhase(e.action.incEventPhase.inc);
-            DecPhase(e.action.incEventPhase.dec);
+            IncPhase(e.data->action.incEventPhase.inc);
+            DecPhase(e.data->action.incEventPhase.dec);
             LOG_DEBUG("sql.sql", "SmartScript::ProcessAction:: SMART_ACTION_INC_EVENT_PHASE: Creature {} inc event phase by {}, "
-                           "decrease by {}", GetBaseObject()->GetGUID().ToString(), e.action.incEventPhase.inc, e.action.incEventPhase.dec);
+                           "decrease by {}", GetBaseObject()->GetGUID().ToString(), e.data->action.incEventPhase.inc, e.data->action.incEventPhase.dec);
             break;
         }
         case SMART_ACTION_EVADE:
@@ -1031,7 +1042,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 break;
 
             me->DoFleeToGetAssistance();
-            if (e.action.flee.withEmote)
+            if (e.data->action.flee.withEmote)
             {
                 Acore::BroadcastTextBuilder builder(me, CHAT_MSG_MONSTER_EMOTE, BROADCAST_TEXT_FLEE_FOR_ASSIST, me->getGender());
                 sCreatureTextMgr->SendChatPacket(me, builder, CHAT_MSG_MONSTER_EMOTE);
@@ -1059,9 +1070,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 Player* player = unitTarget->GetCharmerOrOwnerPlayerOrPlayerItself();
                 if (player && GetBaseObject())
                 {
-                    player->GroupEventHappens(e.action.quest.quest, GetBaseObject());
+                    player->GroupEventHappens(e.data->action.quest.quest, GetBaseObject());
                     LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_CALL_GROUPEVENTHAPPENS: Player {}, group credit for quest {}",
-                        player->GetGUID().ToString(), e.action.quest.quest);
+                        player->GetGUID().ToString(), e.data->action.quest.quest);
                 }
 
                 // Special handling for vehicles
@@ -1071,7 +1082,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     {
                         if (Player* player = ObjectAccessor::GetPlayer(*unitTarget, Seat.second.Passenger.Guid))
                         {
-                            player->GroupEventHappens(e.action.quest.quest, GetBaseObject());
+                            player->GroupEventHappens(e.data->action.quest.quest, GetBaseObject());
                         }
                     }
                 }
@@ -1085,21 +1096,21 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsUnit(target))
                     continue;
 
-                if (e.action.removeAura.spell)
+                if (e.data->action.removeAura.spell)
                 {
-                    if (e.action.removeAura.charges)
+                    if (e.data->action.removeAura.charges)
                     {
-                        if (Aura* aur = target->ToUnit()->GetAura(e.action.removeAura.spell))
-                            aur->ModCharges(-static_cast<int32>(e.action.removeAura.charges), AURA_REMOVE_BY_EXPIRE);
+                        if (Aura* aur = target->ToUnit()->GetAura(e.data->action.removeAura.spell))
+                            aur->ModCharges(-static_cast<int32>(e.data->action.removeAura.charges), AURA_REMOVE_BY_EXPIRE);
                     }
                     else
-                        target->ToUnit()->RemoveAurasDueToSpell(e.action.removeAura.spell);
+                        target->ToUnit()->RemoveAurasDueToSpell(e.data->action.removeAura.spell);
                 }
                 else
                     target->ToUnit()->RemoveAllAuras();
 
                 LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_REMOVEAURASFROMSPELL: Unit {}, spell {}",
-                          target->GetGUID().ToString(), e.action.removeAura.spell);
+                          target->GetGUID().ToString(), e.data->action.removeAura.spell);
             }
             break;
         }
@@ -1108,7 +1119,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            if (e.target.type == SMART_TARGET_NONE || e.target.type == SMART_TARGET_SELF)
+            if (e.data->target.type == SMART_TARGET_NONE || e.data->target.type == SMART_TARGET_SELF)
             {
                 CAST_AI(SmartAI, me->AI())->StopFollow(false);
                 break;
@@ -1118,8 +1129,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    float angle = e.action.follow.angle > 6 ? (e.action.follow.angle * M_PI / 180.0f) : e.action.follow.angle;
-                    CAST_AI(SmartAI, me->AI())->SetFollow(target->ToUnit(), float(e.action.follow.dist) + 0.1f, angle, e.action.follow.credit, e.action.follow.entry, e.action.follow.creditType, e.action.follow.aliveState);
+                    float angle = e.data->action.follow.angle > 6 ? (e.data->action.follow.angle * M_PI / 180.0f) : e.data->action.follow.angle;
+                    CAST_AI(SmartAI, me->AI())->SetFollow(target->ToUnit(), float(e.data->action.follow.dist) + 0.1f, angle, e.data->action.follow.credit, e.data->action.follow.entry, e.data->action.follow.creditType, e.data->action.follow.aliveState);
                     LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_FOLLOW: Creature {} following target {}",
                               me->GetGUID().ToString(), target->GetGUID().ToString());
                     break;
@@ -1133,7 +1144,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 break;
 
             std::vector<uint32> phases;
-            std::copy_if(e.action.randomPhase.phases.begin(), e.action.randomPhase.phases.end(),
+            std::copy_if(e.data->action.randomPhase.phases.begin(), e.data->action.randomPhase.phases.end(),
                          std::back_inserter(phases), [](uint32 phase) { return phase != 0; });
 
             uint32 phase = Acore::Containers::SelectRandomContainerElement(phases);
@@ -1147,7 +1158,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!GetBaseObject())
                 break;
 
-            uint32 phase = urand(e.action.randomPhaseRange.phaseMin, e.action.randomPhaseRange.phaseMax);
+            uint32 phase = urand(e.data->action.randomPhaseRange.phaseMin, e.data->action.randomPhaseRange.phaseMax);
             SetPhase(phase);
             LOG_DEBUG("sql.sql", "SmartScript::ProcessAction: SMART_ACTION_RANDOM_PHASE_RANGE: Creature {} sets event phase to {}",
                            GetBaseObject()->GetGUID().ToString(), phase);
@@ -1157,20 +1168,20 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             if (trigger && IsPlayer(unit))
             {
-                unit->ToPlayer()->RewardPlayerAndGroupAtEvent(e.action.killedMonster.creature, unit);
+                unit->ToPlayer()->RewardPlayerAndGroupAtEvent(e.data->action.killedMonster.creature, unit);
                 LOG_DEBUG("sql.sql", "SmartScript::ProcessAction: SMART_ACTION_CALL_KILLEDMONSTER: (trigger == true) Player {}, Killcredit: {}",
-                          unit->GetGUID().ToString(), e.action.killedMonster.creature);
+                          unit->GetGUID().ToString(), e.data->action.killedMonster.creature);
             }
-            else if (e.target.type == SMART_TARGET_NONE || e.target.type == SMART_TARGET_SELF) // Loot recipient and his group members
+            else if (e.data->target.type == SMART_TARGET_NONE || e.data->target.type == SMART_TARGET_SELF) // Loot recipient and his group members
             {
                 if (!me)
                     break;
 
                 if (Player* player = me->GetLootRecipient())
                 {
-                    player->RewardPlayerAndGroupAtEvent(e.action.killedMonster.creature, player);
+                    player->RewardPlayerAndGroupAtEvent(e.data->action.killedMonster.creature, player);
                     LOG_DEBUG("sql.sql", "SmartScript::ProcessAction: SMART_ACTION_CALL_KILLEDMONSTER: Player {}, Killcredit: {}",
-                              player->GetGUID().ToString(), e.action.killedMonster.creature);
+                              player->GetGUID().ToString(), e.data->action.killedMonster.creature);
                 }
             }
             else // Specific target type
@@ -1184,9 +1195,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (!player)
                         continue;
 
-                    player->RewardPlayerAndGroupAtEvent(e.action.killedMonster.creature, player);
+                    player->RewardPlayerAndGroupAtEvent(e.data->action.killedMonster.creature, player);
                     LOG_DEBUG("sql.sql", "SmartScript::ProcessAction: SMART_ACTION_CALL_KILLEDMONSTER: Player {}, Killcredit: {}",
-                              target->GetGUID().ToString(), e.action.killedMonster.creature);
+                              target->GetGUID().ToString(), e.data->action.killedMonster.creature);
                 }
             }
             break;
@@ -1203,21 +1214,21 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             InstanceScript* instance = obj->GetInstanceScript();
             if (!instance)
             {
-                LOG_ERROR("scripts.ai.sai", "SmartScript: Event {} attempt to set instance data without instance script. EntryOrGuid {}", e.GetEventType(), e.entryOrGuid);
+                LOG_ERROR("scripts.ai.sai", "SmartScript: Event {} attempt to set instance data without instance script. EntryOrGuid {}", e.GetEventType(), e.data->entryOrGuid);
                 break;
             }
 
-            switch (e.action.setInstanceData.type)
+            switch (e.data->action.setInstanceData.type)
             {
                 case 0:
                 {
-                    instance->SetData(e.action.setInstanceData.field, e.action.setInstanceData.data);
-                    LOG_DEBUG("scripts.ai.sai", "SmartScript::ProcessAction: SMART_ACTION_SET_INST_DATA: Field: {}, data: {}", e.action.setInstanceData.field, e.action.setInstanceData.data);
+                    instance->SetData(e.data->action.setInstanceData.field, e.data->action.setInstanceData.data);
+                    LOG_DEBUG("scripts.ai.sai", "SmartScript::ProcessAction: SMART_ACTION_SET_INST_DATA: Field: {}, data: {}", e.data->action.setInstanceData.field, e.data->action.setInstanceData.data);
                 } break;
                 case 1:
                 {
-                    instance->SetBossState(e.action.setInstanceData.field, static_cast<EncounterState>(e.action.setInstanceData.data));
-                    LOG_DEBUG("scripts.ai.sai", "SmartScript::ProcessAction: SMART_ACTION_SET_INST_DATA: SetBossState BossId: {}, State: {} ({})", e.action.setInstanceData.field, e.action.setInstanceData.data, InstanceScript::GetBossStateName(e.action.setInstanceData.data));
+                    instance->SetBossState(e.data->action.setInstanceData.field, static_cast<EncounterState>(e.data->action.setInstanceData.data));
+                    LOG_DEBUG("scripts.ai.sai", "SmartScript::ProcessAction: SMART_ACTION_SET_INST_DATA: SetBossState BossId: {}, State: {} ({})", e.data->action.setInstanceData.field, e.data->action.setInstanceData.data, InstanceScript::GetBossStateName(e.data->action.setInstanceData.data));
                 } break;
                 default:
                 {
@@ -1238,28 +1249,28 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             InstanceScript* instance = obj->GetInstanceScript();
             if (!instance)
             {
-                LOG_ERROR("sql.sql", "SmartScript: Event {} attempt to set instance data without instance script. EntryOrGuid {}", e.GetEventType(), e.entryOrGuid);
+                LOG_ERROR("sql.sql", "SmartScript: Event {} attempt to set instance data without instance script. EntryOrGuid {}", e.GetEventType(), e.data->entryOrGuid);
                 break;
             }
 
             if (targets.empty())
                 break;
 
-            instance->SetGuidData(e.action.setInstanceData64.field, targets.front()->GetGUID());
+            instance->SetGuidData(e.data->action.setInstanceData64.field, targets.front()->GetGUID());
             LOG_DEBUG("scripts.ai", "SmartScript::ProcessAction: SMART_ACTION_SET_INST_DATA64: Field: {}, data: {}",
-                      e.action.setInstanceData64.field, targets.front()->GetGUID().ToString());
+                      e.data->action.setInstanceData64.field, targets.front()->GetGUID().ToString());
             break;
         }
         case SMART_ACTION_UPDATE_TEMPLATE:
         {
             for (WorldObject* target : targets)
                 if (IsCreature(target))
-                    target->ToCreature()->UpdateEntry(e.action.updateTemplate.creature, target->ToCreature()->GetCreatureData(), e.action.updateTemplate.updateLevel != 0);
+                    target->ToCreature()->UpdateEntry(e.data->action.updateTemplate.creature, target->ToCreature()->GetCreatureData(), e.data->action.updateTemplate.updateLevel != 0);
             break;
         }
         case SMART_ACTION_DIE:
         {
-            if (e.action.die.milliseconds)
+            if (e.data->action.die.milliseconds)
             {
                 if (me && !me->isDead())
                 {
@@ -1271,7 +1282,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                                 me->KillSelf();
                                 LOG_DEBUG("sql.sql", "SmartScript::ProcessAction: SMART_ACTION_DIE: Creature {}", me->GetGUID().ToString());
                             }
-                        }, Milliseconds(e.action.die.milliseconds));
+                        }, Milliseconds(e.data->action.die.milliseconds));
                 }
             }
             else if (me && !me->isDead())
@@ -1289,7 +1300,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!me->GetMap()->IsDungeon())
             {
                 ObjectVector units;
-                GetWorldObjectsInDist(units, static_cast<float>(e.target.unitRange.maxDist));
+                GetWorldObjectsInDist(units, static_cast<float>(e.data->target.unitRange.maxDist));
 
                 if (!units.empty() && GetBaseObject())
                     for (WorldObject* unit : units)
@@ -1321,8 +1332,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsCreature(target))
                 {
-                    target->ToCreature()->CallForHelp(float(e.action.callHelp.range));
-                    if (e.action.callHelp.withEmote)
+                    target->ToCreature()->CallForHelp(float(e.data->action.callHelp.range));
+                    if (e.data->action.callHelp.withEmote)
                     {
                         Acore::BroadcastTextBuilder builder(target, CHAT_MSG_MONSTER_EMOTE, BROADCAST_TEXT_CALL_FOR_HELP, LANG_UNIVERSAL, nullptr);
                         sCreatureTextMgr->SendChatPacket(target, builder, CHAT_MSG_MONSTER_EMOTE);
@@ -1337,9 +1348,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             if (me)
             {
-                me->SetSheath(SheathState(e.action.setSheath.sheath));
+                me->SetSheath(SheathState(e.data->action.setSheath.sheath));
                 LOG_DEBUG("sql.sql", "SmartScript::ProcessAction: SMART_ACTION_SET_SHEATH: Creature {}, State: {}",
-                               me->GetGUID().ToString(), e.action.setSheath.sheath);
+                               me->GetGUID().ToString(), e.data->action.setSheath.sheath);
             }
             break;
         }
@@ -1347,9 +1358,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
             {
-                if (e.action.forceDespawn.removeObjectFromWorld)
+                if (e.data->action.forceDespawn.removeObjectFromWorld)
                 {
-                    if (e.action.forceDespawn.delay || e.action.forceDespawn.forceRespawnTimer)
+                    if (e.data->action.forceDespawn.delay || e.data->action.forceDespawn.forceRespawnTimer)
                         LOG_ERROR("sql.sql", "SmartScript: SMART_ACTION_FORCE_DESPAWN has removeObjectFromWorld set. delay and forceRespawnTimer ignored.");
 
                     if (Creature* creature = target->ToCreature())
@@ -1359,13 +1370,13 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 }
                 else
                 {
-                    Milliseconds despawnDelay(e.action.forceDespawn.delay);
+                    Milliseconds despawnDelay(e.data->action.forceDespawn.delay);
 
                     // Wait at least one world update tick before despawn, so it doesn't break linked actions.
                     if (despawnDelay <= 0ms)
                         despawnDelay = 1ms;
 
-                    Seconds forceRespawnTimer(e.action.forceDespawn.forceRespawnTimer);
+                    Seconds forceRespawnTimer(e.data->action.forceDespawn.forceRespawnTimer);
                     if (Creature* creature = target->ToCreature())
                         creature->DespawnOrUnsummon(despawnDelay, forceRespawnTimer);
                     else if (GameObject* go = target->ToGameObject())
@@ -1380,9 +1391,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             for (WorldObject* target : targets)
             {
                 if (IsUnit(target))
-                    target->ToUnit()->SetPhaseMask(e.action.ingamePhaseMask.mask, true);
+                    target->ToUnit()->SetPhaseMask(e.data->action.ingamePhaseMask.mask, true);
                 else if (IsGameObject(target))
-                    target->ToGameObject()->SetPhaseMask(e.action.ingamePhaseMask.mask, true);
+                    target->ToGameObject()->SetPhaseMask(e.data->action.ingamePhaseMask.mask, true);
             }
             break;
         }
@@ -1393,15 +1404,15 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsUnit(target))
                     continue;
 
-                if (e.action.morphOrMount.creature || e.action.morphOrMount.model)
+                if (e.data->action.morphOrMount.creature || e.data->action.morphOrMount.model)
                 {
-                    if (e.action.morphOrMount.creature > 0)
+                    if (e.data->action.morphOrMount.creature > 0)
                     {
-                        if (CreatureTemplate const* cInfo = sObjectMgr->GetCreatureTemplate(e.action.morphOrMount.creature))
+                        if (CreatureTemplate const* cInfo = sObjectMgr->GetCreatureTemplate(e.data->action.morphOrMount.creature))
                             target->ToUnit()->Mount(ObjectMgr::ChooseDisplayId(cInfo)->CreatureDisplayID);
                     }
                     else
-                        target->ToUnit()->Mount(e.action.morphOrMount.model);
+                        target->ToUnit()->Mount(e.data->action.morphOrMount.model);
                 }
                 else
                     target->ToUnit()->Dismount();
@@ -1418,10 +1429,10 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (!ai)
                         continue;
 
-                    if (e.action.invincHP.percent)
-                        ai->SetInvincibilityHpLevel(target->ToCreature()->CountPctFromMaxHealth(e.action.invincHP.percent));
+                    if (e.data->action.invincHP.percent)
+                        ai->SetInvincibilityHpLevel(target->ToCreature()->CountPctFromMaxHealth(e.data->action.invincHP.percent));
                     else
-                        ai->SetInvincibilityHpLevel(e.action.invincHP.minHP);
+                        ai->SetInvincibilityHpLevel(e.data->action.invincHP.minHP);
                 }
             }
             break;
@@ -1437,12 +1448,12 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (IsSmart(cTarget, true) && (me || go))
                     {
                         if (me)
-                            ENSURE_AI(SmartAI, ai)->SetData(e.action.setData.field, e.action.setData.data, me);
+                            ENSURE_AI(SmartAI, ai)->SetData(e.data->action.setData.field, e.data->action.setData.data, me);
                         else
-                            ENSURE_AI(SmartAI, ai)->SetData(e.action.setData.field, e.action.setData.data, go);
+                            ENSURE_AI(SmartAI, ai)->SetData(e.data->action.setData.field, e.data->action.setData.data, go);
                     }
                     else
-                        ai->SetData(e.action.setData.field, e.action.setData.data);
+                        ai->SetData(e.data->action.setData.field, e.data->action.setData.data);
                 }
                 else if (GameObject* oTarget = target->ToGameObject())
                 {
@@ -1451,12 +1462,12 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (IsSmart(oTarget, true) && (me || go))
                     {
                         if (me)
-                            ENSURE_AI(SmartGameObjectAI, ai)->SetData(e.action.setData.field, e.action.setData.data, me);
+                            ENSURE_AI(SmartGameObjectAI, ai)->SetData(e.data->action.setData.field, e.data->action.setData.data, me);
                         else
-                            ENSURE_AI(SmartGameObjectAI, ai)->SetData(e.action.setData.field, e.action.setData.data, go);
+                            ENSURE_AI(SmartGameObjectAI, ai)->SetData(e.data->action.setData.field, e.data->action.setData.data, go);
                     }
                     else
-                        ai->SetData(e.action.setData.field, e.action.setData.data);
+                        ai->SetData(e.data->action.setData.field, e.data->action.setData.data);
                 }
             }
             break;
@@ -1467,7 +1478,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 break;
 
             float x, y, z;
-            me->GetClosePoint(x, y, z, me->GetObjectSize() / 3, (float)e.action.moveRandom.distance);
+            me->GetClosePoint(x, y, z, me->GetObjectSize() / 3, (float)e.data->action.moveRandom.distance);
             me->GetMotionMaster()->MovePoint(SMART_RANDOM_POINT, x, y, z);
             break;
         }
@@ -1476,21 +1487,21 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!me)
                 break;
 
-            me->GetMotionMaster()->MovePoint(SMART_RANDOM_POINT, me->GetPositionX(), me->GetPositionY(), me->GetPositionZ() + (float)e.action.moveRandom.distance);
+            me->GetMotionMaster()->MovePoint(SMART_RANDOM_POINT, me->GetPositionX(), me->GetPositionY(), me->GetPositionZ() + (float)e.data->action.moveRandom.distance);
             break;
         }
         case SMART_ACTION_SET_VISIBILITY:
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->SetVisible(!!e.action.visibility.state);
+                    target->ToUnit()->SetVisible(!!e.data->action.visibility.state);
 
             break;
         }
         case SMART_ACTION_SET_ACTIVE:
         {
             for (WorldObject* target : targets)
-                target->setActive(!!e.action.setActive.state);
+                target->setActive(!!e.data->action.setActive.state);
             break;
         }
         case SMART_ACTION_ATTACK_START:
@@ -1515,7 +1526,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         }
         case SMART_ACTION_SUMMON_CREATURE:
         {
-            EnumFlag<SmartActionSummonCreatureFlags> flags(static_cast<SmartActionSummonCreatureFlags>(e.action.summonCreature.flags));
+            EnumFlag<SmartActionSummonCreatureFlags> flags(static_cast<SmartActionSummonCreatureFlags>(e.data->action.summonCreature.flags));
             bool preferUnit = flags.HasFlag(SmartActionSummonCreatureFlags::PreferUnit);
             WorldObject* summoner = preferUnit ? unit : Coalesce<WorldObject>(GetBaseObject(), unit);
             if (!summoner)
@@ -1525,20 +1536,20 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 
             if (e.GetTargetType() == SMART_TARGET_RANDOM_POINT)
             {
-                float range = (float)e.target.randomPoint.range;
+                float range = (float)e.data->target.randomPoint.range;
                 Position randomPoint;
-                Position srcPos = { e.target.x, e.target.y, e.target.z, e.target.o };
-                for (uint32 i = 0; i < e.target.randomPoint.amount; i++)
+                Position srcPos = { e.data->target.x, e.data->target.y, e.data->target.z, e.data->target.o };
+                for (uint32 i = 0; i < e.data->target.randomPoint.amount; i++)
                 {
-                    if (e.target.randomPoint.self > 0)
+                    if (e.data->target.randomPoint.self > 0)
                         randomPoint = me->GetRandomPoint(me->GetPosition(), range);
                     else
                         randomPoint = me->GetRandomPoint(srcPos, range);
-                    if (Creature* summon = summoner->SummonCreature(e.action.summonCreature.creature, randomPoint, (TempSummonType)e.action.summonCreature.type, e.action.summonCreature.duration, 0, nullptr, personalSpawn))
+                    if (Creature* summon = summoner->SummonCreature(e.data->action.summonCreature.creature, randomPoint, (TempSummonType)e.data->action.summonCreature.type, e.data->action.summonCreature.duration, 0, nullptr, personalSpawn))
                     {
-                        if (unit && e.action.summonCreature.attackInvoker)
+                        if (unit && e.data->action.summonCreature.attackInvoker)
                             summon->AI()->AttackStart(unit);
-                        else if (me && e.action.summonCreature.attackScriptOwner)
+                        else if (me && e.data->action.summonCreature.attackScriptOwner)
                             summon->AI()->AttackStart(me);
                     }
                 }
@@ -1549,17 +1560,17 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             for (WorldObject* target : targets)
             {
                 target->GetPosition(x, y, z, o);
-                x += e.target.x;
-                y += e.target.y;
-                z += e.target.z;
-                o += e.target.o;
-                if (Creature* summon = summoner->SummonCreature(e.action.summonCreature.creature, x, y, z, o, (TempSummonType)e.action.summonCreature.type, e.action.summonCreature.duration, nullptr, personalSpawn))
+                x += e.data->target.x;
+                y += e.data->target.y;
+                z += e.data->target.z;
+                o += e.data->target.o;
+                if (Creature* summon = summoner->SummonCreature(e.data->action.summonCreature.creature, x, y, z, o, (TempSummonType)e.data->action.summonCreature.type, e.data->action.summonCreature.duration, nullptr, personalSpawn))
                 {
-                    if (e.action.summonCreature.attackInvoker == 2) // pussywizard: proper attackInvoker implementation
+                    if (e.data->action.summonCreature.attackInvoker == 2) // pussywizard: proper attackInvoker implementation
                         summon->AI()->AttackStart(unit);
-                    else if (e.action.summonCreature.attackInvoker)
+                    else if (e.data->action.summonCreature.attackInvoker)
                         summon->AI()->AttackStart(target->ToUnit());
-                    else if (me && e.action.summonCreature.attackScriptOwner)
+                    else if (me && e.data->action.summonCreature.attackScriptOwner)
                         summon->AI()->AttackStart(me);
                 }
             }
@@ -1567,11 +1578,11 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (e.GetTargetType() != SMART_TARGET_POSITION)
                 break;
 
-            if (Creature* summon = summoner->SummonCreature(e.action.summonCreature.creature, e.target.x, e.target.y, e.target.z, e.target.o, (TempSummonType)e.action.summonCreature.type, e.action.summonCreature.duration))
+            if (Creature* summon = summoner->SummonCreature(e.data->action.summonCreature.creature, e.data->target.x, e.data->target.y, e.data->target.z, e.data->target.o, (TempSummonType)e.data->action.summonCreature.type, e.data->action.summonCreature.duration))
             {
-                if (unit && e.action.summonCreature.attackInvoker)
+                if (unit && e.data->action.summonCreature.attackInvoker)
                     summon->AI()->AttackStart(unit);
-                else if (me && e.action.summonCreature.attackScriptOwner)
+                else if (me && e.data->action.summonCreature.attackScriptOwner)
                     summon->AI()->AttackStart(me);
             }
             break;
@@ -1591,21 +1602,21 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     //  continue;
 
                     target->GetPosition(x, y, z, o);
-                    x += e.target.x;
-                    y += e.target.y;
-                    z += e.target.z;
-                    o += e.target.o;
-                    if (!e.action.summonGO.targetsummon)
-                        GetBaseObject()->SummonGameObject(e.action.summonGO.entry, x, y, z, o, 0, 0, 0, 0, e.action.summonGO.despawnTime);
+                    x += e.data->target.x;
+                    y += e.data->target.y;
+                    z += e.data->target.z;
+                    o += e.data->target.o;
+                    if (!e.data->action.summonGO.targetsummon)
+                        GetBaseObject()->SummonGameObject(e.data->action.summonGO.entry, x, y, z, o, 0, 0, 0, 0, e.data->action.summonGO.despawnTime);
                     else
-                        target->SummonGameObject(e.action.summonGO.entry, GetBaseObject()->GetPositionX(), GetBaseObject()->GetPositionY(), GetBaseObject()->GetPositionZ(), GetBaseObject()->GetOrientation(), 0, 0, 0, 0, e.action.summonGO.despawnTime);
+                        target->SummonGameObject(e.data->action.summonGO.entry, GetBaseObject()->GetPositionX(), GetBaseObject()->GetPositionY(), GetBaseObject()->GetPositionZ(), GetBaseObject()->GetOrientation(), 0, 0, 0, 0, e.data->action.summonGO.despawnTime);
                 }
             }
 
             if (e.GetTargetType() != SMART_TARGET_POSITION)
                 break;
 
-            GetBaseObject()->SummonGameObject(e.action.summonGO.entry, e.target.x, e.target.y, e.target.z, e.target.o, 0, 0, 0, 0, e.action.summonGO.despawnTime);
+            GetBaseObject()->SummonGameObject(e.data->action.summonGO.entry, e.data->target.x, e.data->target.y, e.data->target.z, e.data->target.o, 0, 0, 0, 0, e.data->action.summonGO.despawnTime);
             break;
         }
         case SMART_ACTION_KILL_UNIT:
@@ -1632,7 +1643,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsPlayer(target))
                     continue;
 
-                target->ToPlayer()->AddItem(e.action.item.entry, e.action.item.count);
+                target->ToPlayer()->AddItem(e.data->action.item.entry, e.data->action.item.count);
             }
             break;
         }
@@ -1643,13 +1654,13 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsPlayer(target))
                     continue;
 
-                target->ToPlayer()->DestroyItemCount(e.action.item.entry, e.action.item.count, true);
+                target->ToPlayer()->DestroyItemCount(e.data->action.item.entry, e.data->action.item.count, true);
             }
             break;
         }
         case SMART_ACTION_STORE_TARGET_LIST:
         {
-            StoreTargetList(targets, e.action.storeTargets.id);
+            StoreTargetList(targets, e.data->action.storeTargets.id);
             break;
         }
         case SMART_ACTION_TELEPORT:
@@ -1657,9 +1668,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             for (WorldObject* target : targets)
             {
                 if (IsPlayer(target))
-                    target->ToPlayer()->TeleportTo(e.action.teleport.mapID, e.target.x, e.target.y, e.target.z, e.target.o);
+                    target->ToPlayer()->TeleportTo(e.data->action.teleport.mapID, e.data->target.x, e.data->target.y, e.data->target.z, e.data->target.o);
                 else if (IsCreature(target))
-                    target->ToCreature()->NearTeleportTo(e.target.x, e.target.y, e.target.z, e.target.o);
+                    target->ToCreature()->NearTeleportTo(e.data->target.x, e.data->target.y, e.data->target.z, e.data->target.o);
             }
             break;
         }
@@ -1668,13 +1679,13 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            CAST_AI(SmartAI, me->AI())->SetFly(e.action.setFly.fly);
+            CAST_AI(SmartAI, me->AI())->SetFly(e.data->action.setFly.fly);
             // Xinef: Set speed if any
-            if (e.action.setFly.speed)
-                me->SetSpeed(MOVE_RUN, float(e.action.setFly.speed / 100.0f), true);
+            if (e.data->action.setFly.speed)
+                me->SetSpeed(MOVE_RUN, float(e.data->action.setFly.speed / 100.0f), true);
 
             // Xinef: this wil be executed only if state is different
-            me->SetDisableGravity(e.action.setFly.disableGravity);
+            me->SetDisableGravity(e.data->action.setFly.disableGravity);
             break;
         }
         case SMART_ACTION_SET_RUN:
@@ -1684,9 +1695,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (IsCreature(target))
                 {
                     if (IsSmart(target->ToCreature()))
-                        CAST_AI(SmartAI, target->ToCreature()->AI())->SetRun(e.action.setRun.run);
+                        CAST_AI(SmartAI, target->ToCreature()->AI())->SetRun(e.data->action.setRun.run);
                     else
-                        target->ToCreature()->SetWalk(e.action.setRun.run ? false : true); // Xinef: reversed
+                        target->ToCreature()->SetWalk(e.data->action.setRun.run ? false : true); // Xinef: reversed
                 }
             }
 
@@ -1697,7 +1708,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            CAST_AI(SmartAI, me->AI())->SetSwim(e.action.setSwim.swim);
+            CAST_AI(SmartAI, me->AI())->SetSwim(e.data->action.setSwim.swim);
             break;
         }
         case SMART_ACTION_SET_COUNTER:
@@ -1709,21 +1720,21 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (IsCreature(target))
                     {
                         if (SmartAI* ai = CAST_AI(SmartAI, target->ToCreature()->AI()))
-                            ai->GetScript()->StoreCounter(e.action.setCounter.counterId, e.action.setCounter.value, e.action.setCounter.reset, e.action.setCounter.subtract);
+                            ai->GetScript()->StoreCounter(e.data->action.setCounter.counterId, e.data->action.setCounter.value, e.data->action.setCounter.reset, e.data->action.setCounter.subtract);
                         else
                             LOG_ERROR("sql.sql", "SmartScript: Action target for SMART_ACTION_SET_COUNTER is not using SmartAI, skipping");
                     }
                     else if (IsGameObject(target))
                     {
                         if (SmartGameObjectAI* ai = CAST_AI(SmartGameObjectAI, target->ToGameObject()->AI()))
-                            ai->GetScript()->StoreCounter(e.action.setCounter.counterId, e.action.setCounter.value, e.action.setCounter.reset, e.action.setCounter.subtract);
+                            ai->GetScript()->StoreCounter(e.data->action.setCounter.counterId, e.data->action.setCounter.value, e.data->action.setCounter.reset, e.data->action.setCounter.subtract);
                         else
                             LOG_ERROR("sql.sql", "SmartScript: Action target for SMART_ACTION_SET_COUNTER is not using SmartGameObjectAI, skipping");
                     }
                 }
             }
             else
-                StoreCounter(e.action.setCounter.counterId, e.action.setCounter.value, e.action.setCounter.reset, e.action.setCounter.subtract);
+                StoreCounter(e.data->action.setCounter.counterId, e.data->action.setCounter.value, e.data->action.setCounter.reset, e.data->action.setCounter.subtract);
             break;
         }
         case SMART_ACTION_WP_START:
@@ -1731,9 +1742,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            bool run = e.action.wpStart.run != 0;
-            uint32 entry = e.action.wpStart.pathID;
-            bool repeat = e.action.wpStart.repeat != 0;
+            bool run = e.data->action.wpStart.run != 0;
+            uint32 entry = e.data->action.wpStart.pathID;
+            bool repeat = e.data->action.wpStart.repeat != 0;
 
             for (WorldObject* target : targets)
             {
@@ -1744,11 +1755,11 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 }
             }
 
-            me->SetReactState((ReactStates)e.action.wpStart.reactState);
+            me->SetReactState((ReactStates)e.data->action.wpStart.reactState);
             CAST_AI(SmartAI, me->AI())->StartPath(run, entry, repeat, unit);
 
-            uint32 quest = e.action.wpStart.quest;
-            uint32 DespawnTime = e.action.wpStart.despawnTime;
+            uint32 quest = e.data->action.wpStart.quest;
+            uint32 DespawnTime = e.data->action.wpStart.despawnTime;
             CAST_AI(SmartAI, me->AI())->mEscortQuestID = quest;
             CAST_AI(SmartAI, me->AI())->SetDespawnTime(DespawnTime);
             break;
@@ -1758,7 +1769,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            uint32 delay = e.action.wpPause.delay;
+            uint32 delay = e.data->action.wpPause.delay;
             CAST_AI(SmartAI, me->AI())->PausePath(delay, e.GetEventType() == SMART_EVENT_WAYPOINT_REACHED ? false : true);
             break;
         }
@@ -1767,9 +1778,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            uint32 DespawnTime = e.action.wpStop.despawnTime;
-            uint32 quest = e.action.wpStop.quest;
-            bool fail = e.action.wpStop.fail;
+            uint32 DespawnTime = e.data->action.wpStop.despawnTime;
+            uint32 quest = e.data->action.wpStop.quest;
+            bool fail = e.data->action.wpStop.fail;
             CAST_AI(SmartAI, me->AI())->StopPath(DespawnTime, quest, fail);
             break;
         }
@@ -1786,20 +1797,20 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!me)
                 break;
 
-            if (e.action.orientation.random > 0)
+            if (e.data->action.orientation.random > 0)
             {
                 float randomOri = frand(0.0f, 2 * M_PI);
                 me->SetFacingTo(randomOri);
-                if (e.action.orientation.quickChange)
+                if (e.data->action.orientation.quickChange)
                     me->SetOrientation(randomOri);
                 break;
             }
 
-            if (e.action.orientation.turnAngle)
+            if (e.data->action.orientation.turnAngle)
             {
-                float turnOri = me->GetOrientation() + (static_cast<float>(e.action.orientation.turnAngle) * M_PI / 180.0f);
+                float turnOri = me->GetOrientation() + (static_cast<float>(e.data->action.orientation.turnAngle) * M_PI / 180.0f);
                 me->SetFacingTo(turnOri);
-                if (e.action.orientation.quickChange)
+                if (e.data->action.orientation.quickChange)
                     me->SetOrientation(turnOri);
                 break;
             }
@@ -1807,19 +1818,19 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (e.GetTargetType() == SMART_TARGET_SELF)
             {
                 me->SetFacingTo((me->HasUnitMovementFlag(MOVEMENTFLAG_ONTRANSPORT) && me->GetTransGUID() ? me->GetTransportHomePosition() : me->GetHomePosition()).GetOrientation());
-                if (e.action.orientation.quickChange)
+                if (e.data->action.orientation.quickChange)
                     me->SetOrientation((me->HasUnitMovementFlag(MOVEMENTFLAG_ONTRANSPORT) && me->GetTransGUID() ? me->GetTransportHomePosition() : me->GetHomePosition()).GetOrientation());
             }
             else if (e.GetTargetType() == SMART_TARGET_POSITION)
             {
-                me->SetFacingTo(e.target.o);
-                if (e.action.orientation.quickChange)
-                    me->SetOrientation(e.target.o);
+                me->SetFacingTo(e.data->target.o);
+                if (e.data->action.orientation.quickChange)
+                    me->SetOrientation(e.data->target.o);
             }
             else if (!targets.empty())
             {
                 me->SetFacingToObject(*targets.begin());
-                if (e.action.orientation.quickChange)
+                if (e.data->action.orientation.quickChange)
                     me->SetInFront(*targets.begin());
             }
 
@@ -1832,7 +1843,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsPlayer(target))
                     continue;
 
-                target->ToPlayer()->SendMovieStart(e.action.movie.entry);
+                target->ToPlayer()->SendMovieStart(e.data->action.movie.entry);
             }
             break;
         }
@@ -1847,13 +1858,13 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 case SMART_TARGET_POSITION:
                 {
-                    G3D::Vector3 dest(e.target.x, e.target.y, e.target.z);
-                    if (e.action.moveToPos.transport)
+                    G3D::Vector3 dest(e.data->target.x, e.data->target.y, e.data->target.z);
+                    if (e.data->action.moveToPos.transport)
                         if (TransportBase* trans = me->GetDirectTransport())
                             trans->CalculatePassengerPosition(dest.x, dest.y, dest.z);
 
-                    me->GetMotionMaster()->MovePoint(e.action.moveToPos.pointId, dest.x, dest.y, dest.z, true, true,
-                        isControlled ? MOTION_SLOT_CONTROLLED : MOTION_SLOT_ACTIVE, e.target.o);
+                    me->GetMotionMaster()->MovePoint(e.data->action.moveToPos.pointId, dest.x, dest.y, dest.z, true, true,
+                        isControlled ? MOTION_SLOT_CONTROLLED : MOTION_SLOT_ACTIVE, e.data->target.o);
 
                     break;
                 }
@@ -1861,11 +1872,11 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 {
                     if (me)
                     {
-                        float range = (float)e.target.randomPoint.range;
-                        Position srcPos = { e.target.x, e.target.y, e.target.z, e.target.o };
+                        float range = (float)e.data->target.randomPoint.range;
+                        Position srcPos = { e.data->target.x, e.data->target.y, e.data->target.z, e.data->target.o };
                         Position randomPoint = me->GetRandomPoint(srcPos, range);
                         me->GetMotionMaster()->MovePoint(
-                            e.action.moveToPos.pointId,
+                            e.data->action.moveToPos.pointId,
                             randomPoint.m_positionX,
                             randomPoint.m_positionY,
                             randomPoint.m_positionZ,
@@ -1890,12 +1901,12 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     float x, y, z;
                     target->GetPosition(x, y, z);
 
-                    if (e.action.moveToPos.combatReach)
-                        target->GetNearPoint(me, x, y, z, target->GetCombatReach() + e.action.moveToPos.ContactDistance, 0, target->GetAngle(me));
-                    else if (e.action.moveToPos.ContactDistance)
-                        target->GetNearPoint(me, x, y, z, e.action.moveToPos.ContactDistance, 0, target->GetAngle(me));
+                    if (e.data->action.moveToPos.combatReach)
+                        target->GetNearPoint(me, x, y, z, target->GetCombatReach() + e.data->action.moveToPos.ContactDistance, 0, target->GetAngle(me));
+                    else if (e.data->action.moveToPos.ContactDistance)
+                        target->GetNearPoint(me, x, y, z, e.data->action.moveToPos.ContactDistance, 0, target->GetAngle(me));
 
-                    me->GetMotionMaster()->MovePoint(e.action.moveToPos.pointId, x + e.target.x, y + e.target.y, z + e.target.z, true, true, isControlled ? MOTION_SLOT_CONTROLLED : MOTION_SLOT_ACTIVE);
+                    me->GetMotionMaster()->MovePoint(e.data->action.moveToPos.pointId, x + e.data->target.x, y + e.data->target.y, z + e.data->target.z, true, true, isControlled ? MOTION_SLOT_CONTROLLED : MOTION_SLOT_ACTIVE);
 
                     break;
                 }
@@ -1910,7 +1921,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (IsCreature(target))
                 {
                     Creature* ctarget = target->ToCreature();
-                    ctarget->GetMotionMaster()->MovePoint(e.action.moveToPos.pointId, e.target.x, e.target.y, e.target.z, true, true, isControlled ? MOTION_SLOT_CONTROLLED : MOTION_SLOT_ACTIVE);
+                    ctarget->GetMotionMaster()->MovePoint(e.data->action.moveToPos.pointId, e.data->target.x, e.data->target.y, e.data->target.z, true, true, isControlled ? MOTION_SLOT_CONTROLLED : MOTION_SLOT_ACTIVE);
                 }
             }
 
@@ -1928,7 +1939,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (target->ToGameObject()->isSpawnedByDefault())
                         target->ToGameObject()->Respawn();
                     else
-                        target->ToGameObject()->SetRespawnTime(e.action.RespawnTarget.goRespawnTime);
+                        target->ToGameObject()->SetRespawnTime(e.data->action.RespawnTarget.goRespawnTime);
                 }
             }
             break;
@@ -1947,7 +1958,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (Creature* npc = target->ToCreature())
                 {
                     std::array<uint32, MAX_EQUIPMENT_ITEMS> slot;
-                    if (int8 equipId = static_cast<int8>(e.action.equip.entry))
+                    if (int8 equipId = static_cast<int8>(e.data->action.equip.entry))
                     {
                         EquipmentInfo const* eInfo = sObjectMgr->GetEquipmentInfo(npc->GetEntry(), equipId);
                         if (!eInfo)
@@ -1961,10 +1972,10 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                         std::copy(std::begin(eInfo->ItemEntry), std::end(eInfo->ItemEntry), std::begin(slot));
                     }
                     else
-                        std::copy(std::begin(e.action.equip.slots), std::end(e.action.equip.slots), std::begin(slot));
+                        std::copy(std::begin(e.data->action.equip.slots), std::end(e.data->action.equip.slots), std::begin(slot));
 
                     for (uint32 i = 0; i < MAX_EQUIPMENT_ITEMS; ++i)
-                        if (!e.action.equip.mask || (e.action.equip.mask & (1 << i)))
+                        if (!e.data->action.equip.mask || (e.data->action.equip.mask & (1 << i)))
                             npc->SetUInt32Value(UNIT_VIRTUAL_ITEM_SLOT_ID + i, slot[i]);
                 }
             }
@@ -1974,13 +1985,13 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             SmartEvent ne = SmartEvent();
             ne.type = (SMART_EVENT)SMART_EVENT_UPDATE;
-            ne.event_chance = e.action.timeEvent.chance;
+            ne.event_chance = e.data->action.timeEvent.chance;
             if (!ne.event_chance) ne.event_chance = 100;
 
-            ne.minMaxRepeat.min = e.action.timeEvent.min;
-            ne.minMaxRepeat.max = e.action.timeEvent.max;
-            ne.minMaxRepeat.repeatMin = e.action.timeEvent.repeatMin;
-            ne.minMaxRepeat.repeatMax = e.action.timeEvent.repeatMax;
+            ne.minMaxRepeat.min = e.data->action.timeEvent.min;
+            ne.minMaxRepeat.max = e.data->action.timeEvent.max;
+            ne.minMaxRepeat.repeatMin = e.data->action.timeEvent.repeatMin;
+            ne.minMaxRepeat.repeatMax = e.data->action.timeEvent.repeatMax;
 
             ne.event_flags = 0;
             if (!ne.minMaxRepeat.repeatMin && !ne.minMaxRepeat.repeatMax)
@@ -1988,26 +1999,28 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 
             SmartAction ac = SmartAction();
             ac.type = (SMART_ACTION)SMART_ACTION_TRIGGER_TIMED_EVENT;
-            ac.timeEvent.id = e.action.timeEvent.id;
+            ac.timeEvent.id = e.data->action.timeEvent.id;
 
-            SmartScriptHolder ev = SmartScriptHolder();
-            ev.event = ne;
-            ev.event_id = e.action.timeEvent.id;
-            ev.target = e.target;
-            ev.action = ac;
+            std::shared_ptr<SmartScriptData> data = std::make_shared<SmartScriptData>();
+            data->event = ne;
+            data->event_id = e.data->action.timeEvent.id;
+            data->target = e.data->target;
+            data->action = ac;
+
+            SmartScriptHolder ev(std::move(data));
             InitTimer(ev);
             mStoredEvents.push_back(ev);
             break;
         }
         case SMART_ACTION_TRIGGER_TIMED_EVENT:
-            ProcessEventsFor((SMART_EVENT)SMART_EVENT_TIMED_EVENT_TRIGGERED, nullptr, e.action.timeEvent.id);
+            ProcessEventsFor((SMART_EVENT)SMART_EVENT_TIMED_EVENT_TRIGGERED, nullptr, e.data->action.timeEvent.id);
 
             // xinef: remove this event if not repeatable
-            if (e.event.event_flags & SMART_EVENT_FLAG_NOT_REPEATABLE)
-                mRemIDs.push_back(e.action.timeEvent.id);
+            if (e.data->event.event_flags & SMART_EVENT_FLAG_NOT_REPEATABLE)
+                mRemIDs.push_back(e.data->action.timeEvent.id);
             break;
         case SMART_ACTION_REMOVE_TIMED_EVENT:
-            mRemIDs.push_back(e.action.timeEvent.id);
+            mRemIDs.push_back(e.data->action.timeEvent.id);
             break;
         case SMART_ACTION_OVERRIDE_SCRIPT_BASE_OBJECT:
         {
@@ -2048,8 +2061,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            float attackDistance = float(e.action.setRangedMovement.distance);
-            float attackAngle = float(e.action.setRangedMovement.angle) / 180.0f * float(M_PI);
+            float attackDistance = float(e.data->action.setRangedMovement.distance);
+            float attackAngle = float(e.data->action.setRangedMovement.angle) / 180.0f * float(M_PI);
 
             for (WorldObject* target : targets)
                 if (Creature* creature = target->ToCreature())
@@ -2063,7 +2076,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             if (e.GetTargetType() == SMART_TARGET_NONE)
             {
-                LOG_ERROR("sql.sql", "SmartScript: Entry {} SourceType {} Event {} Action {} is using TARGET_NONE(0) for Script9 target. Please correct target_type in database.", e.entryOrGuid, e.GetScriptType(), e.GetEventType(), e.GetActionType());
+                LOG_ERROR("sql.sql", "SmartScript: Entry {} SourceType {} Event {} Action {} is using TARGET_NONE(0) for Script9 target. Please correct target_type in database.", e.data->entryOrGuid, e.GetScriptType(), e.GetEventType(), e.GetActionType());
                 break;
             }
 
@@ -2072,12 +2085,12 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (Creature* creature = target->ToCreature())
                 {
                     if (IsSmart(creature))
-                        CAST_AI(SmartAI, creature->AI())->SetScript9(e, e.action.timedActionList.id, GetLastInvoker());
+                        CAST_AI(SmartAI, creature->AI())->SetScript9(e, e.data->action.timedActionList.id, GetLastInvoker());
                 }
                 else if (GameObject* go = target->ToGameObject())
                 {
                     if (IsSmart(go))
-                        CAST_AI(SmartGameObjectAI, go->AI())->SetScript9(e, e.action.timedActionList.id, GetLastInvoker());
+                        CAST_AI(SmartGameObjectAI, go->AI())->SetScript9(e, e.data->action.timedActionList.id, GetLastInvoker());
                 }
             }
             break;
@@ -2086,21 +2099,21 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsCreature(target))
-                    target->ToUnit()->ReplaceAllNpcFlags(NPCFlags(e.action.unitFlag.flag));
+                    target->ToUnit()->ReplaceAllNpcFlags(NPCFlags(e.data->action.unitFlag.flag));
             break;
         }
         case SMART_ACTION_ADD_NPC_FLAG:
         {
             for (WorldObject* target : targets)
                 if (IsCreature(target))
-                    target->ToUnit()->SetNpcFlag(NPCFlags(e.action.unitFlag.flag));
+                    target->ToUnit()->SetNpcFlag(NPCFlags(e.data->action.unitFlag.flag));
             break;
         }
         case SMART_ACTION_REMOVE_NPC_FLAG:
         {
             for (WorldObject* target : targets)
                 if (IsCreature(target))
-                    target->ToUnit()->RemoveNpcFlag(NPCFlags(e.action.unitFlag.flag));
+                    target->ToUnit()->RemoveNpcFlag(NPCFlags(e.data->action.unitFlag.flag));
             break;
         }
         case SMART_ACTION_CROSS_CAST:
@@ -2109,7 +2122,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 break;
 
             ObjectVector casters;
-            GetTargets(casters, CreateSmartEvent(SMART_EVENT_UPDATE_IC, 0, 0, 0, 0, 0, 0, 0, SMART_ACTION_NONE, 0, 0, 0, 0, 0, 0, (SMARTAI_TARGETS)e.action.crossCast.targetType, e.action.crossCast.targetParam1, e.action.crossCast.targetParam2, e.action.crossCast.targetParam3, 0, 0), unit);
+            GetTargets(casters, CreateSmartEvent(SMART_EVENT_UPDATE_IC, 0, 0, 0, 0, 0, 0, 0, SMART_ACTION_NONE, 0, 0, 0, 0, 0, 0, (SMARTAI_TARGETS)e.data->action.crossCast.targetType, e.data->action.crossCast.targetParam1, e.data->action.crossCast.targetParam2, e.data->action.crossCast.targetParam3, 0, 0), unit);
 
             for (WorldObject* caster : casters)
             {
@@ -2125,18 +2138,18 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (!IsUnit(target))
                         continue;
 
-                    if (!(e.action.crossCast.flags & SMARTCAST_AURA_NOT_PRESENT) || !target->ToUnit()->HasAura(e.action.crossCast.spell))
+                    if (!(e.data->action.crossCast.flags & SMARTCAST_AURA_NOT_PRESENT) || !target->ToUnit()->HasAura(e.data->action.crossCast.spell))
                     {
-                        if (!interruptedSpell && e.action.crossCast.flags & SMARTCAST_INTERRUPT_PREVIOUS)
+                        if (!interruptedSpell && e.data->action.crossCast.flags & SMARTCAST_INTERRUPT_PREVIOUS)
                         {
                             casterUnit->InterruptNonMeleeSpells(false);
                             interruptedSpell = true;
                         }
 
-                        casterUnit->CastSpell(target->ToUnit(), e.action.crossCast.spell, (e.action.crossCast.flags & SMARTCAST_TRIGGERED) != 0);
+                        casterUnit->CastSpell(target->ToUnit(), e.data->action.crossCast.spell, (e.data->action.crossCast.flags & SMARTCAST_TRIGGERED) != 0);
                     }
                     else
-                        LOG_DEBUG("scripts.ai", "Spell {} not cast because it has flag SMARTCAST_AURA_NOT_PRESENT and the target ({}) already has the aura", e.action.crossCast.spell, target->GetGUID().ToString());
+                        LOG_DEBUG("scripts.ai", "Spell {} not cast because it has flag SMARTCAST_AURA_NOT_PRESENT and the target ({}) already has the aura", e.data->action.crossCast.spell, target->GetGUID().ToString());
                 }
             }
             break;
@@ -2144,13 +2157,13 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         case SMART_ACTION_CALL_RANDOM_TIMED_ACTIONLIST:
         {
             std::vector<uint32> actionLists;
-            std::copy_if(e.action.randTimedActionList.actionLists.begin(), e.action.randTimedActionList.actionLists.end(),
+            std::copy_if(e.data->action.randTimedActionList.actionLists.begin(), e.data->action.randTimedActionList.actionLists.end(),
                          std::back_inserter(actionLists), [](uint32 actionList) { return actionList != 0; });
 
             uint32 id = Acore::Containers::SelectRandomContainerElement(actionLists);
             if (e.GetTargetType() == SMART_TARGET_NONE)
             {
-                LOG_ERROR("sql.sql", "SmartScript: Entry {} SourceType {} Event {} Action {} is using TARGET_NONE(0) for Script9 target. Please correct target_type in database.", e.entryOrGuid, e.GetScriptType(), e.GetEventType(), e.GetActionType());
+                LOG_ERROR("sql.sql", "SmartScript: Entry {} SourceType {} Event {} Action {} is using TARGET_NONE(0) for Script9 target. Please correct target_type in database.", e.data->entryOrGuid, e.GetScriptType(), e.GetEventType(), e.GetActionType());
                 break;
             }
 
@@ -2171,10 +2184,10 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         }
         case SMART_ACTION_CALL_RANDOM_RANGE_TIMED_ACTIONLIST:
         {
-            uint32 id = urand(e.action.randTimedActionList.actionLists[0], e.action.randTimedActionList.actionLists[1]);
+            uint32 id = urand(e.data->action.randTimedActionList.actionLists[0], e.data->action.randTimedActionList.actionLists[1]);
             if (e.GetTargetType() == SMART_TARGET_NONE)
             {
-                LOG_ERROR("sql.sql", "SmartScript: Entry {} SourceType {} Event {} Action {} is using TARGET_NONE(0) for Script9 target. Please correct target_type in database.", e.entryOrGuid, e.GetScriptType(), e.GetEventType(), e.GetActionType());
+                LOG_ERROR("sql.sql", "SmartScript: Entry {} SourceType {} Event {} Action {} is using TARGET_NONE(0) for Script9 target. Please correct target_type in database.", e.data->entryOrGuid, e.GetScriptType(), e.GetEventType(), e.GetActionType());
                 break;
             }
 
@@ -2197,7 +2210,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsPlayer(target))
-                    target->ToPlayer()->ActivateTaxiPathTo(e.action.taxi.id);
+                    target->ToPlayer()->ActivateTaxiPathTo(e.data->action.taxi.id);
             break;
         }
         case SMART_ACTION_RANDOM_MOVE:
@@ -2210,8 +2223,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 {
                     foundTarget = true;
 
-                    if (e.action.moveRandom.distance)
-                        target->ToCreature()->GetMotionMaster()->MoveRandom(float(e.action.moveRandom.distance));
+                    if (e.data->action.moveRandom.distance)
+                        target->ToCreature()->GetMotionMaster()->MoveRandom(float(e.data->action.moveRandom.distance));
                     else
                         target->ToCreature()->GetMotionMaster()->MoveIdle();
                 }
@@ -2219,8 +2232,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 
             if (!foundTarget && me && IsCreature(me) && me->IsAlive())
             {
-                if (e.action.moveRandom.distance)
-                    me->GetMotionMaster()->MoveRandom(float(e.action.moveRandom.distance));
+                if (e.data->action.moveRandom.distance)
+                    me->GetMotionMaster()->MoveRandom(float(e.data->action.moveRandom.distance));
                 else
                     me->GetMotionMaster()->MoveIdle();
             }
@@ -2230,49 +2243,49 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->SetByteFlag(UNIT_FIELD_BYTES_1, e.action.setunitByte.type, e.action.setunitByte.byte1);
+                    target->ToUnit()->SetByteFlag(UNIT_FIELD_BYTES_1, e.data->action.setunitByte.type, e.data->action.setunitByte.byte1);
             break;
         }
         case SMART_ACTION_REMOVE_UNIT_FIELD_BYTES_1:
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->RemoveByteFlag(UNIT_FIELD_BYTES_1, e.action.delunitByte.type, e.action.delunitByte.byte1);
+                    target->ToUnit()->RemoveByteFlag(UNIT_FIELD_BYTES_1, e.data->action.delunitByte.type, e.data->action.delunitByte.byte1);
             break;
         }
         case SMART_ACTION_INTERRUPT_SPELL:
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->InterruptNonMeleeSpells(e.action.interruptSpellCasting.withDelayed != 0, e.action.interruptSpellCasting.spell_id, e.action.interruptSpellCasting.withInstant != 0);
+                    target->ToUnit()->InterruptNonMeleeSpells(e.data->action.interruptSpellCasting.withDelayed != 0, e.data->action.interruptSpellCasting.spell_id, e.data->action.interruptSpellCasting.withInstant != 0);
             break;
         }
         case SMART_ACTION_SEND_GO_CUSTOM_ANIM:
         {
             for (WorldObject* target : targets)
                 if (IsGameObject(target))
-                    target->ToGameObject()->SendCustomAnim(e.action.sendGoCustomAnim.anim);
+                    target->ToGameObject()->SendCustomAnim(e.data->action.sendGoCustomAnim.anim);
             break;
         }
         case SMART_ACTION_SET_DYNAMIC_FLAG:
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->SetUInt32Value(UNIT_DYNAMIC_FLAGS, e.action.unitFlag.flag);
+                    target->ToUnit()->SetUInt32Value(UNIT_DYNAMIC_FLAGS, e.data->action.unitFlag.flag);
             break;
         }
         case SMART_ACTION_ADD_DYNAMIC_FLAG:
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->SetFlag(UNIT_DYNAMIC_FLAGS, e.action.unitFlag.flag);
+                    target->ToUnit()->SetFlag(UNIT_DYNAMIC_FLAGS, e.data->action.unitFlag.flag);
             break;
         }
         case SMART_ACTION_REMOVE_DYNAMIC_FLAG:
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->RemoveFlag(UNIT_DYNAMIC_FLAGS, e.action.unitFlag.flag);
+                    target->ToUnit()->RemoveFlag(UNIT_DYNAMIC_FLAGS, e.data->action.unitFlag.flag);
             break;
         }
         case SMART_ACTION_JUMP_TO_POS:
@@ -2281,10 +2294,10 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (me)
                 {
-                    float range = (float)e.target.randomPoint.range;
-                    Position srcPos = { e.target.x, e.target.y, e.target.z, e.target.o };
+                    float range = (float)e.data->target.randomPoint.range;
+                    Position srcPos = { e.data->target.x, e.data->target.y, e.data->target.z, e.data->target.o };
                     Position randomPoint = me->GetRandomPoint(srcPos, range);
-                    me->GetMotionMaster()->MoveJump(randomPoint, (float)e.action.jump.speedxy, (float)e.action.jump.speedz);
+                    me->GetMotionMaster()->MoveJump(randomPoint, (float)e.data->action.jump.speedxy, (float)e.data->action.jump.speedz);
                 }
 
                 break;
@@ -2294,11 +2307,11 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 break;
 
             // xinef: my implementation
-            if (e.action.jump.selfJump)
+            if (e.data->action.jump.selfJump)
             {
                 if (WorldObject* target = Acore::Containers::SelectRandomContainerElement(targets))
                     if (me)
-                        me->GetMotionMaster()->MoveJump(target->GetPositionX() + e.target.x, target->GetPositionY() + e.target.y, target->GetPositionZ() + e.target.z, (float)e.action.jump.speedxy, (float)e.action.jump.speedz);
+                        me->GetMotionMaster()->MoveJump(target->GetPositionX() + e.data->target.x, target->GetPositionY() + e.data->target.y, target->GetPositionZ() + e.data->target.z, (float)e.data->action.jump.speedxy, (float)e.data->action.jump.speedz);
             }
             else
             {
@@ -2306,7 +2319,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (WorldObject* obj = (target))
                     {
                         if (Creature* creature = obj->ToCreature())
-                            creature->GetMotionMaster()->MoveJump(e.target.x, e.target.y, e.target.z, (float)e.action.jump.speedxy, (float)e.action.jump.speedz);
+                            creature->GetMotionMaster()->MoveJump(e.data->target.x, e.data->target.y, e.data->target.z, (float)e.data->action.jump.speedxy, (float)e.data->action.jump.speedz);
                     }
             }
 
@@ -2316,14 +2329,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsGameObject(target))
-                    target->ToGameObject()->SetLootState((LootState)e.action.setGoLootState.state);
+                    target->ToGameObject()->SetLootState((LootState)e.data->action.setGoLootState.state);
             break;
         }
         case SMART_ACTION_GO_SET_GO_STATE:
         {
             for (WorldObject* target : targets)
                 if (IsGameObject(target))
-                    target->ToGameObject()->SetGoState((GOState)e.action.goState.state);
+                    target->ToGameObject()->SetGoState((GOState)e.data->action.goState.state);
             break;
         }
         case SMART_ACTION_SEND_TARGET_TO_TARGET:
@@ -2336,7 +2349,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!ref)
                 break;
 
-            ObjectVector const* storedTargets = GetStoredTargetVector(e.action.sendTargetToTarget.id, *ref);
+            ObjectVector const* storedTargets = GetStoredTargetVector(e.data->action.sendTargetToTarget.id, *ref);
             if (!storedTargets)
                 break;
 
@@ -2345,14 +2358,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (IsCreature(target))
                 {
                     if (SmartAI* ai = CAST_AI(SmartAI, target->ToCreature()->AI()))
-                        ai->GetScript()->StoreTargetList(ObjectVector(*storedTargets), e.action.sendTargetToTarget.id);   // store a copy of target list
+                        ai->GetScript()->StoreTargetList(ObjectVector(*storedTargets), e.data->action.sendTargetToTarget.id);   // store a copy of target list
                     else
                         LOG_ERROR("sql.sql", "SmartScript: Action target for SMART_ACTION_SEND_TARGET_TO_TARGET is not using SmartAI, skipping");
                 }
                 else if (IsGameObject(target))
                 {
                     if (SmartGameObjectAI* ai = CAST_AI(SmartGameObjectAI, target->ToGameObject()->AI()))
-                        ai->GetScript()->StoreTargetList(ObjectVector(*storedTargets), e.action.sendTargetToTarget.id);   // store a copy of target list
+                        ai->GetScript()->StoreTargetList(ObjectVector(*storedTargets), e.data->action.sendTargetToTarget.id);   // store a copy of target list
                     else
                         LOG_ERROR("sql.sql", "SmartScript: Action target for SMART_ACTION_SEND_TARGET_TO_TARGET is not using SmartGameObjectAI, skipping");
                 }
@@ -2365,17 +2378,17 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 break;
 
             LOG_DEBUG("sql.sql", "SmartScript::ProcessAction:: SMART_ACTION_SEND_GOSSIP_MENU: gossipMenuId {}, gossipNpcTextId {}",
-                      e.action.sendGossipMenu.gossipMenuId, e.action.sendGossipMenu.gossipNpcTextId);
+                      e.data->action.sendGossipMenu.gossipMenuId, e.data->action.sendGossipMenu.gossipNpcTextId);
 
             for (WorldObject* target : targets)
                 if (Player* player = target->ToPlayer())
                 {
-                    if (e.action.sendGossipMenu.gossipMenuId)
-                        player->PrepareGossipMenu(GetBaseObject(), e.action.sendGossipMenu.gossipMenuId, true);
+                    if (e.data->action.sendGossipMenu.gossipMenuId)
+                        player->PrepareGossipMenu(GetBaseObject(), e.data->action.sendGossipMenu.gossipMenuId, true);
                     else
                         ClearGossipMenuFor(player);
 
-                    SendGossipMenuFor(player, e.action.sendGossipMenu.gossipNpcTextId, GetBaseObject()->GetGUID());
+                    SendGossipMenuFor(player, e.data->action.sendGossipMenu.gossipNpcTextId, GetBaseObject()->GetGUID());
                 }
 
             break;
@@ -2388,7 +2401,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 for (WorldObject* target : targets)
                     if (IsCreature(target))
                     {
-                        if (e.action.setHomePos.spawnPos)
+                        if (e.data->action.setHomePos.spawnPos)
                         {
                             target->ToCreature()->GetRespawnPosition(x, y, z, &o);
                             target->ToCreature()->SetHomePosition(x, y, z, o);
@@ -2399,14 +2412,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             }
             else if (me && e.GetTargetType() == SMART_TARGET_POSITION)
             {
-                if (e.action.setHomePos.spawnPos)
+                if (e.data->action.setHomePos.spawnPos)
                 {
                     float x, y, z, o;
                     me->GetRespawnPosition(x, y, z, &o);
                     me->SetHomePosition(x, y, z, o);
                 }
                 else
-                    me->SetHomePosition(e.target.x, e.target.y, e.target.z, e.target.o);
+                    me->SetHomePosition(e.data->target.x, e.data->target.y, e.data->target.z, e.data->target.o);
             }
             break;
         }
@@ -2414,7 +2427,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsCreature(target))
-                    target->ToCreature()->SetRegeneratingHealth(e.action.setHealthRegen.regenHealth);
+                    target->ToCreature()->SetRegeneratingHealth(e.data->action.setHealthRegen.regenHealth);
 
             break;
         }
@@ -2422,40 +2435,40 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsCreature(target))
-                    target->ToCreature()->SetControlled(e.action.setRoot.root != 0, UNIT_STATE_ROOT);
+                    target->ToCreature()->SetControlled(e.data->action.setRoot.root != 0, UNIT_STATE_ROOT);
             break;
         }
         case SMART_ACTION_SET_GO_FLAG:
         {
             for (WorldObject* target : targets)
                 if (IsGameObject(target))
-                    target->ToGameObject()->SetUInt32Value(GAMEOBJECT_FLAGS, e.action.goFlag.flag);
+                    target->ToGameObject()->SetUInt32Value(GAMEOBJECT_FLAGS, e.data->action.goFlag.flag);
             break;
         }
         case SMART_ACTION_ADD_GO_FLAG:
         {
             for (WorldObject* target : targets)
                 if (IsGameObject(target))
-                    target->ToGameObject()->SetFlag(GAMEOBJECT_FLAGS, e.action.goFlag.flag);
+                    target->ToGameObject()->SetFlag(GAMEOBJECT_FLAGS, e.data->action.goFlag.flag);
             break;
         }
         case SMART_ACTION_REMOVE_GO_FLAG:
         {
             for (WorldObject* target : targets)
                 if (IsGameObject(target))
-                    target->ToGameObject()->RemoveFlag(GAMEOBJECT_FLAGS, e.action.goFlag.flag);
+                    target->ToGameObject()->RemoveFlag(GAMEOBJECT_FLAGS, e.data->action.goFlag.flag);
             break;
         }
     case SMART_ACTION_SUMMON_CREATURE_GROUP:
         {
             std::list<TempSummon*> summonList;
-            GetBaseObject()->SummonCreatureGroup(e.action.creatureGroup.group, &summonList);
+            GetBaseObject()->SummonCreatureGroup(e.data->action.creatureGroup.group, &summonList);
 
             for (std::list<TempSummon*>::const_iterator itr = summonList.begin(); itr != summonList.end(); ++itr)
             {
-                if (unit && e.action.creatureGroup.attackInvoker)
+                if (unit && e.data->action.creatureGroup.attackInvoker)
                     (*itr)->AI()->AttackStart(unit);
-                else if (me && e.action.creatureGroup.attackScriptOwner)
+                else if (me && e.data->action.creatureGroup.attackScriptOwner)
                     (*itr)->AI()->AttackStart(me);
             }
 
@@ -2465,26 +2478,26 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->SetPower(Powers(e.action.power.powerType), e.action.power.newPower);
+                    target->ToUnit()->SetPower(Powers(e.data->action.power.powerType), e.data->action.power.newPower);
             break;
         }
         case SMART_ACTION_ADD_POWER:
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->SetPower(Powers(e.action.power.powerType), target->ToUnit()->GetPower(Powers(e.action.power.powerType)) + e.action.power.newPower);
+                    target->ToUnit()->SetPower(Powers(e.data->action.power.powerType), target->ToUnit()->GetPower(Powers(e.data->action.power.powerType)) + e.data->action.power.newPower);
             break;
         }
         case SMART_ACTION_REMOVE_POWER:
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->SetPower(Powers(e.action.power.powerType), target->ToUnit()->GetPower(Powers(e.action.power.powerType)) - e.action.power.newPower);
+                    target->ToUnit()->SetPower(Powers(e.data->action.power.powerType), target->ToUnit()->GetPower(Powers(e.data->action.power.powerType)) - e.data->action.power.newPower);
             break;
         }
         case SMART_ACTION_GAME_EVENT_STOP:
         {
-            uint32 eventId = e.action.gameEventStop.id;
+            uint32 eventId = e.data->action.gameEventStop.id;
             if (!sGameEventMgr->IsActiveEvent(eventId))
             {
                 LOG_ERROR("scripts.ai.sai", "SmartScript::ProcessAction: At case SMART_ACTION_GAME_EVENT_STOP, inactive event (id: {})", eventId);
@@ -2495,7 +2508,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         }
         case SMART_ACTION_GAME_EVENT_START:
         {
-            uint32 eventId = e.action.gameEventStart.id;
+            uint32 eventId = e.data->action.gameEventStart.id;
             if (sGameEventMgr->IsActiveEvent(eventId))
             {
                 LOG_ERROR("scripts.ai.sai", "SmartScript::ProcessAction: At case SMART_ACTION_GAME_EVENT_START, already activated event (id: {})", eventId);
@@ -2515,7 +2528,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 {
                     if (IsSmart(creature))
                     {
-                        for (uint32 wp = e.action.startClosestWaypoint.pathId1; wp <= e.action.startClosestWaypoint.pathId2; ++wp)
+                        for (uint32 wp = e.data->action.startClosestWaypoint.pathId1; wp <= e.data->action.startClosestWaypoint.pathId2; ++wp)
                         {
                             WPPath* path = sSmartWaypointMgr->GetPath(wp);
                             if (!path || path->empty())
@@ -2538,8 +2551,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 
                         if (closestWpId)
                         {
-                            bool repeat = e.action.startClosestWaypoint.repeat;
-                            bool run = e.action.startClosestWaypoint.run;
+                            bool repeat = e.data->action.startClosestWaypoint.repeat;
+                            bool run = e.data->action.startClosestWaypoint.run;
 
                             CAST_AI(SmartAI, creature->AI())->StartPath(repeat, closestWpId, run);
                         }
@@ -2561,7 +2574,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             for (WorldObject* target : targets)
                 if (IsUnit(target))
                 {
-                    target->ToUnit()->SetUnitMovementFlags(e.action.movementFlag.flag);
+                    target->ToUnit()->SetUnitMovementFlags(e.data->action.movementFlag.flag);
                     target->ToUnit()->SendMovementFlagUpdate();
                 }
 
@@ -2571,7 +2584,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsCreature(target))
-                    target->ToCreature()->m_CombatDistance = e.action.combatDistance.dist;
+                    target->ToCreature()->m_CombatDistance = e.data->action.combatDistance.dist;
 
             break;
         }
@@ -2579,33 +2592,33 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* const target : targets)
                 if (IsCreature(target))
-                    target->ToCreature()->m_SightDistance = e.action.sightDistance.dist;
+                    target->ToCreature()->m_SightDistance = e.data->action.sightDistance.dist;
             break;
         }
         case SMART_ACTION_FLEE:
         {
             for (WorldObject* const target : targets)
                 if (IsCreature(target))
-                    target->ToCreature()->GetMotionMaster()->MoveFleeing(me, e.action.flee.withEmote);
+                    target->ToCreature()->GetMotionMaster()->MoveFleeing(me, e.data->action.flee.withEmote);
             break;
         }
         case SMART_ACTION_ADD_THREAT:
         {
             for (WorldObject* const target : targets)
                 if (IsUnit(target))
-                    me->AddThreat(target->ToUnit(), float(e.action.threatPCT.threatINC) - float(e.action.threatPCT.threatDEC));
+                    me->AddThreat(target->ToUnit(), float(e.data->action.threatPCT.threatINC) - float(e.data->action.threatPCT.threatDEC));
             break;
         }
         case SMART_ACTION_LOAD_EQUIPMENT:
         {
             for (WorldObject* const target : targets)
                 if (IsCreature(target))
-                    target->ToCreature()->LoadEquipment(e.action.loadEquipment.id, e.action.loadEquipment.force != 0);
+                    target->ToCreature()->LoadEquipment(e.data->action.loadEquipment.id, e.data->action.loadEquipment.force != 0);
             break;
         }
         case SMART_ACTION_TRIGGER_RANDOM_TIMED_EVENT:
         {
-            uint32 eventId = urand(e.action.randomTimedEvent.minId, e.action.randomTimedEvent.maxId);
+            uint32 eventId = urand(e.data->action.randomTimedEvent.minId, e.data->action.randomTimedEvent.maxId);
             ProcessEventsFor((SMART_EVENT)SMART_EVENT_TIMED_EVENT_TRIGGERED, nullptr, eventId);
             break;
         }
@@ -2620,14 +2633,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->SetHover(e.action.setHover.state);
+                    target->ToUnit()->SetHover(e.data->action.setHover.state);
             break;
         }
         case SMART_ACTION_ADD_IMMUNITY:
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->ApplySpellImmune(e.action.immunity.id, e.action.immunity.type, e.action.immunity.value, true);
+                    target->ToUnit()->ApplySpellImmune(e.data->action.immunity.id, e.data->action.immunity.type, e.data->action.immunity.value, true);
 
             break;
         }
@@ -2635,7 +2648,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->ApplySpellImmune(e.action.immunity.id, e.action.immunity.type, e.action.immunity.value, false);
+                    target->ToUnit()->ApplySpellImmune(e.data->action.immunity.id, e.data->action.immunity.type, e.data->action.immunity.value, false);
             break;
         }
         case SMART_ACTION_FALL:
@@ -2648,7 +2661,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         }
         case SMART_ACTION_SET_EVENT_FLAG_RESET:
         {
-            SetPhaseReset(e.action.setActive.state);
+            SetPhaseReset(e.data->action.setActive.state);
             break;
         }
         case SMART_ACTION_REMOVE_ALL_GAMEOBJECTS:
@@ -2664,9 +2677,9 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    if (e.action.stopMotion.stopMovement)
+                    if (e.data->action.stopMotion.stopMovement)
                         target->ToUnit()->StopMoving();
-                    if (e.action.stopMotion.movementExpired)
+                    if (e.data->action.stopMotion.movementExpired)
                         target->ToUnit()->GetMotionMaster()->MovementExpired();
                 }
             }
@@ -2695,17 +2708,17 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         case SMART_ACTION_LOAD_GRID:
         {
             if (me && me->FindMap())
-                me->FindMap()->LoadGrid(e.target.x, e.target.y);
+                me->FindMap()->LoadGrid(e.data->target.x, e.data->target.y);
             break;
         }
         case SMART_ACTION_PLAYER_TALK:
         {
-            std::string text = sObjectMgr->GetAcoreString(e.action.playerTalk.textId, DEFAULT_LOCALE);
+            std::string text = sObjectMgr->GetAcoreString(e.data->action.playerTalk.textId, DEFAULT_LOCALE);
 
             if (!targets.empty())
                 for (WorldObject* target : targets)
                     if (IsPlayer(target))
-                        !e.action.playerTalk.flag ? target->ToPlayer()->Say(text, LANG_UNIVERSAL) : target->ToPlayer()->Yell(text, LANG_UNIVERSAL);
+                        !e.data->action.playerTalk.flag ? target->ToPlayer()->Say(text, LANG_UNIVERSAL) : target->ToPlayer()->Yell(text, LANG_UNIVERSAL);
 
             break;
         }
@@ -2718,18 +2731,18 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    if (e.action.castCustom.flags & SMARTCAST_INTERRUPT_PREVIOUS)
+                    if (e.data->action.castCustom.flags & SMARTCAST_INTERRUPT_PREVIOUS)
                     {
                         me->InterruptNonMeleeSpells(false);
                     }
 
-                    if (e.action.castCustom.flags & SMARTCAST_COMBAT_MOVE)
+                    if (e.data->action.castCustom.flags & SMARTCAST_COMBAT_MOVE)
                     {
                         // If cast flag SMARTCAST_COMBAT_MOVE is set combat movement will not be allowed
                         // unless target is outside spell range, out of mana, or LOS.
 
                         bool _allowMove = false;
-                        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(e.action.castCustom.spell); // AssertSpellInfo?
+                        SpellInfo const* spellInfo = sSpellMgr->GetSpellInfo(e.data->action.castCustom.spell); // AssertSpellInfo?
                         int32 mana = me->GetPower(POWER_MANA);
 
                         if (me->GetDistance(target->ToUnit()) > spellInfo->GetMaxRange(true) ||
@@ -2741,16 +2754,16 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                         CAST_AI(SmartAI, me->AI())->SetCombatMove(_allowMove);
                     }
 
-                    if (!(e.action.castCustom.flags & SMARTCAST_AURA_NOT_PRESENT) || !target->ToUnit()->HasAura(e.action.castCustom.spell))
+                    if (!(e.data->action.castCustom.flags & SMARTCAST_AURA_NOT_PRESENT) || !target->ToUnit()->HasAura(e.data->action.castCustom.spell))
                     {
                         CustomSpellValues values;
-                        if (e.action.castCustom.bp1)
-                            values.AddSpellMod(SPELLVALUE_BASE_POINT0, e.action.castCustom.bp1);
-                        if (e.action.castCustom.bp2)
-                            values.AddSpellMod(SPELLVALUE_BASE_POINT1, e.action.castCustom.bp2);
-                        if (e.action.castCustom.bp3)
-                            values.AddSpellMod(SPELLVALUE_BASE_POINT2, e.action.castCustom.bp3);
-                        me->CastCustomSpell(e.action.castCustom.spell, values, target->ToUnit(), (e.action.castCustom.flags & SMARTCAST_TRIGGERED) ? TRIGGERED_FULL_MASK : TRIGGERED_NONE);
+                        if (e.data->action.castCustom.bp1)
+                            values.AddSpellMod(SPELLVALUE_BASE_POINT0, e.data->action.castCustom.bp1);
+                        if (e.data->action.castCustom.bp2)
+                            values.AddSpellMod(SPELLVALUE_BASE_POINT1, e.data->action.castCustom.bp2);
+                        if (e.data->action.castCustom.bp3)
+                            values.AddSpellMod(SPELLVALUE_BASE_POINT2, e.data->action.castCustom.bp3);
+                        me->CastCustomSpell(e.data->action.castCustom.spell, values, target->ToUnit(), (e.data->action.castCustom.flags & SMARTCAST_TRIGGERED) ? TRIGGERED_FULL_MASK : TRIGGERED_NONE);
                     }
                 }
             }
@@ -2764,12 +2777,12 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (targets.empty())
                 break;
 
-            TempSummonType summon_type = (e.action.summonVortex.summonDuration > 0) ? TEMPSUMMON_TIMED_DESPAWN : TEMPSUMMON_CORPSE_DESPAWN;
+            TempSummonType summon_type = (e.data->action.summonVortex.summonDuration > 0) ? TEMPSUMMON_TIMED_DESPAWN : TEMPSUMMON_CORPSE_DESPAWN;
 
-            float a = static_cast<float>(e.action.summonVortex.a);
-            float k = static_cast<float>(e.action.summonVortex.k) / 1000.0f;
-            float r_max = static_cast<float>(e.action.summonVortex.r_max);
-            float delta_phi = M_PI * static_cast<float>(e.action.summonVortex.phi_delta) / 180.0f;
+            float a = static_cast<float>(e.data->action.summonVortex.a);
+            float k = static_cast<float>(e.data->action.summonVortex.k) / 1000.0f;
+            float r_max = static_cast<float>(e.data->action.summonVortex.r_max);
+            float delta_phi = M_PI * static_cast<float>(e.data->action.summonVortex.phi_delta) / 180.0f;
 
             // r(phi) = a * e ^ (k * phi)
             // r(phi + delta_phi) = a * e ^ (k * (phi + delta_phi))
@@ -2791,7 +2804,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     Position summonPosition(*target);
                     summonPosition.RelocatePolarOffset(phi, summonRadius);
 
-                    me->SummonCreature(e.action.summonVortex.summonEntry, summonPosition, summon_type, e.action.summonVortex.summonDuration);
+                    me->SummonCreature(e.data->action.summonVortex.summonEntry, summonPosition, summon_type, e.data->action.summonVortex.summonDuration);
 
                     phi += delta_phi;
                     summonRadius *= factor;
@@ -2805,12 +2818,12 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!me)
                 break;
 
-            TempSummonType spawnType = (e.action.coneSummon.summonDuration > 0) ? TEMPSUMMON_TIMED_DESPAWN : TEMPSUMMON_CORPSE_DESPAWN;
+            TempSummonType spawnType = (e.data->action.coneSummon.summonDuration > 0) ? TEMPSUMMON_TIMED_DESPAWN : TEMPSUMMON_CORPSE_DESPAWN;
 
-            float distInARow = static_cast<float>(e.action.coneSummon.distanceBetweenSummons);
-            float coneAngle = static_cast<float>(e.action.coneSummon.coneAngle) * M_PI / 180.0f;
+            float distInARow = static_cast<float>(e.data->action.coneSummon.distanceBetweenSummons);
+            float coneAngle = static_cast<float>(e.data->action.coneSummon.coneAngle) * M_PI / 180.0f;
 
-            for (uint32 radius = 0; radius <= e.action.coneSummon.coneLength; radius += e.action.coneSummon.distanceBetweenRings)
+            for (uint32 radius = 0; radius <= e.data->action.coneSummon.coneLength; radius += e.data->action.coneSummon.distanceBetweenRings)
             {
                 float deltaAngle = 0.0f;
                 if (radius > 0)
@@ -2823,7 +2836,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 float currentAngle = -static_cast<float>(count) * deltaAngle / 2.0f;
 
                 if (e.GetTargetType() == SMART_TARGET_SELF || e.GetTargetType() == SMART_TARGET_NONE)
-                    currentAngle += G3D::fuzzyGt(e.target.o, 0.0f) ? (e.target.o - me->GetOrientation()) : 0.0f;
+                    currentAngle += G3D::fuzzyGt(e.data->target.o, 0.0f) ? (e.data->target.o - me->GetOrientation()) : 0.0f;
                 else if (!targets.empty())
                 {
                     currentAngle += (me->GetAngle(targets.front()) - me->GetOrientation());
@@ -2835,7 +2848,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     spawnPosition.RelocatePolarOffset(currentAngle, radius);
                     currentAngle += deltaAngle;
 
-                    me->SummonCreature(e.action.coneSummon.summonEntry, spawnPosition, spawnType, e.action.coneSummon.summonDuration);
+                    me->SummonCreature(e.data->action.coneSummon.summonEntry, spawnPosition, spawnType, e.data->action.coneSummon.summonDuration);
                 }
             }
 
@@ -2859,8 +2872,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         }
         case SMART_ACTION_DO_ACTION:
         {
-            int32 const actionId = e.action.doAction.isNegative ? -e.action.doAction.actionId : e.action.doAction.actionId;
-            if (!e.action.doAction.instanceTarget)
+            int32 const actionId = e.data->action.doAction.isNegative ? -e.data->action.doAction.actionId : e.data->action.doAction.actionId;
+            if (!e.data->action.doAction.instanceTarget)
             {
                 if (targets.empty())
                     break;
@@ -2906,7 +2919,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!IsSmart())
                 break;
 
-            CAST_AI(SmartAI, me->AI())->SetEvadeDisabled(e.action.disableEvade.disable != 0);
+            CAST_AI(SmartAI, me->AI())->SetEvadeDisabled(e.data->action.disableEvade.disable != 0);
             break;
         }
         case SMART_ACTION_SET_CORPSE_DELAY:
@@ -2914,7 +2927,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             for (WorldObject* const target : targets)
             {
                 if (IsCreature(target))
-                    target->ToCreature()->SetCorpseDelay(e.action.corpseDelay.timer);
+                    target->ToCreature()->SetCorpseDelay(e.data->action.corpseDelay.timer);
             }
             break;
         }
@@ -2922,18 +2935,18 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (Unit* targetUnit = target->ToUnit())
-                    targetUnit->SetHealth(targetUnit->CountPctFromMaxHealth(e.action.setHealthPct.percent));
+                    targetUnit->SetHealth(targetUnit->CountPctFromMaxHealth(e.data->action.setHealthPct.percent));
             break;
         }
         case SMART_ACTION_SET_MOVEMENT_SPEED:
         {
-            uint32 speedInteger = e.action.movementSpeed.speedInteger;
-            uint32 speedFraction = e.action.movementSpeed.speedFraction;
+            uint32 speedInteger = e.data->action.movementSpeed.speedInteger;
+            uint32 speedFraction = e.data->action.movementSpeed.speedFraction;
             float speed = float(speedInteger) + float(speedFraction) / std::pow(10, std::floor(std::log10(float(speedFraction ? speedFraction : 1)) + 1));
 
             for (WorldObject* target : targets)
                 if (IsCreature(target))
-                    target->ToCreature()->SetSpeed(UnitMoveType(e.action.movementSpeed.movementType), speed);
+                    target->ToCreature()->SetSpeed(UnitMoveType(e.data->action.movementSpeed.movementType), speed);
 
             break;
         }
@@ -2944,7 +2957,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 if (!IsPlayer(target))
                     continue;
 
-                target->ToPlayer()->SendCinematicStart(e.action.cinematic.entry);
+                target->ToPlayer()->SendCinematicStart(e.data->action.cinematic.entry);
             }
             break;
         }
@@ -2954,7 +2967,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 ObjectGuid guidToSend = me ? me->GetGUID() : go->GetGUID();
 
-                if (e.action.setGuid.invokerGUID)
+                if (e.data->action.setGuid.invokerGUID)
                 {
                     if (WorldObject* invoker = GetLastInvoker())
                     {
@@ -2964,11 +2977,11 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 
                 if (Creature* creature = target->ToCreature())
                 {
-                    creature->AI()->SetGUID(guidToSend, e.action.setGuid.index);
+                    creature->AI()->SetGUID(guidToSend, e.data->action.setGuid.index);
                 }
                 else if (GameObject* object = target->ToGameObject())
                 {
-                    object->AI()->SetGUID(guidToSend, e.action.setGuid.index);
+                    object->AI()->SetGUID(guidToSend, e.data->action.setGuid.index);
                 }
             }
             break;
@@ -2976,7 +2989,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         case SMART_ACTION_SCRIPTED_SPAWN:
         {
             // Enable Scripted Spawns
-            switch (e.action.scriptSpawn.state)
+            switch (e.data->action.scriptSpawn.state)
             {
             case 0: // Disable Respawn
             {
@@ -2985,7 +2998,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                     if (Creature* c = target->ToCreature())
                     {
                         CAST_AI(SmartAI, c->AI())->SetCanRespawn(false);
-                        if (!e.action.scriptSpawn.dontDespawn)
+                        if (!e.data->action.scriptSpawn.dontDespawn)
                             c->DespawnOrUnsummon();
                     }
                 }
@@ -3013,18 +3026,18 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                         CAST_AI(SmartAI, c->AI())->SetCanRespawn(true);
 
                         // If 0, respawn immediately
-                        if (e.action.scriptSpawn.spawnTimerMax)
-                            c->SetRespawnTime(urand(e.action.scriptSpawn.spawnTimerMin, e.action.scriptSpawn.spawnTimerMax));
+                        if (e.data->action.scriptSpawn.spawnTimerMax)
+                            c->SetRespawnTime(urand(e.data->action.scriptSpawn.spawnTimerMin, e.data->action.scriptSpawn.spawnTimerMax));
                         else
                             c->Respawn(true);
 
                         // If 0, use DB values
-                        if (e.action.scriptSpawn.respawnDelay)
-                            c->SetRespawnDelay(e.action.scriptSpawn.respawnDelay);
+                        if (e.data->action.scriptSpawn.respawnDelay)
+                            c->SetRespawnDelay(e.data->action.scriptSpawn.respawnDelay);
 
                         // If 0, use default
-                        if (e.action.scriptSpawn.corpseDelay)
-                            c->SetCorpseDelay(e.action.scriptSpawn.corpseDelay);
+                        if (e.data->action.scriptSpawn.corpseDelay)
+                            c->SetCorpseDelay(e.data->action.scriptSpawn.corpseDelay);
                     }
                 }
                 break;
@@ -3036,7 +3049,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         }
         case SMART_ACTION_SET_SCALE:
         {
-            float scale = static_cast<float>(e.action.setScale.scale) / 100.0f;
+            float scale = static_cast<float>(e.data->action.setScale.scale) / 100.0f;
 
             for (WorldObject* target : targets)
             {
@@ -3052,26 +3065,26 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             if (!me)
                 break;
 
-            TempSummonType spawnType = (e.action.radialSummon.summonDuration > 0) ? TEMPSUMMON_TIMED_DESPAWN : TEMPSUMMON_CORPSE_DESPAWN;
+            TempSummonType spawnType = (e.data->action.radialSummon.summonDuration > 0) ? TEMPSUMMON_TIMED_DESPAWN : TEMPSUMMON_CORPSE_DESPAWN;
 
-            float startAngle = me->GetOrientation() + (static_cast<float>(e.action.radialSummon.startAngle) * M_PI / 180.0f);
-            float stepAngle = static_cast<float>(e.action.radialSummon.stepAngle) * M_PI / 180.0f;
+            float startAngle = me->GetOrientation() + (static_cast<float>(e.data->action.radialSummon.startAngle) * M_PI / 180.0f);
+            float stepAngle = static_cast<float>(e.data->action.radialSummon.stepAngle) * M_PI / 180.0f;
 
-            if (e.action.radialSummon.dist)
+            if (e.data->action.radialSummon.dist)
             {
-                for (uint32 itr = 0; itr < e.action.radialSummon.repetitions; itr++)
+                for (uint32 itr = 0; itr < e.data->action.radialSummon.repetitions; itr++)
                 {
                     Position summonPos = me->GetPosition();
-                    summonPos.RelocatePolarOffset(itr * stepAngle, static_cast<float>(e.action.radialSummon.dist));
-                    me->SummonCreature(e.action.radialSummon.summonEntry, summonPos, spawnType, e.action.radialSummon.summonDuration);
+                    summonPos.RelocatePolarOffset(itr * stepAngle, static_cast<float>(e.data->action.radialSummon.dist));
+                    me->SummonCreature(e.data->action.radialSummon.summonEntry, summonPos, spawnType, e.data->action.radialSummon.summonDuration);
                 }
                 break;
             }
 
-            for (uint32 itr = 0; itr < e.action.radialSummon.repetitions; itr++)
+            for (uint32 itr = 0; itr < e.data->action.radialSummon.repetitions; itr++)
             {
                 float currentAngle = startAngle + (itr * stepAngle);
-                me->SummonCreature(e.action.radialSummon.summonEntry, me->GetPositionX(), me->GetPositionY(), me->GetPositionZ(), currentAngle, spawnType, e.action.radialSummon.summonDuration);
+                me->SummonCreature(e.data->action.radialSummon.summonEntry, me->GetPositionX(), me->GetPositionY(), me->GetPositionZ(), currentAngle, spawnType, e.data->action.radialSummon.summonDuration);
             }
 
             break;
@@ -3082,15 +3095,15 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             {
                 if (IsUnit(target))
                 {
-                    if (e.action.spellVisual.visualId)
-                        target->ToUnit()->SendPlaySpellVisual(e.action.spellVisual.visualId);
+                    if (e.data->action.spellVisual.visualId)
+                        target->ToUnit()->SendPlaySpellVisual(e.data->action.spellVisual.visualId);
                 }
             }
             break;
         }
         case SMART_ACTION_FOLLOW_GROUP:
         {
-            if (!e.action.followGroup.followState)
+            if (!e.data->action.followGroup.followState)
             {
                 for (WorldObject* target : targets)
                     if (IsUnit(target))
@@ -3101,8 +3114,8 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
 
             uint8 membCount = targets.size();
             uint8 itr = 1;
-            float dist = float(e.action.followGroup.dist / 100);
-            switch (e.action.followGroup.followType)
+            float dist = float(e.data->action.followGroup.dist / 100);
+            switch (e.data->action.followGroup.followType)
             {
                 case FOLLOW_TYPE_CIRCLE:
                 {
@@ -3185,7 +3198,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         }
         case SMART_ACTION_SET_ORIENTATION_TARGET:
         {
-            switch (e.action.orientationTarget.type)
+            switch (e.data->action.orientationTarget.type)
             {
                 case 0: // Reset
                 {
@@ -3197,7 +3210,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 case 1: // Target target.o
                 {
                     for (WorldObject* target : targets)
-                        target->ToCreature()->SetFacingTo(e.target.o);
+                        target->ToCreature()->SetFacingTo(e.data->target.o);
 
                     break;
                 }
@@ -3211,7 +3224,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
                 case 3: // Target parameters
                 {
                     ObjectVector facingTargets;
-                    GetTargets(facingTargets, CreateSmartEvent(SMART_EVENT_UPDATE_IC, 0, 0, 0, 0, 0, 0, 0, SMART_ACTION_NONE, 0, 0, 0, 0, 0, 0, (SMARTAI_TARGETS)e.action.orientationTarget.targetType, e.action.orientationTarget.targetParam1, e.action.orientationTarget.targetParam2, e.action.orientationTarget.targetParam3, e.action.orientationTarget.targetParam4, 0), unit);
+                    GetTargets(facingTargets, CreateSmartEvent(SMART_EVENT_UPDATE_IC, 0, 0, 0, 0, 0, 0, 0, SMART_ACTION_NONE, 0, 0, 0, 0, 0, 0, (SMARTAI_TARGETS)e.data->action.orientationTarget.targetType, e.data->action.orientationTarget.targetParam1, e.data->action.orientationTarget.targetParam2, e.data->action.orientationTarget.targetParam3, e.data->action.orientationTarget.targetParam4, 0), unit);
 
                     for (WorldObject* facingTarget : facingTargets)
                         for (WorldObject* target : targets)
@@ -3226,14 +3239,14 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         }
         case SMART_ACTION_WAYPOINT_DATA_START:
         {
-            if (e.action.wpData.pathId)
+            if (e.data->action.wpData.pathId)
             {
                 for (WorldObject* target : targets)
                 {
                     if (IsCreature(target))
                     {
-                        target->ToCreature()->LoadPath(e.action.wpData.pathId);
-                        target->ToCreature()->GetMotionMaster()->MovePath(e.action.wpData.pathId, e.action.wpData.repeat);
+                        target->ToCreature()->LoadPath(e.data->action.wpData.pathId);
+                        target->ToCreature()->GetMotionMaster()->MovePath(e.data->action.wpData.pathId, e.data->action.wpData.repeat);
                     }
                 }
             }
@@ -3242,15 +3255,15 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         }
         case SMART_ACTION_WAYPOINT_DATA_RANDOM:
         {
-            if (e.action.wpDataRandom.pathId1 && e.action.wpDataRandom.pathId2)
+            if (e.data->action.wpDataRandom.pathId1 && e.data->action.wpDataRandom.pathId2)
             {
                 for (WorldObject* target : targets)
                 {
                     if (IsCreature(target))
                     {
-                        uint32 path = urand(e.action.wpDataRandom.pathId1, e.action.wpDataRandom.pathId2);
+                        uint32 path = urand(e.data->action.wpDataRandom.pathId1, e.data->action.wpDataRandom.pathId2);
                         target->ToCreature()->LoadPath(path);
-                        target->ToCreature()->GetMotionMaster()->MovePath(path, e.action.wpDataRandom.repeat);
+                        target->ToCreature()->GetMotionMaster()->MovePath(path, e.data->action.wpDataRandom.repeat);
                     }
                 }
             }
@@ -3269,7 +3282,7 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->PauseMovement(e.action.move.timer);
+                    target->ToUnit()->PauseMovement(e.data->action.move.timer);
 
             break;
         }
@@ -3277,13 +3290,13 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
         {
             for (WorldObject* target : targets)
                 if (IsUnit(target))
-                    target->ToUnit()->ResumeMovement(e.action.move.timer);
+                    target->ToUnit()->ResumeMovement(e.data->action.move.timer);
 
             break;
         }
         case SMART_ACTION_WORLD_SCRIPT:
         {
-            sWorldState->HandleExternalEvent(static_cast<WorldStateEvent>(e.action.worldStateScript.eventId), e.action.worldStateScript.param);
+            sWorldState->HandleExternalEvent(static_cast<WorldStateEvent>(e.data->action.worldStateScript.eventId), e.data->action.worldStateScript.param);
             break;
         }
         case SMART_ACTION_DISABLE_REWARD:
@@ -3291,36 +3304,36 @@ void SmartScript::ProcessAction(SmartScriptHolder& e, Unit* unit, uint32 var0, u
             for (WorldObject* target : targets)
                 if (IsCreature(target))
                 {
-                    target->ToCreature()->SetReputationRewardDisabled(static_cast<bool>(e.action.reward.reputation));
-                    target->ToCreature()->SetLootRewardDisabled(static_cast<bool>(e.action.reward.loot));
+                    target->ToCreature()->SetReputationRewardDisabled(static_cast<bool>(e.data->action.reward.reputation));
+                    target->ToCreature()->SetLootRewardDisabled(static_cast<bool>(e.data->action.reward.loot));
                 }
             break;
         }
         default:
-            LOG_ERROR("sql.sql", "SmartScript::ProcessAction: Entry {} SourceType {}, Event {}, Unhandled Action type {}", e.entryOrGuid, e.GetScriptType(), e.event_id, e.GetActionType());
+            LOG_ERROR("sql.sql", "SmartScript::ProcessAction: Entry {} SourceType {}, Event {}, Unhandled Action type {}", e.data->entryOrGuid, e.GetScriptType(), e.data->event_id, e.GetActionType());
             break;
     }
 
-    if (e.link && e.link != e.event_id)
+    if (e.data->link && e.data->link != e.data->event_id)
     {
-        auto linked = FindLinkedEvent(e.link);
+        auto linked = FindLinkedEvent(e.data->link);
         if (linked.has_value())
         {
             auto& linkedEvent = linked.value().get();
             if (linkedEvent.GetEventType() == SMART_EVENT_LINK)
                 executionStack.emplace_back(SmartScriptFrame{ linkedEvent, unit, var0, var1, bvar, spell, gob });
             else
-                LOG_ERROR("sql.sql", "SmartScript::ProcessAction: Entry {} SourceType {}, Event {}, Link Event {} found but has wrong type (should be 61, is {}).", e.entryOrGuid, e.GetScriptType(), e.event_id, e.link, linkedEvent.GetEventType());
+                LOG_ERROR("sql.sql", "SmartScript::ProcessAction: Entry {} SourceType {}, Event {}, Link Event {} found but has wrong type (should be 61, is {}).", e.data->entryOrGuid, e.GetScriptType(), e.data->event_id, e.data->link, linkedEvent.GetEventType());
         }
         else
-            LOG_ERROR("sql.sql", "SmartScript::ProcessAction: Entry {} SourceType {}, Event {}, Link Event {} not found, skipped.", e.entryOrGuid, e.GetScriptType(), e.event_id, e.link);
+            LOG_ERROR("sql.sql", "SmartScript::ProcessAction: Entry {} SourceType {}, Event {}, Link Event {} not found, skipped.", e.data->entryOrGuid, e.GetScriptType(), e.data->event_id, e.data->link);
     }
 }
 
 void SmartScript::ProcessTimedAction(SmartScriptHolder& e, uint32 const& min, uint32 const& max, Unit* unit, uint32 var0, uint32 var1, bool bvar, SpellInfo const* spell, GameObject* gob)
 {
     // xinef: extended by selfs victim
-    ConditionList const conds = sConditionMgr->GetConditionsForSmartEvent(e.entryOrGuid, e.event_id, e.source_type);
+    ConditionSpan conds = GetConditions(e);
     ConditionSourceInfo info = ConditionSourceInfo(unit, GetBaseObject(), me ? me->GetVictim() : nullptr);
 
     if (sConditionMgr->IsObjectMeetToConditions(info, conds))
@@ -3338,25 +3351,25 @@ void SmartScript::InstallTemplate(SmartScriptHolder const& e)
         return;
     if (mTemplate != SMARTAI_TEMPLATE_BASIC)
     {
-        LOG_ERROR("sql.sql", "SmartScript::InstallTemplate: Entry {} SourceType {} AI Template can not be set more then once, skipped.", e.entryOrGuid, e.GetScriptType());
+        LOG_ERROR("sql.sql", "SmartScript::InstallTemplate: Entry {} SourceType {} AI Template can not be set more then once, skipped.", e.data->entryOrGuid, e.GetScriptType());
         return;
     }
-    mTemplate = (SMARTAI_TEMPLATE)e.action.installTtemplate.id;
-    switch ((SMARTAI_TEMPLATE)e.action.installTtemplate.id)
+    mTemplate = (SMARTAI_TEMPLATE)e.data->action.installTtemplate.id;
+    switch ((SMARTAI_TEMPLATE)e.data->action.installTtemplate.id)
     {
         case SMARTAI_TEMPLATE_CASTER:
             {
-                AddEvent(SMART_EVENT_UPDATE_IC, 0, 0, 0, e.action.installTtemplate.param2, e.action.installTtemplate.param3, 0, 0, SMART_ACTION_CAST, e.action.installTtemplate.param1, e.target.raw.param1, 0, 0, 0, 0, SMART_TARGET_VICTIM, 0, 0, 0, 0, 1);
-                AddEvent(SMART_EVENT_RANGE, 0, e.action.installTtemplate.param4, 300, 0, 0, 0, 0, SMART_ACTION_ALLOW_COMBAT_MOVEMENT, 1, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 1);
-                AddEvent(SMART_EVENT_RANGE, 0, 0, e.action.installTtemplate.param4 > 10 ? e.action.installTtemplate.param4 - 10 : 0, 0, 0, 0, 0, SMART_ACTION_ALLOW_COMBAT_MOVEMENT, 0, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 1);
-                AddEvent(SMART_EVENT_MANA_PCT, 0, e.action.installTtemplate.param5 - 15 > 100 ? 100 : e.action.installTtemplate.param5 + 15, 100, 1000, 1000, 0, 0, SMART_ACTION_SET_EVENT_PHASE, 1, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 0);
-                AddEvent(SMART_EVENT_MANA_PCT, 0, 0, e.action.installTtemplate.param5, 1000, 1000, 0, 0, SMART_ACTION_SET_EVENT_PHASE, 0, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 0);
-                AddEvent(SMART_EVENT_MANA_PCT, 0, 0, e.action.installTtemplate.param5, 1000, 1000, 0, 0, SMART_ACTION_ALLOW_COMBAT_MOVEMENT, 1, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 0);
+                AddEvent(SMART_EVENT_UPDATE_IC, 0, 0, 0, e.data->action.installTtemplate.param2, e.data->action.installTtemplate.param3, 0, 0, SMART_ACTION_CAST, e.data->action.installTtemplate.param1, e.data->target.raw.param1, 0, 0, 0, 0, SMART_TARGET_VICTIM, 0, 0, 0, 0, 1);
+                AddEvent(SMART_EVENT_RANGE, 0, e.data->action.installTtemplate.param4, 300, 0, 0, 0, 0, SMART_ACTION_ALLOW_COMBAT_MOVEMENT, 1, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 1);
+                AddEvent(SMART_EVENT_RANGE, 0, 0, e.data->action.installTtemplate.param4 > 10 ? e.data->action.installTtemplate.param4 - 10 : 0, 0, 0, 0, 0, SMART_ACTION_ALLOW_COMBAT_MOVEMENT, 0, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 1);
+                AddEvent(SMART_EVENT_MANA_PCT, 0, e.data->action.installTtemplate.param5 - 15 > 100 ? 100 : e.data->action.installTtemplate.param5 + 15, 100, 1000, 1000, 0, 0, SMART_ACTION_SET_EVENT_PHASE, 1, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 0);
+                AddEvent(SMART_EVENT_MANA_PCT, 0, 0, e.data->action.installTtemplate.param5, 1000, 1000, 0, 0, SMART_ACTION_SET_EVENT_PHASE, 0, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 0);
+                AddEvent(SMART_EVENT_MANA_PCT, 0, 0, e.data->action.installTtemplate.param5, 1000, 1000, 0, 0, SMART_ACTION_ALLOW_COMBAT_MOVEMENT, 1, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 0);
                 break;
             }
         case SMARTAI_TEMPLATE_TURRET:
             {
-                AddEvent(SMART_EVENT_UPDATE_IC, 0, 0, 0, e.action.installTtemplate.param2, e.action.installTtemplate.param3, 0, 0, SMART_ACTION_CAST, e.action.installTtemplate.param1, e.target.raw.param1, 0, 0, 0, 0, SMART_TARGET_VICTIM, 0, 0, 0, 0, 0);
+                AddEvent(SMART_EVENT_UPDATE_IC, 0, 0, 0, e.data->action.installTtemplate.param2, e.data->action.installTtemplate.param3, 0, 0, SMART_ACTION_CAST, e.data->action.installTtemplate.param1, e.data->target.raw.param1, 0, 0, 0, 0, SMART_TARGET_VICTIM, 0, 0, 0, 0, 0);
                 AddEvent(SMART_EVENT_JUST_CREATED, 0, 0, 0, 0, 0, 0, 0, SMART_ACTION_ALLOW_COMBAT_MOVEMENT, 0, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 0);
                 break;
             }
@@ -3365,22 +3378,22 @@ void SmartScript::InstallTemplate(SmartScriptHolder const& e)
                 if (!me)
                     return;
                 //store cage as id1
-                AddEvent(SMART_EVENT_DATA_SET, 0, 0, 0, 0, 0, 0, 0, SMART_ACTION_STORE_TARGET_LIST, 1, 0, 0, 0, 0, 0, SMART_TARGET_CLOSEST_GAMEOBJECT, e.action.installTtemplate.param1, 10, 0, 0, 0);
+                AddEvent(SMART_EVENT_DATA_SET, 0, 0, 0, 0, 0, 0, 0, SMART_ACTION_STORE_TARGET_LIST, 1, 0, 0, 0, 0, 0, SMART_TARGET_CLOSEST_GAMEOBJECT, e.data->action.installTtemplate.param1, 10, 0, 0, 0);
 
                 //reset(close) cage on hostage(me) respawn
-                AddEvent(SMART_EVENT_UPDATE, SMART_EVENT_FLAG_NOT_REPEATABLE, 0, 0, 0, 0, 0, 0, SMART_ACTION_RESET_GOBJECT, 0, 0, 0, 0, 0, 0, SMART_TARGET_GAMEOBJECT_DISTANCE, e.action.installTtemplate.param1, 5, 0, 0, 0);
+                AddEvent(SMART_EVENT_UPDATE, SMART_EVENT_FLAG_NOT_REPEATABLE, 0, 0, 0, 0, 0, 0, SMART_ACTION_RESET_GOBJECT, 0, 0, 0, 0, 0, 0, SMART_TARGET_GAMEOBJECT_DISTANCE, e.data->action.installTtemplate.param1, 5, 0, 0, 0);
 
-                AddEvent(SMART_EVENT_DATA_SET, 0, 0, 0, 0, 0, 0, 0, SMART_ACTION_SET_RUN, e.action.installTtemplate.param3, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 0);
+                AddEvent(SMART_EVENT_DATA_SET, 0, 0, 0, 0, 0, 0, 0, SMART_ACTION_SET_RUN, e.data->action.installTtemplate.param3, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 0);
                 AddEvent(SMART_EVENT_DATA_SET, 0, 0, 0, 0, 0, 0, 0, SMART_ACTION_SET_EVENT_PHASE, 1, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 0);
 
-                AddEvent(SMART_EVENT_UPDATE, SMART_EVENT_FLAG_NOT_REPEATABLE, 1000, 1000, 0, 0, 0, 0, SMART_ACTION_MOVE_FORWARD, e.action.installTtemplate.param4, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 1);
+                AddEvent(SMART_EVENT_UPDATE, SMART_EVENT_FLAG_NOT_REPEATABLE, 1000, 1000, 0, 0, 0, 0, SMART_ACTION_MOVE_FORWARD, e.data->action.installTtemplate.param4, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 1);
                 //phase 1: give quest credit on movepoint reached
                 AddEvent(SMART_EVENT_MOVEMENTINFORM, 0, POINT_MOTION_TYPE, SMART_RANDOM_POINT, 0, 0, 0, 0, SMART_ACTION_SET_DATA, 0, 0, 0, 0, 0, 0, SMART_TARGET_STORED, 1, 0, 0, 0, 1);
                 //phase 1: despawn after time on movepoint reached
-                AddEvent(SMART_EVENT_MOVEMENTINFORM, 0, POINT_MOTION_TYPE, SMART_RANDOM_POINT, 0, 0, 0, 0, SMART_ACTION_FORCE_DESPAWN, e.action.installTtemplate.param2, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 1);
+                AddEvent(SMART_EVENT_MOVEMENTINFORM, 0, POINT_MOTION_TYPE, SMART_RANDOM_POINT, 0, 0, 0, 0, SMART_ACTION_FORCE_DESPAWN, e.data->action.installTtemplate.param2, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 1);
 
-                if (sCreatureTextMgr->TextExist(me->GetEntry(), (uint8)e.action.installTtemplate.param5))
-                    AddEvent(SMART_EVENT_MOVEMENTINFORM, 0, POINT_MOTION_TYPE, SMART_RANDOM_POINT, 0, 0, 0, 0, SMART_ACTION_TALK, e.action.installTtemplate.param5, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 1);
+                if (sCreatureTextMgr->TextExist(me->GetEntry(), (uint8)e.data->action.installTtemplate.param5))
+                    AddEvent(SMART_EVENT_MOVEMENTINFORM, 0, POINT_MOTION_TYPE, SMART_RANDOM_POINT, 0, 0, 0, 0, SMART_ACTION_TALK, e.data->action.installTtemplate.param5, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 1);
                 break;
             }
         case SMARTAI_TEMPLATE_CAGED_GO_PART:
@@ -3388,16 +3401,16 @@ void SmartScript::InstallTemplate(SmartScriptHolder const& e)
                 if (!go)
                     return;
                 //store hostage as id1
-                AddEvent(SMART_EVENT_GO_STATE_CHANGED, 0, 2, 0, 0, 0, 0, 0, SMART_ACTION_STORE_TARGET_LIST, 1, 0, 0, 0, 0, 0, SMART_TARGET_CLOSEST_CREATURE, e.action.installTtemplate.param1, 10, 0, 0, 0);
+                AddEvent(SMART_EVENT_GO_STATE_CHANGED, 0, 2, 0, 0, 0, 0, 0, SMART_ACTION_STORE_TARGET_LIST, 1, 0, 0, 0, 0, 0, SMART_TARGET_CLOSEST_CREATURE, e.data->action.installTtemplate.param1, 10, 0, 0, 0);
                 //store invoker as id2
                 AddEvent(SMART_EVENT_GO_STATE_CHANGED, 0, 2, 0, 0, 0, 0, 0, SMART_ACTION_STORE_TARGET_LIST, 2, 0, 0, 0, 0, 0, SMART_TARGET_NONE, 0, 0, 0, 0, 0);
                 //signal hostage
                 AddEvent(SMART_EVENT_GO_STATE_CHANGED, 0, 2, 0, 0, 0, 0, 0, SMART_ACTION_SET_DATA, 0, 0, 0, 0, 0, 0, SMART_TARGET_STORED, 1, 0, 0, 0, 0);
                 //when hostage raeched end point, give credit to invoker
-                if (e.action.installTtemplate.param2)
-                    AddEvent(SMART_EVENT_DATA_SET, 0, 0, 0, 0, 0, 0, 0, SMART_ACTION_CALL_KILLEDMONSTER, e.action.installTtemplate.param1, 0, 0, 0, 0, 0, SMART_TARGET_STORED, 2, 0, 0, 0, 0);
+                if (e.data->action.installTtemplate.param2)
+                    AddEvent(SMART_EVENT_DATA_SET, 0, 0, 0, 0, 0, 0, 0, SMART_ACTION_CALL_KILLEDMONSTER, e.data->action.installTtemplate.param1, 0, 0, 0, 0, 0, SMART_TARGET_STORED, 2, 0, 0, 0, 0);
                 else
-                    AddEvent(SMART_EVENT_GO_STATE_CHANGED, 0, 2, 0, 0, 0, 0, 0, SMART_ACTION_CALL_KILLEDMONSTER, e.action.installTtemplate.param1, 0, 0, 0, 0, 0, SMART_TARGET_STORED, 2, 0, 0, 0, 0);
+                    AddEvent(SMART_EVENT_GO_STATE_CHANGED, 0, 2, 0, 0, 0, 0, 0, SMART_ACTION_CALL_KILLEDMONSTER, e.data->action.installTtemplate.param1, 0, 0, 0, 0, 0, SMART_TARGET_STORED, 2, 0, 0, 0, 0);
                 break;
             }
         case SMARTAI_TEMPLATE_BASIC:
@@ -3413,7 +3426,8 @@ void SmartScript::AddEvent(SMART_EVENT e, uint32 event_flags, uint32 event_param
 
 SmartScriptHolder SmartScript::CreateSmartEvent(SMART_EVENT e, uint32 event_flags, uint32 event_param1, uint32 event_param2, uint32 event_param3, uint32 event_param4, uint32 event_param5, uint32 event_param6, SMART_ACTION action, uint32 action_param1, uint32 action_param2, uint32 action_param3, uint32 action_param4, uint32 action_param5, uint32 action_param6, SMARTAI_TARGETS t, uint32 target_param1, uint32 target_param2, uint32 target_param3, uint32 target_param4, uint32 phaseMask)
 {
-    SmartScriptHolder script;
+    std::shared_ptr<SmartScriptData> data = std::make_shared<SmartScriptData>();
+    SmartScriptData& script = *data;
     script.event.type = e;
     script.event.raw.param1 = event_param1;
     script.event.raw.param2 = event_param2;
@@ -3440,8 +3454,10 @@ SmartScriptHolder SmartScript::CreateSmartEvent(SMART_EVENT e, uint32 event_flag
     script.target.raw.param4 = target_param4;
 
     script.source_type = SMART_SCRIPT_TYPE_CREATURE;
-    InitTimer(script);
-    return script;
+
+    SmartScriptHolder holder(std::move(data));
+    InitTimer(holder);
+    return holder;
 }
 
 void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e, WorldObject* invoker /*= nullptr*/) const
@@ -3468,55 +3484,55 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
         case SMART_TARGET_HOSTILE_SECOND_AGGRO:
             if (me)
             {
-                if (e.target.hostileRandom.powerType)
+                if (e.data->target.hostileRandom.powerType)
                 {
-                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MaxThreat, 0, PowerUsersSelector(me, Powers(e.target.hostileRandom.powerType - 1), (float)e.target.hostileRandom.maxDist, e.target.hostileRandom.playerOnly, false)))
+                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MaxThreat, 0, PowerUsersSelector(me, Powers(e.data->target.hostileRandom.powerType - 1), (float)e.data->target.hostileRandom.maxDist, e.data->target.hostileRandom.playerOnly, false)))
                         targets.push_back(u);
                 }
-                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MaxThreat, 0, (float)e.target.hostileRandom.maxDist, e.target.hostileRandom.playerOnly, false, -e.target.hostileRandom.aura))
+                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MaxThreat, 0, (float)e.data->target.hostileRandom.maxDist, e.data->target.hostileRandom.playerOnly, false, -e.data->target.hostileRandom.aura))
                     targets.push_back(u);
             }
             break;
         case SMART_TARGET_HOSTILE_LAST_AGGRO:
             if (me)
             {
-                if (e.target.hostileRandom.powerType)
+                if (e.data->target.hostileRandom.powerType)
                 {
-                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MinThreat, 0, PowerUsersSelector(me, Powers(e.target.hostileRandom.powerType - 1), (float)e.target.hostileRandom.maxDist, e.target.hostileRandom.playerOnly)))
+                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MinThreat, 0, PowerUsersSelector(me, Powers(e.data->target.hostileRandom.powerType - 1), (float)e.data->target.hostileRandom.maxDist, e.data->target.hostileRandom.playerOnly)))
                         targets.push_back(u);
                 }
-                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MinThreat, 0, (float)e.target.hostileRandom.maxDist, e.target.hostileRandom.playerOnly, true, -e.target.hostileRandom.aura))
+                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MinThreat, 0, (float)e.data->target.hostileRandom.maxDist, e.data->target.hostileRandom.playerOnly, true, -e.data->target.hostileRandom.aura))
                     targets.push_back(u);
             }
             break;
         case SMART_TARGET_HOSTILE_RANDOM:
             if (me)
             {
-                if (e.target.hostileRandom.powerType)
+                if (e.data->target.hostileRandom.powerType)
                 {
-                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 0, PowerUsersSelector(me, Powers(e.target.hostileRandom.powerType - 1), (float)e.target.hostileRandom.maxDist, e.target.hostileRandom.playerOnly)))
+                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 0, PowerUsersSelector(me, Powers(e.data->target.hostileRandom.powerType - 1), (float)e.data->target.hostileRandom.maxDist, e.data->target.hostileRandom.playerOnly)))
                         targets.push_back(u);
                 }
-                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 0, (float)e.target.hostileRandom.maxDist, e.target.hostileRandom.playerOnly, true, -e.target.hostileRandom.aura))
+                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 0, (float)e.data->target.hostileRandom.maxDist, e.data->target.hostileRandom.playerOnly, true, -e.data->target.hostileRandom.aura))
                     targets.push_back(u);
             }
             break;
         case SMART_TARGET_HOSTILE_RANDOM_NOT_TOP:
             if (me)
             {
-                if (e.target.hostileRandom.powerType)
+                if (e.data->target.hostileRandom.powerType)
                 {
-                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 0, PowerUsersSelector(me, Powers(e.target.hostileRandom.powerType - 1), (float)e.target.hostileRandom.maxDist, e.target.hostileRandom.playerOnly, false)))
+                    if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 0, PowerUsersSelector(me, Powers(e.data->target.hostileRandom.powerType - 1), (float)e.data->target.hostileRandom.maxDist, e.data->target.hostileRandom.playerOnly, false)))
                         targets.push_back(u);
                 }
-                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 0, (float)e.target.hostileRandom.maxDist, e.target.hostileRandom.playerOnly, false, -e.target.hostileRandom.aura))
+                else if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::Random, 0, (float)e.data->target.hostileRandom.maxDist, e.data->target.hostileRandom.playerOnly, false, -e.data->target.hostileRandom.aura))
                     targets.push_back(u);
             }
             break;
         case SMART_TARGET_FARTHEST:
             if (me)
             {
-                if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MinDistance, 0, RangeSelector(me, e.target.farthest.maxDist, e.target.farthest.playerOnly, e.target.farthest.isInLos, e.target.farthest.minDist)))
+                if (Unit* u = me->AI()->SelectTarget(SelectTargetMethod::MinDistance, 0, RangeSelector(me, e.data->target.farthest.maxDist, e.data->target.farthest.playerOnly, e.data->target.farthest.isInLos, e.data->target.farthest.minDist)))
                     targets.push_back(u);
             }
             break;
@@ -3542,7 +3558,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                                 if (member->IsInMap(player))
                                     targets.push_back(member);
 
-                                if (e.target.invokerParty.includePets)
+                                if (e.data->target.invokerParty.includePets)
                                     if (Creature* pet = ObjectAccessor::GetCreatureOrPetOrVehicle(*member, member->GetPetGUID()))
                                         if (pet->IsPet() && pet->IsInMap(player))
                                             targets.push_back(pet);
@@ -3565,12 +3581,12 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!ref)
             {
                 LOG_ERROR("scripts.ai.sai", "SMART_TARGET_CREATURE_RANGE: Entry {} SourceType {} Event {} Action {} Target {} is missing base object or invoker",
-                    e.entryOrGuid, e.GetScriptType(), e.event_id, e.GetActionType(), e.GetTargetType());
+                    e.data->entryOrGuid, e.GetScriptType(), e.data->event_id, e.GetActionType(), e.GetTargetType());
                 break;
             }
 
             ObjectVector units;
-            GetWorldObjectsInDist(units, static_cast<float>(e.target.unitRange.maxDist));
+            GetWorldObjectsInDist(units, static_cast<float>(e.data->target.unitRange.maxDist));
 
             for (WorldObject* unit : units)
             {
@@ -3581,7 +3597,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                     continue;
 
                 // check alive state - 1 alive, 2 dead, 0 both
-                if (uint32 state = e.target.unitRange.livingState)
+                if (uint32 state = e.data->target.unitRange.livingState)
                 {
                     if (unit->ToCreature()->IsAlive() && state == 2)
                         continue;
@@ -3589,7 +3605,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                         continue;
                 }
 
-                if (((e.target.unitRange.creature && unit->ToCreature()->GetEntry() == e.target.unitRange.creature) || !e.target.unitRange.creature) && ref->IsInRange(unit, (float)e.target.unitRange.minDist, (float)e.target.unitRange.maxDist))
+                if (((e.data->target.unitRange.creature && unit->ToCreature()->GetEntry() == e.data->target.unitRange.creature) || !e.data->target.unitRange.creature) && ref->IsInRange(unit, (float)e.data->target.unitRange.minDist, (float)e.data->target.unitRange.maxDist))
                     targets.push_back(unit);
             }
 
@@ -3598,7 +3614,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
         case SMART_TARGET_CREATURE_DISTANCE:
         {
             ObjectVector units;
-            GetWorldObjectsInDist(units, static_cast<float>(e.target.unitDistance.dist));
+            GetWorldObjectsInDist(units, static_cast<float>(e.data->target.unitDistance.dist));
 
             for (WorldObject* unit : units)
             {
@@ -3609,7 +3625,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                     continue;
 
                 // check alive state - 1 alive, 2 dead, 0 both
-                if (uint32 state = e.target.unitDistance.livingState)
+                if (uint32 state = e.data->target.unitDistance.livingState)
                 {
                     if (unit->ToCreature()->IsAlive() && state == 2)
                         continue;
@@ -3617,7 +3633,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                         continue;
                 }
 
-                if ((e.target.unitDistance.creature && unit->ToCreature()->GetEntry() == e.target.unitDistance.creature) || !e.target.unitDistance.creature)
+                if ((e.data->target.unitDistance.creature && unit->ToCreature()->GetEntry() == e.data->target.unitDistance.creature) || !e.data->target.unitDistance.creature)
                     targets.push_back(unit);
             }
 
@@ -3626,7 +3642,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
         case SMART_TARGET_GAMEOBJECT_DISTANCE:
         {
             ObjectVector units;
-            GetWorldObjectsInDist(units, static_cast<float>(e.target.goDistance.dist));
+            GetWorldObjectsInDist(units, static_cast<float>(e.data->target.goDistance.dist));
 
             for (WorldObject* unit : units)
             {
@@ -3636,7 +3652,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                 if (go && go->GetGUID() == unit->GetGUID())
                     continue;
 
-                if ((e.target.goDistance.entry && unit->ToGameObject()->GetEntry() == e.target.goDistance.entry) || !e.target.goDistance.entry)
+                if ((e.data->target.goDistance.entry && unit->ToGameObject()->GetEntry() == e.data->target.goDistance.entry) || !e.data->target.goDistance.entry)
                     targets.push_back(unit);
             }
 
@@ -3652,12 +3668,12 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!ref)
             {
                 LOG_ERROR("scripts.ai.sai", "SMART_TARGET_GAMEOBJECT_RANGE: Entry: {} SourceType {} Event {} Action {} Target {} is missing base object or invoker.",
-                    e.entryOrGuid, e.GetScriptType(), e.event_id, e.GetActionType(), e.GetTargetType());
+                    e.data->entryOrGuid, e.GetScriptType(), e.data->event_id, e.GetActionType(), e.GetTargetType());
                 break;
             }
 
             ObjectVector units;
-            GetWorldObjectsInDist(units, static_cast<float>(e.target.goRange.maxDist));
+            GetWorldObjectsInDist(units, static_cast<float>(e.data->target.goRange.maxDist));
 
             for (WorldObject* unit : units)
             {
@@ -3667,7 +3683,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                 if (go && go->GetGUID() == unit->GetGUID())
                     continue;
 
-                if (((e.target.goRange.entry && IsGameObject(unit) && unit->ToGameObject()->GetEntry() == e.target.goRange.entry) || !e.target.goRange.entry) && ref->IsInRange((unit), (float)e.target.goRange.minDist, (float)e.target.goRange.maxDist))
+                if (((e.data->target.goRange.entry && IsGameObject(unit) && unit->ToGameObject()->GetEntry() == e.data->target.goRange.entry) || !e.data->target.goRange.entry) && ref->IsInRange((unit), (float)e.data->target.goRange.minDist, (float)e.data->target.goRange.maxDist))
                     targets.push_back(unit);
             }
 
@@ -3678,12 +3694,12 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!scriptTrigger && !baseObject)
             {
                 LOG_ERROR("scripts.ai.sai", "SMART_TARGET_CREATURE_GUID: Entry {} SourceType {} Event {} Action {} Target {} is missing base object or invoker.",
-                    e.entryOrGuid, e.GetScriptType(), e.event_id, e.GetActionType(), e.GetTargetType());
+                    e.data->entryOrGuid, e.GetScriptType(), e.data->event_id, e.GetActionType(), e.GetTargetType());
                 break;
             }
 
-            Creature* target = FindCreatureNear(scriptTrigger ? scriptTrigger : GetBaseObject(), e.target.unitGUID.dbGuid);
-            if (target && (!e.target.unitGUID.entry || target->GetEntry() == e.target.unitGUID.entry))
+            Creature* target = FindCreatureNear(scriptTrigger ? scriptTrigger : GetBaseObject(), e.data->target.unitGUID.dbGuid);
+            if (target && (!e.data->target.unitGUID.entry || target->GetEntry() == e.data->target.unitGUID.entry))
                 targets.push_back(target);
             break;
         }
@@ -3692,34 +3708,34 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!scriptTrigger && !GetBaseObject())
             {
                 LOG_ERROR("scripts.ai.sai", "SMART_TARGET_GAMEOBJECT_GUID: Entry {} SourceType {} Event {} Action {} Target {} is missing base object or invoker.",
-                    e.entryOrGuid, e.GetScriptType(), e.event_id, e.GetActionType(), e.GetTargetType());
+                    e.data->entryOrGuid, e.GetScriptType(), e.data->event_id, e.GetActionType(), e.GetTargetType());
                 break;
             }
 
-            GameObject* target = FindGameObjectNear(scriptTrigger ? scriptTrigger : GetBaseObject(), e.target.goGUID.dbGuid);
-            if (target && (!e.target.goGUID.entry || target->GetEntry() == e.target.goGUID.entry))
+            GameObject* target = FindGameObjectNear(scriptTrigger ? scriptTrigger : GetBaseObject(), e.data->target.goGUID.dbGuid);
+            if (target && (!e.data->target.goGUID.entry || target->GetEntry() == e.data->target.goGUID.entry))
                 targets.push_back(target);
             break;
         }
         case SMART_TARGET_PLAYER_RANGE:
         {
             ObjectVector units;
-            GetWorldObjectsInDist(units, static_cast<float>(e.target.playerRange.maxDist));
+            GetWorldObjectsInDist(units, static_cast<float>(e.data->target.playerRange.maxDist));
 
             if (!units.empty() && baseObject)
                 for (WorldObject* unit : units)
-                    if (IsPlayer(unit) && !unit->ToPlayer()->IsGameMaster() && baseObject->IsInRange(unit, float(e.target.playerRange.minDist), float(e.target.playerRange.maxDist)))
+                    if (IsPlayer(unit) && !unit->ToPlayer()->IsGameMaster() && baseObject->IsInRange(unit, float(e.data->target.playerRange.minDist), float(e.data->target.playerRange.maxDist)))
                         targets.push_back(unit);
 
-            if (e.target.playerRange.maxCount)
-                Acore::Containers::RandomResize(targets, e.target.playerRange.maxCount);
+            if (e.data->target.playerRange.maxCount)
+                Acore::Containers::RandomResize(targets, e.data->target.playerRange.maxCount);
 
             break;
         }
         case SMART_TARGET_PLAYER_DISTANCE:
         {
             ObjectVector units;
-            GetWorldObjectsInDist(units, static_cast<float>(e.target.playerDistance.dist));
+            GetWorldObjectsInDist(units, static_cast<float>(e.data->target.playerDistance.dist));
 
             for (WorldObject* unit : units)
                 if (IsPlayer(unit))
@@ -3735,11 +3751,11 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!ref)
             {
                 LOG_ERROR("scripts.ai.sai", "SMART_TARGET_STORED: Entry {} SourceType {} Event {} Action {} Target {} is missing base object or invoker.",
-                    e.entryOrGuid, e.GetScriptType(), e.event_id, e.GetActionType(), e.GetTargetType());
+                    e.data->entryOrGuid, e.GetScriptType(), e.data->event_id, e.GetActionType(), e.GetTargetType());
                 break;
             }
 
-            if (ObjectVector const* stored = GetStoredTargetVector(e.target.stored.id, *ref))
+            if (ObjectVector const* stored = GetStoredTargetVector(e.data->target.stored.id, *ref))
                 targets.assign(stored->begin(), stored->end());
             break;
         }
@@ -3753,11 +3769,11 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!ref)
             {
                 LOG_ERROR("scripts.ai.sai", "SMART_TARGET_CLOSEST_CREATURE: Entry {} SourceType {} Event {} Action {} Target {} is missing base object or invoker.",
-                    e.entryOrGuid, e.GetScriptType(), e.event_id, e.GetActionType(), e.GetTargetType());
+                    e.data->entryOrGuid, e.GetScriptType(), e.data->event_id, e.GetActionType(), e.GetTargetType());
                 break;
             }
 
-            Creature* target = GetClosestCreatureWithEntry(ref, e.target.unitClosest.entry, (float)(e.target.unitClosest.dist ? e.target.unitClosest.dist : 100), !e.target.unitClosest.dead);
+            Creature* target = GetClosestCreatureWithEntry(ref, e.data->target.unitClosest.entry, (float)(e.data->target.unitClosest.dist ? e.data->target.unitClosest.dist : 100), !e.data->target.unitClosest.dead);
             if (target)
                 targets.push_back(target);
             break;
@@ -3772,11 +3788,11 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!ref)
             {
                 LOG_ERROR("scripts.ai.sai", "SMART_TARGET_CLOSEST_GAMEOBJECT: Entry {} SourceType {} Event {} Action {} Target {} is missing base object or invoker.",
-                    e.entryOrGuid, e.GetScriptType(), e.event_id, e.GetActionType(), e.GetTargetType());
+                    e.data->entryOrGuid, e.GetScriptType(), e.data->event_id, e.GetActionType(), e.GetTargetType());
                 break;
             }
 
-            GameObject* target = GetClosestGameObjectWithEntry(ref, e.target.goClosest.entry, (float)(e.target.goClosest.dist ? e.target.goClosest.dist : 100), e.target.goClosest.onlySpawned);
+            GameObject* target = GetClosestGameObjectWithEntry(ref, e.data->target.goClosest.entry, (float)(e.data->target.goClosest.dist ? e.data->target.goClosest.dist : 100), e.data->target.goClosest.onlySpawned);
             if (target)
                 targets.push_back(target);
             break;
@@ -3791,11 +3807,11 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             if (!ref)
             {
                 LOG_ERROR("scripts.ai.sai", "SMART_TARGET_CLOSEST_PLAYER: Entry {} SourceType {} Event {} Action {} Target {} is missing base object or invoker.",
-                    e.entryOrGuid, e.GetScriptType(), e.event_id, e.GetActionType(), e.GetTargetType());
+                    e.data->entryOrGuid, e.GetScriptType(), e.data->event_id, e.GetActionType(), e.GetTargetType());
                 break;
             }
 
-            if (Player* target = ref->SelectNearestPlayer((float)e.target.playerDistance.dist))
+            if (Player* target = ref->SelectNearestPlayer((float)e.data->target.playerDistance.dist))
                 targets.push_back(target);
             break;
         }
@@ -3826,7 +3842,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             }
 
             // xinef: Get owner of owner
-            if (e.target.owner.useCharmerOrOwner && !targets.empty())
+            if (e.data->target.owner.useCharmerOrOwner && !targets.empty())
             {
                 if (WorldObject* owner = targets.front())
                 {
@@ -3858,7 +3874,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                 for (ThreatContainer::StorageType::const_iterator i = threatList.begin(); i != threatList.end(); ++i)
                     if (Unit* temp = ObjectAccessor::GetUnit(*me, (*i)->getUnitGuid()))
                         // Xinef: added distance check
-                        if (e.target.threatList.maxDist == 0 || me->IsWithinCombatRange(temp, (float)e.target.threatList.maxDist))
+                        if (e.data->target.threatList.maxDist == 0 || me->IsWithinCombatRange(temp, (float)e.data->target.threatList.maxDist))
                             targets.push_back(temp);
             }
             break;
@@ -3866,7 +3882,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
         case SMART_TARGET_CLOSEST_ENEMY:
         {
             if (me)
-                if (Unit* target = me->SelectNearestTarget(e.target.closestAttackable.maxDist, e.target.closestAttackable.playerOnly))
+                if (Unit* target = me->SelectNearestTarget(e.data->target.closestAttackable.maxDist, e.data->target.closestAttackable.playerOnly))
                     targets.push_back(target);
 
             break;
@@ -3874,7 +3890,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
         case SMART_TARGET_CLOSEST_FRIENDLY:
         {
             if (me)
-                if (Unit* target = DoFindClosestFriendlyInRange(e.target.closestFriendly.maxDist, e.target.closestFriendly.playerOnly))
+                if (Unit* target = DoFindClosestFriendlyInRange(e.data->target.closestFriendly.maxDist, e.data->target.closestFriendly.playerOnly))
                     targets.push_back(target);
 
             break;
@@ -3882,25 +3898,25 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
         case SMART_TARGET_PLAYER_WITH_AURA:
         {
             ObjectVector units;
-            GetWorldObjectsInDist(units, static_cast<float>(e.target.playerDistance.dist));
+            GetWorldObjectsInDist(units, static_cast<float>(e.data->target.playerDistance.dist));
 
             for (WorldObject* unit : units)
                 if (IsPlayer(unit) && unit->ToPlayer()->IsAlive() && !unit->ToPlayer()->IsGameMaster())
-                    if (GetBaseObject()->IsInRange(unit, (float)e.target.playerWithAura.distMin, (float)e.target.playerWithAura.distMax))
-                        if (bool(e.target.playerWithAura.negation) != unit->ToPlayer()->HasAura(e.target.playerWithAura.spellId))
+                    if (GetBaseObject()->IsInRange(unit, (float)e.data->target.playerWithAura.distMin, (float)e.data->target.playerWithAura.distMax))
+                        if (bool(e.data->target.playerWithAura.negation) != unit->ToPlayer()->HasAura(e.data->target.playerWithAura.spellId))
                             targets.push_back(unit);
 
-            if (e.target.o > 0)
-                Acore::Containers::RandomResize(targets, e.target.o);
+            if (e.data->target.o > 0)
+                Acore::Containers::RandomResize(targets, e.data->target.o);
 
             break;
         }
         case SMART_TARGET_ROLE_SELECTION:
         {
             ObjectVector units;
-            GetWorldObjectsInDist(units, static_cast<float>(e.target.playerDistance.dist));
+            GetWorldObjectsInDist(units, static_cast<float>(e.data->target.playerDistance.dist));
             // 1 = Tanks, 2 = Healer, 4 = Damage
-            uint32 roleMask = e.target.roleSelection.roleMask;
+            uint32 roleMask = e.data->target.roleSelection.roleMask;
             for (WorldObject* unit : units)
                 if (Player* targetPlayer = unit->ToPlayer())
                     if (targetPlayer->IsAlive() && !targetPlayer->IsGameMaster())
@@ -3931,8 +3947,8 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
                         }
                     }
 
-            if (e.target.roleSelection.resize > 0)
-                Acore::Containers::RandomResize(targets, e.target.roleSelection.resize);
+            if (e.data->target.roleSelection.resize > 0)
+                Acore::Containers::RandomResize(targets, e.data->target.roleSelection.resize);
 
             break;
         }
@@ -3940,7 +3956,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
         {
             if (me && me->IsVehicle())
             {
-                if (Unit* target = me->GetVehicleKit()->GetPassenger(e.target.vehicle.seatMask))
+                if (Unit* target = me->GetVehicleKit()->GetPassenger(e.data->target.vehicle.seatMask))
                 {
                     targets.push_back(target);
                 }
@@ -3977,7 +3993,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             {
                 for (ObjectGuid const& guid : _summonList)
                 {
-                    if (!e.target.summonedCreatures.entry || guid.GetEntry() == e.target.summonedCreatures.entry)
+                    if (!e.data->target.summonedCreatures.entry || guid.GetEntry() == e.data->target.summonedCreatures.entry)
                     {
                         if (Creature* creature = me->GetMap()->GetCreature(guid))
                         {
@@ -3992,16 +4008,16 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
         {
             if (InstanceScript* instance = GetBaseObject()->GetInstanceScript())
             {
-                if (e.target.instanceStorage.type == 1)
+                if (e.data->target.instanceStorage.type == 1)
                 {
-                    if (Creature* creature = instance->GetCreature(e.target.instanceStorage.index))
+                    if (Creature* creature = instance->GetCreature(e.data->target.instanceStorage.index))
                     {
                         targets.push_back(creature);
                     }
                 }
-                else if (e.target.instanceStorage.type == 2)
+                else if (e.data->target.instanceStorage.type == 2)
                 {
-                    if (GameObject* go = instance->GetGameObject(e.target.instanceStorage.index))
+                    if (GameObject* go = instance->GetGameObject(e.data->target.instanceStorage.index))
                     {
                         targets.push_back(go);
                     }
@@ -4010,7 +4026,7 @@ void SmartScript::GetTargets(ObjectVector& targets, SmartScriptHolder const& e,
             else
             {
                 LOG_ERROR("scripts.ai.sai", "SMART_TARGET_INSTANCE_STORAGE: Entry {} SourceType {} Event {} Action {} Target {} called outside an instance map.",
-                    e.entryOrGuid, e.GetScriptType(), e.event_id, e.GetActionType(), e.GetTargetType());
+                    e.data->entryOrGuid, e.GetScriptType(), e.data->event_id, e.GetActionType(), e.GetTargetType());
             }
 
             break;
@@ -4038,10 +4054,10 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
     if (!e.active && e.GetEventType() != SMART_EVENT_LINK)
         return;
 
-    if ((e.event.event_phase_mask && !IsInPhase(e.event.event_phase_mask)) || ((e.event.event_flags & SMART_EVENT_FLAG_NOT_REPEATABLE) && e.runOnce))
+    if ((e.data->event.event_phase_mask && !IsInPhase(e.data->event.event_phase_mask)) || ((e.data->event.event_flags & SMART_EVENT_FLAG_NOT_REPEATABLE) && e.runOnce))
         return;
 
-    if (!(e.event.event_flags & SMART_EVENT_FLAG_WHILE_CHARMED) && IsCharmedCreature(me))
+    if (!(e.data->event.event_flags & SMART_EVENT_FLAG_WHILE_CHARMED) && IsCharmedCreature(me))
         return;
 
     switch (e.GetEventType())
@@ -4051,26 +4067,26 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             break;
         //called from Update tick
         case SMART_EVENT_UPDATE:
-            ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+            ProcessTimedAction(e, e.data->event.minMaxRepeat.repeatMin, e.data->event.minMaxRepeat.repeatMax);
             break;
         case SMART_EVENT_UPDATE_OOC:
             if (me && me->IsEngaged())
                 return;
-            ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+            ProcessTimedAction(e, e.data->event.minMaxRepeat.repeatMin, e.data->event.minMaxRepeat.repeatMax);
             break;
         case SMART_EVENT_UPDATE_IC:
             if (!me || !me->IsEngaged())
                 return;
-            ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+            ProcessTimedAction(e, e.data->event.minMaxRepeat.repeatMin, e.data->event.minMaxRepeat.repeatMax);
             break;
         case SMART_EVENT_HEALTH_PCT:
             {
                 if (!me || !me->IsEngaged() || !me->GetMaxHealth())
                     return;
                 uint32 perc = (uint32)me->GetHealthPct();
-                if (perc > e.event.minMaxRepeat.max || perc < e.event.minMaxRepeat.min)
+                if (perc > e.data->event.minMaxRepeat.max || perc < e.data->event.minMaxRepeat.min)
                     return;
-                ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+                ProcessTimedAction(e, e.data->event.minMaxRepeat.repeatMin, e.data->event.minMaxRepeat.repeatMax);
                 break;
             }
         case SMART_EVENT_TARGET_HEALTH_PCT:
@@ -4078,9 +4094,9 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 if (!me || !me->IsEngaged() || !me->GetVictim() || !me->GetVictim()->GetMaxHealth())
                     return;
                 uint32 perc = (uint32)me->GetVictim()->GetHealthPct();
-                if (perc > e.event.minMaxRepeat.max || perc < e.event.minMaxRepeat.min)
+                if (perc > e.data->event.minMaxRepeat.max || perc < e.data->event.minMaxRepeat.min)
                     return;
-                ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, me->GetVictim());
+                ProcessTimedAction(e, e.data->event.minMaxRepeat.repeatMin, e.data->event.minMaxRepeat.repeatMax, me->GetVictim());
                 break;
             }
         case SMART_EVENT_MANA_PCT:
@@ -4088,9 +4104,9 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 if (!me || !me->IsEngaged() || !me->GetMaxPower(POWER_MANA))
                     return;
                 uint32 perc = uint32(me->GetPowerPct(POWER_MANA));
-                if (perc > e.event.minMaxRepeat.max || perc < e.event.minMaxRepeat.min)
+                if (perc > e.data->event.minMaxRepeat.max || perc < e.data->event.minMaxRepeat.min)
                     return;
-                ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+                ProcessTimedAction(e, e.data->event.minMaxRepeat.repeatMin, e.data->event.minMaxRepeat.repeatMax);
                 break;
             }
         case SMART_EVENT_TARGET_MANA_PCT:
@@ -4098,9 +4114,9 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 if (!me || !me->IsEngaged() || !me->GetVictim() || !me->GetVictim()->GetMaxPower(POWER_MANA))
                     return;
                 uint32 perc = uint32(me->GetVictim()->GetPowerPct(POWER_MANA));
-                if (perc > e.event.minMaxRepeat.max || perc < e.event.minMaxRepeat.min)
+                if (perc > e.data->event.minMaxRepeat.max || perc < e.data->event.minMaxRepeat.min)
                     return;
-                ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, me->GetVictim());
+                ProcessTimedAction(e, e.data->event.minMaxRepeat.repeatMin, e.data->event.minMaxRepeat.repeatMax, me->GetVictim());
                 break;
             }
         case SMART_EVENT_RANGE:
@@ -4108,8 +4124,8 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 if (!me || !me->IsEngaged() || !me->GetVictim())
                     return;
 
-                if (me->IsInRange(me->GetVictim(), (float)e.event.minMaxRepeat.rangeMin, (float)e.event.minMaxRepeat.rangeMax))
-                    ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, me->GetVictim());
+                if (me->IsInRange(me->GetVictim(), (float)e.data->event.minMaxRepeat.rangeMin, (float)e.data->event.minMaxRepeat.rangeMax))
+                    ProcessTimedAction(e, e.data->event.minMaxRepeat.repeatMin, e.data->event.minMaxRepeat.repeatMax, me->GetVictim());
                 else
                     RecalcTimer(e, 1200, 1200); // make it predictable
 
@@ -4125,12 +4141,12 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 if (!victim || !victim->IsNonMeleeSpellCast(false, false, true))
                     return;
 
-                if (e.event.targetCasting.spellId > 0)
+                if (e.data->event.targetCasting.spellId > 0)
                     if (Spell* currSpell = victim->GetCurrentSpell(CURRENT_GENERIC_SPELL))
-                        if (currSpell->m_spellInfo->Id != e.event.targetCasting.spellId)
+                        if (currSpell->m_spellInfo->Id != e.data->event.targetCasting.spellId)
                             return;
 
-                ProcessTimedAction(e, e.event.targetCasting.repeatMin, e.event.targetCasting.repeatMax, me->GetVictim());
+                ProcessTimedAction(e, e.data->event.targetCasting.repeatMin, e.data->event.targetCasting.repeatMax, me->GetVictim());
                 break;
             }
         case SMART_EVENT_FRIENDLY_HEALTH:
@@ -4138,14 +4154,14 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 if (!me || !me->IsEngaged())
                     return;
 
-                Unit* target = DoSelectLowestHpFriendly((float)e.event.friendlyHealth.radius, e.event.friendlyHealth.hpDeficit);
+                Unit* target = DoSelectLowestHpFriendly((float)e.data->event.friendlyHealth.radius, e.data->event.friendlyHealth.hpDeficit);
                 if (!target || !target->IsInCombat())
                 {
                     // Xinef: if there are at least two same npcs, they will perform the same action immediately even if this is useless...
                     RecalcTimer(e, 1000, 3000);
                     return;
                 }
-                ProcessTimedAction(e, e.event.friendlyHealth.repeatMin, e.event.friendlyHealth.repeatMax, target);
+                ProcessTimedAction(e, e.data->event.friendlyHealth.repeatMin, e.data->event.friendlyHealth.repeatMax, target);
                 break;
             }
         case SMART_EVENT_FRIENDLY_IS_CC:
@@ -4154,54 +4170,54 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     return;
 
                 std::vector<Creature*> creatures;
-                DoFindFriendlyCC(creatures, float(e.event.friendlyCC.radius));
+                DoFindFriendlyCC(creatures, float(e.data->event.friendlyCC.radius));
                 if (creatures.empty())
                 {
                     // Xinef: if there are at least two same npcs, they will perform the same action immediately even if this is useless...
                     RecalcTimer(e, 1000, 3000);
                     return;
                 }
-                ProcessTimedAction(e, e.event.friendlyCC.repeatMin, e.event.friendlyCC.repeatMax, Acore::Containers::SelectRandomContainerElement(creatures));
+                ProcessTimedAction(e, e.data->event.friendlyCC.repeatMin, e.data->event.friendlyCC.repeatMax, Acore::Containers::SelectRandomContainerElement(creatures));
                 break;
             }
         case SMART_EVENT_FRIENDLY_MISSING_BUFF:
         {
-            if (e.event.missingBuff.onlyInCombat && !me->IsEngaged())
+            if (e.data->event.missingBuff.onlyInCombat && !me->IsEngaged())
             {
                 return;
             }
 
             std::vector<Creature*> creatures;
-            DoFindFriendlyMissingBuff(creatures, float(e.event.missingBuff.radius), e.event.missingBuff.spell);
+            DoFindFriendlyMissingBuff(creatures, float(e.data->event.missingBuff.radius), e.data->event.missingBuff.spell);
 
             if (creatures.empty())
                 return;
 
-            ProcessTimedAction(e, e.event.missingBuff.repeatMin, e.event.missingBuff.repeatMax, Acore::Containers::SelectRandomContainerElement(creatures));
+            ProcessTimedAction(e, e.data->event.missingBuff.repeatMin, e.data->event.missingBuff.repeatMax, Acore::Containers::SelectRandomContainerElement(creatures));
             break;
         }
         case SMART_EVENT_HAS_AURA:
             {
                 if (!me)
                     return;
-                uint32 count = me->GetAuraCount(e.event.aura.spell);
-                if ((!e.event.aura.count && !count) || (e.event.aura.count && count >= e.event.aura.count))
-                    ProcessTimedAction(e, e.event.aura.repeatMin, e.event.aura.repeatMax);
+                uint32 count = me->GetAuraCount(e.data->event.aura.spell);
+                if ((!e.data->event.aura.count && !count) || (e.data->event.aura.count && count >= e.data->event.aura.count))
+                    ProcessTimedAction(e, e.data->event.aura.repeatMin, e.data->event.aura.repeatMax);
                 break;
             }
         case SMART_EVENT_TARGET_BUFFED:
             {
                 if (!me || !me->GetVictim())
                     return;
-                uint32 count = me->GetVictim()->GetAuraCount(e.event.aura.spell);
-                if (count < e.event.aura.count)
+                uint32 count = me->GetVictim()->GetAuraCount(e.data->event.aura.spell);
+                if (count < e.data->event.aura.count)
                     return;
-                ProcessTimedAction(e, e.event.aura.repeatMin, e.event.aura.repeatMax, me->GetVictim());
+                ProcessTimedAction(e, e.data->event.aura.repeatMin, e.data->event.aura.repeatMax, me->GetVictim());
                 break;
             }
         case SMART_EVENT_CHARMED:
             {
-                if (bvar == (e.event.charm.onRemove != 1))
+                if (bvar == (e.data->event.charm.onRemove != 1))
                     ProcessAction(e, unit, var0, var1, bvar, spell, gob);
                 break;
             }
@@ -4229,7 +4245,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             break;
 
         case SMART_EVENT_GOSSIP_HELLO:
-            switch (e.event.gossipHello.filter)
+            switch (e.data->event.gossipHello.filter)
             {
             case 0:
                 // no filter set, always execute action
@@ -4262,9 +4278,9 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
 
                 if (Unit* victim = me->GetVictim())
                 {
-                    if (e.event.minMaxRepeat.rangeMax && (me->IsInRange(victim, (float)e.event.minMaxRepeat.rangeMin, (float)e.event.minMaxRepeat.rangeMax)))
+                    if (e.data->event.minMaxRepeat.rangeMax && (me->IsInRange(victim, (float)e.data->event.minMaxRepeat.rangeMin, (float)e.data->event.minMaxRepeat.rangeMax)))
                         if (!victim->HasInArc(static_cast<float>(M_PI), me))
-                            ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, victim);
+                            ProcessTimedAction(e, e.data->event.minMaxRepeat.repeatMin, e.data->event.minMaxRepeat.repeatMax, victim);
                 }
 
                 break;
@@ -4275,28 +4291,28 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     return;
 
                 if (Unit* victim = me->GetVictim())
-                    if ((!e.event.meleeRange.invert && me->IsWithinMeleeRange(victim, static_cast<float>(e.event.meleeRange.dist))) ||
-                        (e.event.meleeRange.invert && !me->IsWithinMeleeRange(victim, static_cast<float>(e.event.meleeRange.dist))))
-                        ProcessTimedAction(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax, victim);
+                    if ((!e.data->event.meleeRange.invert && me->IsWithinMeleeRange(victim, static_cast<float>(e.data->event.meleeRange.dist))) ||
+                        (e.data->event.meleeRange.invert && !me->IsWithinMeleeRange(victim, static_cast<float>(e.data->event.meleeRange.dist))))
+                        ProcessTimedAction(e, e.data->event.minMaxRepeat.repeatMin, e.data->event.minMaxRepeat.repeatMax, victim);
 
                 break;
             }
         case SMART_EVENT_RECEIVE_EMOTE:
-            if (e.event.emote.emote == var0)
+            if (e.data->event.emote.emote == var0)
             {
                 ProcessAction(e, unit);
-                RecalcTimer(e, e.event.emote.cooldownMin, e.event.emote.cooldownMax);
+                RecalcTimer(e, e.data->event.emote.cooldownMin, e.data->event.emote.cooldownMax);
             }
             break;
         case SMART_EVENT_KILL:
             {
                 if (!me || !unit)
                     return;
-                if (e.event.kill.playerOnly && !unit->IsPlayer())
+                if (e.data->event.kill.playerOnly && !unit->IsPlayer())
                     return;
-                if (e.event.kill.creature && unit->GetEntry() != e.event.kill.creature)
+                if (e.data->event.kill.creature && unit->GetEntry() != e.data->event.kill.creature)
                     return;
-                RecalcTimer(e, e.event.kill.cooldownMin, e.event.kill.cooldownMax);
+                RecalcTimer(e, e.data->event.kill.cooldownMin, e.data->event.kill.cooldownMax);
                 ProcessAction(e, unit);
                 break;
             }
@@ -4305,10 +4321,10 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             {
                 if (!spell)
                     return;
-                if ((!e.event.spellHit.spell || spell->Id == e.event.spellHit.spell) &&
-                        (!e.event.spellHit.school || (spell->SchoolMask & e.event.spellHit.school)))
+                if ((!e.data->event.spellHit.spell || spell->Id == e.data->event.spellHit.spell) &&
+                        (!e.data->event.spellHit.school || (spell->SchoolMask & e.data->event.spellHit.school)))
                 {
-                    RecalcTimer(e, e.event.spellHit.cooldownMin, e.event.spellHit.cooldownMax);
+                    RecalcTimer(e, e.data->event.spellHit.cooldownMin, e.data->event.spellHit.cooldownMax);
                     ProcessAction(e, unit, 0, 0, bvar, spell);
                 }
                 break;
@@ -4318,20 +4334,20 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 if (!me || me->IsEngaged())
                     return;
                 //can trigger if closer than fMaxAllowedRange
-                float range = (float)e.event.los.maxDist;
+                float range = (float)e.data->event.los.maxDist;
 
                 //if range is ok and we are actually in LOS
                 if (me->IsWithinDistInMap(unit, range) && me->IsWithinLOSInMap(unit))
                 {
-                    SmartEvent::LOSHostilityMode hostilityMode = static_cast<SmartEvent::LOSHostilityMode>(e.event.los.hostilityMode);
+                    SmartEvent::LOSHostilityMode hostilityMode = static_cast<SmartEvent::LOSHostilityMode>(e.data->event.los.hostilityMode);
                     //if friendly event&&who is not hostile OR hostile event&&who is hostile
                     if ((hostilityMode == SmartEvent::LOSHostilityMode::Any) ||
                         (hostilityMode == SmartEvent::LOSHostilityMode::NotHostile && !me->IsHostileTo(unit)) ||
                         (hostilityMode == SmartEvent::LOSHostilityMode::Hostile && me->IsHostileTo(unit)))
                     {
-                        if (e.event.los.playerOnly && !unit->IsPlayer())
+                        if (e.data->event.los.playerOnly && !unit->IsPlayer())
                             return;
-                        RecalcTimer(e, e.event.los.cooldownMin, e.event.los.cooldownMax);
+                        RecalcTimer(e, e.data->event.los.cooldownMin, e.data->event.los.cooldownMax);
                         ProcessAction(e, unit);
                     }
                 }
@@ -4342,20 +4358,20 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 if (!me || !me->IsEngaged())
                     return;
                 //can trigger if closer than fMaxAllowedRange
-                float range = (float)e.event.los.maxDist;
+                float range = (float)e.data->event.los.maxDist;
 
                 //if range is ok and we are actually in LOS
                 if (me->IsWithinDistInMap(unit, range) && me->IsWithinLOSInMap(unit))
                 {
-                    SmartEvent::LOSHostilityMode hostilityMode = static_cast<SmartEvent::LOSHostilityMode>(e.event.los.hostilityMode);
+                    SmartEvent::LOSHostilityMode hostilityMode = static_cast<SmartEvent::LOSHostilityMode>(e.data->event.los.hostilityMode);
                     //if friendly event&&who is not hostile OR hostile event&&who is hostile
                     if ((hostilityMode == SmartEvent::LOSHostilityMode::Any) ||
                         (hostilityMode == SmartEvent::LOSHostilityMode::NotHostile && !me->IsHostileTo(unit)) ||
                         (hostilityMode == SmartEvent::LOSHostilityMode::Hostile && me->IsHostileTo(unit)))
                     {
-                        if (e.event.los.playerOnly && !unit->IsPlayer())
+                        if (e.data->event.los.playerOnly && !unit->IsPlayer())
                             return;
-                        RecalcTimer(e, e.event.los.cooldownMin, e.event.los.cooldownMax);
+                        RecalcTimer(e, e.data->event.los.cooldownMin, e.data->event.los.cooldownMax);
                         ProcessAction(e, unit);
                     }
                 }
@@ -4365,9 +4381,9 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             {
                 if (!GetBaseObject())
                     return;
-                if (e.event.respawn.type == SMART_SCRIPT_RESPAWN_CONDITION_MAP && GetBaseObject()->GetMapId() != e.event.respawn.map)
+                if (e.data->event.respawn.type == SMART_SCRIPT_RESPAWN_CONDITION_MAP && GetBaseObject()->GetMapId() != e.data->event.respawn.map)
                     return;
-                if (e.event.respawn.type == SMART_SCRIPT_RESPAWN_CONDITION_AREA && GetBaseObject()->GetZoneId() != e.event.respawn.area)
+                if (e.data->event.respawn.type == SMART_SCRIPT_RESPAWN_CONDITION_AREA && GetBaseObject()->GetZoneId() != e.data->event.respawn.area)
                     return;
                 ProcessAction(e);
                 break;
@@ -4378,9 +4394,9 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             {
                 if (!IsCreature(unit))
                     return;
-                if (e.event.summoned.creature && unit->GetEntry() != e.event.summoned.creature)
+                if (e.data->event.summoned.creature && unit->GetEntry() != e.data->event.summoned.creature)
                     return;
-                RecalcTimer(e, e.event.summoned.cooldownMin, e.event.summoned.cooldownMax);
+                RecalcTimer(e, e.data->event.summoned.cooldownMin, e.data->event.summoned.cooldownMax);
                 ProcessAction(e, unit);
                 break;
             }
@@ -4388,15 +4404,15 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
         case SMART_EVENT_DAMAGED:
         case SMART_EVENT_DAMAGED_TARGET:
             {
-                if (var0 > e.event.minMaxRepeat.max || var0 < e.event.minMaxRepeat.min)
+                if (var0 > e.data->event.minMaxRepeat.max || var0 < e.data->event.minMaxRepeat.min)
                     return;
-                RecalcTimer(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+                RecalcTimer(e, e.data->event.minMaxRepeat.repeatMin, e.data->event.minMaxRepeat.repeatMax);
                 ProcessAction(e, unit);
                 break;
             }
         case SMART_EVENT_MOVEMENTINFORM:
             {
-                if ((e.event.movementInform.type && var0 != e.event.movementInform.type) || (e.event.movementInform.id && var1 != e.event.movementInform.id))
+                if ((e.data->event.movementInform.type && var0 != e.data->event.movementInform.type) || (e.data->event.movementInform.id && var1 != e.data->event.movementInform.id))
                     return;
                 ProcessAction(e, unit, var0, var1);
                 break;
@@ -4404,7 +4420,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
         case SMART_EVENT_TRANSPORT_RELOCATE:
         case SMART_EVENT_WAYPOINT_START:
             {
-                if (e.event.waypoint.pathID && var0 != e.event.waypoint.pathID)
+                if (e.data->event.waypoint.pathID && var0 != e.data->event.waypoint.pathID)
                     return;
                 ProcessAction(e, unit, var0);
                 break;
@@ -4415,62 +4431,62 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
         case SMART_EVENT_WAYPOINT_STOPPED:
         case SMART_EVENT_WAYPOINT_ENDED:
             {
-                if (!me || (e.event.waypoint.pointID && var0 != e.event.waypoint.pointID) || (e.event.waypoint.pathID && GetPathId() != e.event.waypoint.pathID))
+                if (!me || (e.data->event.waypoint.pointID && var0 != e.data->event.waypoint.pointID) || (e.data->event.waypoint.pathID && GetPathId() != e.data->event.waypoint.pathID))
                     return;
                 ProcessAction(e, unit);
                 break;
             }
         case SMART_EVENT_SUMMON_DESPAWNED:
             {
-                if (e.event.summoned.creature && e.event.summoned.creature != var0)
+                if (e.data->event.summoned.creature && e.data->event.summoned.creature != var0)
                     return;
-                RecalcTimer(e, e.event.summoned.cooldownMin, e.event.summoned.cooldownMax);
+                RecalcTimer(e, e.data->event.summoned.cooldownMin, e.data->event.summoned.cooldownMax);
                 ProcessAction(e, unit, var0);
                 break;
             }
         case SMART_EVENT_INSTANCE_PLAYER_ENTER:
             {
-                if (e.event.instancePlayerEnter.team && var0 != e.event.instancePlayerEnter.team)
+                if (e.data->event.instancePlayerEnter.team && var0 != e.data->event.instancePlayerEnter.team)
                     return;
-                RecalcTimer(e, e.event.instancePlayerEnter.cooldownMin, e.event.instancePlayerEnter.cooldownMax);
+                RecalcTimer(e, e.data->event.instancePlayerEnter.cooldownMin, e.data->event.instancePlayerEnter.cooldownMax);
                 ProcessAction(e, unit, var0);
                 break;
             }
         case SMART_EVENT_ACCEPTED_QUEST:
         case SMART_EVENT_REWARD_QUEST:
             {
-                if (e.event.quest.quest && var0 != e.event.quest.quest)
+                if (e.data->event.quest.quest && var0 != e.data->event.quest.quest)
                     return;
-                RecalcTimer(e, e.event.quest.cooldownMin, e.event.quest.cooldownMax);
+                RecalcTimer(e, e.data->event.quest.cooldownMin, e.data->event.quest.cooldownMax);
                 ProcessAction(e, unit, var0);
                 break;
             }
         case SMART_EVENT_TRANSPORT_ADDCREATURE:
             {
-                if (e.event.transportAddCreature.creature && var0 != e.event.transportAddCreature.creature)
+                if (e.data->event.transportAddCreature.creature && var0 != e.data->event.transportAddCreature.creature)
                     return;
                 ProcessAction(e, unit, var0);
                 break;
             }
         case SMART_EVENT_AREATRIGGER_ONTRIGGER:
             {
-                if (e.event.areatrigger.id && var0 != e.event.areatrigger.id)
+                if (e.data->event.areatrigger.id && var0 != e.data->event.areatrigger.id)
                     return;
                 ProcessAction(e, unit, var0);
                 break;
             }
         case SMART_EVENT_TEXT_OVER:
             {
-                if (var0 != e.event.textOver.textGroupID || (e.event.textOver.creatureEntry && e.event.textOver.creatureEntry != var1))
+                if (var0 != e.data->event.textOver.textGroupID || (e.data->event.textOver.creatureEntry && e.data->event.textOver.creatureEntry != var1))
                     return;
                 ProcessAction(e, unit, var0);
                 break;
             }
         case SMART_EVENT_DATA_SET:
             {
-                if (e.event.dataSet.id != var0 || e.event.dataSet.value != var1)
+                if (e.data->event.dataSet.id != var0 || e.data->event.dataSet.value != var1)
                     return;
-                RecalcTimer(e, e.event.dataSet.cooldownMin, e.event.dataSet.cooldownMax);
+                RecalcTimer(e, e.data->event.dataSet.cooldownMin, e.data->event.dataSet.cooldownMax);
                 ProcessAction(e, unit, var0, var1, false, nullptr, gob);
                 break;
             }
@@ -4479,27 +4495,27 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             {
                 if (!unit)
                     return;
-                RecalcTimer(e, e.event.minMax.repeatMin, e.event.minMax.repeatMax);
+                RecalcTimer(e, e.data->event.minMax.repeatMin, e.data->event.minMax.repeatMax);
                 ProcessAction(e, unit);
                 break;
             }
         case SMART_EVENT_TIMED_EVENT_TRIGGERED:
             {
-                if (e.event.timedEvent.id == var0)
+                if (e.data->event.timedEvent.id == var0)
                     ProcessAction(e, unit);
                 break;
             }
         case SMART_EVENT_GOSSIP_SELECT:
             {
                 LOG_DEBUG("sql.sql", "SmartScript: Gossip Select:  menu {} action {}", var0, var1); //little help for scripters
-                if (e.event.gossip.sender != var0 || e.event.gossip.action != var1)
+                if (e.data->event.gossip.sender != var0 || e.data->event.gossip.action != var1)
                     return;
                 ProcessAction(e, unit, var0, var1);
                 break;
             }
         case SMART_EVENT_EVENT_PHASE_CHANGE:
             {
-                if (!IsInPhase(e.event.eventPhaseChange.phasemask))
+                if (!IsInPhase(e.data->event.eventPhaseChange.phasemask))
                     return;
 
                 WorldObject* templastInvoker = GetLastInvoker();
@@ -4515,28 +4531,28 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
         case SMART_EVENT_GAME_EVENT_START:
         case SMART_EVENT_GAME_EVENT_END:
             {
-                if (e.event.gameEvent.gameEventId != var0)
+                if (e.data->event.gameEvent.gameEventId != var0)
                     return;
                 ProcessAction(e, nullptr, var0);
                 break;
             }
         case SMART_EVENT_GO_STATE_CHANGED:
             {
-                if (e.event.goStateChanged.state != var0)
+                if (e.data->event.goStateChanged.state != var0)
                     return;
                 ProcessAction(e, unit, var0, var1);
                 break;
             }
         case SMART_EVENT_GO_EVENT_INFORM:
             {
-                if (e.event.eventInform.eventId != var0)
+                if (e.data->event.eventInform.eventId != var0)
                     return;
                 ProcessAction(e, nullptr, var0);
                 break;
             }
         case SMART_EVENT_ACTION_DONE:
             {
-                if (e.event.doAction.eventId != var0)
+                if (e.data->event.doAction.eventId != var0)
                     return;
                 ProcessAction(e, unit, var0);
                 break;
@@ -4564,7 +4580,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                             if (IsUnit(target) && me->IsFriendlyTo(target->ToUnit()) && target->ToUnit()->IsAlive() && target->ToUnit()->IsInCombat())
                             {
                                 uint32 healthPct = uint32(target->ToUnit()->GetHealthPct());
-                                if (healthPct > e.event.friendlyHealthPct.hpPct)
+                                if (healthPct > e.data->event.friendlyHealthPct.hpPct)
                                 {
                                     continue;
                                 }
@@ -4578,7 +4594,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     }
                     case SMART_TARGET_SELF:
                     case SMART_TARGET_ACTION_INVOKER:
-                        unitTarget = DoSelectLowestHpPercentFriendly((float)e.event.friendlyHealthPct.radius, 0, e.event.friendlyHealthPct.hpPct);
+                        unitTarget = DoSelectLowestHpPercentFriendly((float)e.data->event.friendlyHealthPct.radius, 0, e.data->event.friendlyHealthPct.hpPct);
                         break;
                     default:
                         return;
@@ -4587,7 +4603,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 if (!unitTarget)
                     return;
 
-                ProcessTimedAction(e, e.event.friendlyHealthPct.repeatMin, e.event.friendlyHealthPct.repeatMax, unitTarget);
+                ProcessTimedAction(e, e.data->event.friendlyHealthPct.repeatMin, e.data->event.friendlyHealthPct.repeatMax, unitTarget);
                 break;
             }
         case SMART_EVENT_DISTANCE_CREATURE:
@@ -4597,27 +4613,27 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
 
                 WorldObject* creature = nullptr;
 
-                if (e.event.distance.guid != 0)
+                if (e.data->event.distance.guid != 0)
                 {
-                    creature = FindCreatureNear(me, e.event.distance.guid);
+                    creature = FindCreatureNear(me, e.data->event.distance.guid);
 
                     if (!creature)
                         return;
 
-                    if (!me->IsInRange(creature, 0, (float)e.event.distance.dist))
+                    if (!me->IsInRange(creature, 0, (float)e.data->event.distance.dist))
                         return;
                 }
-                else if (e.event.distance.entry != 0)
+                else if (e.data->event.distance.entry != 0)
                 {
                     std::list<Creature*> list;
-                    me->GetCreatureListWithEntryInGrid(list, e.event.distance.entry, (float)e.event.distance.dist);
+                    me->GetCreatureListWithEntryInGrid(list, e.data->event.distance.entry, (float)e.data->event.distance.dist);
 
                     if (!list.empty())
                         creature = list.front();
                 }
 
                 if (creature)
-                    ProcessTimedAction(e, e.event.distance.repeat, e.event.distance.repeat);
+                    ProcessTimedAction(e, e.data->event.distance.repeat, e.data->event.distance.repeat);
 
                 break;
             }
@@ -4628,41 +4644,41 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
 
                 WorldObject* gameobject = nullptr;
 
-                if (e.event.distance.guid != 0)
+                if (e.data->event.distance.guid != 0)
                 {
-                    gameobject = FindGameObjectNear(me, e.event.distance.guid);
+                    gameobject = FindGameObjectNear(me, e.data->event.distance.guid);
 
                     if (!gameobject)
                         return;
 
-                    if (!me->IsInRange(gameobject, 0, (float)e.event.distance.dist))
+                    if (!me->IsInRange(gameobject, 0, (float)e.data->event.distance.dist))
                         return;
                 }
-                else if (e.event.distance.entry != 0)
+                else if (e.data->event.distance.entry != 0)
                 {
                     std::list<GameObject*> list;
-                    me->GetGameObjectListWithEntryInGrid(list, e.event.distance.entry, (float)e.event.distance.dist);
+                    me->GetGameObjectListWithEntryInGrid(list, e.data->event.distance.entry, (float)e.data->event.distance.dist);
 
                     if (!list.empty())
                         gameobject = list.front();
                 }
 
                 if (gameobject)
-                    ProcessTimedAction(e, e.event.distance.repeat, e.event.distance.repeat);
+                    ProcessTimedAction(e, e.data->event.distance.repeat, e.data->event.distance.repeat);
 
                 break;
             }
         case SMART_EVENT_COUNTER_SET:
-            if (e.event.counter.id != var0 || GetCounterValue(e.event.counter.id) != e.event.counter.value)
+            if (e.data->event.counter.id != var0 || GetCounterValue(e.data->event.counter.id) != e.data->event.counter.value)
                 return;
 
-            ProcessTimedAction(e, e.event.counter.cooldownMin, e.event.counter.cooldownMax);
+            ProcessTimedAction(e, e.data->event.counter.cooldownMin, e.data->event.counter.cooldownMax);
             break;
         case SMART_EVENT_NEAR_PLAYERS:
         {
             uint32 playerCount = 0;
             ObjectVector targets;
-            GetWorldObjectsInDist(targets, static_cast<float>(e.event.nearPlayer.radius));
+            GetWorldObjectsInDist(targets, static_cast<float>(e.data->event.nearPlayer.radius));
 
             if (!targets.empty())
             {
@@ -4670,17 +4686,17 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     if (IsPlayer(target) && !target->ToPlayer()->IsGameMaster())
                         playerCount++;
 
-                if (playerCount >= e.event.nearPlayer.minCount)
+                if (playerCount >= e.data->event.nearPlayer.minCount)
                     ProcessAction(e, unit);
             }
-            RecalcTimer(e, e.event.nearPlayer.repeatMin, e.event.nearPlayer.repeatMax);
+            RecalcTimer(e, e.data->event.nearPlayer.repeatMin, e.data->event.nearPlayer.repeatMax);
             break;
         }
         case SMART_EVENT_NEAR_PLAYERS_NEGATION:
         {
             uint32 playerCount = 0;
             ObjectVector targets;
-            GetWorldObjectsInDist(targets, static_cast<float>(e.event.nearPlayerNegation.radius));
+            GetWorldObjectsInDist(targets, static_cast<float>(e.data->event.nearPlayerNegation.radius));
 
             if (!targets.empty())
             {
@@ -4688,25 +4704,25 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     if (IsPlayer(target) && !target->ToPlayer()->IsGameMaster())
                         playerCount++;
 
-                if (playerCount < e.event.nearPlayerNegation.maxCount)
+                if (playerCount < e.data->event.nearPlayerNegation.maxCount)
                     ProcessAction(e, unit);
             }
-            RecalcTimer(e, e.event.nearPlayerNegation.repeatMin, e.event.nearPlayerNegation.repeatMax);
+            RecalcTimer(e, e.data->event.nearPlayerNegation.repeatMin, e.data->event.nearPlayerNegation.repeatMax);
             break;
         }
         case SMART_EVENT_NEAR_UNIT:
         {
             uint32 unitCount = 0;
             ObjectVector targets;
-            GetWorldObjectsInDist(targets, static_cast<float>(e.event.nearUnit.range));
+            GetWorldObjectsInDist(targets, static_cast<float>(e.data->event.nearUnit.range));
 
             if (!targets.empty())
             {
-                if (e.event.nearUnit.type)
+                if (e.data->event.nearUnit.type)
                 {
                     for (WorldObject* target : targets)
                     {
-                        if (IsGameObject(target) && target->GetEntry() == e.event.nearUnit.entry)
+                        if (IsGameObject(target) && target->GetEntry() == e.data->event.nearUnit.entry)
                             unitCount++;
                     }
                 }
@@ -4714,30 +4730,30 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 {
                     for (WorldObject* target : targets)
                     {
-                        if (IsCreature(target) && target->GetEntry() == e.event.nearUnit.entry)
+                        if (IsCreature(target) && target->GetEntry() == e.data->event.nearUnit.entry)
                             unitCount++;
                     }
                 }
 
-                if (unitCount >= e.event.nearUnit.count)
+                if (unitCount >= e.data->event.nearUnit.count)
                     ProcessAction(e, unit);
             }
-            RecalcTimer(e, e.event.nearUnit.timer, e.event.nearUnit.timer);
+            RecalcTimer(e, e.data->event.nearUnit.timer, e.data->event.nearUnit.timer);
             break;
         }
         case SMART_EVENT_NEAR_UNIT_NEGATION:
         {
             uint32 unitCount = 0;
             ObjectVector targets;
-            GetWorldObjectsInDist(targets, static_cast<float>(e.event.nearUnitNegation.range));
+            GetWorldObjectsInDist(targets, static_cast<float>(e.data->event.nearUnitNegation.range));
 
             if (!targets.empty())
             {
-                if (e.event.nearUnitNegation.type)
+                if (e.data->event.nearUnitNegation.type)
                 {
                     for (WorldObject* target : targets)
                     {
-                        if (IsGameObject(target) && target->GetEntry() == e.event.nearUnitNegation.entry)
+                        if (IsGameObject(target) && target->GetEntry() == e.data->event.nearUnitNegation.entry)
                             unitCount++;
                     }
                 }
@@ -4745,15 +4761,15 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                 {
                     for (WorldObject* target : targets)
                     {
-                        if (IsCreature(target) && target->GetEntry() == e.event.nearUnitNegation.entry)
+                        if (IsCreature(target) && target->GetEntry() == e.data->event.nearUnitNegation.entry)
                             unitCount++;
                     }
                 }
 
-                if (unitCount < e.event.nearUnitNegation.count)
+                if (unitCount < e.data->event.nearUnitNegation.count)
                     ProcessAction(e, unit);
             }
-            RecalcTimer(e, e.event.nearUnitNegation.timer, e.event.nearUnitNegation.timer);
+            RecalcTimer(e, e.data->event.nearUnitNegation.timer, e.data->event.nearUnitNegation.timer);
             break;
         }
         case SMART_EVENT_AREA_CASTING:
@@ -4769,11 +4785,11 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
                     if (!target || !IsPlayer(target) || !target->IsNonMeleeSpellCast(false, false, true))
                         continue;
 
-                    if (!(me->IsInRange(target, (float)e.event.minMaxRepeat.rangeMin, (float)e.event.minMaxRepeat.rangeMax)))
+                    if (!(me->IsInRange(target, (float)e.data->event.minMaxRepeat.rangeMin, (float)e.data->event.minMaxRepeat.rangeMax)))
                         continue;
 
                     ProcessAction(e, target);
-                    RecalcTimer(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+                    RecalcTimer(e, e.data->event.minMaxRepeat.repeatMin, e.data->event.minMaxRepeat.repeatMax);
                     return;
                 }
 
@@ -4794,11 +4810,11 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
             {
                 if (Unit* target = ObjectAccessor::GetUnit(*me, (*i)->getUnitGuid()))
                 {
-                    if (!(me->IsInRange(target, (float)e.event.minMaxRepeat.rangeMin, (float)e.event.minMaxRepeat.rangeMax)))
+                    if (!(me->IsInRange(target, (float)e.data->event.minMaxRepeat.rangeMin, (float)e.data->event.minMaxRepeat.rangeMax)))
                         continue;
 
                     ProcessAction(e, target);
-                    RecalcTimer(e, e.event.minMaxRepeat.repeatMin, e.event.minMaxRepeat.repeatMax);
+                    RecalcTimer(e, e.data->event.minMaxRepeat.repeatMin, e.data->event.minMaxRepeat.repeatMax);
                     return;
                 }
             }
@@ -4810,7 +4826,7 @@ void SmartScript::ProcessEvent(SmartScriptHolder& e, Unit* unit, uint32 var0, ui
         case SMART_EVENT_WAYPOINT_DATA_REACHED:
         case SMART_EVENT_WAYPOINT_DATA_ENDED:
         {
-            if (!me || (e.event.wpData.pointId && var0 != e.event.wpData.pointId) || (e.event.wpData.pathId && me->GetWaypointPath() != e.event.wpData.pathId))
+            if (!me || (e.data->event.wpData.pointId && var0 != e.data->event.wpData.pointId) || (e.data->event.wpData.pathId && me->GetWaypointPath() != e.data->event.wpData.pathId))
                 return;
             ProcessAction(e, unit);
             break;
@@ -4828,7 +4844,7 @@ void SmartScript::InitTimer(SmartScriptHolder& e)
         //set only events which have initial timers
         case SMART_EVENT_NEAR_PLAYERS:
         case SMART_EVENT_NEAR_PLAYERS_NEGATION:
-            RecalcTimer(e, e.event.nearPlayer.firstTimer, e.event.nearPlayer.firstTimer);
+            RecalcTimer(e, e.data->event.nearPlayer.firstTimer, e.data->event.nearPlayer.firstTimer);
             break;
         case SMART_EVENT_UPDATE:
         case SMART_EVENT_UPDATE_IC:
@@ -4839,15 +4855,15 @@ void SmartScript::InitTimer(SmartScriptHolder& e)
         case SMART_EVENT_IS_BEHIND_TARGET:
         case SMART_EVENT_FRIENDLY_HEALTH_PCT:
         case SMART_EVENT_IS_IN_MELEE_RANGE:
-            RecalcTimer(e, e.event.minMaxRepeat.min, e.event.minMaxRepeat.max);
+            RecalcTimer(e, e.data->event.minMaxRepeat.min, e.data->event.minMaxRepeat.max);
             break;
         case SMART_EVENT_DISTANCE_CREATURE:
         case SMART_EVENT_DISTANCE_GAMEOBJECT:
-            RecalcTimer(e, e.event.distance.repeat, e.event.distance.repeat);
+            RecalcTimer(e, e.data->event.distance.repeat, e.data->event.distance.repeat);
             break;
         case SMART_EVENT_NEAR_UNIT:
         case SMART_EVENT_NEAR_UNIT_NEGATION:
-            RecalcTimer(e, e.event.nearUnit.timer, e.event.nearUnit.timer);
+            RecalcTimer(e, e.data->event.nearUnit.timer, e.data->event.nearUnit.timer);
             break;
         default:
             e.active = true;
@@ -4866,7 +4882,7 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
     if (e.GetEventType() == SMART_EVENT_LINK)
         return;
 
-    if (e.event.event_phase_mask && !IsInPhase(e.event.event_phase_mask))
+    if (e.data->event.event_phase_mask && !IsInPhase(e.data->event.event_phase_mask))
         return;
 
     if (e.GetEventType() == SMART_EVENT_UPDATE_IC && (!me || !me->IsEngaged()))
@@ -4880,7 +4896,7 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
         // delay spell cast for another AI tick if another spell is being cast
         if (e.GetActionType() == SMART_ACTION_CAST)
         {
-            if (!(e.action.cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS))
+            if (!(e.data->action.cast.castFlags & SMARTCAST_INTERRUPT_PREVIOUS))
             {
                 if (me && me->HasUnitState(UNIT_STATE_CASTING))
                 {
@@ -4940,7 +4956,7 @@ void SmartScript::UpdateTimer(SmartScriptHolder& e, uint32 const diff)
                         for (SmartAIEventList::iterator i = mTimedActionList.begin(); i != mTimedActionList.end(); ++i)
                         {
                             //find the first event which is not the current one and enable it
-                            if (i->event_id > e.event_id)
+                            if (i->data->event_id > e.data->event_id)
                             {
                                 i->enableTimed = true;
                                 break;
@@ -4980,6 +4996,7 @@ void SmartScript::InstallEvents()
             mEvents.push_back(*i);//must be before UpdateTimers
 
         mInstallEvents.clear();
+        BuildEventIndex();
     }
 }
 
@@ -4993,6 +5010,7 @@ void SmartScript::OnUpdate(uint32 const diff)
     if (mEventSortingRequired)
     {
         SortEvents(mEvents);
+        BuildEventIndex();
         mEventSortingRequired = false;
     }
 
@@ -5056,6 +5074,26 @@ void SmartScript::SortEvents(SmartAIEventList& events)
     std::sort(events.begin(), events.end());
 }
 
+void SmartScript::BuildEventIndex()
+{
+    // counting sort of the event positions by type, keeping the order of mEvents inside every type
+    mEventIndexOffsets.fill(0);
+    for (SmartScriptHolder const& holder : mEvents)
+        if (holder.GetEventType() < SMART_EVENT_AC_END)
+            ++mEventIndexOffsets[holder.GetEventType() + 1];
+
+    for (uint32 type = 0; type < SMART_EVENT_AC_END; ++type)
+        mEventIndexOffsets[type + 1] += mEventIndexOffsets[type];
+
+    std::array<uint32, SMART_EVENT_AC_END> next;
+    std::copy_n(mEventIndexOffsets.begin(), SMART_EVENT_AC_END, next.begin());
+
+    mEventIndex.resize(mEventIndexOffsets[SMART_EVENT_AC_END]);
+    for (uint32 i = 0; i < mEvents.size(); ++i)
+        if (mEvents[i].GetEventType() < SMART_EVENT_AC_END)
+            mEventIndex[next[mEvents[i].GetEventType()]++] = i;
+}
+
 void SmartScript::RaisePriority(SmartScriptHolder& e)
 {
     e.timer = 1200;
@@ -5073,12 +5111,12 @@ void SmartScript::RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll)
 
     // This allows to retry the action later without rolling again the chance roll (which might fail and end up not executing the action)
     if (ignoreChanceRoll)
-        e.event.event_flags |= SMART_EVENT_FLAG_TEMP_IGNORE_CHANCE_ROLL;
+        e.ignoreChanceRoll = true;
 
     e.runOnce = false;
 }
 
-void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTrigger const* at)
+void SmartScript::FillScript(std::span<SmartScriptData const> e, WorldObject* obj, AreaTrigger const* at)
 {
     (void)at; // ensure that the variable is referenced even if extra logs are disabled in order to pass compiler checks
 
@@ -5091,7 +5129,8 @@ void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTrigger c
             LOG_DEBUG("sql.sql", "SmartScript: EventMap for AreaTrigger {} is empty but is using SmartScript.", at->entry);
         return;
     }
-    for (SmartAIEventList::iterator i = e.begin(); i != e.end(); ++i)
+    mEvents.reserve(mEvents.size() + e.size());
+    for (auto i = e.begin(); i != e.end(); ++i)
     {
 #ifndef ACORE_DEBUG
         if ((*i).event.event_flags & SMART_EVENT_FLAG_DEBUG_ONLY)
@@ -5104,23 +5143,28 @@ void SmartScript::FillScript(SmartAIEventList e, WorldObject* obj, AreaTrigger c
             {
                 if ((1 << (obj->GetMap()->GetSpawnMode() + 1)) & (*i).event.event_flags)
                 {
-                    mEvents.push_back((*i));
+                    mEvents.emplace_back(*i);
                 }
             }
             continue;
         }
-        mEvents.push_back((*i));//NOTE: 'world(0)' events still get processed in ANY instance mode
+        mEvents.emplace_back(*i);//NOTE: 'world(0)' events still get processed in ANY instance mode
     }
+
+    BuildEventIndex();
 }
 
 void SmartScript::GetScript()
 {
-    SmartAIEventList e;
+    // the rows stay owned by the table, keep it alive for as long as this script runs
+    mScriptTable = sSmartScriptMgr->GetScriptTable();
+
+    std::span<SmartScriptData const> e;
     if (me)
     {
-        e = sSmartScriptMgr->GetScript(-((int32)me->GetSpawnId()), mScriptType);
+        e = mScriptTable->GetScript(-((int32)me->GetSpawnId()), mScriptType);
         if (e.empty())
-            e = sSmartScriptMgr->GetScript((int32)me->GetEntry(), mScriptType);
+            e = mScriptTable->GetScript((int32)me->GetEntry(), mScriptType);
 
         FillScript(e, me, nullptr);
 
@@ -5128,21 +5172,21 @@ void SmartScript::GetScript()
         {
             if (cInfo->HasFlagsExtra(CREATURE_FLAG_EXTRA_DONT_OVERRIDE_ENTRY_SAI))
             {
-                e = sSmartScriptMgr->GetScript((int32)me->GetEntry(), mScriptType);
+                e = mScriptTable->GetScript((int32)me->GetEntry(), mScriptType);
                 FillScript(e, me, nullptr);
             }
         }
     }
     else if (go)
     {
-        e = sSmartScriptMgr->GetScript(-((int32)go->GetSpawnId()), mScriptType);
+        e = mScriptTable->GetScript(-((int32)go->GetSpawnId()), mScriptType);
         if (e.empty())
-            e = sSmartScriptMgr->GetScript((int32)go->GetEntry(), mScriptType);
+            e = mScriptTable->GetScript((int32)go->GetEntry(), mScriptType);
         FillScript(e, go, nullptr);
     }
     else if (trigger)
     {
-        e = sSmartScriptMgr->GetScript((int32)trigger->entry, mScriptType);
+        e = mScriptTable->GetScript((int32)trigger->entry, mScriptType);
         FillScript(e, nullptr, trigger);
     }
 }
@@ -5308,30 +5352,36 @@ void SmartScript::SetScript9(SmartScriptHolder& e, uint32 entry)
     // any SmartScriptHolder contained like the "e" parameter passed to this function
     if (isProcessingTimedActionList)
     {
-        LOG_ERROR("scripts.ai.sai", "Entry {} SourceType {} Event {} Action {} is trying to overwrite timed action list from a timed action, this is not allowed!.", e.entryOrGuid, e.GetScriptType(), e.GetEventType(), e.GetActionType());
+        LOG_ERROR("scripts.ai.sai", "Entry {} SourceType {} Event {} Action {} is trying to overwrite timed action list from a timed action, this is not allowed!.", e.data->entryOrGuid, e.GetScriptType(), e.GetEventType(), e.GetActionType());
         return;
     }
 
     // Do NOT allow to start a new actionlist if a previous one is already running, unless explicitly allowed. We need to always finish the current actionlist
-    if (!e.action.timedActionList.allowOverride && !mTimedActionList.empty())
+    if (!e.data->action.timedActionList.allowOverride && !mTimedActionList.empty())
     {
         return;
     }
 
     mTimedActionList.clear();
-    mTimedActionList = sSmartScriptMgr->GetScript(entry, SMART_SCRIPT_TYPE_TIMED_ACTIONLIST);
-    if (mTimedActionList.empty())
+    mTimedActionListTable = sSmartScriptMgr->GetScriptTable();
+    std::span<SmartScriptData const> actionList = mTimedActionListTable->GetScript(entry, SMART_SCRIPT_TYPE_TIMED_ACTIONLIST);
+    if (actionList.empty())
         return;
+
+    mTimedActionList.reserve(actionList.size());
+    for (SmartScriptData const& data : actionList)
+        mTimedActionList.emplace_back(data);
+
     for (SmartAIEventList::iterator i = mTimedActionList.begin(); i != mTimedActionList.end(); ++i)
     {
         i->enableTimed = i == mTimedActionList.begin();//enable processing only for the first action
 
-        if (e.action.timedActionList.timerType == 0)
-            i->event.type = SMART_EVENT_UPDATE_OOC;
-        else if (e.action.timedActionList.timerType == 1)
-            i->event.type = SMART_EVENT_UPDATE_IC;
-        else if (e.action.timedActionList.timerType > 1)
-            i->event.type = SMART_EVENT_UPDATE;
+        if (e.data->action.timedActionList.timerType == 0)
+            i->eventType = SMART_EVENT_UPDATE_OOC;
+        else if (e.data->action.timedActionList.timerType == 1)
+            i->eventType = SMART_EVENT_UPDATE_IC;
+        else if (e.data->action.timedActionList.timerType > 1)
+            i->eventType = SMART_EVENT_UPDATE;
 
         InitTimer((*i));
     }
@@ -23,6 +23,7 @@
 #include "SmartScriptMgr.h"
 #include "Spell.h"
 #include "Unit.h"
+#include <array>
 #include <deque>
 
 class SmartScript
@@ -44,7 +45,7 @@ public:
 
     void OnInitialize(WorldObject* obj, AreaTrigger const* at = nullptr);
     void GetScript();
-    void FillScript(SmartAIEventList e, WorldObject* obj, AreaTrigger const* at);
+    void FillScript(std::span<SmartScriptData const> e, WorldObject* obj, AreaTrigger const* at);
 
     void ProcessEventsFor(SMART_EVENT e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
     void ProcessEvent(SmartScriptHolder& e, Unit* unit = nullptr, uint32 var0 = 0, uint32 var1 = 0, bool bvar = false, SpellInfo const* spell = nullptr, GameObject* gob = nullptr);
@@ -214,12 +215,19 @@ private:
     bool IsInPhase(uint32 p) const;
 
     void SortEvents(SmartAIEventList& events);
+    void BuildEventIndex();
+    static ConditionSpan GetConditions(SmartScriptHolder& e);
     void RaisePriority(SmartScriptHolder& e);
     void RetryLater(SmartScriptHolder& e, bool ignoreChanceRoll = false);
 
     SmartAIEventList mEvents;
+    // positions in mEvents grouped by event type, mEventIndex[mEventIndexOffsets[type]] up to mEventIndexOffsets[type + 1]
+    std::vector<uint32> mEventIndex;
+    std::array<uint32, SMART_EVENT_AC_END + 1> mEventIndexOffsets;
     SmartAIEventList mInstallEvents;
     SmartAIEventList mTimedActionList;
+    std::shared_ptr<SmartScriptTable const> mScriptTable;
+    std::shared_ptr<SmartScriptTable const> mTimedActionListTable;
     bool isProcessingTimedActionList;
     Creature* me;
     ObjectGuid meOrigGUID;
@@ -255,7 +263,7 @@ private:
         {
             for (SmartAIEventStoredList::iterator i = mStoredEvents.begin(); i != mStoredEvents.end(); ++i)
             {
-                if (i->event_id == id)
+                if (i->data->event_id == id)
                 {
                     mStoredEvents.erase(i);
                     return;
@@ -270,7 +278,7 @@ private:
         {
             for (SmartAIEventList::iterator i = mEvents.begin(); i != mEvents.end(); ++i)
             {
-                if (i->event_id == link)
+                if (i->data->event_id == link)
                 {
                     return std::ref(*i);
                 }
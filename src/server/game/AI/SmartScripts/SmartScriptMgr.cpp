@@ -27,7 +27,7 @@
 #include "ScriptedCreature.h"
 #include "SpellMgr.h"
 
-bool SmartAIMgr::IsSAIBoolValid(SmartScriptHolder const& e, SAIBool value)
+bool SmartAIMgr::IsSAIBoolValid(SmartScriptData const& e, SAIBool value)
 {
     if (value != 0 && value != 1)
     {
@@ -128,8 +128,9 @@ void SmartAIMgr::LoadSmartAIFromDB()
 {
     uint32 oldMSTime = getMSTime();
 
-    for (uint8 i = 0; i < SMART_SCRIPT_TYPE_MAX; i++)
-        mEventMap[i].clear();  //Drop Existing SmartAI List
+    // scripts that are already running keep the previous table until they are gone
+    mScriptTable = std::make_shared<SmartScriptTable>();
+    SmartAIEventMap eventMap[SMART_SCRIPT_TYPE_MAX];
 
     WorldDatabasePreparedStatement* stmt = WorldDatabase.GetPreparedStatement(WORLD_SEL_SMART_SCRIPTS);
     PreparedQueryResult result = WorldDatabase.Query(stmt);
@@ -142,12 +143,13 @@ void SmartAIMgr::LoadSmartAIFromDB()
     }
 
     uint32 count = 0;
+    std::size_t rowCount = 0;
 
     do
     {
         Field* fields = result->Fetch();
 
-        SmartScriptHolder temp;
+        SmartScriptData temp;
 
         temp.entryOrGuid = fields[0].Get<int32>();
         if (!temp.entryOrGuid)
@@ -287,16 +289,31 @@ void SmartAIMgr::LoadSmartAIFromDB()
                 temp.target.type = SMART_TARGET_POSITION;
 
         // creature entry / guid not found in storage, create empty event list for it and increase counters
-        if (mEventMap[source_type].find(temp.entryOrGuid) == mEventMap[source_type].end())
+        if (eventMap[source_type].find(temp.entryOrGuid) == eventMap[source_type].end())
         {
             ++count;
-            SmartAIEventList eventList;
-            mEventMap[source_type][temp.entryOrGuid] = eventList;
+            eventMap[source_type][temp.entryOrGuid] = std::vector<SmartScriptData>();
         }
         // store the new event
-        mEventMap[source_type][temp.entryOrGuid].push_back(temp);
+        eventMap[source_type][temp.entryOrGuid].push_back(temp);
+        ++rowCount;
     } while (result->NextRow());
 
+    // flatten the scripts, so the rows of a script are next to each other
+    std::shared_ptr<SmartScriptTable> table = std::make_shared<SmartScriptTable>();
+    table->_rows.reserve(rowCount);
+
+    for (uint32 type = 0; type < SMART_SCRIPT_TYPE_MAX; ++type)
+    {
+        for (auto const& [entryOrGuid, events] : eventMap[type])
+        {
+            table->_scripts[type][entryOrGuid] = { uint32(table->_rows.size()), uint32(events.size()) };
+            table->_rows.insert(table->_rows.end(), events.begin(), events.end());
+        }
+    }
+
+    mScriptTable = std::move(table);
+
     CheckIfSmartAIInDatabaseExists();
 
     LOG_INFO("server.loading", ">> Loaded {} SmartAI scripts in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
@@ -314,7 +331,7 @@ void SmartAIMgr::CheckIfSmartAIInDatabaseExists()
         bool found = false;
 
         // check template SAI
-        if (mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_CREATURE)].find(creatureTemplate.Entry) != mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_CREATURE)].end())
+        if (!mScriptTable->GetScript(creatureTemplate.Entry, SmartScriptType::SMART_SCRIPT_TYPE_CREATURE).empty())
             found = true;
         else
         {
@@ -324,7 +341,7 @@ void SmartAIMgr::CheckIfSmartAIInDatabaseExists()
                 if (pair.second.id1 != creatureTemplate.Entry)
                     continue;
 
-                if (mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_CREATURE)].find((-1) * pair.first) != mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_CREATURE)].end())
+                if (!mScriptTable->GetScript((-1) * pair.first, SmartScriptType::SMART_SCRIPT_TYPE_CREATURE).empty())
                 {
                     found = true;
                     break;
@@ -345,7 +362,7 @@ void SmartAIMgr::CheckIfSmartAIInDatabaseExists()
         bool found = false;
 
         // check template SAI
-        if (mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_GAMEOBJECT)].find(gameobjectTemplate.entry) != mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_GAMEOBJECT)].end())
+        if (!mScriptTable->GetScript(gameobjectTemplate.entry, SmartScriptType::SMART_SCRIPT_TYPE_GAMEOBJECT).empty())
             found = true;
         else
         {
@@ -355,7 +372,7 @@ void SmartAIMgr::CheckIfSmartAIInDatabaseExists()
                 if (pair.second.id != gameobjectTemplate.entry)
                     continue;
 
-                if (mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_GAMEOBJECT)].find((-1) * pair.first) != mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_GAMEOBJECT)].end())
+                if (!mScriptTable->GetScript((-1) * pair.first, SmartScriptType::SMART_SCRIPT_TYPE_GAMEOBJECT).empty())
                 {
                     found = true;
                     break;
@@ -375,7 +392,7 @@ void SmartAIMgr::CheckIfSmartAIInDatabaseExists()
         if (pair.second != scriptID)
             continue;
 
-        if (mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_AREATRIGGER)].find(pair.first) == mEventMap[uint32(SmartScriptType::SMART_SCRIPT_TYPE_AREATRIGGER)].end())
+        if (mScriptTable->GetScript(pair.first, SmartScriptType::SMART_SCRIPT_TYPE_AREATRIGGER).empty())
             LOG_ERROR("sql.sql", "AreaTrigger entry ({}) has SmartTrigger enabled but no SmartAI entries in the database.", pair.first);
     }
 }
@@ -435,7 +452,7 @@ void SmartAIMgr::CheckIfSmartAIInDatabaseExists()
     }
 }
 
-bool SmartAIMgr::IsTargetValid(SmartScriptHolder const& e)
+bool SmartAIMgr::IsTargetValid(SmartScriptData const& e)
 {
     if (e.GetActionType() == SMART_ACTION_INSTALL_AI_TEMPLATE)
         return true; // AI template has special handling
@@ -559,7 +576,7 @@ bool SmartAIMgr::IsTargetValid(SmartScriptHolder const& e)
     return true;
 }
 
-bool SmartAIMgr::CheckUnusedEventParams(SmartScriptHolder const& e)
+bool SmartAIMgr::CheckUnusedEventParams(SmartScriptData const& e)
 {
     std::size_t paramsStructSize = [&]() -> std::size_t
     {
@@ -684,7 +701,7 @@ bool SmartAIMgr::CheckUnusedEventParams(SmartScriptHolder const& e)
     return valid;
 }
 
-bool SmartAIMgr::CheckUnusedActionParams(SmartScriptHolder const& e)
+bool SmartAIMgr::CheckUnusedActionParams(SmartScriptData const& e)
 {
     std::size_t paramsStructSize = [&]() -> std::size_t
     {
@@ -886,7 +903,7 @@ bool SmartAIMgr::CheckUnusedActionParams(SmartScriptHolder const& e)
     return valid;
 }
 
-bool SmartAIMgr::CheckUnusedTargetParams(SmartScriptHolder const& e)
+bool SmartAIMgr::CheckUnusedTargetParams(SmartScriptData const& e)
 {
     std::size_t paramsStructSize = [&]() -> std::size_t
     {
@@ -950,7 +967,7 @@ bool SmartAIMgr::CheckUnusedTargetParams(SmartScriptHolder const& e)
     return valid;
 }
 
-bool SmartAIMgr::IsEventValid(SmartScriptHolder& e)
+bool SmartAIMgr::IsEventValid(SmartScriptData& e)
 {
     if ((e.event.type >= SMART_EVENT_TC_END && e.event.type <= SMART_EVENT_AC_START) || e.event.type >= SMART_EVENT_AC_END)
     {
@@ -2012,7 +2029,7 @@ bool SmartAIMgr::IsEventValid(SmartScriptHolder& e)
     return true;
 }
 
-bool SmartAIMgr::IsTextValid(SmartScriptHolder const& e, uint32 id)
+bool SmartAIMgr::IsTextValid(SmartScriptData const& e, uint32 id)
 {
     if (e.GetScriptType() != SMART_SCRIPT_TYPE_CREATURE)
         return true;
@@ -26,6 +26,8 @@
 #include "Optional.h"
 #include "SpellMgr.h"
 #include <limits>
+#include <memory>
+#include <span>
 
 typedef uint32 SAIBool;
 
@@ -1962,12 +1964,11 @@ enum SmartFollowType
     FOLLOW_TYPE_ANGULAR                    = 6                   // geese-like formation 135 and 225 degrees behind leader
 };
 
-// one line in DB is one event
-struct SmartScriptHolder
+// one line in DB is one event, shared by every object running the script
+struct SmartScriptData
 {
-    SmartScriptHolder() : entryOrGuid(0), source_type(SMART_SCRIPT_TYPE_CREATURE)
-        , event_id(0), link(0), event(), action(), target(), timer(0), priority(DEFAULT_PRIORITY), active(false), runOnce(false)
-        , enableTimed(false) {}
+    SmartScriptData() : entryOrGuid(0), source_type(SMART_SCRIPT_TYPE_CREATURE)
+        , event_id(0), link(0), event(), action(), target() {}
 
     int32 entryOrGuid;
     SmartScriptType source_type;
@@ -1983,17 +1984,44 @@ public:
     uint32 GetEventType() const { return (uint32)event.type; }
     uint32 GetActionType() const { return (uint32)action.type; }
     uint32 GetTargetType() const { return (uint32)target.type; }
+};
+
+// one event of a running script, only the state changing at runtime is kept per object
+struct SmartScriptHolder
+{
+    explicit SmartScriptHolder(SmartScriptData const& scriptData) : data(&scriptData), timer(0), priority(DEFAULT_PRIORITY), eventType(scriptData.event.type)
+        , active(false), runOnce(false), enableTimed(false), ignoreChanceRoll(false), conditionsLoadCount(0) {}
+    // events created at runtime own their data
+    explicit SmartScriptHolder(std::shared_ptr<SmartScriptData const> scriptData) : SmartScriptHolder(*scriptData)
+    {
+        ownedData = std::move(scriptData);
+    }
+
+    SmartScriptData const* data;
+
+    uint32 GetScriptType() const { return data->GetScriptType(); }
+    uint32 GetEventType() const { return (uint32)eventType; }
+    uint32 GetActionType() const { return data->GetActionType(); }
+    uint32 GetTargetType() const { return data->GetTargetType(); }
 
     uint32 timer;
     uint32 priority;
+    SMART_EVENT eventType;      // timed action lists override the type of their events
     bool active;
     bool runOnce;
     bool enableTimed;
+    bool ignoreChanceRoll;
+
+    // stored conditions of the event, resolved again whenever the conditions are reloaded
+    ConditionSpan conditions;
+    uint32 conditionsLoadCount;
+
+    std::shared_ptr<SmartScriptData const> ownedData;
 
     // Default comparision operator using priority field as first ordering field
     bool operator<(SmartScriptHolder const& other) const
     {
-        return std::tie(priority, entryOrGuid, source_type, event_id, link) < std::tie(other.priority, other.entryOrGuid, other.source_type, other.event_id, other.link);
+        return std::tie(priority, data->entryOrGuid, data->source_type, data->event_id, data->link) < std::tie(other.priority, other.data->entryOrGuid, other.data->source_type, other.data->event_id, other.data->link);
     }
 
     static constexpr uint32 DEFAULT_PRIORITY = std::numeric_limits<uint32>::max();
@@ -2064,7 +2092,38 @@ typedef std::vector<SmartScriptHolder> SmartAIEventList;
 typedef std::list<SmartScriptHolder> SmartAIEventStoredList;
 
 // all events for all entries / guids
-typedef std::unordered_map<int32, SmartAIEventList> SmartAIEventMap;
+typedef std::unordered_map<int32, std::vector<SmartScriptData>> SmartAIEventMap;
+
+/**
+ * Every loaded smart_scripts row in one flat array, ordered by script.
+ *
+ * Running scripts point into the rows and keep the table alive through a shared pointer,
+ * so reloading the scripts only affects objects that look up their script afterwards.
+ */
+class SmartScriptTable
+{
+public:
+    std::span<SmartScriptData const> GetScript(int32 entry, SmartScriptType type) const
+    {
+        auto itr = _scripts[uint32(type)].find(entry);
+        if (itr == _scripts[uint32(type)].end())
+        {
+            if (entry > 0) //first search is for guid (negative), do not drop error if not found
+                LOG_DEBUG("sql.sql", "SmartScriptTable::GetScript: Could not load Script for Entry {} ScriptType {}.", entry, uint32(type));
+            return {};
+        }
+
+        return std::span<SmartScriptData const>(_rows).subspan(itr->second.first, itr->second.second);
+    }
+
+    std::size_t GetRowCount() const { return _rows.size(); }
+
+private:
+    friend class SmartAIMgr;
+
+    std::vector<SmartScriptData> _rows;
+    std::unordered_map<int32, std::pair<uint32 /*first row*/, uint32 /*row count*/>> _scripts[SMART_SCRIPT_TYPE_MAX];
+};
 
 class SmartAIMgr
 {
@@ -2077,29 +2136,19 @@ public:
     void LoadSmartAIFromDB();
     void CheckIfSmartAIInDatabaseExists();
 
-    SmartAIEventList GetScript(int32 entry, SmartScriptType type)
-    {
-        SmartAIEventList temp;
-        if (mEventMap[uint32(type)].find(entry) != mEventMap[uint32(type)].end())
-            return mEventMap[uint32(type)][entry];
-        else
-        {
-            if (entry > 0) //first search is for guid (negative), do not drop error if not found
-                LOG_DEBUG("sql.sql", "SmartAIMgr::GetScript: Could not load Script for Entry {} ScriptType {}.", entry, uint32(type));
-            return temp;
-        }
-    }
+    /// Scripts are looked up in the returned table, which must be kept for as long as its rows are used
+    std::shared_ptr<SmartScriptTable const> GetScriptTable() const { return mScriptTable; }
 
 private:
     //event stores
-    SmartAIEventMap mEventMap[SMART_SCRIPT_TYPE_MAX];
+    std::shared_ptr<SmartScriptTable const> mScriptTable = std::make_shared<SmartScriptTable>();
 
     static bool EventHasInvoker(SMART_EVENT event);
 
-    bool IsEventValid(SmartScriptHolder& e);
-    bool IsTargetValid(SmartScriptHolder const& e);
+    bool IsEventValid(SmartScriptData& e);
+    bool IsTargetValid(SmartScriptData const& e);
 
-    /*inline bool IsTargetValid(SmartScriptHolder e, int32 target)
+    /*inline bool IsTargetValid(SmartScriptData e, int32 target)
     {
         if (target < SMART_TARGET_NONE || target >= SMART_TARGET_END)
         {
@@ -2109,7 +2158,7 @@ private:
         return true;
     }*/
 
-    bool IsMinMaxValid(SmartScriptHolder const& e, uint32 min, uint32 max)
+    bool IsMinMaxValid(SmartScriptData const& e, uint32 min, uint32 max)
     {
         if (max < min)
         {
@@ -2119,7 +2168,7 @@ private:
         return true;
     }
 
-    /*inline bool IsPercentValid(SmartScriptHolder e, int32 pct)
+    /*inline bool IsPercentValid(SmartScriptData e, int32 pct)
     {
         if (pct < -100 || pct > 100)
         {
@@ -2129,7 +2178,7 @@ private:
         return true;
     }*/
 
-    bool NotNULL(SmartScriptHolder const& e, uint32 data)
+    bool NotNULL(SmartScriptData const& e, uint32 data)
     {
         if (!data)
         {
@@ -2139,7 +2188,7 @@ private:
         return true;
     }
 
-    bool IsCreatureValid(SmartScriptHolder const& e, uint32 entry)
+    bool IsCreatureValid(SmartScriptData const& e, uint32 entry)
     {
         if (!sObjectMgr->GetCreatureTemplate(entry))
         {
@@ -2149,7 +2198,7 @@ private:
         return true;
     }
 
-    bool IsQuestValid(SmartScriptHolder const& e, uint32 entry)
+    bool IsQuestValid(SmartScriptData const& e, uint32 entry)
     {
         if (!sObjectMgr->GetQuestTemplate(entry))
         {
@@ -2159,7 +2208,7 @@ private:
         return true;
     }
 
-    bool IsGameObjectValid(SmartScriptHolder const& e, uint32 entry)
+    bool IsGameObjectValid(SmartScriptData const& e, uint32 entry)
     {
         if (!sObjectMgr->GetGameObjectTemplate(entry))
         {
@@ -2169,7 +2218,7 @@ private:
         return true;
     }
 
-    bool IsSpellValid(SmartScriptHolder const& e, uint32 entry)
+    bool IsSpellValid(SmartScriptData const& e, uint32 entry)
     {
         if (!sSpellMgr->GetSpellInfo(entry))
         {
@@ -2179,7 +2228,7 @@ private:
         return true;
     }
 
-    bool IsItemValid(SmartScriptHolder const& e, uint32 entry)
+    bool IsItemValid(SmartScriptData const& e, uint32 entry)
     {
         if (!sItemStore.LookupEntry(entry))
         {
@@ -2189,7 +2238,7 @@ private:
         return true;
     }
 
-    bool IsTextEmoteValid(SmartScriptHolder const& e, uint32 entry)
+    bool IsTextEmoteValid(SmartScriptData const& e, uint32 entry)
     {
         if (!sEmotesTextStore.LookupEntry(entry))
         {
@@ -2199,7 +2248,7 @@ private:
         return true;
     }
 
-    bool IsEmoteValid(SmartScriptHolder const& e, uint32 entry)
+    bool IsEmoteValid(SmartScriptData const& e, uint32 entry)
     {
         if (!sEmotesStore.LookupEntry(entry))
         {
@@ -2209,7 +2258,7 @@ private:
         return true;
     }
 
-    bool IsAreaTriggerValid(SmartScriptHolder const& e, uint32 entry)
+    bool IsAreaTriggerValid(SmartScriptData const& e, uint32 entry)
     {
         if (!sObjectMgr->GetAreaTrigger(entry))
         {
@@ -2219,7 +2268,7 @@ private:
         return true;
     }
 
-    bool IsSoundValid(SmartScriptHolder const& e, uint32 entry)
+    bool IsSoundValid(SmartScriptData const& e, uint32 entry)
     {
         if (!sSoundEntriesStore.LookupEntry(entry))
         {
@@ -2229,11 +2278,11 @@ private:
         return true;
     }
 
-    static bool IsSAIBoolValid(SmartScriptHolder const& e, SAIBool value);
-    static bool IsTextValid(SmartScriptHolder const& e, uint32 id);
-    static bool CheckUnusedEventParams(SmartScriptHolder const& e);
-    static bool CheckUnusedActionParams(SmartScriptHolder const& e);
-    static bool CheckUnusedTargetParams(SmartScriptHolder const& e);
+    static bool IsSAIBoolValid(SmartScriptData const& e, SAIBool value);
+    static bool IsTextValid(SmartScriptData const& e, uint32 id);
+    static bool CheckUnusedEventParams(SmartScriptData const& e);
+    static bool CheckUnusedActionParams(SmartScriptData const& e);
+    static bool CheckUnusedTargetParams(SmartScriptData const& e);
 };
 
 #define sSmartScriptMgr SmartAIMgr::instance()
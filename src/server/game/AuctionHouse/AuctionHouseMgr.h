@@ -115,6 +115,7 @@ struct AuctionEntry
     [[nodiscard]] uint32 GetAuctionCut() const;
     [[nodiscard]] uint32 GetAuctionOutBid() const;
     [[nodiscard]] static uint32 CalculateAuctionOutBid(uint32 bid);
+    [[nodiscard]] uint64 GetShardKey() const { return MakeDatabaseShardKey(DatabaseShardKeyType::Auction, Id); }
     void DeleteFromDB(CharacterDatabaseTransaction trans) const;
     void SaveToDB(CharacterDatabaseTransaction trans) const;
     bool LoadFromDB(Field* fields);
@@ -21,13 +21,18 @@
 #include "DBCStores.h"
 #include "GameTime.h"
 #include "Player.h"
+#include <algorithm>
 
-AuctionHouseWorkerThread::AuctionHouseWorkerThread(ProducerConsumerQueue<AuctionSearcherRequest*>* requestQueue, MPSCQueue<AuctionSearcherResponse>* responseQueue)
+AuctionHouseWorkerThread::AuctionHouseWorkerThread(uint32 index, ProducerConsumerQueue<AuctionSearcherRequest*>* requestQueue, MPSCQueue<AuctionSearcherResponse>* responseQueue)
 {
-    _workerThread = std::thread(&AuctionHouseWorkerThread::Run, this);
+    _index = index;
+    for (AuctionSearchIndex& searchIndex : _searchIndex)
+        searchIndex.SetWorker(index);
+
     _requestQueue = requestQueue;
     _responseQueue = responseQueue;
     _stopped = false;
+    _workerThread = std::thread(&AuctionHouseWorkerThread::Run, this);
 }
 
 void AuctionHouseWorkerThread::Stop()
@@ -85,25 +90,17 @@ void AuctionHouseWorkerThread::ProcessSearchUpdates()
 
 void AuctionHouseWorkerThread::SearchUpdateAdd(AuctionSearchAdd const& auctionAdd)
 {
-    SearchableAuctionEntriesMap& searchableAuctionMap = GetSearchableAuctionMap(auctionAdd.listFaction);
-    searchableAuctionMap.insert(std::make_pair(auctionAdd.searchableAuctionEntry->Id, auctionAdd.searchableAuctionEntry));
+    GetSearchIndex(auctionAdd.listFaction).Add(auctionAdd.searchableAuctionEntry);
 }
 
 void AuctionHouseWorkerThread::SearchUpdateRemove(AuctionSearchRemove const& auctionRemove)
 {
-    SearchableAuctionEntriesMap& searchableAuctionMap = GetSearchableAuctionMap(auctionRemove.listFaction);
-    searchableAuctionMap.erase(auctionRemove.auctionId);
+    GetSearchIndex(auctionRemove.listFaction).Remove(auctionRemove.auctionId);
 }
 
 void AuctionHouseWorkerThread::SearchUpdateBid(AuctionSearchUpdateBid const& auctionUpdateBid)
 {
-    SearchableAuctionEntriesMap const& searchableAuctionMap = GetSearchableAuctionMap(auctionUpdateBid.listFaction);
-    SearchableAuctionEntriesMap::const_iterator itr = searchableAuctionMap.find(auctionUpdateBid.auctionId);
-    if (itr != searchableAuctionMap.end())
-    {
-        itr->second->bid = auctionUpdateBid.bid;
-        itr->second->bidderGuid = auctionUpdateBid.bidderGuid;
-    }
+    GetSearchIndex(auctionUpdateBid.listFaction).UpdateBid(auctionUpdateBid.auctionId, auctionUpdateBid.bid, auctionUpdateBid.bidderGuid);
 }
 
 void AuctionHouseWorkerThread::ProcessSearchRequests()
@@ -141,7 +138,7 @@ void AuctionHouseWorkerThread::ProcessSearchRequests()
 
 void AuctionHouseWorkerThread::SearchListRequest(AuctionSearchListRequest const& searchListRequest)
 {
-    SearchableAuctionEntriesMap const& searchableAuctionMap = GetSearchableAuctionMap(searchListRequest.listFaction);
+    AuctionSearchIndex& searchIndex = GetSearchIndex(searchListRequest.listFaction);
     uint32 count = 0, totalCount = 0;
 
     AuctionSearcherResponse* searchResponse = new AuctionSearcherResponse();
@@ -151,42 +148,25 @@ void AuctionHouseWorkerThread::SearchListRequest(AuctionSearchListRequest const&
 
     if (!searchListRequest.searchInfo.getAll)
     {
-        SortableAuctionEntriesList auctionEntries;
-        BuildListAuctionItems(searchListRequest, auctionEntries, searchableAuctionMap);
-
-        if (!searchListRequest.searchInfo.sorting.empty() && auctionEntries.size() > MAX_AUCTIONS_PER_PAGE)
-        {
-            AuctionSorter sorter(&searchListRequest.searchInfo.sorting, searchListRequest.playerInfo.loc_idx);
-            std::sort(auctionEntries.begin(), auctionEntries.end(), sorter);
-        }
-
-        SortableAuctionEntriesList::const_iterator itr = auctionEntries.begin();
-        if (searchListRequest.searchInfo.listfrom)
-        {
-            if (searchListRequest.searchInfo.listfrom > auctionEntries.size())
-                itr = auctionEntries.end();
-            else
-                itr += searchListRequest.searchInfo.listfrom;
-        }
+        SortableAuctionEntriesList page;
+        totalCount = searchIndex.SearchPage(searchListRequest, page);
 
-        for (; itr != auctionEntries.end(); ++itr)
+        for (SearchableAuctionEntry const* auction : page)
         {
-            (*itr)->BuildAuctionInfo(searchResponse->packet);
-
-            if (++count >= MAX_AUCTIONS_PER_PAGE)
-                break;
+            auction->BuildAuctionInfo(searchResponse->packet, _index);
+            ++count;
         }
-
-        totalCount = auctionEntries.size();
     }
     else
     {
+        SearchableAuctionEntriesMap const& searchableAuctionMap = searchIndex.GetAuctions();
+
         // getAll handling
         for (auto const& pair : searchableAuctionMap)
         {
             std::shared_ptr<SearchableAuctionEntry> const& Aentry = pair.second;
             ++count;
-            Aentry->BuildAuctionInfo(searchResponse->packet);
+            Aentry->BuildAuctionInfo(searchResponse->packet, _index);
 
             if (count >= MAX_GETALL_RETURN)
                 break;
@@ -204,7 +184,7 @@ void AuctionHouseWorkerThread::SearchListRequest(AuctionSearchListRequest const&
 
 void AuctionHouseWorkerThread::SearchOwnerListRequest(AuctionSearchOwnerListRequest const& searchOwnerListRequest)
 {
-    SearchableAuctionEntriesMap const& searchableAuctionMap = GetSearchableAuctionMap(searchOwnerListRequest.listFaction);
+    SearchableAuctionEntriesMap const& searchableAuctionMap = GetSearchIndex(searchOwnerListRequest.listFaction).GetAuctions();
 
     AuctionSearcherResponse* searchResponse = new AuctionSearcherResponse();
     searchResponse->playerGuid = searchOwnerListRequest.ownerGuid;
@@ -220,7 +200,7 @@ void AuctionHouseWorkerThread::SearchOwnerListRequest(AuctionSearchOwnerListRequ
             continue;
 
         std::shared_ptr<SearchableAuctionEntry> const& auctionEntry = pair.second;
-        auctionEntry->BuildAuctionInfo(searchResponse->packet);
+        auctionEntry->BuildAuctionInfo(searchResponse->packet, _index);
         ++count;
         ++totalcount;
     }
@@ -234,7 +214,7 @@ void AuctionHouseWorkerThread::SearchOwnerListRequest(AuctionSearchOwnerListRequ
 
 void AuctionHouseWorkerThread::SearchBidderListRequest(AuctionSearchBidderListRequest const& searchBidderListRequest)
 {
-    SearchableAuctionEntriesMap const& searchableAuctionMap = GetSearchableAuctionMap(searchBidderListRequest.listFaction);
+    SearchableAuctionEntriesMap const& searchableAuctionMap = GetSearchIndex(searchBidderListRequest.listFaction).GetAuctions();
 
     AuctionSearcherResponse* searchResponse = new AuctionSearcherResponse();
     searchResponse->playerGuid = searchBidderListRequest.ownerGuid;
@@ -251,18 +231,18 @@ void AuctionHouseWorkerThread::SearchBidderListRequest(AuctionSearchBidderListRe
             continue;
 
         std::shared_ptr<SearchableAuctionEntry> const& auctionEntry = itr->second;
-        auctionEntry->BuildAuctionInfo(searchResponse->packet);
+        auctionEntry->BuildAuctionInfo(searchResponse->packet, _index);
         ++count;
         ++totalcount;
     }
 
     for (auto const& pair : searchableAuctionMap)
     {
-        if (pair.second->bidderGuid != searchBidderListRequest.ownerGuid)
+        if (pair.second->bids[_index].bidderGuid != searchBidderListRequest.ownerGuid)
             continue;
 
         std::shared_ptr<SearchableAuctionEntry> const& auctionEntry = pair.second;
-        auctionEntry->BuildAuctionInfo(searchResponse->packet);
+        auctionEntry->BuildAuctionInfo(searchResponse->packet, _index);
         ++count;
         ++totalcount;
     }
@@ -274,70 +254,470 @@ void AuctionHouseWorkerThread::SearchBidderListRequest(AuctionSearchBidderListRe
     _responseQueue->Enqueue(searchResponse);
 }
 
-void AuctionHouseWorkerThread::BuildListAuctionItems(AuctionSearchListRequest const& searchRequest, SortableAuctionEntriesList& auctionEntries, SearchableAuctionEntriesMap const& auctionMap) const
+void AuctionSearchIndex::Add(std::shared_ptr<SearchableAuctionEntry> const& auction)
+{
+    auto [itr, inserted] = _auctions.emplace(auction->Id, auction);
+    if (!inserted)
+        return;
+
+    AddToIndexes(auction.get());
+
+    for (SortedView& view : _sortedViews)
+        InsertIntoView(view, auction.get());
+}
+
+void AuctionSearchIndex::Remove(uint32 auctionId)
+{
+    auto itr = _auctions.find(auctionId);
+    if (itr == _auctions.end())
+        return;
+
+    SearchableAuctionEntry* auction = itr->second.get();
+    RemoveFromIndexes(auction);
+
+    for (SortedView& view : _sortedViews)
+        RemoveFromView(view, auction);
+
+    _auctions.erase(itr);
+}
+
+void AuctionSearchIndex::UpdateBid(uint32 auctionId, uint32 bid, ObjectGuid bidderGuid)
+{
+    auto itr = _auctions.find(auctionId);
+    if (itr == _auctions.end())
+        return;
+
+    // every worker gets this update and only changes its own copy of the bid, the orderings of the others stay valid
+    SearchableAuctionEntry* auction = itr->second.get();
+    for (SortedView& view : _sortedViews)
+        if (view.DependsOnBid)
+            RemoveFromView(view, auction);
+
+    auction->bids[_worker] = { bid, bidderGuid };
+
+    for (SortedView& view : _sortedViews)
+        if (view.DependsOnBid)
+            InsertIntoView(view, auction);
+}
+
+uint32 AuctionSearchIndex::SearchPage(AuctionSearchListRequest const& searchRequest, SortableAuctionEntriesList& page)
 {
+    AuctionHouseSearchInfo const& searchInfo = searchRequest.searchInfo;
+
     // pussywizard: optimization, this is a simplified case for the default search state (no filters)
-    if (searchRequest.searchInfo.itemClass == 0xffffffff && searchRequest.searchInfo.itemSubClass == 0xffffffff
-        && searchRequest.searchInfo.inventoryType == 0xffffffff && searchRequest.searchInfo.quality == 0xffffffff
-        && searchRequest.searchInfo.levelmin == 0x00 && searchRequest.searchInfo.levelmax == 0x00
-        && searchRequest.searchInfo.usable == 0x00 && searchRequest.searchInfo.wsearchedname.empty())
+    bool const unfiltered = searchInfo.itemClass == 0xffffffff && searchInfo.itemSubClass == 0xffffffff
+        && searchInfo.inventoryType == 0xffffffff && searchInfo.quality == 0xffffffff
+        && searchInfo.levelmin == 0x00 && searchInfo.levelmax == 0x00
+        && searchInfo.usable == 0x00 && searchInfo.wsearchedname.empty();
+
+    SortableAuctionEntriesList candidates;
+    if (!unfiltered)
+        FindCandidates(searchRequest, candidates);
+
+    std::size_t const totalCount = unfiltered ? _auctions.size() : candidates.size();
+    std::size_t const pageEnd = std::size_t(searchInfo.listfrom) + MAX_AUCTIONS_PER_PAGE;
+    if (searchInfo.listfrom >= totalCount)
+        return totalCount;
+
+    // small results are sorted by the client
+    if (searchInfo.sorting.empty() || totalCount <= MAX_AUCTIONS_PER_PAGE)
     {
-        for (auto const& pair : auctionMap)
-            auctionEntries.push_back(pair.second.get());
+        if (!unfiltered)
+        {
+            page.assign(candidates.begin() + searchInfo.listfrom, candidates.begin() + std::min(pageEnd, totalCount));
+            return totalCount;
+        }
 
-        return;
+        std::size_t position = 0;
+        for (auto const& [auctionId, auction] : _auctions)
+        {
+            if (position++ < searchInfo.listfrom)
+                continue;
+
+            page.push_back(auction.get());
+            if (position >= pageEnd)
+                break;
+        }
+
+        return totalCount;
+    }
+
+    // walking a presorted ordering pays off when the matches are not too sparse in it,
+    // about pageEnd * auctions / matches auctions are checked to fill the page
+    if (unfiltered || pageEnd * _auctions.size() <= totalCount * totalCount)
+    {
+        SortedView& view = GetSortedView(searchInfo.sorting, searchRequest.playerInfo.loc_idx);
+
+        std::size_t position = 0;
+        for (SearchableAuctionEntry* auction : view.Auctions)
+        {
+            if (!unfiltered && !Matches(*auction, searchRequest))
+                continue;
+
+            if (position++ < searchInfo.listfrom)
+                continue;
+
+            page.push_back(auction);
+            if (position >= pageEnd)
+                break;
+        }
+
+        return totalCount;
+    }
+
+    // only order the requested window of the matches
+    AuctionSorter sorter(&searchInfo.sorting, searchRequest.playerInfo.loc_idx, _worker);
+    auto pageBegin = candidates.begin() + searchInfo.listfrom;
+    auto pageLast = candidates.begin() + std::min(pageEnd, totalCount);
+    if (searchInfo.listfrom)
+        std::nth_element(candidates.begin(), pageBegin, candidates.end(), sorter);
+
+    std::partial_sort(pageBegin, pageLast, candidates.end(), sorter);
+    page.assign(pageBegin, pageLast);
+    return totalCount;
+}
+
+bool AuctionSearchIndex::Matches(SearchableAuctionEntry const& auction, AuctionSearchListRequest const& searchRequest)
+{
+    SearchableAuctionEntryItem const& Aitem = auction.item;
+    ItemTemplate const* proto = Aitem.itemTemplate;
+
+    if (searchRequest.searchInfo.itemClass != 0xffffffff && proto->Class != searchRequest.searchInfo.itemClass)
+        return false;
+
+    if (searchRequest.searchInfo.itemSubClass != 0xffffffff && proto->SubClass != searchRequest.searchInfo.itemSubClass)
+        return false;
+
+    if (searchRequest.searchInfo.inventoryType != 0xffffffff && proto->InventoryType != searchRequest.searchInfo.inventoryType)
+    {
+        // xinef: exception, robes are counted as chests
+        if (searchRequest.searchInfo.inventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
+            return false;
+    }
+
+    if (searchRequest.searchInfo.quality != 0xffffffff && proto->Quality < searchRequest.searchInfo.quality)
+        return false;
+
+    if (searchRequest.searchInfo.levelmin != 0x00 && (proto->RequiredLevel < searchRequest.searchInfo.levelmin
+        || (searchRequest.searchInfo.levelmax != 0x00 && proto->RequiredLevel > searchRequest.searchInfo.levelmax)))
+    {
+        return false;
     }
 
-    for (auto const& pair : auctionMap)
+    if (searchRequest.searchInfo.usable != 0x00)
     {
-        std::shared_ptr<SearchableAuctionEntry> const& Aentry = pair.second;
-        SearchableAuctionEntryItem const& Aitem = Aentry->item;
-        ItemTemplate const* proto = Aitem.itemTemplate;
+        if (!searchRequest.playerInfo.usablePlayerInfo.value().PlayerCanUseItem(proto))
+            return false;
+    }
+
+    // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
+    // No need to do any of this if no search term was entered
+    if (!searchRequest.searchInfo.wsearchedname.empty())
+    {
+        if (Aitem.itemName->Get(searchRequest.playerInfo.loc_idx).find(searchRequest.searchInfo.wsearchedname) == std::wstring::npos)
+            return false;
+    }
+
+    return true;
+}
+
+void AuctionSearchIndex::RemoveFromBucket(Bucket& bucket, SearchableAuctionEntry* auction)
+{
+    auto itr = std::find(bucket.begin(), bucket.end(), auction);
+    if (itr == bucket.end())
+        return;
+
+    *itr = bucket.back();
+    bucket.pop_back();
+}
+
+void AuctionSearchIndex::RemoveFromBucket(std::unordered_map<uint32, Bucket>& buckets, uint32 key, SearchableAuctionEntry* auction)
+{
+    auto itr = buckets.find(key);
+    if (itr == buckets.end())
+        return;
+
+    RemoveFromBucket(itr->second, auction);
+    if (itr->second.empty())
+        buckets.erase(itr);
+}
+
+void AuctionSearchIndex::GetNameTrigrams(std::wstring const& name, std::vector<uint64>& trigrams)
+{
+    trigrams.clear();
+    if (name.size() < 3)
+        return;
+
+    // unicode code points fit into 21 bits
+    for (std::size_t i = 0; i + 2 < name.size(); ++i)
+        trigrams.push_back(uint64(name[i] & 0x1FFFFF) << 42 | uint64(name[i + 1] & 0x1FFFFF) << 21 | uint64(name[i + 2] & 0x1FFFFF));
+
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+}
 
-        if (searchRequest.searchInfo.itemClass != 0xffffffff && proto->Class != searchRequest.searchInfo.itemClass)
+void AuctionSearchIndex::AddToIndexes(SearchableAuctionEntry* auction)
+{
+    ItemTemplate const* proto = auction->item.itemTemplate;
+    _classIndex[proto->Class].push_back(auction);
+    _subClassIndex[proto->Class << 16 | proto->SubClass].push_back(auction);
+    _inventoryTypeIndex[proto->InventoryType].push_back(auction);
+    _qualityIndex[proto->Quality].push_back(auction);
+    _levelIndex[proto->RequiredLevel].push_back(auction);
+
+    std::vector<uint64> trigrams;
+    for (uint32 locale = 0; locale < TOTAL_LOCALES; ++locale)
+    {
+        if (!_nameIndexBuilt[locale])
             continue;
 
-        if (searchRequest.searchInfo.itemSubClass != 0xffffffff && proto->SubClass != searchRequest.searchInfo.itemSubClass)
+        GetNameTrigrams(auction->item.itemName->Get(locale), trigrams);
+        for (uint64 trigram : trigrams)
+            _nameIndex[locale][trigram].push_back(auction);
+    }
+}
+
+void AuctionSearchIndex::RemoveFromIndexes(SearchableAuctionEntry* auction)
+{
+    ItemTemplate const* proto = auction->item.itemTemplate;
+    RemoveFromBucket(_classIndex, proto->Class, auction);
+    RemoveFromBucket(_subClassIndex, proto->Class << 16 | proto->SubClass, auction);
+    RemoveFromBucket(_inventoryTypeIndex, proto->InventoryType, auction);
+
+    auto qualityItr = _qualityIndex.find(proto->Quality);
+    if (qualityItr != _qualityIndex.end())
+    {
+        RemoveFromBucket(qualityItr->second, auction);
+        if (qualityItr->second.empty())
+            _qualityIndex.erase(qualityItr);
+    }
+
+    auto levelItr = _levelIndex.find(proto->RequiredLevel);
+    if (levelItr != _levelIndex.end())
+    {
+        RemoveFromBucket(levelItr->second, auction);
+        if (levelItr->second.empty())
+            _levelIndex.erase(levelItr);
+    }
+
+    std::vector<uint64> trigrams;
+    for (uint32 locale = 0; locale < TOTAL_LOCALES; ++locale)
+    {
+        if (!_nameIndexBuilt[locale])
             continue;
 
-        if (searchRequest.searchInfo.inventoryType != 0xffffffff && proto->InventoryType != searchRequest.searchInfo.inventoryType)
+        GetNameTrigrams(auction->item.itemName->Get(locale), trigrams);
+        for (uint64 trigram : trigrams)
         {
-            // xinef: exception, robes are counted as chests
-            if (searchRequest.searchInfo.inventoryType != INVTYPE_CHEST || proto->InventoryType != INVTYPE_ROBE)
+            auto itr = _nameIndex[locale].find(trigram);
+            if (itr == _nameIndex[locale].end())
                 continue;
+
+            RemoveFromBucket(itr->second, auction);
+            if (itr->second.empty())
+                _nameIndex[locale].erase(itr);
         }
+    }
+}
 
-        if (searchRequest.searchInfo.quality != 0xffffffff && proto->Quality < searchRequest.searchInfo.quality)
-            continue;
+void AuctionSearchIndex::BuildNameIndex(int locIdx)
+{
+    // most realms only ever see one or two locales, the others are never indexed
+    _nameIndexBuilt[locIdx] = true;
+
+    std::vector<uint64> trigrams;
+    for (auto const& [auctionId, auction] : _auctions)
+    {
+        GetNameTrigrams(auction->item.itemName->Get(locIdx), trigrams);
+        for (uint64 trigram : trigrams)
+            _nameIndex[locIdx][trigram].push_back(auction.get());
+    }
+}
+
+void AuctionSearchIndex::FindCandidates(AuctionSearchListRequest const& searchRequest, SortableAuctionEntriesList& candidates)
+{
+    AuctionHouseSearchInfo const& searchInfo = searchRequest.searchInfo;
+
+    // walk the smallest candidate set, every set holds each auction at most once
+    std::vector<Bucket const*> buckets;
+    std::size_t bucketsSize = _auctions.size();
+    bool indexed = false;
 
-        if (searchRequest.searchInfo.levelmin != 0x00 && (proto->RequiredLevel < searchRequest.searchInfo.levelmin
-            || (searchRequest.searchInfo.levelmax != 0x00 && proto->RequiredLevel > searchRequest.searchInfo.levelmax)))
+    auto useIfSmaller = [&](std::vector<Bucket const*>&& otherBuckets)
+    {
+        std::size_t otherSize = 0;
+        for (Bucket const* bucket : otherBuckets)
+            otherSize += bucket->size();
+
+        if (!indexed || otherSize < bucketsSize)
         {
-            continue;
+            buckets = std::move(otherBuckets);
+            bucketsSize = otherSize;
+            indexed = true;
         }
+    };
+
+    auto findBucket = [](std::unordered_map<uint32, Bucket> const& index, uint32 key) -> std::vector<Bucket const*>
+    {
+        auto itr = index.find(key);
+        if (itr == index.end())
+            return { };
+
+        return { &itr->second };
+    };
+
+    if (searchInfo.itemClass != 0xffffffff)
+    {
+        if (searchInfo.itemSubClass != 0xffffffff)
+            useIfSmaller(findBucket(_subClassIndex, searchInfo.itemClass << 16 | searchInfo.itemSubClass));
+        else
+            useIfSmaller(findBucket(_classIndex, searchInfo.itemClass));
+    }
 
-        if (searchRequest.searchInfo.usable != 0x00)
+    if (searchInfo.inventoryType != 0xffffffff)
+    {
+        std::vector<Bucket const*> inventoryTypeBuckets = findBucket(_inventoryTypeIndex, searchInfo.inventoryType);
+
+        // xinef: exception, robes are counted as chests
+        if (searchInfo.inventoryType == INVTYPE_CHEST)
+            for (Bucket const* bucket : findBucket(_inventoryTypeIndex, INVTYPE_ROBE))
+                inventoryTypeBuckets.push_back(bucket);
+
+        useIfSmaller(std::move(inventoryTypeBuckets));
+    }
+
+    if (searchInfo.quality != 0xffffffff)
+    {
+        std::vector<Bucket const*> qualityBuckets;
+        for (auto itr = _qualityIndex.lower_bound(searchInfo.quality); itr != _qualityIndex.end(); ++itr)
+            qualityBuckets.push_back(&itr->second);
+
+        useIfSmaller(std::move(qualityBuckets));
+    }
+
+    if (searchInfo.levelmin != 0x00)
+    {
+        if (searchInfo.levelmax != 0x00 && searchInfo.levelmax < searchInfo.levelmin)
+            return;
+
+        std::vector<Bucket const*> levelBuckets;
+        auto end = searchInfo.levelmax != 0x00 ? _levelIndex.upper_bound(searchInfo.levelmax) : _levelIndex.end();
+        for (auto itr = _levelIndex.lower_bound(searchInfo.levelmin); itr != end; ++itr)
+            levelBuckets.push_back(&itr->second);
+
+        useIfSmaller(std::move(levelBuckets));
+    }
+
+    int const locIdx = searchRequest.playerInfo.loc_idx;
+    if (searchInfo.wsearchedname.size() >= 3 && locIdx >= 0 && locIdx < TOTAL_LOCALES)
+    {
+        if (!_nameIndexBuilt[locIdx])
+            BuildNameIndex(locIdx);
+
+        std::vector<uint64> trigrams;
+        GetNameTrigrams(searchInfo.wsearchedname, trigrams);
+        for (uint64 trigram : trigrams)
         {
-            if (!searchRequest.playerInfo.usablePlayerInfo.value().PlayerCanUseItem(proto))
-                continue;
+            auto itr = _nameIndex[locIdx].find(trigram);
+            if (itr == _nameIndex[locIdx].end())
+                return;                         // no name contains this part of the searched one
+
+            useIfSmaller({ &itr->second });
         }
+    }
+
+    if (!indexed)
+    {
+        for (auto const& [auctionId, auction] : _auctions)
+            if (Matches(*auction, searchRequest))
+                candidates.push_back(auction.get());
+
+        return;
+    }
+
+    for (Bucket const* bucket : buckets)
+        for (SearchableAuctionEntry* auction : *bucket)
+            if (Matches(*auction, searchRequest))
+                candidates.push_back(auction);
+}
+
+AuctionSearchIndex::SortedView& AuctionSearchIndex::GetSortedView(AuctionSortOrderVector const& sorting, int locIdx)
+{
+    bool const sortsByName = std::any_of(sorting.begin(), sorting.end(), [](AuctionSortInfo const& sortInfo) { return sortInfo.sortOrder == AUCTION_SORT_ITEM; });
+    if (!sortsByName)
+        locIdx = 0;
 
-        // Allow search by suffix (ie: of the Monkey) or partial name (ie: Monkey)
-        // No need to do any of this if no search term was entered
-        if (!searchRequest.searchInfo.wsearchedname.empty())
+    auto sameSorting = [&sorting](AuctionSortOrderVector const& other)
+    {
+        return std::equal(sorting.begin(), sorting.end(), other.begin(), other.end(), [](AuctionSortInfo const& left, AuctionSortInfo const& right)
         {
-            if (Aitem.itemName[searchRequest.playerInfo.loc_idx].find(searchRequest.searchInfo.wsearchedname) == std::wstring::npos)
-                continue;
+            return left.sortOrder == right.sortOrder && left.isDesc == right.isDesc;
+        });
+    };
+
+    for (SortedView& view : _sortedViews)
+    {
+        if (view.LocIdx == locIdx && sameSorting(view.Sorting))
+        {
+            view.LastUse = ++_sortedViewClock;
+            return view;
         }
+    }
 
-        auctionEntries.push_back(Aentry.get());
+    // the least recently used ordering makes room for the new one
+    SortedView* view;
+    if (_sortedViews.size() < MAX_SORTED_VIEWS)
+        view = &_sortedViews.emplace_back();
+    else
+    {
+        view = &*std::min_element(_sortedViews.begin(), _sortedViews.end(), [](SortedView const& left, SortedView const& right) { return left.LastUse < right.LastUse; });
+        *view = SortedView();
     }
+
+    view->Sorting = sorting;
+    view->LocIdx = locIdx;
+    view->DependsOnBid = std::any_of(sorting.begin(), sorting.end(), [](AuctionSortInfo const& sortInfo)
+    {
+        switch (sortInfo.sortOrder)
+        {
+            case AUCTION_SORT_BUYOUT:
+            case AUCTION_SORT_UNK4:
+            case AUCTION_SORT_MINBIDBUY:
+            case AUCTION_SORT_BID:
+                return true;
+            default:
+                return false;
+        }
+    });
+    view->LastUse = ++_sortedViewClock;
+
+    view->Auctions.reserve(_auctions.size());
+    for (auto const& [auctionId, auction] : _auctions)
+        view->Auctions.push_back(auction.get());
+
+    std::sort(view->Auctions.begin(), view->Auctions.end(), AuctionSorter(&view->Sorting, view->LocIdx, _worker));
+    return *view;
+}
+
+void AuctionSearchIndex::InsertIntoView(SortedView& view, SearchableAuctionEntry* auction) const
+{
+    AuctionSorter sorter(&view.Sorting, view.LocIdx, _worker);
+    view.Auctions.insert(std::upper_bound(view.Auctions.begin(), view.Auctions.end(), auction, sorter), auction);
+}
+
+void AuctionSearchIndex::RemoveFromView(SortedView& view, SearchableAuctionEntry* auction) const
+{
+    AuctionSorter sorter(&view.Sorting, view.LocIdx, _worker);
+    auto [begin, end] = std::equal_range(view.Auctions.begin(), view.Auctions.end(), auction, sorter);
+    auto itr = std::find(begin, end, auction);
+    if (itr != end)
+        view.Auctions.erase(itr);
 }
 
 AuctionHouseSearcher::AuctionHouseSearcher()
 {
     for (uint32 i = 0; i < sWorld->getIntConfig(CONFIG_AUCTIONHOUSE_WORKERTHREADS); ++i)
-        _workerThreads.push_back(std::make_unique<AuctionHouseWorkerThread>(&_requestQueue, &_responseQueue));
+        _workerThreads.push_back(std::make_unique<AuctionHouseWorkerThread>(i, &_requestQueue, &_responseQueue));
 }
 
 AuctionHouseSearcher::~AuctionHouseSearcher()
@@ -382,8 +762,7 @@ void AuctionHouseSearcher::AddAuction(AuctionEntry const* auctionEntry)
     searchableAuctionEntry->buyout = auctionEntry->buyout;
     searchableAuctionEntry->expire_time = auctionEntry->expire_time;
     searchableAuctionEntry->listFaction = auctionEntry->GetFactionId();
-    searchableAuctionEntry->bid = auctionEntry->bid;
-    searchableAuctionEntry->bidderGuid = auctionEntry->bidder;
+    searchableAuctionEntry->bids.assign(_workerThreads.size(), { auctionEntry->bid, auctionEntry->bidder });
 
     // Item info
     searchableAuctionEntry->item.entry = item->GetEntry();
@@ -400,8 +779,7 @@ void AuctionHouseSearcher::AddAuction(AuctionEntry const* auctionEntry)
     searchableAuctionEntry->item.count = item->GetCount();
     searchableAuctionEntry->item.spellCharges = item->GetSpellCharges();
     searchableAuctionEntry->item.itemTemplate = item->GetTemplate();
-
-    searchableAuctionEntry->SetItemNames();
+    searchableAuctionEntry->item.itemName = _itemNames.GetName(item->GetTemplate(), item->GetItemRandomPropertyId());
 
     // Let the worker threads know we have a new auction
     NotifyAllWorkers(std::make_shared<AuctionSearchAdd>(searchableAuctionEntry));
@@ -414,9 +792,9 @@ void AuctionHouseSearcher::RemoveAuction(AuctionEntry const* auctionEntry)
 
 void AuctionHouseSearcher::UpdateBid(AuctionEntry const* auctionEntry)
 {
-    // Updating bids is a bit unique, we really only need to update a single worker as every worker thread contains
-    // a map of shared pointers to the same SearchableAuctionEntry's, so updating one will update them all.
-    NotifyOneWorker(std::make_shared<AuctionSearchUpdateBid>(auctionEntry->Id, auctionEntry->GetFactionId(), auctionEntry->bid, auctionEntry->bidder));
+    // Every worker thread contains a map of shared pointers to the same SearchableAuctionEntry's, but each of them
+    // keeps its own copy of the bid and its own orderings by it, which have to be updated as well.
+    NotifyAllWorkers(std::make_shared<AuctionSearchUpdateBid>(auctionEntry->Id, auctionEntry->GetFactionId(), auctionEntry->bid, auctionEntry->bidder));
 }
 
 void AuctionHouseSearcher::NotifyAllWorkers(std::shared_ptr<AuctionSearcherUpdate> const auctionSearchUpdate)
@@ -431,8 +809,10 @@ void AuctionHouseSearcher::NotifyOneWorker(std::shared_ptr<AuctionSearcherUpdate
     (*_workerThreads.begin())->AddAuctionSearchUpdateToQueue(auctionSearchUpdate);
 }
 
-void SearchableAuctionEntry::BuildAuctionInfo(WorldPacket& data) const
+void SearchableAuctionEntry::BuildAuctionInfo(WorldPacket& data, uint32 worker) const
 {
+    SearchableAuctionBid const& bid = bids[worker];
+
     data << uint32(Id);
     data << uint32(item.entry);
 
@@ -450,24 +830,44 @@ void SearchableAuctionEntry::BuildAuctionInfo(WorldPacket& data) const
     data << uint32(0);                                              // item->flags (client doesnt do anything with it)
     data << ownerGuid;                                              // Auction->owner
     data << uint32(startbid);                                       // Auction->startbid (not sure if useful)
-    data << uint32(bid ? AuctionEntry::CalculateAuctionOutBid(bid) : 0);
+    data << uint32(bid.bid ? AuctionEntry::CalculateAuctionOutBid(bid.bid) : 0);
     // Minimal outbid
     data << uint32(buyout);                                         // Auction->buyout
     data << uint32((expire_time - GameTime::GetGameTime().count()) * IN_MILLISECONDS); // time left
-    data << bidderGuid;                                             // auction->bidder current
-    data << uint32(bid);                                            // current bid
+    data << bid.bidderGuid;                                         // auction->bidder current
+    data << uint32(bid.bid);                                        // current bid
 }
 
-void SearchableAuctionEntry::SetItemNames()
+AuctionItemName::AuctionItemName(ItemTemplate const* proto, int32 randomPropertyId)
 {
-    ItemTemplate const* proto = item.itemTemplate;
-    ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId);
+    if (proto->Name1.empty())
+        return;
 
-    for (uint32 locale = 0; locale < TOTAL_LOCALES; ++locale)
+    // DO NOT use GetItemEnchantMod(proto->RandomProperty) as it may return a result
+    //  that matches the search but it may not equal item->GetItemRandomPropertyId()
+    //  used in BuildAuctionInfo() which then causes wrong items to be listed
+    // Append the suffix to the name (ie: of the Monkey) if one exists
+    // These are found in ItemRandomSuffix.dbc and ItemRandomProperties.dbc
+    // even though the DBC name seems misleading
+    std::array<char const*, 16> const* suffix = nullptr;
+
+    if (randomPropertyId < 0)
     {
-        if (proto->Name1.empty())
-            continue;
+        ItemRandomSuffixEntry const* itemRandEntry = sItemRandomSuffixStore.LookupEntry(-randomPropertyId);
+        if (itemRandEntry)
+            suffix = &itemRandEntry->Name;
+    }
+    else if (randomPropertyId > 0)
+    {
+        ItemRandomPropertiesEntry const* itemRandEntry = sItemRandomPropertiesStore.LookupEntry(randomPropertyId);
+        if (itemRandEntry)
+            suffix = &itemRandEntry->Name;
+    }
 
+    ItemLocale const* il = sObjectMgr->GetItemLocale(proto->ItemId);
+
+    for (uint8 locale = LOCALE_enUS; locale < TOTAL_LOCALES; ++locale)
+    {
         std::string itemName = proto->Name1;
 
         // local name
@@ -475,50 +875,60 @@ void SearchableAuctionEntry::SetItemNames()
         if (locdbc_idx >= LOCALE_enUS && il)
             ObjectMgr::GetLocaleString(il->Name, locale, itemName);
 
-        // DO NOT use GetItemEnchantMod(proto->RandomProperty) as it may return a result
-        //  that matches the search but it may not equal item->GetItemRandomPropertyId()
-        //  used in BuildAuctionInfo() which then causes wrong items to be listed
-        int32 propRefID = item.randomPropertyId;
-
-        if (propRefID)
+        // dbc local name
+        if (suffix)
         {
-            // Append the suffix to the name (ie: of the Monkey) if one exists
-            // These are found in ItemRandomSuffix.dbc and ItemRandomProperties.dbc
-            // even though the DBC name seems misleading
-            std::array<char const*, 16> const* suffix = nullptr;
-
-            if (propRefID < 0)
-            {
-                ItemRandomSuffixEntry const* itemRandEntry = sItemRandomSuffixStore.LookupEntry(-item.randomPropertyId);
-                if (itemRandEntry)
-                    suffix = &itemRandEntry->Name;
-            }
-            else
-            {
-                ItemRandomPropertiesEntry const* itemRandEntry = sItemRandomPropertiesStore.LookupEntry(item.randomPropertyId);
-                if (itemRandEntry)
-                    suffix = &itemRandEntry->Name;
-            }
-
-            // dbc local name
-            if (suffix)
-            {
-                // Append the suffix (ie: of the Monkey) to the name using localization
-                // or default enUS if localization is invalid
-                itemName += ' ';
-                itemName += (*suffix)[locdbc_idx >= 0 ? locdbc_idx : LOCALE_enUS];
-            }
+            // Append the suffix (ie: of the Monkey) to the name using localization
+            // or default enUS if localization is invalid
+            itemName += ' ';
+            itemName += (*suffix)[locdbc_idx >= 0 ? locdbc_idx : LOCALE_enUS];
         }
 
-        if (!Utf8toWStr(itemName, item.itemName[locale]))
-            continue;
-
-        wstrToLower(item.itemName[locale]);
+        if (locale == LOCALE_enUS || itemName != _sourceNames[LOCALE_enUS])
+            _sourceNames[locale] = std::move(itemName);
     }
 }
 
-int SearchableAuctionEntry::CompareAuctionEntry(uint32 column, SearchableAuctionEntry const& auc, int loc_idx) const
+std::wstring const& AuctionItemName::Get(int locale) const
+{
+    std::call_once(_built[locale], &AuctionItemName::Build, this, locale);
+    return _names[locale];
+}
+
+void AuctionItemName::Build(int locale) const
+{
+    std::string const& itemName = _sourceNames[locale].empty() ? _sourceNames[LOCALE_enUS] : _sourceNames[locale];
+    if (itemName.empty())
+        return;
+
+    if (!Utf8toWStr(itemName, _names[locale]))
+        return;
+
+    wstrToLower(_names[locale]);
+}
+
+std::shared_ptr<AuctionItemName const> AuctionItemNameTable::GetName(ItemTemplate const* proto, int32 randomPropertyId)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    std::shared_ptr<AuctionItemName const>& name = _names[uint64(proto->ItemId) << 32 | uint32(randomPropertyId)];
+    if (!name)
+        name = std::make_shared<AuctionItemName const>(proto, randomPropertyId);
+
+    return name;
+}
+
+void AuctionItemNameTable::Clear()
 {
+    std::lock_guard<std::mutex> guard(_lock);
+    _names.clear();
+}
+
+int SearchableAuctionEntry::CompareAuctionEntry(uint32 column, SearchableAuctionEntry const& auc, int loc_idx, uint32 worker) const
+{
+    SearchableAuctionBid const& bid = bids[worker];
+    SearchableAuctionBid const& aucBid = auc.bids[worker];
+
     switch (column)
     {
     case AUCTION_SORT_MINLEVEL:                                             // level = 0
@@ -553,9 +963,9 @@ int SearchableAuctionEntry::CompareAuctionEntry(uint32 column, SearchableAuction
         }
         else
         {
-            if (bid < auc.bid)
+            if (bid.bid < aucBid.bid)
                 return -1;
-            else if (bid > auc.bid)
+            else if (bid.bid > aucBid.bid)
                 return +1;
         }
         break;
@@ -566,14 +976,14 @@ int SearchableAuctionEntry::CompareAuctionEntry(uint32 column, SearchableAuction
             return +1;
         break;
     case AUCTION_SORT_UNK4:                                             // status = 4 (WRONG)
-        if (bidderGuid.GetCounter() < auc.bidderGuid.GetCounter())
+        if (bid.bidderGuid.GetCounter() < aucBid.bidderGuid.GetCounter())
             return -1;
-        else if (bidderGuid.GetCounter() > auc.bidderGuid.GetCounter())
+        else if (bid.bidderGuid.GetCounter() > aucBid.bidderGuid.GetCounter())
             return +1;
         break;
     case AUCTION_SORT_ITEM:                                             // name = 5
     {
-        int comparison = item.itemName[loc_idx].compare(auc.item.itemName[loc_idx]);
+        int comparison = item.itemName->Get(loc_idx).compare(auc.item.itemName->Get(loc_idx));
         if (comparison > 0)
             return -1;
         else if (comparison < 0)
@@ -592,9 +1002,9 @@ int SearchableAuctionEntry::CompareAuctionEntry(uint32 column, SearchableAuction
         }
         else
         {
-            if (bid < auc.bid)
+            if (bid.bid < aucBid.bid)
                 return -1;
-            else if (bid > auc.bid)
+            else if (bid.bid > aucBid.bid)
                 return +1;
         }
         break;
@@ -611,8 +1021,8 @@ int SearchableAuctionEntry::CompareAuctionEntry(uint32 column, SearchableAuction
     }
     case AUCTION_SORT_BID:                                             // bid = 8
     {
-        uint32 bid1 = bid ? bid : startbid;
-        uint32 bid2 = auc.bid ? auc.bid : auc.startbid;
+        uint32 bid1 = bid.bid ? bid.bid : startbid;
+        uint32 bid2 = aucBid.bid ? aucBid.bid : auc.startbid;
 
         if (bid1 > bid2)
             return -1;
@@ -648,7 +1058,7 @@ bool AuctionSorter::operator()(SearchableAuctionEntry const* auc1, SearchableAuc
 
     for (AuctionSortOrderVector::const_iterator itr = _sort->begin(); itr != _sort->end(); ++itr)
     {
-        int res = auc1->CompareAuctionEntry(itr->sortOrder, *auc2, _loc_idx);
+        int res = auc1->CompareAuctionEntry(itr->sortOrder, *auc2, _loc_idx, _worker);
         // "equal" by used column
         if (res == 0)
             continue;
@@ -24,10 +24,14 @@
 #include "LockedQueue.h"
 #include "MPSCQueue.h"
 #include "PCQueue.h"
+#include <array>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 struct ItemTemplate;
 
@@ -63,9 +67,47 @@ struct AuctionEntryItemEnchants
     uint32 charges;
 };
 
+/**
+ * Lower case name of an item with one random property, shared by all auctions listing it.
+ *
+ * The names of all locales are copied from the locale stores when the item is first listed, on the
+ * world thread, as a reload may replace those stores at any time. The lower case name of a locale is
+ * only built when a worker first needs it, for the first search or ordering by name from a player of
+ * that locale, so locales nobody plays with take little memory.
+ */
+class AuctionItemName
+{
+public:
+    /// World thread only
+    AuctionItemName(ItemTemplate const* proto, int32 randomPropertyId);
+
+    /// Thread safe, the name is built by the first caller
+    std::wstring const& Get(int locale) const;
+
+private:
+    void Build(int locale) const;
+
+    std::array<std::string, TOTAL_LOCALES> _sourceNames;   // empty when equal to the enUS name
+    mutable std::array<std::wstring, TOTAL_LOCALES> _names;
+    mutable std::array<std::once_flag, TOTAL_LOCALES> _built;
+};
+
+/// Interns the names of listed items, only a few thousand items are ever listed. Auctions keep their
+/// names alive, so the table can be dropped when the item locales are reloaded.
+class AuctionItemNameTable
+{
+public:
+    std::shared_ptr<AuctionItemName const> GetName(ItemTemplate const* proto, int32 randomPropertyId);
+    void Clear();
+
+private:
+    std::mutex _lock;
+    std::unordered_map<uint64 /*entry << 32 | randomPropertyId*/, std::shared_ptr<AuctionItemName const>> _names;
+};
+
 struct SearchableAuctionEntryItem
 {
-    std::wstring itemName[TOTAL_LOCALES];
+    std::shared_ptr<AuctionItemName const> itemName;
     uint32 entry;
     AuctionEntryItemEnchants enchants[MAX_INSPECTED_ENCHANTMENT_SLOT];
     int32 randomPropertyId;
@@ -75,6 +117,13 @@ struct SearchableAuctionEntryItem
     ItemTemplate const* itemTemplate;
 };
 
+/// Bid of an auction as known to one worker thread
+struct SearchableAuctionBid
+{
+    uint32 bid;
+    ObjectGuid bidderGuid;
+};
+
 struct SearchableAuctionEntry
 {
     uint32 Id;
@@ -83,15 +132,13 @@ struct SearchableAuctionEntry
     uint32 buyout;
     time_t expire_time;
     uint32 startbid;
-    uint32 bid;
-    ObjectGuid bidderGuid;
+    std::vector<SearchableAuctionBid> bids;     // one per worker thread, a worker only reads and writes its own
     AuctionHouseFaction listFaction;
     SearchableAuctionEntryItem item;
 
-    void BuildAuctionInfo(WorldPacket& data) const;
-    void SetItemNames();
+    void BuildAuctionInfo(WorldPacket& data, uint32 worker) const;
 
-    int CompareAuctionEntry(uint32 column, SearchableAuctionEntry const& auc, int loc_idx) const;
+    int CompareAuctionEntry(uint32 column, SearchableAuctionEntry const& auc, int loc_idx, uint32 worker) const;
 };
 
 typedef std::vector<AuctionSortInfo> AuctionSortOrderVector;
@@ -232,18 +279,93 @@ typedef std::vector<SearchableAuctionEntry*> SortableAuctionEntriesList;
 class AuctionSorter
 {
 public:
-    AuctionSorter(AuctionSortOrderVector const* sort, int loc_idx) : _sort(sort), _loc_idx(loc_idx) {}
+    AuctionSorter(AuctionSortOrderVector const* sort, int loc_idx, uint32 worker) : _sort(sort), _loc_idx(loc_idx), _worker(worker) {}
     bool operator()(SearchableAuctionEntry const* auc1, SearchableAuctionEntry const* auc2) const;
 
 private:
     AuctionSortOrderVector const* _sort;
     int _loc_idx;
+    uint32 _worker;
+};
+
+/**
+ * Auctions of one auction house faction as seen by one worker thread.
+ *
+ * Besides the auctions by id it keeps buckets by item class, subclass, inventory type, quality and
+ * required level, and a trigram index over the item names of every locale searched so far. A list
+ * request walks the smallest bucket range its filters allow and checks the remaining filters on
+ * each candidate.
+ *
+ * Orderings of large results are kept presorted and updated on every change, so a page of such a
+ * result only walks the auctions up to that page instead of sorting all matches.
+ */
+class AuctionSearchIndex
+{
+public:
+    void Add(std::shared_ptr<SearchableAuctionEntry> const& auction);
+    void Remove(uint32 auctionId);
+    void UpdateBid(uint32 auctionId, uint32 bid, ObjectGuid bidderGuid);
+
+    /// Index of the worker thread owning this index, selects its bids of the shared auctions
+    void SetWorker(uint32 worker) { _worker = worker; }
+    [[nodiscard]] uint32 GetWorker() const { return _worker; }
+
+    [[nodiscard]] SearchableAuctionEntriesMap const& GetAuctions() const { return _auctions; }
+
+    /// Fills the requested page and returns the number of auctions matching the request
+    uint32 SearchPage(AuctionSearchListRequest const& searchRequest, SortableAuctionEntriesList& page);
+
+    static bool Matches(SearchableAuctionEntry const& auction, AuctionSearchListRequest const& searchRequest);
+
+private:
+    using Bucket = std::vector<SearchableAuctionEntry*>;
+
+    struct SortedView
+    {
+        AuctionSortOrderVector Sorting;
+        int LocIdx = 0;                     // only used when sorting by name
+        bool DependsOnBid = false;
+        uint32 LastUse = 0;
+        SortableAuctionEntriesList Auctions;
+    };
+
+    static constexpr std::size_t MAX_SORTED_VIEWS = 4;
+
+    static void RemoveFromBucket(Bucket& bucket, SearchableAuctionEntry* auction);
+    static void RemoveFromBucket(std::unordered_map<uint32, Bucket>& buckets, uint32 key, SearchableAuctionEntry* auction);
+    static void GetNameTrigrams(std::wstring const& name, std::vector<uint64>& trigrams);
+
+    void AddToIndexes(SearchableAuctionEntry* auction);
+    void RemoveFromIndexes(SearchableAuctionEntry* auction);
+    void BuildNameIndex(int locIdx);
+
+    void FindCandidates(AuctionSearchListRequest const& searchRequest, SortableAuctionEntriesList& candidates);
+
+    SortedView& GetSortedView(AuctionSortOrderVector const& sorting, int locIdx);
+    void InsertIntoView(SortedView& view, SearchableAuctionEntry* auction) const;
+    void RemoveFromView(SortedView& view, SearchableAuctionEntry* auction) const;
+
+    uint32 _worker = 0;
+
+    SearchableAuctionEntriesMap _auctions;
+
+    std::unordered_map<uint32 /*class*/, Bucket> _classIndex;
+    std::unordered_map<uint32 /*class << 16 | subclass*/, Bucket> _subClassIndex;
+    std::unordered_map<uint32 /*inventoryType*/, Bucket> _inventoryTypeIndex;
+    std::map<uint32 /*quality*/, Bucket> _qualityIndex;
+    std::map<uint32 /*requiredLevel*/, Bucket> _levelIndex;
+
+    std::array<std::unordered_map<uint64 /*trigram*/, Bucket>, TOTAL_LOCALES> _nameIndex;
+    std::array<bool, TOTAL_LOCALES> _nameIndexBuilt = { };
+
+    std::vector<SortedView> _sortedViews;
+    uint32 _sortedViewClock = 0;
 };
 
 class AuctionHouseWorkerThread
 {
 public:
-    AuctionHouseWorkerThread(ProducerConsumerQueue<AuctionSearcherRequest*>* requestQueue, MPSCQueue<AuctionSearcherResponse>* responseQueue);
+    AuctionHouseWorkerThread(uint32 index, ProducerConsumerQueue<AuctionSearcherRequest*>* requestQueue, MPSCQueue<AuctionSearcherResponse>* responseQueue);
 
     void Stop();
 
@@ -262,16 +384,15 @@ private:
     void SearchOwnerListRequest(AuctionSearchOwnerListRequest const& searchOwnerListRequest);
     void SearchBidderListRequest(AuctionSearchBidderListRequest const& searchBidderListRequest);
 
-    void BuildListAuctionItems(AuctionSearchListRequest const& searchRequest, SortableAuctionEntriesList& auctionEntries, SearchableAuctionEntriesMap const& auctionMap) const;
-
-    SearchableAuctionEntriesMap& GetSearchableAuctionMap(AuctionHouseFaction faction) { return _searchableAuctionMap[static_cast<uint8>(faction)]; };
+    AuctionSearchIndex& GetSearchIndex(AuctionHouseFaction faction) { return _searchIndex[static_cast<uint8>(faction)]; };
 
-    SearchableAuctionEntriesMap _searchableAuctionMap[MAX_AUCTION_HOUSE_FACTIONS];
+    AuctionSearchIndex _searchIndex[MAX_AUCTION_HOUSE_FACTIONS];
     LockedQueue<std::shared_ptr<AuctionSearcherUpdate>> _auctionUpdatesQueue;
 
     ProducerConsumerQueue<AuctionSearcherRequest*>* _requestQueue;
     MPSCQueue<AuctionSearcherResponse>* _responseQueue;
 
+    uint32 _index;
     std::thread _workerThread;
     std::atomic<bool> _stopped;
 };
@@ -290,12 +411,16 @@ public:
     void RemoveAuction(AuctionEntry const* auctionEntry);
     void UpdateBid(AuctionEntry const* auctionEntry);
 
+    /// Auctions listed from now on take their names from the reloaded item locales
+    void ClearItemNames() { _itemNames.Clear(); }
+
     void NotifyAllWorkers(std::shared_ptr<AuctionSearcherUpdate> const auctionSearchUpdate);
     void NotifyOneWorker(std::shared_ptr<AuctionSearcherUpdate> const auctionSearchUpdate);
 
 private:
     ProducerConsumerQueue<AuctionSearcherRequest*> _requestQueue;
     MPSCQueue<AuctionSearcherResponse> _responseQueue;
+    AuctionItemNameTable _itemNames;
     std::vector<std::unique_ptr<AuctionHouseWorkerThread>> _workerThreads;
 };
 
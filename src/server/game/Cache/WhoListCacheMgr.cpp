@@ -19,8 +19,228 @@
 #include "AreaDefines.h"
 #include "GuildMgr.h"
 #include "ObjectAccessor.h"
+#include "Player.h"
 #include "World.h"
-#include "WorldSessionMgr.h"
+#include "WorldSession.h"
+#include <algorithm>
+
+void WhoListIndex::Update(WhoListPlayerInfo info)
+{
+    auto itr = _slotByGuid.find(info.GetGuid());
+    if (itr == _slotByGuid.end())
+    {
+        uint32 slot;
+        if (!_freeSlots.empty())
+        {
+            slot = _freeSlots.back();
+            _freeSlots.pop_back();
+            _entries[slot] = std::move(info);
+        }
+        else
+        {
+            slot = uint32(_entries.size());
+            _entries.push_back(std::move(info));
+        }
+
+        WhoListPlayerInfo const& entry = _entries[slot];
+        _slotByGuid[entry.GetGuid()] = slot;
+        _levelIndex[entry.GetLevel()].push_back(slot);
+        _zoneIndex[entry.GetZoneId()].push_back(slot);
+        AddToNameIndex(slot);
+        return;
+    }
+
+    uint32 const slot = itr->second;
+    WhoListPlayerInfo& entry = _entries[slot];
+
+    bool const levelChanged = entry.GetLevel() != info.GetLevel();
+    bool const zoneChanged = entry.GetZoneId() != info.GetZoneId();
+    bool const nameChanged = entry.GetWidePlayerName() != info.GetWidePlayerName();
+
+    if (levelChanged)
+        RemoveFromBucket(_levelIndex[entry.GetLevel()], slot);
+    if (zoneChanged)
+        RemoveFromZoneIndex(slot);
+    if (nameChanged)
+        RemoveFromNameIndex(slot);
+
+    entry = std::move(info);
+
+    if (levelChanged)
+        _levelIndex[entry.GetLevel()].push_back(slot);
+    if (zoneChanged)
+        _zoneIndex[entry.GetZoneId()].push_back(slot);
+    if (nameChanged)
+        AddToNameIndex(slot);
+}
+
+void WhoListIndex::Remove(ObjectGuid guid)
+{
+    auto itr = _slotByGuid.find(guid);
+    if (itr == _slotByGuid.end())
+        return;
+
+    uint32 const slot = itr->second;
+    _slotByGuid.erase(itr);
+
+    RemoveFromBucket(_levelIndex[_entries[slot].GetLevel()], slot);
+    RemoveFromZoneIndex(slot);
+    RemoveFromNameIndex(slot);
+
+    _entries[slot] = WhoListPlayerInfo();
+    _freeSlots.push_back(slot);
+}
+
+WhoListPlayerInfo const* WhoListIndex::Find(ObjectGuid guid) const
+{
+    auto itr = _slotByGuid.find(guid);
+    if (itr == _slotByGuid.end())
+        return nullptr;
+
+    return &_entries[itr->second];
+}
+
+void WhoListIndex::Search(WhoListQuery const& query, std::vector<WhoListPlayerInfo const*>& result) const
+{
+    result.clear();
+
+    uint32 const levelMax = std::min<uint32>(query.LevelMax, STRONG_MAX_LEVEL);
+    if (query.LevelMin > levelMax)
+        return;
+
+    std::vector<uint32> zoneIds = query.ZoneIds;
+    std::sort(zoneIds.begin(), zoneIds.end());
+    zoneIds.erase(std::unique(zoneIds.begin(), zoneIds.end()), zoneIds.end());
+
+    // walk the smallest candidate set, every set holds each player at most once
+    std::vector<Bucket const*> candidates;
+    std::size_t candidateCount = 0;
+
+    for (uint32 level = query.LevelMin; level <= levelMax; ++level)
+    {
+        if (!_levelIndex[level].empty())
+        {
+            candidates.push_back(&_levelIndex[level]);
+            candidateCount += _levelIndex[level].size();
+        }
+    }
+
+    if (!zoneIds.empty())
+    {
+        std::vector<Bucket const*> zoneBuckets;
+        std::size_t zoneCount = 0;
+        for (uint32 zoneId : zoneIds)
+        {
+            auto itr = _zoneIndex.find(zoneId);
+            if (itr != _zoneIndex.end())
+            {
+                zoneBuckets.push_back(&itr->second);
+                zoneCount += itr->second.size();
+            }
+        }
+
+        if (zoneCount < candidateCount)
+        {
+            candidates = std::move(zoneBuckets);
+            candidateCount = zoneCount;
+        }
+    }
+
+    std::vector<uint64> trigrams;
+    GetNameTrigrams(query.PlayerName, trigrams);
+    for (uint64 trigram : trigrams)
+    {
+        auto itr = _nameIndex.find(trigram);
+        if (itr == _nameIndex.end())
+            return;                             // no name contains this part of the requested one
+
+        if (itr->second.size() < candidateCount)
+        {
+            candidates.assign(1, &itr->second);
+            candidateCount = itr->second.size();
+        }
+    }
+
+    for (Bucket const* bucket : candidates)
+    {
+        for (uint32 slot : *bucket)
+        {
+            WhoListPlayerInfo const& info = _entries[slot];
+            if (info.GetLevel() < query.LevelMin || info.GetLevel() > levelMax)
+                continue;
+
+            if (!(query.ClassMask & (1 << info.GetClass())) || !(query.RaceMask & (1 << info.GetRace())))
+                continue;
+
+            if (!zoneIds.empty() && !std::binary_search(zoneIds.begin(), zoneIds.end(), info.GetZoneId()))
+                continue;
+
+            if (!query.PlayerName.empty() && info.GetWidePlayerName().find(query.PlayerName) == std::wstring::npos)
+                continue;
+
+            result.push_back(&info);
+        }
+    }
+}
+
+void WhoListIndex::RemoveFromBucket(Bucket& bucket, uint32 slot)
+{
+    auto itr = std::find(bucket.begin(), bucket.end(), slot);
+    if (itr == bucket.end())
+        return;
+
+    *itr = bucket.back();
+    bucket.pop_back();
+}
+
+void WhoListIndex::GetNameTrigrams(std::wstring const& name, std::vector<uint64>& trigrams)
+{
+    trigrams.clear();
+    if (name.size() < 3)
+        return;
+
+    // unicode code points fit into 21 bits
+    for (std::size_t i = 0; i + 2 < name.size(); ++i)
+        trigrams.push_back(uint64(name[i] & 0x1FFFFF) << 42 | uint64(name[i + 1] & 0x1FFFFF) << 21 | uint64(name[i + 2] & 0x1FFFFF));
+
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()), trigrams.end());
+}
+
+void WhoListIndex::AddToNameIndex(uint32 slot)
+{
+    std::vector<uint64> trigrams;
+    GetNameTrigrams(_entries[slot].GetWidePlayerName(), trigrams);
+    for (uint64 trigram : trigrams)
+        _nameIndex[trigram].push_back(slot);
+}
+
+void WhoListIndex::RemoveFromNameIndex(uint32 slot)
+{
+    std::vector<uint64> trigrams;
+    GetNameTrigrams(_entries[slot].GetWidePlayerName(), trigrams);
+    for (uint64 trigram : trigrams)
+    {
+        auto itr = _nameIndex.find(trigram);
+        if (itr == _nameIndex.end())
+            continue;
+
+        RemoveFromBucket(itr->second, slot);
+        if (itr->second.empty())
+            _nameIndex.erase(itr);
+    }
+}
+
+void WhoListIndex::RemoveFromZoneIndex(uint32 slot)
+{
+    auto itr = _zoneIndex.find(_entries[slot].GetZoneId());
+    if (itr == _zoneIndex.end())
+        return;
+
+    RemoveFromBucket(itr->second, slot);
+    if (itr->second.empty())
+        _zoneIndex.erase(itr);
+}
 
 WhoListCacheMgr* WhoListCacheMgr::instance()
 {
@@ -30,34 +250,93 @@ WhoListCacheMgr* WhoListCacheMgr::instance()
 
 void WhoListCacheMgr::Update()
 {
-    // clear current list
-    _whoListStorage.clear();
-    _whoListStorage.reserve(sWorldSessionMgr->GetPlayerCount() + 1);
+    std::unordered_set<ObjectGuid> scheduledUpdates;
+    {
+        std::lock_guard<std::mutex> guard(_scheduledLock);
+        if (_scheduledUpdates.empty())
+            return;
+
+        scheduledUpdates.swap(_scheduledUpdates);
+    }
 
+    for (ObjectGuid const& guid : scheduledUpdates)
+    {
+        if (Player* player = ObjectAccessor::FindConnectedPlayer(guid))
+            UpdatePlayer(player);
+        else
+            _whoList.Remove(guid);
+    }
+}
+
+void WhoListCacheMgr::Resync()
+{
     for (auto const& [guid, player] : ObjectAccessor::GetPlayers())
+        UpdatePlayer(player);
+
+    std::vector<ObjectGuid> loggedOut;
+    _whoList.ForEach([&loggedOut](WhoListPlayerInfo const& info)
     {
-        if (!player->FindMap() || player->GetSession()->PlayerLoading())
-            continue;
+        if (!ObjectAccessor::FindConnectedPlayer(info.GetGuid()))
+            loggedOut.push_back(info.GetGuid());
+    });
 
-        std::string playerName = player->GetName();
-        std::wstring widePlayerName;
+    for (ObjectGuid const& guid : loggedOut)
+        _whoList.Remove(guid);
+}
 
-        if (!Utf8toWStr(playerName, widePlayerName))
-            continue;
+void WhoListCacheMgr::ScheduleUpdate(ObjectGuid guid)
+{
+    std::lock_guard<std::mutex> guard(_scheduledLock);
+    _scheduledUpdates.insert(guid);
+}
 
-        wstrToLower(widePlayerName);
+void WhoListCacheMgr::UpdatePlayer(Player* player)
+{
+    if (!player->FindMap() || player->GetSession()->PlayerLoading())
+    {
+        _whoList.Remove(player->GetGUID());
+        return;
+    }
 
-        std::string guildName = sGuildMgr->GetGuildNameById(player->GetGuildId());
-        std::wstring wideGuildName;
+    TeamId team = player->GetTeamId();
+    AccountTypes security = player->GetSession()->GetSecurity();
+    uint8 level = player->GetLevel();
+    uint32 zoneId = player->IsSpectator() ? AREA_DALARAN : player->GetZoneId();
+    bool visible = player->IsVisible();
+    uint32 guildId = player->GetGuildId();
 
-        if (!Utf8toWStr(guildName, wideGuildName))
-            continue;
+    Guild const* guild = guildId ? sGuildMgr->GetGuildById(guildId) : nullptr;
+    std::string_view currentGuildName = guild ? std::string_view(guild->GetName()) : std::string_view();
 
-        wstrToLower(wideGuildName);
+    // names are only converted when a player is added, changes guild or the guild is renamed
+    WhoListPlayerInfo const* info = _whoList.Find(player->GetGUID());
+    if (info && info->GetGuildId() == guildId && info->GetGuildName() == currentGuildName)
+    {
+        if (info->GetTeamId() == team && info->GetSecurity() == security && info->GetLevel() == level && info->GetZoneId() == zoneId &&
+            info->IsVisible() == visible && info->GetGender() == player->getGender())
+            return;
 
-        _whoListStorage.emplace_back(player->GetGUID(), player->GetTeamId(), player->GetSession()->GetSecurity(), player->GetLevel(),
-            player->getClass(), player->getRace(),
-            (player->IsSpectator() ? AREA_DALARAN : player->GetZoneId()), player->getGender(), player->IsVisible(),
-            widePlayerName, wideGuildName, playerName, guildName);
+        _whoList.Update(WhoListPlayerInfo(player->GetGUID(), team, security, level, player->getClass(), player->getRace(), zoneId, player->getGender(), visible,
+            guildId, info->GetWidePlayerName(), info->GetWideGuildName(), info->GetPlayerName(), info->GetGuildName()));
+        return;
     }
+
+    std::string playerName = player->GetName();
+    std::wstring widePlayerName;
+
+    if (!Utf8toWStr(playerName, widePlayerName))
+        return;
+
+    wstrToLower(widePlayerName);
+
+    std::string guildName(currentGuildName);
+    std::wstring wideGuildName;
+
+    if (!Utf8toWStr(guildName, wideGuildName))
+        return;
+
+    wstrToLower(wideGuildName);
+
+    _whoList.Update(WhoListPlayerInfo(player->GetGUID(), team, security, level, player->getClass(), player->getRace(), zoneId, player->getGender(), visible,
+        guildId, widePlayerName, wideGuildName, playerName, guildName));
 }
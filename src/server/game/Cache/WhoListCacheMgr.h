@@ -19,14 +19,23 @@
 #define _WHO_LISTCACHE_H_
 
 #include "Common.h"
+#include "DBCEnums.h"
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
+#include <array>
+#include <mutex>
+#include <unordered_set>
+
+class Player;
 
 class WhoListPlayerInfo
 {
+    friend class WhoListIndex;
+
 public:
-    WhoListPlayerInfo(ObjectGuid guid, TeamId team, AccountTypes security, uint8 level, uint8 clss, uint8 race, uint32 zoneid, uint8 gender, bool visible, std::wstring const& widePlayerName,
-        std::wstring const& wideGuildName, std::string const& playerName, std::string const& guildName) :
+    WhoListPlayerInfo() = default;
+    WhoListPlayerInfo(ObjectGuid guid, TeamId team, AccountTypes security, uint8 level, uint8 clss, uint8 race, uint32 zoneid, uint8 gender, bool visible, uint32 guildId,
+        std::wstring const& widePlayerName, std::wstring const& wideGuildName, std::string const& playerName, std::string const& guildName) :
         _guid(guid),
         _team(team),
         _security(security),
@@ -36,6 +45,7 @@ public:
         _zoneid(zoneid),
         _gender(gender),
         _visible(visible),
+        _guildId(guildId),
         _widePlayerName(widePlayerName),
         _wideGuildName(wideGuildName),
         _playerName(playerName),
@@ -50,6 +60,7 @@ public:
     uint32 GetZoneId() const { return _zoneid; }
     uint8 GetGender() const { return _gender; }
     bool IsVisible() const { return _visible; }
+    uint32 GetGuildId() const { return _guildId; }
     std::wstring const& GetWidePlayerName() const { return _widePlayerName; }
     std::wstring const& GetWideGuildName() const { return _wideGuildName; }
     std::string const& GetPlayerName() const { return _playerName; }
@@ -57,21 +68,78 @@ public:
 
 private:
     ObjectGuid _guid;
-    TeamId _team;
-    AccountTypes _security;
-    uint8 _level;
-    uint8 _class;
-    uint8 _race;
-    uint32 _zoneid;
-    uint8 _gender;
-    bool _visible;
+    TeamId _team = TEAM_NEUTRAL;
+    AccountTypes _security = SEC_PLAYER;
+    uint8 _level = 0;
+    uint8 _class = 0;
+    uint8 _race = 0;
+    uint32 _zoneid = 0;
+    uint8 _gender = 0;
+    bool _visible = false;
+    uint32 _guildId = 0;
     std::wstring _widePlayerName;
     std::wstring _wideGuildName;
     std::string _playerName;
     std::string _guildName;
 };
 
-using WhoListInfoVector = std::vector<WhoListPlayerInfo>;
+/// Filters of a /who request that WhoListIndex can answer from its indexes
+struct WhoListQuery
+{
+    uint32 LevelMin = 0;
+    uint32 LevelMax = STRONG_MAX_LEVEL;
+    uint32 RaceMask = 0xFFFFFFFF;
+    uint32 ClassMask = 0xFFFFFFFF;
+    std::vector<uint32> ZoneIds;            // any zone when empty
+    std::wstring PlayerName;                // lowercase part of the player name, any name when empty
+};
+
+/**
+ * Online players of the who list with indexes by level, zone and name trigrams.
+ *
+ * Search() walks the smallest of the level buckets, zone buckets or the posting list of the
+ * rarest trigram of the requested name, and checks the remaining filters on each candidate.
+ * Class and race are plain mask tests on the candidates.
+ */
+class AC_GAME_API WhoListIndex
+{
+public:
+    /// Adds the player or updates the indexes of the fields that changed
+    void Update(WhoListPlayerInfo info);
+    void Remove(ObjectGuid guid);
+
+    [[nodiscard]] WhoListPlayerInfo const* Find(ObjectGuid guid) const;
+    [[nodiscard]] std::size_t GetSize() const { return _slotByGuid.size(); }
+
+    /// Players matching every filter of the query, in no particular order
+    void Search(WhoListQuery const& query, std::vector<WhoListPlayerInfo const*>& result) const;
+
+    template<typename Worker>
+    void ForEach(Worker&& worker) const
+    {
+        for (WhoListPlayerInfo const& info : _entries)
+            if (info.GetGuid())
+                worker(info);
+    }
+
+private:
+    using Bucket = std::vector<uint32 /*slot*/>;
+
+    static void RemoveFromBucket(Bucket& bucket, uint32 slot);
+    static void GetNameTrigrams(std::wstring const& name, std::vector<uint64>& trigrams);
+
+    void AddToNameIndex(uint32 slot);
+    void RemoveFromNameIndex(uint32 slot);
+    void RemoveFromZoneIndex(uint32 slot);
+
+    std::vector<WhoListPlayerInfo> _entries;                 // free slots have an empty guid
+    std::vector<uint32> _freeSlots;
+    std::unordered_map<ObjectGuid, uint32 /*slot*/> _slotByGuid;
+
+    std::array<Bucket, STRONG_MAX_LEVEL + 1> _levelIndex;
+    std::unordered_map<uint32 /*zoneId*/, Bucket> _zoneIndex;
+    std::unordered_map<uint64 /*trigram*/, Bucket> _nameIndex;
+};
 
 class AC_GAME_API WhoListCacheMgr
 {
@@ -86,11 +154,22 @@ class AC_GAME_API WhoListCacheMgr
 public:
     static WhoListCacheMgr* instance();
 
+    /// Applies the changes scheduled since the last call, world thread only
     void Update();
-    WhoListInfoVector const& GetWhoList() const { return _whoListStorage; }
+    /// Compares every online player with its entry, for changes that are not scheduled (visibility, security, guild)
+    void Resync();
+    /// Thread safe, called on login, logout, level and zone changes
+    void ScheduleUpdate(ObjectGuid guid);
+
+    WhoListIndex const& GetWhoList() const { return _whoList; }
 
 protected:
-    WhoListInfoVector _whoListStorage;
+    void UpdatePlayer(Player* player);
+
+    WhoListIndex _whoList;
+
+    std::mutex _scheduledLock;
+    std::unordered_set<ObjectGuid> _scheduledUpdates;
 };
 
 #define sWhoListCacheMgr WhoListCacheMgr::instance()
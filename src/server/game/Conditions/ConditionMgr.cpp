@@ -29,6 +29,30 @@
 #include "SpellAuras.h"
 #include "SpellMgr.h"
 #include "WorldState.h"
+#include <algorithm>
+
+namespace
+{
+    uint64 MakeConditionKey(uint32 key1, uint32 key2)
+    {
+        return uint64(key1) << 32 | key2;
+    }
+
+    // SAI source type (SourceId) and event id + 1 (SourceGroup) of smart event conditions share one key
+    uint32 MakeSmartEventConditionKey(uint32 sourceType, uint32 eventGroup)
+    {
+        return sourceType << 24 | eventGroup;
+    }
+
+    ConditionSpan FindConditions(ConditionContainer const& store, uint32 key1, uint32 key2)
+    {
+        ConditionContainer::const_iterator itr = store.find(MakeConditionKey(key1, key2));
+        if (itr == store.end())
+            return ConditionSpan();
+
+        return itr->second;
+    }
+}
 
 // Checks if object meets the condition
 // Can have CONDITION_SOURCE_TYPE_NONE && !mReferenceId if called from a special event (ie: eventAI)
@@ -786,6 +810,52 @@ uint32 Condition::GetSearcherTypeMaskForCondition()
     return mask;
 }
 
+uint8 Condition::GetEvaluationCost() const
+{
+    // references are resolved and checked recursively
+    if (ReferenceId)
+        return 3;
+
+    switch (ConditionType)
+    {
+    // fields of the object or its map
+    case CONDITION_NONE:
+    case CONDITION_ZONEID:
+    case CONDITION_TEAM:
+    case CONDITION_CLASS:
+    case CONDITION_RACE:
+    case CONDITION_GENDER:
+    case CONDITION_MAPID:
+    case CONDITION_AREAID:
+    case CONDITION_LEVEL:
+    case CONDITION_DRUNKENSTATE:
+    case CONDITION_OBJECT_ENTRY_GUID:
+    case CONDITION_TYPE_MASK:
+    case CONDITION_ALIVE:
+    case CONDITION_HP_VAL:
+    case CONDITION_HP_PCT:
+    case CONDITION_PHASEMASK:
+    case CONDITION_TITLE:
+    case CONDITION_SPAWNMASK:
+    case CONDITION_UNIT_STATE:
+    case CONDITION_CREATURE_TYPE:
+    case CONDITION_STAND_STATE:
+    case CONDITION_DIFFICULTY_ID:
+    case CONDITION_CHARMED:
+    case CONDITION_TAXI:
+        return 0;
+    // scanning the inventory or searching the grids
+    case CONDITION_ITEM:
+    case CONDITION_QUEST_SATISFY_EXCLUSIVE:
+    case CONDITION_NEAR_CREATURE:
+    case CONDITION_NEAR_GAMEOBJECT:
+        return 2;
+    // lookups in containers of the object or global managers
+    default:
+        return 1;
+    }
+}
+
 uint32 Condition::GetMaxAvailableConditionTargets()
 {
     // returns number of targets which are available for given source type
@@ -824,78 +894,116 @@ ConditionMgr* ConditionMgr::instance()
     return &instance;
 }
 
-ConditionList ConditionMgr::GetConditionReferences(uint32 refId)
+ConditionSpan ConditionMgr::GetConditionReferences(uint32 refId) const
 {
-    ConditionList                               conditions;
     ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(refId);
     if (ref != ConditionReferenceStore.end())
-        conditions = (*ref).second;
-    return conditions;
+        return ref->second;
+    return ConditionSpan();
 }
 
-uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionList const& conditions)
+void ConditionMgr::AddToConditionList(ConditionList& conditions, Condition* cond)
 {
-    if (conditions.empty())
-        return GRID_MAP_TYPE_MASK_ALL;
-    //     groupId, typeMask
-    std::map<uint32, uint32> ElseGroupStore;
-    for (ConditionList::const_iterator i = conditions.begin(); i != conditions.end(); ++i)
-    {
-        // no point of having not loaded conditions in list
-        ASSERT((*i)->isLoaded() && "ConditionMgr::GetSearcherTypeMaskForConditionList - not yet loaded condition found in list");
-        std::map<uint32, uint32>::const_iterator itr = ElseGroupStore.find((*i)->ElseGroup);
-        // group not filled yet, fill with widest mask possible
-        if (itr == ElseGroupStore.end())
-            ElseGroupStore[(*i)->ElseGroup] = GRID_MAP_TYPE_MASK_ALL;
-        // no point of checking anymore, empty mask
-        else if (!(*itr).second)
-            continue;
+    conditions.push_back(cond);
+    _unsortedLists.insert(&conditions);
+}
 
-        if ((*i)->ReferenceId) // handle reference
+void ConditionMgr::SortConditionList(ConditionList& conditions)
+{
+    // conditions of an ElseGroup follow each other, so evaluating them needs no lookups
+    std::stable_sort(conditions.begin(), conditions.end(), [](Condition const* left, Condition const* right)
+    {
+        return left->ElseGroup < right->ElseGroup;
+    });
+
+    // the cheapest checks of a group go first to fail it early, unless the failed condition is reported to the caster
+    for (ConditionList::iterator group = conditions.begin(); group != conditions.end();)
+    {
+        ConditionList::iterator groupEnd = std::find_if(group, conditions.end(), [group](Condition const* condition)
         {
-            ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
-            ASSERT(ref != ConditionReferenceStore.end() && "ConditionMgr::GetSearcherTypeMaskForConditionList - incorrect reference");
-            ElseGroupStore[(*i)->ElseGroup] &= GetSearcherTypeMaskForConditionList((*ref).second);
-        }
-        else // handle normal condition
+            return condition->ElseGroup != (*group)->ElseGroup;
+        });
+
+        bool reportsFailure = std::any_of(group, groupEnd, [](Condition const* condition)
         {
-            // object will match conditions in one ElseGroupStore only when it matches all of them
-            // so, let's find a smallest possible mask which satisfies all conditions
-            ElseGroupStore[(*i)->ElseGroup] &= (*i)->GetSearcherTypeMaskForCondition();
+            return condition->SourceType == CONDITION_SOURCE_TYPE_SPELL || condition->ErrorType;
+        });
+
+        if (!reportsFailure)
+        {
+            std::stable_sort(group, groupEnd, [](Condition const* left, Condition const* right)
+            {
+                return left->GetEvaluationCost() < right->GetEvaluationCost();
+            });
         }
+
+        group = groupEnd;
     }
-    // object will match condition when one of the checks in ElseGroupStore is matching
+}
+
+uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionSpan conditions)
+{
+    if (conditions.empty())
+        return GRID_MAP_TYPE_MASK_ALL;
+
+    // object will match condition when one of the ElseGroups is matching
     // so, let's include all possible masks
     uint32 mask = 0;
-    for (std::map<uint32, uint32>::const_iterator i = ElseGroupStore.begin(); i != ElseGroupStore.end(); ++i) mask |= i->second;
+    for (ConditionSpan::iterator i = conditions.begin(); i != conditions.end();)
+    {
+        uint32 const elseGroup = (*i)->ElseGroup;
+        uint32 groupMask = GRID_MAP_TYPE_MASK_ALL;
+        for (; i != conditions.end() && (*i)->ElseGroup == elseGroup; ++i)
+        {
+            // no point of having not loaded conditions in list
+            ASSERT((*i)->isLoaded() && "ConditionMgr::GetSearcherTypeMaskForConditionList - not yet loaded condition found in list");
+            // no point of checking anymore, empty mask
+            if (!groupMask)
+                continue;
+
+            if ((*i)->ReferenceId) // handle reference
+            {
+                ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
+                ASSERT(ref != ConditionReferenceStore.end() && "ConditionMgr::GetSearcherTypeMaskForConditionList - incorrect reference");
+                groupMask &= GetSearcherTypeMaskForConditionList(ref->second);
+            }
+            else // handle normal condition
+            {
+                // object will match conditions in one ElseGroup only when it matches all of them
+                // so, let's find a smallest possible mask which satisfies all conditions
+                groupMask &= (*i)->GetSearcherTypeMaskForCondition();
+            }
+        }
+
+        mask |= groupMask;
+    }
 
     return mask;
 }
 
-bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions)
+bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionSpan conditions)
 {
-    //     groupId, groupCheckPassed
-    std::map<uint32, bool> ElseGroupStore;
-    for (ConditionList::const_iterator i = conditions.begin(); i != conditions.end(); ++i)
-    {
-        LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList condType: {} val1: {}", (*i)->ConditionType, (*i)->ConditionValue1);
-        if ((*i)->isLoaded())
-        {
-            //! Find ElseGroup in ElseGroupStore
-            std::map<uint32, bool>::const_iterator itr = ElseGroupStore.find((*i)->ElseGroup);
-            //! If not found, add an entry in the store and set to true (placeholder)
-            if (itr == ElseGroupStore.end())
-                ElseGroupStore[(*i)->ElseGroup] = true;
-            else if (!(*itr).second)
+    // lists are sorted by ElseGroup, the first group with all of its conditions met is enough
+    for (ConditionSpan::iterator i = conditions.begin(); i != conditions.end();)
+    {
+        uint32 const elseGroup = (*i)->ElseGroup;
+        bool groupChecked = false;
+        bool groupCheckPassed = true;
+        for (; i != conditions.end() && (*i)->ElseGroup == elseGroup; ++i)
+        {
+            if (!groupCheckPassed || !(*i)->isLoaded())
                 continue;
 
+            LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList condType: {} val1: {}", (*i)->ConditionType, (*i)->ConditionValue1);
+            groupChecked = true;
+
             if ((*i)->ReferenceId) // handle reference
             {
                 ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
                 if (ref != ConditionReferenceStore.end())
                 {
-                    if (!IsObjectMeetToConditionList(sourceInfo, (*ref).second))
-                        ElseGroupStore[(*i)->ElseGroup] = false;
+                    if (!IsObjectMeetToConditionList(sourceInfo, ref->second))
+                        groupCheckPassed = false;
                 }
                 else
                 {
@@ -905,30 +1013,30 @@ bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo,
             else // handle normal condition
             {
                 if (!(*i)->Meets(sourceInfo))
-                    ElseGroupStore[(*i)->ElseGroup] = false;
+                    groupCheckPassed = false;
             }
         }
-    }
-    for (std::map<uint32, bool>::const_iterator i = ElseGroupStore.begin(); i != ElseGroupStore.end(); ++i)
-        if (i->second)
+
+        if (groupChecked && groupCheckPassed)
             return true;
+    }
 
     return false;
 }
 
-bool ConditionMgr::IsObjectMeetToConditions(WorldObject* object, ConditionList const& conditions)
+bool ConditionMgr::IsObjectMeetToConditions(WorldObject* object, ConditionSpan conditions)
 {
     ConditionSourceInfo srcInfo = ConditionSourceInfo(object);
     return IsObjectMeetToConditions(srcInfo, conditions);
 }
 
-bool ConditionMgr::IsObjectMeetToConditions(WorldObject* object1, WorldObject* object2, ConditionList const& conditions)
+bool ConditionMgr::IsObjectMeetToConditions(WorldObject* object1, WorldObject* object2, ConditionSpan conditions)
 {
     ConditionSourceInfo srcInfo = ConditionSourceInfo(object1, object2);
     return IsObjectMeetToConditions(srcInfo, conditions);
 }
 
-bool ConditionMgr::IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionList const& conditions)
+bool ConditionMgr::IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionSpan conditions)
 {
     if (conditions.empty())
         return true;
@@ -949,94 +1057,66 @@ bool ConditionMgr::CanHaveSourceIdSet(ConditionSourceType sourceType) const
     return (sourceType == CONDITION_SOURCE_TYPE_SMART_EVENT);
 }
 
-ConditionList ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry)
+ConditionSpan ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry) const
 {
-    ConditionList spellCond;
-    if (sourceType > CONDITION_SOURCE_TYPE_NONE && sourceType < CONDITION_SOURCE_TYPE_MAX)
-    {
-        ConditionContainer::const_iterator itr = ConditionStore.find(sourceType);
-        if (itr != ConditionStore.end())
-        {
-            ConditionTypeContainer::const_iterator i = (*itr).second.find(entry);
-            if (i != (*itr).second.end())
-            {
-                spellCond = (*i).second;
-                LOG_DEBUG("condition", "GetConditionsForNotGroupedEntry: found conditions for type {} and entry {}", uint32(sourceType), entry);
-            }
-        }
-    }
-    return spellCond;
+    if (sourceType <= CONDITION_SOURCE_TYPE_NONE || sourceType >= CONDITION_SOURCE_TYPE_MAX)
+        return ConditionSpan();
+
+    ConditionSpan conditions = FindConditions(ConditionStore, sourceType, entry);
+    if (!conditions.empty())
+        LOG_DEBUG("condition", "GetConditionsForNotGroupedEntry: found conditions for type {} and entry {}", uint32(sourceType), entry);
+    return conditions;
 }
 
-ConditionList ConditionMgr::GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId)
+ConditionSpan ConditionMgr::GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId) const
 {
-    ConditionList                                   cond;
-    CreatureSpellConditionContainer::const_iterator itr = SpellClickEventConditionStore.find(creatureId);
-    if (itr != SpellClickEventConditionStore.end())
-    {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(spellId);
-        if (i != (*itr).second.end())
-        {
-            cond = (*i).second;
-            LOG_DEBUG("condition", "GetConditionsForSpellClickEvent: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
-        }
-    }
-    return cond;
+    ConditionSpan conditions = FindConditions(SpellClickEventConditionStore, creatureId, spellId);
+    if (!conditions.empty())
+        LOG_DEBUG("condition", "GetConditionsForSpellClickEvent: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
+    return conditions;
 }
 
-ConditionList ConditionMgr::GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId)
+ConditionSpan ConditionMgr::GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId) const
 {
-    ConditionList                                   cond;
-    CreatureSpellConditionContainer::const_iterator itr = VehicleSpellConditionStore.find(creatureId);
-    if (itr != VehicleSpellConditionStore.end())
-    {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(spellId);
-        if (i != (*itr).second.end())
-        {
-            cond = (*i).second;
-            LOG_DEBUG("condition", "GetConditionsForVehicleSpell: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
-        }
-    }
-    return cond;
+    ConditionSpan conditions = FindConditions(VehicleSpellConditionStore, creatureId, spellId);
+    if (!conditions.empty())
+        LOG_DEBUG("condition", "GetConditionsForVehicleSpell: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
+    return conditions;
 }
 
-ConditionList ConditionMgr::GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType)
+ConditionSpan ConditionMgr::GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType) const
 {
-    ConditionList                                cond;
-    SmartEventConditionContainer::const_iterator itr = SmartEventConditionStore.find(std::make_pair(entryOrGuid, sourceType));
-    if (itr != SmartEventConditionStore.end())
-    {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(eventId + 1);
-        if (i != (*itr).second.end())
-        {
-            cond = (*i).second;
-            LOG_DEBUG("condition", "GetConditionsForSmartEvent: found conditions for Smart Event entry or guid {} event_id {}", entryOrGuid, eventId);
-        }
-    }
-    return cond;
+    ConditionSpan conditions = FindConditions(SmartEventConditionStore, uint32(entryOrGuid), MakeSmartEventConditionKey(sourceType, eventId + 1));
+    if (!conditions.empty())
+        LOG_DEBUG("condition", "GetConditionsForSmartEvent: found conditions for Smart Event entry or guid {} event_id {}", entryOrGuid, eventId);
+    return conditions;
 }
 
-ConditionList ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId)
+ConditionSpan ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId) const
 {
-    ConditionList                               cond;
-    NpcVendorConditionContainer::const_iterator itr = NpcVendorConditionContainerStore.find(creatureId);
-    if (itr != NpcVendorConditionContainerStore.end())
+    ConditionSpan conditions = FindConditions(NpcVendorConditionContainerStore, creatureId, itemId);
+    if (!conditions.empty())
     {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(itemId);
-        if (i != (*itr).second.end())
+        if (itemId)
         {
-            cond = (*i).second;
-            if (itemId)
-            {
-                LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {} item {}", creatureId, itemId);
-            }
-            else
-            {
-                LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {}", creatureId);
-            }
+            LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {} item {}", creatureId, itemId);
+        }
+        else
+        {
+            LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {}", creatureId);
         }
     }
-    return cond;
+    return conditions;
+}
+
+std::vector<ConditionSpan> ConditionMgr::GetAllConditionLists() const
+{
+    std::vector<ConditionSpan> lists;
+    for (ConditionContainer const* store : { &ConditionStore, &VehicleSpellConditionStore, &SpellClickEventConditionStore, &NpcVendorConditionContainerStore, &SmartEventConditionStore })
+        for (auto const& [key, conditions] : *store)
+            lists.emplace_back(conditions);
+
+    return lists;
 }
 
 void ConditionMgr::LoadConditions(bool isReload)
@@ -1044,6 +1124,7 @@ void ConditionMgr::LoadConditions(bool isReload)
     uint32 oldMSTime = getMSTime();
 
     Clean();
+    ++_loadCount;
 
     // must clear all custom handled cases (groupped types) before reload
     if (isReload)
@@ -1146,12 +1227,7 @@ void ConditionMgr::LoadConditions(bool isReload)
         if (iSourceTypeOrReferenceId < 0) // it is a reference template
         {
             uint32 uRefId = std::abs(iSourceTypeOrReferenceId);
-            if (ConditionReferenceStore.find(uRefId) == ConditionReferenceStore.end()) // make sure we have a list for our conditions, based on reference id
-            {
-                ConditionList mCondList;
-                ConditionReferenceStore[uRefId] = mCondList;
-            }
-            ConditionReferenceStore[uRefId].push_back(cond); // add to reference storage
+            AddToConditionList(ConditionReferenceStore[uRefId], cond); // add to reference storage
             count++;
             continue;
         } // end of reference templates
@@ -1239,7 +1315,7 @@ void ConditionMgr::LoadConditions(bool isReload)
                 break;
             case CONDITION_SOURCE_TYPE_SPELL_CLICK_EVENT:
             {
-                SpellClickEventConditionStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                AddToConditionList(SpellClickEventConditionStore[MakeConditionKey(cond->SourceGroup, cond->SourceEntry)], cond);
                 valid = true;
                 ++count;
                 continue; // do not add to m_AllocatedMemory to avoid double deleting
@@ -1249,23 +1325,22 @@ void ConditionMgr::LoadConditions(bool isReload)
                 break;
             case CONDITION_SOURCE_TYPE_VEHICLE_SPELL:
             {
-                VehicleSpellConditionStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                AddToConditionList(VehicleSpellConditionStore[MakeConditionKey(cond->SourceGroup, cond->SourceEntry)], cond);
                 valid = true;
                 ++count;
                 continue; // do not add to m_AllocatedMemory to avoid double deleting
             }
             case CONDITION_SOURCE_TYPE_SMART_EVENT:
             {
-                //! TODO: PAIR_32 ?
-                std::pair<int32, uint32> key = std::make_pair(cond->SourceEntry, cond->SourceId);
-                SmartEventConditionStore[key][cond->SourceGroup].push_back(cond);
+                uint64 key = MakeConditionKey(cond->SourceEntry, MakeSmartEventConditionKey(cond->SourceId, cond->SourceGroup));
+                AddToConditionList(SmartEventConditionStore[key], cond);
                 valid = true;
                 ++count;
                 continue;
             }
             case CONDITION_SOURCE_TYPE_NPC_VENDOR:
             {
-                NpcVendorConditionContainerStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                AddToConditionList(NpcVendorConditionContainerStore[MakeConditionKey(cond->SourceGroup, cond->SourceEntry)], cond);
                 valid = true;
                 ++count;
                 continue;
@@ -1293,25 +1368,17 @@ void ConditionMgr::LoadConditions(bool isReload)
         }
 
         // handle not grouped conditions
-        // make sure we have a storage list for our SourceType
-        if (ConditionStore.find(cond->SourceType) == ConditionStore.end())
-        {
-            ConditionTypeContainer mTypeMap;
-            ConditionStore[cond->SourceType] = mTypeMap; // add new empty list for SourceType
-        }
-
-        // make sure we have a condition list for our SourceType's entry
-        if (ConditionStore[cond->SourceType].find(cond->SourceEntry) == ConditionStore[cond->SourceType].end())
-        {
-            ConditionList mCondList;
-            ConditionStore[cond->SourceType][cond->SourceEntry] = mCondList;
-        }
-
         // add new Condition to storage based on Type/Entry
-        ConditionStore[cond->SourceType][cond->SourceEntry].push_back(cond);
+        AddToConditionList(ConditionStore[MakeConditionKey(cond->SourceType, cond->SourceEntry)], cond);
         ++count;
     } while (result->NextRow());
 
+    // sort every filled list once instead of on each insert
+    for (ConditionList* conditions : _unsortedLists)
+        SortConditionList(*conditions);
+
+    _unsortedLists.clear();
+
     LOG_INFO("server.loading", ">> Loaded {} conditions in {} ms", count, GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
@@ -1341,7 +1408,7 @@ bool ConditionMgr::addToGossipMenus(Condition* cond)
         {
             if ((*itr).second.MenuID == cond->SourceGroup && (*itr).second.TextID == uint32(cond->SourceEntry))
             {
-                (*itr).second.Conditions.push_back(cond);
+                AddToConditionList((*itr).second.Conditions, cond);
                 return true;
             }
         }
@@ -1360,7 +1427,7 @@ bool ConditionMgr::addToGossipMenuItems(Condition* cond)
         {
             if ((*itr).second.MenuID == cond->SourceGroup && (*itr).second.OptionID == uint32(cond->SourceEntry))
             {
-                (*itr).second.Conditions.push_back(cond);
+                AddToConditionList((*itr).second.Conditions, cond);
                 return true;
             }
         }
@@ -1449,7 +1516,7 @@ bool ConditionMgr::addToSpellImplicitTargetConditions(Condition* cond)
                     delete sharedList;
             }
             if (sharedList)
-                sharedList->push_back(cond);
+                AddToConditionList(*sharedList, cond);
             break;
         }
     }
@@ -1829,6 +1896,15 @@ bool ConditionMgr::isSourceTypeValid(Condition* cond)
     case CONDITION_SOURCE_TYPE_GOSSIP_MENU:
     case CONDITION_SOURCE_TYPE_GOSSIP_MENU_OPTION:
     case CONDITION_SOURCE_TYPE_SMART_EVENT:
+    {
+        // event id and SAI source type are stored in one key
+        if (cond->SourceGroup > 0xFFFFFF || cond->SourceId > 0xFF)
+        {
+            LOG_ERROR("sql.sql", "SourceGroup {} or SourceId {} in `condition` table is not a valid smart script event, ignoring.", cond->SourceGroup, cond->SourceId);
+            return false;
+        }
+        break;
+    }
     case CONDITION_SOURCE_TYPE_NONE:
     default:
         break;
@@ -2472,73 +2548,20 @@ bool ConditionMgr::isConditionTypeValid(Condition* cond)
 void ConditionMgr::Clean()
 {
     for (ConditionReferenceContainer::iterator itr = ConditionReferenceStore.begin(); itr != ConditionReferenceStore.end(); ++itr)
-    {
-        for (ConditionList::const_iterator it = itr->second.begin(); it != itr->second.end(); ++it) delete *it;
-        itr->second.clear();
-    }
+        for (Condition* condition : itr->second)
+            delete condition;
 
     ConditionReferenceStore.clear();
 
-    for (ConditionContainer::iterator itr = ConditionStore.begin(); itr != ConditionStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
-
-    ConditionStore.clear();
-
-    for (CreatureSpellConditionContainer::iterator itr = VehicleSpellConditionStore.begin(); itr != VehicleSpellConditionStore.end(); ++itr)
+    for (ConditionContainer* store : { &ConditionStore, &VehicleSpellConditionStore, &SmartEventConditionStore, &SpellClickEventConditionStore, &NpcVendorConditionContainerStore })
     {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
-
-    VehicleSpellConditionStore.clear();
+        for (ConditionContainer::iterator itr = store->begin(); itr != store->end(); ++itr)
+            for (Condition* condition : itr->second)
+                delete condition;
 
-    for (SmartEventConditionContainer::iterator itr = SmartEventConditionStore.begin(); itr != SmartEventConditionStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
+        store->clear();
     }
 
-    SmartEventConditionStore.clear();
-
-    for (CreatureSpellConditionContainer::iterator itr = SpellClickEventConditionStore.begin(); itr != SpellClickEventConditionStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
-
-    SpellClickEventConditionStore.clear();
-
-    for (NpcVendorConditionContainer::iterator itr = NpcVendorConditionContainerStore.begin(); itr != NpcVendorConditionContainerStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
-
-    NpcVendorConditionContainerStore.clear();
-
     // this is a BIG hack, feel free to fix it if you can figure out the ConditionMgr ;)
     for (std::list<Condition*>::const_iterator itr = AllocatedMemoryStore.begin(); itr != AllocatedMemoryStore.end(); ++itr) delete *itr;
 
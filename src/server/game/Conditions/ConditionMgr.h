@@ -20,7 +20,10 @@
 
 #include "Define.h"
 #include <list>
-#include <map>
+#include <span>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 class Player;
 class Unit;
@@ -108,8 +111,8 @@ enum ConditionTypes
     The following steps only apply if your condition can be grouped:
 
     Step 6: Determine how you are going to store your conditions. You need to add a new storage container
-            for it in ConditionMgr class, along with a function like:
-            ConditionList GetConditionsForXXXYourNewSourceTypeXXX(parameters...)
+            for it in ConditionMgr class, filled through ConditionMgr::AddToConditionList, along with a function like:
+            ConditionSpan GetConditionsForXXXYourNewSourceTypeXXX(parameters...)
 
             The above function should be placed in upper level (practical) code that actually
             checks the conditions.
@@ -232,16 +235,16 @@ struct Condition
     uint32 GetSearcherTypeMaskForCondition();
     [[nodiscard]] bool isLoaded() const { return ConditionType > CONDITION_NONE || ReferenceId; }
     uint32 GetMaxAvailableConditionTargets();
+    /// Rough cost of Meets(), conditions of an ElseGroup are checked from the cheapest to the most expensive one
+    [[nodiscard]] uint8 GetEvaluationCost() const;
 };
 
-typedef std::list<Condition*> ConditionList;
-typedef std::map<uint32, ConditionList> ConditionTypeContainer;
-typedef std::map<ConditionSourceType, ConditionTypeContainer> ConditionContainer;
-typedef std::map<uint32, ConditionTypeContainer> CreatureSpellConditionContainer;
-typedef std::map<uint32, ConditionTypeContainer> NpcVendorConditionContainer;
-typedef std::map<std::pair<int32, uint32 /*SAI source_type*/>, ConditionTypeContainer> SmartEventConditionContainer;
+/// Conditions of one source, sorted by ElseGroup (see ConditionMgr::SortConditionList)
+typedef std::vector<Condition*> ConditionList;
+typedef std::span<Condition* const> ConditionSpan;
+typedef std::unordered_map<uint64 /*two packed 32 bit keys of the source*/, ConditionList> ConditionContainer;
 
-typedef std::map<uint32, ConditionList> ConditionReferenceContainer;//only used for references
+typedef std::unordered_map<uint32, ConditionList> ConditionReferenceContainer;//only used for references
 
 class ConditionMgr
 {
@@ -254,19 +257,30 @@ public:
 
     void LoadConditions(bool isReload = false);
     bool isConditionTypeValid(Condition* cond);
-    ConditionList GetConditionReferences(uint32 refId);
+    [[nodiscard]] ConditionSpan GetConditionReferences(uint32 refId) const;
 
-    uint32 GetSearcherTypeMaskForConditionList(ConditionList const& conditions);
-    bool IsObjectMeetToConditions(WorldObject* object, ConditionList const& conditions);
-    bool IsObjectMeetToConditions(WorldObject* object1, WorldObject* object2, ConditionList const& conditions);
-    bool IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
+    /// Adds a loaded condition to the list of its source, the list is sorted for IsObjectMeetToConditions once LoadConditions is done
+    void AddToConditionList(ConditionList& conditions, Condition* cond);
+
+    uint32 GetSearcherTypeMaskForConditionList(ConditionSpan conditions);
+    bool IsObjectMeetToConditions(WorldObject* object, ConditionSpan conditions);
+    bool IsObjectMeetToConditions(WorldObject* object1, WorldObject* object2, ConditionSpan conditions);
+    bool IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionSpan conditions);
     [[nodiscard]] bool CanHaveSourceGroupSet(ConditionSourceType sourceType) const;
     [[nodiscard]] bool CanHaveSourceIdSet(ConditionSourceType sourceType) const;
-    ConditionList GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry);
-    ConditionList GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId);
-    ConditionList GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType);
-    ConditionList GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId);
-    ConditionList GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId);
+
+    // the returned conditions are stored by ConditionMgr and only valid while GetLoadCount() does not change
+    [[nodiscard]] ConditionSpan GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry) const;
+    [[nodiscard]] ConditionSpan GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId) const;
+    [[nodiscard]] ConditionSpan GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType) const;
+    [[nodiscard]] ConditionSpan GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId) const;
+    [[nodiscard]] ConditionSpan GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId) const;
+
+    /// Incremented every time the conditions are (re)loaded and previously returned lists are freed
+    [[nodiscard]] uint32 GetLoadCount() const { return _loadCount; }
+
+    /// Every condition list stored by ConditionMgr itself, for benchmarking the evaluation
+    [[nodiscard]] std::vector<ConditionSpan> GetAllConditionLists() const;
 
 private:
     bool isSourceTypeValid(Condition* cond);
@@ -274,17 +288,22 @@ private:
     bool addToGossipMenus(Condition* cond);
     bool addToGossipMenuItems(Condition* cond);
     bool addToSpellImplicitTargetConditions(Condition* cond);
-    bool IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
+    bool IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionSpan conditions);
+    static void SortConditionList(ConditionList& conditions);
 
     void Clean(); // free up resources
     std::list<Condition*> AllocatedMemoryStore; // some garbage collection :)
 
     ConditionContainer                ConditionStore;
     ConditionReferenceContainer       ConditionReferenceStore;
-    CreatureSpellConditionContainer   VehicleSpellConditionStore;
-    CreatureSpellConditionContainer   SpellClickEventConditionStore;
-    NpcVendorConditionContainer       NpcVendorConditionContainerStore;
-    SmartEventConditionContainer      SmartEventConditionStore;
+    ConditionContainer                VehicleSpellConditionStore;
+    ConditionContainer                SpellClickEventConditionStore;
+    ConditionContainer                NpcVendorConditionContainerStore;
+    ConditionContainer                SmartEventConditionStore;
+
+    std::unordered_set<ConditionList*> _unsortedLists;  // lists that got conditions during the current LoadConditions
+
+    uint32 _loadCount = 0;
 };
 
 #define sConditionMgr ConditionMgr::instance()
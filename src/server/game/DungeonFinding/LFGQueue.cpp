@@ -30,6 +30,50 @@
 
 namespace lfg
 {
+    LfgRoleMask LFGQueueRoles::GetRoleMask(LfgRolesMap const& roles)
+    {
+        if (roles.empty())
+            return 0;
+
+        LfgRoleMask mask = 1; // nobody assigned yet
+        for (LfgRolesMap::const_iterator itr = roles.begin(); itr != roles.end(); ++itr)
+        {
+            LfgRoleMask playerMask = 0;
+            if (itr->second & PLAYER_ROLE_TANK)
+                playerMask |= 1 << 8;
+            if (itr->second & PLAYER_ROLE_HEALER)
+                playerMask |= 1 << 4;
+            if (itr->second & PLAYER_ROLE_DAMAGE)
+                playerMask |= 1 << 1;
+
+            mask = CombineRoleMasks(mask, playerMask);
+        }
+
+        return mask;
+    }
+
+    LfgRoleMask LFGQueueRoles::CombineRoleMasks(LfgRoleMask first, LfgRoleMask second)
+    {
+        LfgRoleMask mask = 0;
+        for (uint8 i = 0; i < 16; ++i)
+        {
+            if (!(first & (1 << i)))
+                continue;
+
+            for (uint8 j = 0; j < 16; ++j)
+            {
+                if (!(second & (1 << j)))
+                    continue;
+
+                // the composition fits if no role is needed more often than a group has it
+                if ((i >> 3) + (j >> 3) <= LFG_TANKS_NEEDED && ((i >> 2) & 1) + ((j >> 2) & 1) <= LFG_HEALERS_NEEDED && (i & 3) + (j & 3) <= LFG_DPS_NEEDED)
+                    mask |= 1 << (i + j);
+            }
+        }
+
+        return mask;
+    }
+
     LfgQueueData::LfgQueueData() :
         joinTime(time_t(GameTime::GetGameTime().count())), lastRefreshTime(joinTime), tanks(LFG_TANKS_NEEDED),
         healers(LFG_HEALERS_NEEDED), dps(LFG_DPS_NEEDED) { }
@@ -107,10 +151,33 @@ namespace lfg
     void LFGQueue::AddQueueData(ObjectGuid guid, time_t joinTime, LfgDungeonSet const& dungeons, LfgRolesMap const& rolesMap)
     {
         LOG_DEBUG("lfg", "JOINED AddQueueData: {}", guid.ToString());
-        QueueDataStore[guid] = LfgQueueData(joinTime, dungeons, rolesMap);
+        LfgQueueData& queueData = QueueDataStore[guid] = LfgQueueData(joinTime, dungeons, rolesMap);
+        SetDungeonMask(queueData);
         AddToQueue(guid);
     }
 
+    void LFGQueue::SetDungeonMask(LfgQueueData& queueData)
+    {
+        queueData.dungeonMask.reset();
+        for (uint32 dungeonId : queueData.dungeons)
+        {
+            auto itr = dungeonIndexStore.find(dungeonId);
+            if (itr == dungeonIndexStore.end())
+            {
+                if (dungeonIndexStore.size() >= LFG_QUEUE_MAX_DUNGEONS)
+                {
+                    // no bits left, only the dungeon sets themselves tell if this entry is compatible
+                    queueData.dungeonMask.set();
+                    return;
+                }
+
+                itr = dungeonIndexStore.emplace(dungeonId, uint32(dungeonIndexStore.size())).first;
+            }
+
+            queueData.dungeonMask.set(itr->second);
+        }
+    }
+
     void LFGQueue::RemoveQueueData(ObjectGuid guid)
     {
         LOG_DEBUG("lfg", "LEFT RemoveQueueData: {}", guid.ToString());
@@ -265,6 +332,7 @@ namespace lfg
         uint8 numLfgGroups = 0;
         ObjectGuid guid;
         uint64 addToFoundMask = 0;
+        std::array<LfgQueueData*, 5> checkQueueData = { };
 
         for (uint8 i = 0; i < 5 && !(guid = check.guids[i]).IsEmpty() && numLfgGroups < 2 && numPlayers <= MAXGROUPSIZE; ++i)
         {
@@ -276,6 +344,8 @@ namespace lfg
                 return LFG_COMPATIBILITY_PENDING;
             }
 
+            checkQueueData[i] = &itQueue->second;
+
             // Store group so we don't need to call Mgr to get it later (if it's player group will be 0 otherwise would have joined as group)
             for (LfgRolesMap::const_iterator it2 = itQueue->second.roles.begin(); it2 != itQueue->second.roles.end(); ++it2)
                 proposalGroups[it2->first] = itQueue->first.IsGroup() ? itQueue->first : ObjectGuid::Empty;
@@ -314,9 +384,24 @@ namespace lfg
         // If it's single group no need to check for duplicate players, ignores, bad roles or bad dungeons as it's been checked before joining
         if (check.size() > 1)
         {
+            // most combinations fail on roles or dungeons, the masks tell that without building the proposal
+            LfgRoleMask roleMask = checkQueueData[0]->roleMask;
+            LfgDungeonMask dungeonMask = checkQueueData[0]->dungeonMask;
+            for (uint8 i = 1; i < 5 && check.guids[i]; ++i)
+            {
+                roleMask = LFGQueueRoles::CombineRoleMasks(roleMask, checkQueueData[i]->roleMask);
+                dungeonMask &= checkQueueData[i]->dungeonMask;
+            }
+
+            if (!roleMask)
+                return LFG_INCOMPATIBLES_NO_ROLES;
+
+            if (dungeonMask.none())
+                return LFG_INCOMPATIBLES_NO_DUNGEONS;
+
             for (uint8 i = 0; i < 5 && check.guids[i]; ++i)
             {
-                const LfgRolesMap& roles = QueueDataStore[check.guids[i]].roles;
+                const LfgRolesMap& roles = checkQueueData[i]->roles;
                 for (LfgRolesMap::const_iterator itRoles = roles.begin(); itRoles != roles.end(); ++itRoles)
                 {
                     LfgRolesMap::const_iterator itPlayer;
@@ -369,11 +454,11 @@ namespace lfg
             else
                 addToFoundMask |= (((uint64)1) << (roleCheckResult - 1));
 
-            proposalDungeons = QueueDataStore[check.front()].dungeons;
+            proposalDungeons = checkQueueData[0]->dungeons;
             for (uint8 i = 1; i < 5 && check.guids[i]; ++i)
             {
                 LfgDungeonSet temporal;
-                LfgDungeonSet& dungeons = QueueDataStore[check.guids[i]].dungeons;
+                LfgDungeonSet& dungeons = checkQueueData[i]->dungeons;
                 std::set_intersection(proposalDungeons.begin(), proposalDungeons.end(), dungeons.begin(), dungeons.end(), std::inserter(temporal, temporal.begin()));
                 proposalDungeons = temporal;
             }
@@ -383,8 +468,7 @@ namespace lfg
         }
         else
         {
-            ObjectGuid gguid = check.front();
-            const LfgQueueData& queue = QueueDataStore[gguid];
+            const LfgQueueData& queue = *checkQueueData[0];
             proposalDungeons = queue.dungeons;
             proposalRoles = queue.roles;
             LFGMgr::CheckGroupRoles(proposalRoles);          // assing new roles
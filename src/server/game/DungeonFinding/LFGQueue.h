@@ -19,9 +19,18 @@
 #define _LFGQUEUE_H
 
 #include "LFG.h"
+#include <bitset>
+#include <unordered_map>
 
 namespace lfg
 {
+    // Dungeons of a queue entry by their index in the queue, every dungeon ever queued gets one
+    constexpr std::size_t LFG_QUEUE_MAX_DUNGEONS = 512;
+    typedef std::bitset<LFG_QUEUE_MAX_DUNGEONS> LfgDungeonMask;
+
+    // Role compositions a queue entry can fill, bit (8 * tanks + 4 * healers + dps) as returned by LFGMgr::CheckGroupRoles
+    typedef uint16 LfgRoleMask;
+
     enum LfgCompatibility
     {
         LFG_COMPATIBILITY_PENDING,
@@ -35,6 +44,18 @@ namespace lfg
         LFG_COMPATIBLES_MATCH                                  // Must be the last one
     };
 
+    /**
+        Role compositions as bit masks, so combinations of queue entries that cannot
+        fill a group are rejected without trying every role assignment
+    */
+    namespace LFGQueueRoles
+    {
+        // Compositions the players of one queue entry can fill, leader flags are ignored
+        AC_GAME_API LfgRoleMask GetRoleMask(LfgRolesMap const& roles);
+        // Compositions of two disjoint sets of players taken together
+        AC_GAME_API LfgRoleMask CombineRoleMasks(LfgRoleMask first, LfgRoleMask second);
+    }
+
     // Stores player or group queue info
     struct LfgQueueData
     {
@@ -42,7 +63,7 @@ namespace lfg
 
         LfgQueueData(time_t _joinTime, LfgDungeonSet  _dungeons, LfgRolesMap  _roles):
             joinTime(_joinTime), lastRefreshTime(_joinTime), tanks(LFG_TANKS_NEEDED), healers(LFG_HEALERS_NEEDED),
-            dps(LFG_DPS_NEEDED), dungeons(std::move(_dungeons)), roles(std::move(_roles))
+            dps(LFG_DPS_NEEDED), dungeons(std::move(_dungeons)), roles(std::move(_roles)), roleMask(LFGQueueRoles::GetRoleMask(roles))
         { }
 
         time_t joinTime;                                       // Player queue join time (to calculate wait times)
@@ -53,6 +74,8 @@ namespace lfg
         LfgDungeonSet dungeons;                                // Selected Player/Group Dungeon/s
         LfgRolesMap roles;                                     // Selected Player Role/s
         Lfg5Guids bestCompatible;                              // Best compatible combination of people queued
+        LfgDungeonMask dungeonMask;                            // Selected dungeons as bits, all set if they did not fit
+        LfgRoleMask roleMask{0};                               // Role compositions the selected roles can fill
     };
 
     struct LfgWaitTime
@@ -63,7 +86,7 @@ namespace lfg
     };
 
     typedef std::map<uint32, LfgWaitTime> LfgWaitTimesContainer;
-    typedef std::map<ObjectGuid, LfgQueueData> LfgQueueDataContainer;
+    typedef std::unordered_map<ObjectGuid, LfgQueueData> LfgQueueDataContainer;
     typedef std::list<Lfg5Guids> LfgCompatibleContainer;
 
     /**
@@ -97,6 +120,8 @@ namespace lfg
         void AddToNewQueue(ObjectGuid guid, bool front);
         void RemoveFromNewQueue(ObjectGuid guid);
 
+        void SetDungeonMask(LfgQueueData& queueData);
+
         void RemoveFromCompatibles(ObjectGuid guid);
         void AddToCompatibles(Lfg5Guids const& key);
 
@@ -118,6 +143,7 @@ namespace lfg
         LfgWaitTimesContainer waitTimesDpsStore;           // Average wait time to find a group queuing as dps
         LfgGuidList newToQueueStore;                       // New groups to add to queue
         LfgGuidList restoredAfterProposal;
+        std::unordered_map<uint32 /*dungeonId*/, uint32 /*index*/> dungeonIndexStore; // Bits of LfgDungeonMask
     };
 }
 
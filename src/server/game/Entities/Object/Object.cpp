@@ -87,6 +87,9 @@ WorldObject::~WorldObject()
 {
     sScriptMgr->OnWorldObjectDestroy(this);
 
+    ClearObservers();
+    ClearObservedObjects();
+
     // this may happen because there are many !create/delete
     if (IsWorldObject() && m_currMap)
     {
@@ -245,6 +248,12 @@ void Object::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target)
 
 void Object::SendUpdateToPlayer(Player* player)
 {
+    if (player->GetSession()->IsHeadless())
+    {
+        WorldSession::CountHeadlessPacketAvoided();
+        return;
+    }
+
     // send create update to player
     UpdateData upd;
     WorldPacket packet;
@@ -500,27 +509,51 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targe
         return;
 
     ByteBuffer fieldBuffer;
-    UpdateMask updateMask;
-    updateMask.SetCount(m_valuesCount);
 
     uint32* flags = nullptr;
     uint32 visibleFlag = GetUpdateFieldData(target, flags);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    UpdateMask updateMask;
+    BuildValuesUpdateMask(updateType, flags, visibleFlag, updateMask);
+    updateMask.ForEachSetBit([&](uint32 index)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-                ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)))
-        {
-            updateMask.SetBit(index);
-            fieldBuffer << m_uint32Values[index];
-        }
-    }
+        fieldBuffer << m_uint32Values[index];
+    });
 
     *data << uint8(updateMask.GetBlockCount());
     updateMask.AppendToPacket(data);
     data->append(fieldBuffer);
 }
 
+void Object::BuildValuesUpdateMask(uint8 updateType, uint32 const* flags, uint32 visibleFlag, UpdateMask& updateMask, uint32 forcedFlag /*= UF_FLAG_NONE*/) const
+{
+    UpdateFieldFlagMasks const& fieldMasks = UpdateFieldFlagMasks::Get(flags);
+
+    updateMask.SetCount(m_valuesCount);
+    for (uint32 block = 0; block < updateMask.GetBlockCount(); ++block)
+    {
+        UpdateMask::ClientUpdateMaskType forced = fieldMasks.GetBlock(_fieldNotifyFlags | forcedFlag, block);
+        UpdateMask::ClientUpdateMaskType visible = fieldMasks.GetBlock(visibleFlag, block);
+
+        if (updateType == UPDATETYPE_VALUES)
+        {
+            updateMask.SetBlock(block, forced | (visible & _changesMask.GetBlock(block)));
+            continue;
+        }
+
+        // create blocks skip visible fields that are still zero
+        UpdateMask::ClientUpdateMaskType selected = forced;
+        for (UpdateMask::ClientUpdateMaskType bits = visible & ~forced & updateMask.GetBlockFieldMask(block); bits; bits &= bits - 1)
+        {
+            uint32 bit = std::countr_zero(bits);
+            if (m_uint32Values[block * UpdateMask::CLIENT_UPDATE_MASK_BITS + bit])
+                selected |= UpdateMask::ClientUpdateMaskType(1) << bit;
+        }
+
+        updateMask.SetBlock(block, selected);
+    }
+}
+
 void Object::AddToObjectUpdateIfNeeded()
 {
     if (m_inWorld && !m_objectUpdated)
@@ -1197,6 +1230,8 @@ void WorldObject::RemoveFromWorld()
         return;
 
     DestroyForNearbyPlayers();
+    ClearObservers();
+    ClearObservedObjects();
 
     Object::RemoveFromWorld();
 }
@@ -1756,7 +1791,7 @@ bool WorldObject::CanSeeOrDetect(WorldObject const* obj, bool ignoreStealth, boo
                 return false;
             }
 
-            ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_CREATURE_VISIBILITY, cObj->GetEntry());
+            ConditionSpan conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_CREATURE_VISIBILITY, cObj->GetEntry());
             if (!sConditionMgr->IsObjectMeetToConditions((WorldObject*)this, (WorldObject*)obj, conditions))
             {
                 return false;
@@ -2990,7 +3025,7 @@ void WorldObject::DestroyForNearbyPlayers()
             continue;
 
         DestroyForPlayer(player);
-        player->m_clientGUIDs.erase(GetGUID());
+        player->RemoveClientGUID(this);
     }
 }
 
@@ -3027,15 +3062,13 @@ void WorldObject::AddToNotify(uint16 f)
         }
 }
 
-struct WorldObjectChangeAccumulator
+// Grid walk that used to drive BuildUpdate, still used for motion transports and to validate the observer index
+struct WorldObjectObserverCollector
 {
-    UpdateDataMapType& i_updateDatas;
-    UpdatePlayerSet& i_playerSet;
+    std::unordered_set<Player*>& i_players;
     WorldObject& i_object;
-    WorldObjectChangeAccumulator(WorldObject& obj, UpdateDataMapType& d, UpdatePlayerSet& p) : i_updateDatas(d), i_playerSet(p), i_object(obj)
-    {
-        i_playerSet.clear();
-    }
+    WorldObjectObserverCollector(WorldObject& obj, std::unordered_set<Player*>& p) : i_players(p), i_object(obj) { }
+
     void Visit(PlayerMapType& m)
     {
         Player* source = nullptr;
@@ -3043,13 +3076,13 @@ struct WorldObjectChangeAccumulator
         {
             source = iter->GetSource();
 
-            BuildPacket(source);
+            Collect(source);
 
             if (source->HasSharedVision())
             {
                 SharedVisionList::const_iterator it = source->GetSharedVisionList().begin();
                 for (; it != source->GetSharedVisionList().end(); ++it)
-                    BuildPacket(*it);
+                    Collect(*it);
             }
         }
     }
@@ -3064,7 +3097,7 @@ struct WorldObjectChangeAccumulator
             {
                 SharedVisionList::const_iterator it = source->GetSharedVisionList().begin();
                 for (; it != source->GetSharedVisionList().end(); ++it)
-                    BuildPacket(*it);
+                    Collect(*it);
             }
         }
     }
@@ -3082,33 +3115,117 @@ struct WorldObjectChangeAccumulator
                 //Caster may be nullptr if DynObj is in removelist
                 if (Player* caster = ObjectAccessor::FindPlayer(guid))
                     if (caster->GetGuidValue(PLAYER_FARSIGHT) == source->GetGUID())
-                        BuildPacket(caster);
+                        Collect(caster);
             }
         }
     }
 
-    void BuildPacket(Player* player)
+    void Collect(Player* player)
     {
-        // Only send update once to a player
-        if (i_playerSet.find(player->GetGUID()) == i_playerSet.end() && player->HaveAtClient(&i_object))
-        {
-            i_object.BuildFieldsUpdate(player, i_updateDatas);
-            i_playerSet.insert(player->GetGUID());
-        }
+        if (player != &i_object && player->HaveAtClient(&i_object))
+            i_players.insert(player);
     }
 
     template<class SKIP> void Visit(GridRefMgr<SKIP>&) {}
 };
 
-void WorldObject::BuildUpdate(UpdateDataMapType& data_map, UpdatePlayerSet& player_set)
+void WorldObject::BuildUpdate(UpdateDataMapType& data_map, UpdatePlayerSet& /*player_set*/)
 {
-    WorldObjectChangeAccumulator notifier(*this, data_map, player_set);
-    //we must build packets for all visible players
-    Cell::VisitWorldObjects(this, notifier, GetVisibilityRange());
+    auto buildPacket = [this, &data_map](Player* player)
+    {
+        if (!player->HaveAtClient(this))
+            return;
+
+        if (player->GetSession()->IsHeadless())
+        {
+            WorldSession::CountHeadlessPacketAvoided();
+            return;
+        }
+
+        BuildFieldsUpdate(player, data_map);
+    };
+
+    // Motion transports are at client for every player on the map without being in m_clientGUIDs,
+    // so they are never linked as observed objects and still search the grid for players in range
+    GameObject const* gameobject = ToGameObject();
+    if (gameobject && gameobject->IsMotionTransport())
+    {
+        std::unordered_set<Player*> players;
+        WorldObjectObserverCollector collector(*this, players);
+        Cell::VisitWorldObjects(this, collector, GetVisibilityRange());
+
+        for (Player* player : players)
+            buildPacket(player);
+
+        ClearUpdateMask(false);
+        return;
+    }
+
+    if (sWorld->getBoolConfig(CONFIG_DEBUG_VISIBILITY_INDEX))
+        CheckObserverIndex();
+
+    // every player with this object at client is linked as observer, so no grid search is needed here
+    if (Player* player = ToPlayer())
+        buildPacket(player);
+
+    for (Player* player : _observers)
+        buildPacket(player);
 
     ClearUpdateMask(false);
 }
 
+void WorldObject::AddObserver(Player* player)
+{
+    if (_observers.insert(player).second)
+        static_cast<WorldObject*>(player)->_observedObjects.insert(this);
+}
+
+void WorldObject::RemoveObserver(Player* player)
+{
+    if (_observers.erase(player))
+        static_cast<WorldObject*>(player)->_observedObjects.erase(this);
+}
+
+void WorldObject::ClearObservers()
+{
+    for (Player* player : _observers)
+        static_cast<WorldObject*>(player)->_observedObjects.erase(this);
+
+    _observers.clear();
+}
+
+void WorldObject::ClearObservedObjects()
+{
+    if (_observedObjects.empty())
+        return;
+
+    Player* player = static_cast<Player*>(this);
+    for (WorldObject* object : _observedObjects)
+        object->_observers.erase(player);
+
+    _observedObjects.clear();
+}
+
+bool WorldObject::CheckObserverIndex()
+{
+    std::unordered_set<Player*> players;
+    WorldObjectObserverCollector collector(*this, players);
+    Cell::VisitWorldObjects(this, collector, GetVisibilityRange());
+
+    bool consistent = true;
+    for (Player* player : players)
+    {
+        if (_observers.find(player) == _observers.end())
+        {
+            LOG_ERROR("entities.object", "WorldObject::CheckObserverIndex: {} has {} at client but is missing from its observers",
+                player->GetGUID().ToString(), GetGUID().ToString());
+            consistent = false;
+        }
+    }
+
+    return consistent;
+}
+
 void WorldObject::GetCreaturesWithEntryInRange(std::list<Creature*>& creatureList, float radius, uint32 entry)
 {
     Acore::AllCreaturesOfEntryInRange check(this, entry, radius);
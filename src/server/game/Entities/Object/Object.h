@@ -32,11 +32,13 @@
 #include "Optional.h"
 #include "Position.h"
 #include "UpdateData.h"
+#include "UpdateFieldFlags.h"
 #include "UpdateMask.h"
 #include <memory>
 #include <set>
 #include <sstream>
 #include <string>
+#include <unordered_set>
 
 #include "UpdateFields.h"
 
@@ -248,6 +250,8 @@ protected:
 
     void BuildMovementUpdate(ByteBuffer* data, uint16 flags) const;
     virtual void BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target);
+    /// Selects the fields sent to a target: notify fields and fields having forcedFlag always, other visible fields when changed (values update) or non zero (create)
+    void BuildValuesUpdateMask(uint8 updateType, uint32 const* flags, uint32 visibleFlag, UpdateMask& updateMask, uint32 forcedFlag = UF_FLAG_NONE) const;
 
     uint16 m_objectType;
 
@@ -613,6 +617,14 @@ public:
     virtual void UpdateObjectVisibility(bool forced = true, bool fromUpdate = false);
     virtual void UpdateObjectVisibilityOnCreate() { UpdateObjectVisibility(true); }
     void BuildUpdate(UpdateDataMapType& data_map, UpdatePlayerSet& player_set) override;
+
+    // reverse visibility index, mirrors Player::m_clientGUIDs while both objects are in world
+    void AddObserver(Player* player);
+    void RemoveObserver(Player* player);
+    [[nodiscard]] std::unordered_set<Player*> const& GetObservers() const { return _observers; }
+    void ClearObservers();
+    void ClearObservedObjects();
+    bool CheckObserverIndex();
     void GetCreaturesWithEntryInRange(std::list<Creature*>& creatureList, float radius, uint32 entry);
 
     void SetPositionDataUpdate();
@@ -747,6 +759,9 @@ private:
     bool CanDetectStealthOf(WorldObject const* obj, bool checkAlert = false) const;
 
     GuidUnorderedSet _allowedLooters;
+
+    std::unordered_set<Player*> _observers;             // players that have this object at client
+    std::unordered_set<WorldObject*> _observedObjects;  // players only: objects linked through AddObserver
 };
 
 namespace Acore
@@ -16,6 +16,7 @@
  */
 
 #include "UpdateFieldFlags.h"
+#include "UpdateMask.h"
 
 uint32 ItemUpdateFieldFlags[CONTAINER_END] =
 {
@@ -1566,3 +1567,35 @@ uint32 CorpseUpdateFieldFlags[CORPSE_END] =
     UF_FLAG_DYNAMIC,                                        // CORPSE_FIELD_DYNAMIC_FLAGS
     UF_FLAG_NONE,                                           // CORPSE_FIELD_PAD
 };
+
+UpdateFieldFlagMasks::UpdateFieldFlagMasks(uint32 const* flags, uint32 count)
+{
+    for (UpdateMask& mask : _masks)
+        mask.SetCount(count);
+
+    for (uint32 index = 0; index < count; ++index)
+        for (uint32 bit = 0; bit < UF_FLAG_BIT_COUNT; ++bit)
+            if (flags[index] & (1 << bit))
+                _masks[bit].SetBit(index);
+}
+
+UpdateFieldFlagMasks const& UpdateFieldFlagMasks::Get(uint32 const* flags)
+{
+    static UpdateFieldFlagMasks const itemMasks(ItemUpdateFieldFlags, CONTAINER_END);
+    static UpdateFieldFlagMasks const unitMasks(UnitUpdateFieldFlags, PLAYER_END);
+    static UpdateFieldFlagMasks const gameObjectMasks(GameObjectUpdateFieldFlags, GAMEOBJECT_END);
+    static UpdateFieldFlagMasks const dynamicObjectMasks(DynamicObjectUpdateFieldFlags, DYNAMICOBJECT_END);
+    static UpdateFieldFlagMasks const corpseMasks(CorpseUpdateFieldFlags, CORPSE_END);
+
+    if (flags == ItemUpdateFieldFlags)
+        return itemMasks;
+    if (flags == UnitUpdateFieldFlags)
+        return unitMasks;
+    if (flags == GameObjectUpdateFieldFlags)
+        return gameObjectMasks;
+    if (flags == DynamicObjectUpdateFieldFlags)
+        return dynamicObjectMasks;
+
+    ASSERT(flags == CorpseUpdateFieldFlags);
+    return corpseMasks;
+}
@@ -20,7 +20,13 @@
 
 #include "ByteBuffer.h"
 #include "Errors.h"
+#include "UpdateFields.h"
+#include <array>
+#include <bit>
+#include <vector>
 
+/// Field bits packed in the 32 bit blocks the client reads. Masks of up to UNIT_END fields are stored inline,
+/// larger ones (players) allocate their blocks once per SetCount.
 class UpdateMask
 {
 public:
@@ -30,33 +36,56 @@ public:
     enum UpdateMaskCount
     {
         CLIENT_UPDATE_MASK_BITS = sizeof(ClientUpdateMaskType) * 8,
+        INLINE_UPDATE_MASK_BLOCKS = (UNIT_END + CLIENT_UPDATE_MASK_BITS - 1) / CLIENT_UPDATE_MASK_BITS,
     };
 
-    UpdateMask()  = default;
+    UpdateMask() = default;
 
-    UpdateMask(UpdateMask const& right)
+    void SetBit(uint32 index) { Blocks()[index / CLIENT_UPDATE_MASK_BITS] |= ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS); }
+    void UnsetBit(uint32 index) { Blocks()[index / CLIENT_UPDATE_MASK_BITS] &= ~(ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS)); }
+    [[nodiscard]] bool GetBit(uint32 index) const { return (Blocks()[index / CLIENT_UPDATE_MASK_BITS] >> (index % CLIENT_UPDATE_MASK_BITS)) & 1; }
+
+    [[nodiscard]] ClientUpdateMaskType GetBlock(uint32 block) const { return Blocks()[block]; }
+    void SetBlock(uint32 block, ClientUpdateMaskType value) { Blocks()[block] = value & GetBlockFieldMask(block); }
+
+    /// Bits of the block that map to existing fields, only the last block can be partial
+    [[nodiscard]] ClientUpdateMaskType GetBlockFieldMask(uint32 block) const
     {
-        SetCount(right.GetCount());
-        memcpy(_bits, right._bits, sizeof(uint8) * _blockCount * 32);
+        uint32 fieldsInBlock = _fieldCount - block * CLIENT_UPDATE_MASK_BITS;
+        return fieldsInBlock >= CLIENT_UPDATE_MASK_BITS ? ~ClientUpdateMaskType(0) : (ClientUpdateMaskType(1) << fieldsInBlock) - 1;
     }
 
-    ~UpdateMask() { delete[] _bits; }
+    void AppendToPacket(ByteBuffer* data) const
+    {
+        for (uint32 i = 0; i < GetBlockCount(); ++i)
+            *data << Blocks()[i];
+    }
 
-    void SetBit(uint32 index) { _bits[index] = 1; }
-    void UnsetBit(uint32 index) { _bits[index] = 0; }
-    [[nodiscard]] bool GetBit(uint32 index) const { return _bits[index] != 0; }
+    /// Calls f(index) for every set bit in ascending order
+    template<typename F>
+    void ForEachSetBit(F&& f) const
+    {
+        for (uint32 i = 0; i < GetBlockCount(); ++i)
+            for (ClientUpdateMaskType bits = Blocks()[i]; bits; bits &= bits - 1)
+                f(i * CLIENT_UPDATE_MASK_BITS + std::countr_zero(bits));
+    }
 
-    void AppendToPacket(ByteBuffer* data)
+    [[nodiscard]] bool IsEmpty() const
     {
         for (uint32 i = 0; i < GetBlockCount(); ++i)
-        {
-            ClientUpdateMaskType maskPart = 0;
-            for (uint32 j = 0; j < CLIENT_UPDATE_MASK_BITS; ++j)
-                if (_bits[CLIENT_UPDATE_MASK_BITS * i + j])
-                    maskPart |= 1 << j;
-
-            *data << maskPart;
-        }
+            if (Blocks()[i])
+                return false;
+
+        return true;
+    }
+
+    [[nodiscard]] uint32 GetSetBitCount() const
+    {
+        uint32 count = 0;
+        for (uint32 i = 0; i < GetBlockCount(); ++i)
+            count += std::popcount(Blocks()[i]);
+
+        return count;
     }
 
     [[nodiscard]] uint32 GetBlockCount() const { return _blockCount; }
@@ -64,36 +93,26 @@ public:
 
     void SetCount(uint32 valuesCount)
     {
-        delete[] _bits;
-
         _fieldCount = valuesCount;
         _blockCount = (valuesCount + CLIENT_UPDATE_MASK_BITS - 1) / CLIENT_UPDATE_MASK_BITS;
+        if (_blockCount > INLINE_UPDATE_MASK_BLOCKS)
+            _heapBlocks.resize(_blockCount);
+        else
+            _heapBlocks.clear();
 
-        _bits = new uint8[_blockCount * CLIENT_UPDATE_MASK_BITS];
-        memset(_bits, 0, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+        Clear();
     }
 
     void Clear()
     {
-        if (_bits)
-            memset(_bits, 0, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
-    }
-
-    UpdateMask& operator=(UpdateMask const& right)
-    {
-        if (this == &right)
-            return *this;
-
-        SetCount(right.GetCount());
-        memcpy(_bits, right._bits, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
-        return *this;
+        std::fill_n(Blocks(), _blockCount, ClientUpdateMaskType(0));
     }
 
     UpdateMask& operator&=(UpdateMask const& right)
     {
         ASSERT(right.GetCount() <= GetCount());
-        for (uint32 i = 0; i < _fieldCount; ++i)
-            _bits[i] &= right._bits[i];
+        for (uint32 i = 0; i < _blockCount; ++i)
+            Blocks()[i] &= i < right._blockCount ? right.Blocks()[i] : 0;
 
         return *this;
     }
@@ -101,13 +120,13 @@ public:
     UpdateMask& operator|=(UpdateMask const& right)
     {
         ASSERT(right.GetCount() <= GetCount());
-        for (uint32 i = 0; i < _fieldCount; ++i)
-            _bits[i] |= right._bits[i];
+        for (uint32 i = 0; i < right._blockCount; ++i)
+            Blocks()[i] |= right.Blocks()[i];
 
         return *this;
     }
 
-    UpdateMask operator|(UpdateMask const& right)
+    UpdateMask operator|(UpdateMask const& right) const
     {
         UpdateMask ret(*this);
         ret |= right;
@@ -115,9 +134,39 @@ public:
     }
 
 private:
+    ClientUpdateMaskType* Blocks() { return _blockCount > INLINE_UPDATE_MASK_BLOCKS ? _heapBlocks.data() : _inlineBlocks.data(); }
+    [[nodiscard]] ClientUpdateMaskType const* Blocks() const { return _blockCount > INLINE_UPDATE_MASK_BLOCKS ? _heapBlocks.data() : _inlineBlocks.data(); }
+
     uint32 _fieldCount{0};
     uint32 _blockCount{0};
-    uint8* _bits{nullptr};
+    std::array<ClientUpdateMaskType, INLINE_UPDATE_MASK_BLOCKS> _inlineBlocks{};
+    std::vector<ClientUpdateMaskType> _heapBlocks;
+};
+
+/// Fields of one object type grouped by update field flag, so the fields visible to a target can be
+/// selected one mask block at a time instead of testing the flags of every field
+class UpdateFieldFlagMasks
+{
+public:
+    UpdateFieldFlagMasks(uint32 const* flags, uint32 count);
+
+    /// Fields having any of the given flags
+    [[nodiscard]] UpdateMask::ClientUpdateMaskType GetBlock(uint32 flagMask, uint32 block) const
+    {
+        UpdateMask::ClientUpdateMaskType result = 0;
+        for (uint32 bits = flagMask & ((1 << UF_FLAG_BIT_COUNT) - 1); bits; bits &= bits - 1)
+            result |= _masks[std::countr_zero(bits)].GetBlock(block);
+
+        return result;
+    }
+
+    /// Masks of one of the update field flag tables
+    static UpdateFieldFlagMasks const& Get(uint32 const* flags);
+
+private:
+    static constexpr uint32 UF_FLAG_BIT_COUNT = 9;
+
+    std::array<UpdateMask, UF_FLAG_BIT_COUNT> _masks;
 };
 
 #endif
@@ -66,7 +66,7 @@ public:
     void SavePetToDB(PetSaveMode mode);
     void FillPetInfo(PetStable::PetInfo* petInfo) const;
     void Remove(PetSaveMode mode, bool returnreagent = false);
-    static void DeleteFromDB(ObjectGuid::LowType guidlow);
+    static void DeleteFromDB(ObjectGuid::LowType guidlow, ObjectGuid::LowType ownerGuid);
 
     void setDeathState(DeathState s, bool despawn = false) override;                   // overwrite virtual Creature::setDeathState and Unit::setDeathState
     void Update(uint32 diff) override;                           // overwrite virtual Creature::Update and Unit::Update
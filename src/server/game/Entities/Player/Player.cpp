@@ -89,6 +89,7 @@
 #include "WorldState.h"
 #include "WorldStateDefines.h"
 #include "WorldStatePackets.h"
+#include <algorithm>
 #include <cmath>
 
 /// @todo: this import is not necessary for compilation and marked as unused by the IDE
@@ -2537,7 +2538,7 @@ void Player::GiveLevel(uint8 level)
         //- TODO: Poor design of mail system
         CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
         MailDraft(mailReward->mailTemplateId).SendMailTo(trans, this, MailSender(MAIL_CREATURE, mailReward->senderEntry));
-        CharacterDatabase.CommitTransaction(trans);
+        CharacterDatabase.CommitTransaction(trans, GetGUID().GetCounter());
     }
 
     UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_REACH_LEVEL);
@@ -3621,20 +3622,13 @@ void Player::_LoadSpellCooldowns(PreparedQueryResult result)
     }
 }
 
-void Player::_SaveSpellCooldowns(CharacterDatabaseTransaction trans, bool logout)
+void Player::_SaveSpellCooldowns(CharacterDatabaseTransaction trans, bool logout, bool fullSave)
 {
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN);
-    stmt->SetData(0, GetGUID().GetCounter());
-    trans->Append(stmt);
-
-    time_t curTime = GameTime::GetGameTime().count();
     uint32 curMSTime = GameTime::GetGameTimeMS().count();
     uint32 infTime = curMSTime + infinityCooldownDelayCheck;
 
-    bool first_round = true;
-    std::ostringstream ss;
-
-    // remove outdated and save active
+    // remove outdated and collect active
+    SpellCooldowns cooldowns;
     for (SpellCooldowns::iterator itr = m_spellCooldowns.begin(); itr != m_spellCooldowns.end();)
     {
         // Xinef: dummy cooldown for procs
@@ -3647,26 +3641,44 @@ void Player::_SaveSpellCooldowns(CharacterDatabaseTransaction trans, bool logout
         if (itr->second.end <= curMSTime + 1000)
             m_spellCooldowns.erase(itr++);
         else if (itr->second.end <= infTime && (logout || itr->second.end > (curMSTime + 5 * MINUTE * IN_MILLISECONDS)))             // not save locked cooldowns, it will be reset or set at reload
+            cooldowns.insert(*itr++);
+        else
+            ++itr;
+    }
+
+    // same rows as stored by the previous save, nothing to write. The first save after login always writes,
+    // the rows loaded may include cooldowns that were reset since
+    if (!fullSave && m_savedSpellCooldowns && std::equal(cooldowns.begin(), cooldowns.end(), m_savedSpellCooldowns->begin(), m_savedSpellCooldowns->end(),
+        [](SpellCooldowns::value_type const& a, SpellCooldowns::value_type const& b)
         {
-            if (first_round)
-            {
-                ss << "INSERT INTO character_spell_cooldown (guid, spell, category, item, time, needSend) VALUES ";
-                first_round = false;
-            }
-            // next new/changed record prefix
-            else
+            return a.first == b.first && a.second.end == b.second.end && a.second.category == b.second.category
+                && a.second.itemid == b.second.itemid && a.second.needSendToClient == b.second.needSendToClient;
+        }))
+        return;
+
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_COOLDOWN);
+    stmt->SetData(0, GetGUID().GetCounter());
+    trans->Append(stmt);
+
+    if (!cooldowns.empty())
+    {
+        time_t curTime = GameTime::GetGameTime().count();
+
+        std::ostringstream ss;
+        ss << "INSERT INTO character_spell_cooldown (guid, spell, category, item, time, needSend) VALUES ";
+        for (SpellCooldowns::const_iterator itr = cooldowns.begin(); itr != cooldowns.end(); ++itr)
+        {
+            // next record prefix
+            if (itr != cooldowns.begin())
                 ss << ',';
 
             uint64 cooldown = uint64(((itr->second.end - curMSTime) / IN_MILLISECONDS) + curTime);
             ss << '(' << GetGUID().GetCounter() << ',' << itr->first << ',' << itr->second.category << "," << itr->second.itemid << ',' << cooldown << ',' << (itr->second.needSendToClient ? '1' : '0') << ')';
-            ++itr;
         }
-        else
-            ++itr;
-    }
-    // if something changed execute
-    if (!first_round)
         trans->Append(ss.str().c_str());
+    }
+
+    m_savedSpellCooldowns = std::move(cooldowns);
 }
 
 uint32 Player::resetTalentsCost() const
@@ -4111,7 +4123,7 @@ void Player::DeleteFromDB(ObjectGuid::LowType lowGuid, uint32 accountId, bool up
                     do
                     {
                         ObjectGuid::LowType petguidlow = (*resultPets)[0].Get<uint32>();
-                        Pet::DeleteFromDB(petguidlow);
+                        Pet::DeleteFromDB(petguidlow, lowGuid);
                     } while (resultPets->NextRow());
                 }
 
@@ -4290,7 +4302,7 @@ void Player::DeleteFromDB(ObjectGuid::LowType lowGuid, uint32 accountId, bool up
 
                 sScriptMgr->OnPlayerDeleteFromDB(trans, lowGuid);
 
-                CharacterDatabase.CommitTransaction(trans);
+                CharacterDatabase.CommitTransaction(trans, lowGuid);
                 break;
             }
         // The character gets unlinked from the account, the name gets freed up and appears as deleted ingame
@@ -4300,7 +4312,7 @@ void Player::DeleteFromDB(ObjectGuid::LowType lowGuid, uint32 accountId, bool up
 
                 stmt->SetData(0, lowGuid);
 
-                CharacterDatabase.Execute(stmt);
+                CharacterDatabase.Execute(stmt, lowGuid);
                 break;
             }
         default:
@@ -4688,7 +4700,7 @@ void Player::RemoveCorpse()
 
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     Corpse::DeleteFromDB(GetGUID(), trans);
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetGUID().GetCounter());
 
     _corpseLocation.WorldRelocate();
 }
@@ -4709,7 +4721,7 @@ void Player::SpawnCorpseBones(bool triggerSave /*= true*/)
 
             _SaveAuras(trans, false);
 
-            CharacterDatabase.CommitTransaction(trans);
+            CharacterDatabase.CommitTransaction(trans, GetGUID().GetCounter());
         }
 }
 
@@ -6389,7 +6401,7 @@ uint32 Player::GetZoneIdFromDB(ObjectGuid guid)
             stmt->SetData(0, uint16(zone));
             stmt->SetData(1, guidLow);
 
-            CharacterDatabase.Execute(stmt);
+            CharacterDatabase.Execute(stmt, guidLow);
         }
     }
 
@@ -9129,7 +9141,7 @@ void Player::RemovePet(Pet* pet, PetSaveMode mode, bool returnreagent)
             stmt->SetData(0, PET_SAVE_NOT_IN_SLOT);
             stmt->SetData(1, GetGUID().GetCounter());
             stmt->SetData(2, m_petStable->CurrentPet->PetNumber);
-            CharacterDatabase.Execute(stmt);
+            CharacterDatabase.Execute(stmt, GetGUID().GetCounter());
 
             m_petStable->UnslottedPets.push_back(std::move(*m_petStable->CurrentPet));
             m_petStable->CurrentPet.reset();
@@ -9613,7 +9625,7 @@ void Player::VehicleSpellInitialize()
             continue;
         }
 
-        ConditionList conditions = sConditionMgr->GetConditionsForVehicleSpell(vehicle->GetEntry(), spellId);
+        ConditionSpan conditions = sConditionMgr->GetConditionsForVehicleSpell(vehicle->GetEntry(), spellId);
         if (!sConditionMgr->IsObjectMeetToConditions(this, vehicle, conditions))
         {
             LOG_DEBUG("condition", "VehicleSpellInitialize: conditions not met for Vehicle entry {} spell {}", vehicle->ToCreature()->GetEntry(), spellId);
@@ -10137,7 +10149,7 @@ void Player::RemovePetitionsAndSigns(ObjectGuid guid, uint32 type)
         // xinef: clear petition store
         sPetitionMgr->RemovePetitionByOwnerAndType(guid, uint8(type));
     }
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, guid.GetCounter());
 }
 
 void Player::LeaveAllArenaTeams(ObjectGuid guid)
@@ -10720,7 +10732,7 @@ bool Player::BuyItemFromVendorSlot(ObjectGuid vendorguid, uint32 vendorslot, uin
         return false;
     }
 
-    ConditionList conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), item);
+    ConditionSpan conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), item);
     if (!sConditionMgr->IsObjectMeetToConditions(this, creature, conditions))
     {
         //LOG_DEBUG("condition", "BuyItemFromVendor: conditions not met for creature entry {} item {}", creature->GetEntry(), item);
@@ -12473,7 +12485,7 @@ void Player::AutoUnequipOffhandIfNeed(bool force /*= false*/)
         std::string subject = GetSession()->GetAcoreString(LANG_NOT_EQUIPPED_ITEM);
         MailDraft(subject, "There were problems with equipping one or several items").AddItem(offItem).SendMailTo(trans, this, MailSender(this, MAIL_STATIONERY_GM), MAIL_CHECK_MASK_COPIED);
 
-        CharacterDatabase.CommitTransaction(trans);
+        CharacterDatabase.CommitTransaction(trans, GetGUID().GetCounter());
     }
     UpdateTitansGrip();
 }
@@ -13686,7 +13698,7 @@ void Player::_LoadSkills(PreparedQueryResult result)
                 stmt->SetData(0, GetGUID().GetCounter());
                 stmt->SetData(1, skill);
 
-                CharacterDatabase.Execute(stmt);
+                CharacterDatabase.Execute(stmt, GetGUID().GetCounter());
 
                 continue;
             }
@@ -14257,7 +14269,7 @@ bool Player::CanSeeSpellClickOn(Creature const* c) const
         if (!itr->second.IsFitToRequirements(this, c))
             return false;
 
-        ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(c->GetEntry(), itr->second.spellId);
+        ConditionSpan conds = sConditionMgr->GetConditionsForSpellClickEvent(c->GetEntry(), itr->second.spellId);
         ConditionSourceInfo info = ConditionSourceInfo(const_cast<Player*>(this), const_cast<Creature*>(c));
         if (sConditionMgr->IsObjectMeetToConditions(info, conds))
             return true;
@@ -14271,7 +14283,7 @@ bool Player::CanSeeVendor(Creature const* creature) const
     if (!creature->HasNpcFlag(UNIT_NPC_FLAG_VENDOR))
         return true;
 
-    ConditionList conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), 0);
+    ConditionSpan conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), 0);
     if (!sConditionMgr->IsObjectMeetToConditions(const_cast<Player*>(this), const_cast<Creature*>(creature), conditions))
     {
         return false;
@@ -14562,13 +14574,22 @@ void Player::_SaveEquipmentSets(CharacterDatabaseTransaction trans)
     }
 }
 
-void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
+void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans, bool fullSave)
 {
     // xinef: dont save joinpos with invalid mapid
     MapEntry const* mEntry = sMapStore.LookupEntry(m_entryPointData.joinPos.GetMapId());
     if (!mEntry)
         return;
 
+    if (!fullSave && m_savedEntryPointData && m_savedEntryPointData->mountSpell == m_entryPointData.mountSpell
+        && m_savedEntryPointData->taxiPath == m_entryPointData.taxiPath
+        && m_savedEntryPointData->joinPos.GetMapId() == m_entryPointData.joinPos.GetMapId()
+        && m_savedEntryPointData->joinPos.GetPositionX() == m_entryPointData.joinPos.GetPositionX()
+        && m_savedEntryPointData->joinPos.GetPositionY() == m_entryPointData.joinPos.GetPositionY()
+        && m_savedEntryPointData->joinPos.GetPositionZ() == m_entryPointData.joinPos.GetPositionZ()
+        && m_savedEntryPointData->joinPos.GetOrientation() == m_entryPointData.joinPos.GetOrientation())
+        return;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_ENTRY_POINT);
     stmt->SetData(0, GetGUID().GetCounter());
     trans->Append(stmt);
@@ -14584,6 +14605,8 @@ void Player::_SaveEntryPoint(CharacterDatabaseTransaction trans)
     stmt->SetData(7, m_entryPointData.taxiPath[1]);
     stmt->SetData(8, m_entryPointData.mountSpell);
     trans->Append(stmt);
+
+    m_savedEntryPointData = m_entryPointData;
 }
 
 void Player::DeleteEquipmentSet(uint64 setGuid)
@@ -14612,7 +14635,7 @@ void Player::RemoveAtLoginFlag(AtLoginFlags flags, bool persist /*= false*/)
         stmt->SetData(0, uint16(flags));
         stmt->SetData(1, GetGUID().GetCounter());
 
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, GetGUID().GetCounter());
     }
 }
 
@@ -15049,7 +15072,7 @@ void Player::ActivateSpec(uint8 spec)
     // xinef: save current actions order
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     _SaveActions(trans);
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetGUID().GetCounter());
 
     // xinef: remove pet, it will be resummoned later
     if (Pet* pet = GetPet())
@@ -15666,7 +15689,7 @@ void Player::RefundItem(Item* item)
 
     SaveInventoryAndGoldToDB(trans);
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetGUID().GetCounter());
 }
 
 void Player::SetRandomWinner(bool isWinner)
@@ -15743,6 +15766,8 @@ void Player::_LoadInstanceTimeRestrictions(PreparedQueryResult result)
         Field* fields = result->Fetch();
         _instanceResetTimes.insert(InstanceTimeMap::value_type(fields[0].Get<uint32>(), fields[1].Get<uint64>()));
     } while (result->NextRow());
+
+    _savedInstanceResetTimes = _instanceResetTimes;
 }
 
 void Player::_LoadBrewOfTheMonth(PreparedQueryResult result)
@@ -15778,7 +15803,7 @@ void Player::_LoadBrewOfTheMonth(PreparedQueryResult result)
         stmt->SetData(1, uint32(eventId));
         trans->Append(stmt);
 
-        CharacterDatabase.CommitTransaction(trans);
+        CharacterDatabase.CommitTransaction(trans, GetGUID().GetCounter());
     }
 }
 
@@ -15834,11 +15859,14 @@ void Player::_LoadPetStable(uint8 petStableSlots, PreparedQueryResult result)
     }
 }
 
-void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans)
+void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans, bool fullSave)
 {
     if (_instanceResetTimes.empty())
         return;
 
+    if (!fullSave && _instanceResetTimes == _savedInstanceResetTimes)
+        return;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ACCOUNT_INSTANCE_LOCK_TIMES);
     stmt->SetData(0, GetSession()->GetAccountId());
     trans->Append(stmt);
@@ -15851,6 +15879,8 @@ void Player::_SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans)
         stmt->SetData(2, (int64)itr->second);
         trans->Append(stmt);
     }
+
+    _savedInstanceResetTimes = _instanceResetTimes;
 }
 
 bool Player::IsInWhisperWhiteList(ObjectGuid guid)
@@ -41,6 +41,7 @@
 #include "TradeData.h"
 #include "Unit.h"
 #include "WorldSession.h"
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -1583,6 +1584,10 @@ public:
     void SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logout);
     void SaveInventoryAndGoldToDB(CharacterDatabaseTransaction trans);                    // fast save function for item/money cheating preventing
     void SaveGoldToDB(CharacterDatabaseTransaction trans);
+
+    /// Number of SaveToDB calls and of statements they appended, across all players
+    static void GetSaveStats(uint64& saves, uint64& statements);
+
     void _SaveSkills(CharacterDatabaseTransaction trans);
 
     static void Customize(CharacterCustomizeInfo const* customizeInfo, CharacterDatabaseTransaction trans);
@@ -1810,7 +1815,7 @@ public:
     void RemoveArenaSpellCooldowns(bool removeActivePetCooldowns = false);
     void RemoveAllSpellCooldown();
     void _LoadSpellCooldowns(PreparedQueryResult result);
-    void _SaveSpellCooldowns(CharacterDatabaseTransaction trans, bool logout);
+    void _SaveSpellCooldowns(CharacterDatabaseTransaction trans, bool logout, bool fullSave);
     uint32 GetLastPotionId() { return m_lastPotionId; }
     void SetLastPotionId(uint32 item_id) { m_lastPotionId = item_id; }
     void UpdatePotionCooldown(Spell* spell = nullptr);
@@ -2382,8 +2387,11 @@ public:
     [[nodiscard]] WorldLocation const& GetEntryPoint() const { return m_entryPointData.joinPos; }
     void SetEntryPoint();
 
-    // currently visible objects at player client
+    // currently visible objects at player client, update through the helpers below to keep the observer index of the objects in sync
     GuidUnorderedSet m_clientGUIDs;
+    void AddClientGUID(WorldObject* target) { m_clientGUIDs.insert(target->GetGUID()); target->AddObserver(this); }
+    void RemoveClientGUID(WorldObject* target) { m_clientGUIDs.erase(target->GetGUID()); target->RemoveObserver(this); }
+    void ClearClientGUIDs() { m_clientGUIDs.clear(); ClearObservedObjects(); }
     std::vector<Unit*> m_newVisible; // pussywizard
 
     [[nodiscard]] bool HaveAtClient(WorldObject const* u) const;
@@ -2691,6 +2699,7 @@ protected:
     /*********************************************************/
 
     EntryPointData m_entryPointData;
+    Optional<EntryPointData> m_savedEntryPointData;         // as stored in db, unset until loaded or saved once
 
     /*********************************************************/
     /***                    QUEST SYSTEM                   ***/
@@ -2756,13 +2765,13 @@ protected:
     void _SaveSeasonalQuestStatus(CharacterDatabaseTransaction trans);
     void _SaveSpells(CharacterDatabaseTransaction trans);
     void _SaveEquipmentSets(CharacterDatabaseTransaction trans);
-    void _SaveEntryPoint(CharacterDatabaseTransaction trans);
+    void _SaveEntryPoint(CharacterDatabaseTransaction trans, bool fullSave);
     void _SaveGlyphs(CharacterDatabaseTransaction trans);
     void _SaveTalents(CharacterDatabaseTransaction trans);
     void _SaveStats(CharacterDatabaseTransaction trans);
     void _SaveCharacter(bool create, CharacterDatabaseTransaction trans);
-    void _SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans);
-    void _SavePlayerSettings(CharacterDatabaseTransaction trans);
+    void _SaveInstanceTimeRestrictions(CharacterDatabaseTransaction trans, bool fullSave);
+    void _SavePlayerSettings(CharacterDatabaseTransaction trans, bool fullSave);
 
     /*********************************************************/
     /***              ENVIRONMENTAL SYSTEM                 ***/
@@ -2990,10 +2999,12 @@ private:
     ReputationMgr*  m_reputationMgr;
 
     SpellCooldowns m_spellCooldowns;
+    Optional<SpellCooldowns> m_savedSpellCooldowns;         // rows written by the last _SaveSpellCooldowns, unset until saved once
 
     uint32 m_ChampioningFaction;
 
     InstanceTimeMap _instanceResetTimes;
+    InstanceTimeMap _savedInstanceResetTimes;
     uint32 _pendingBindId;
     uint32 _pendingBindTimer;
 
@@ -3014,6 +3025,10 @@ private:
     bool _wasOutdoor;
 
     PlayerSettingMap m_charSettingsMap;
+    std::set<std::string> m_charSettingsChanged;            // sources updated since the last save
+
+    static std::atomic<uint64> _saveCount;
+    static std::atomic<uint64> _saveStatements;
 
     Seconds m_creationTime;
 };
@@ -93,7 +93,7 @@ void Player::SavePositionInDB(uint32 mapid, float x, float y, float z, float o,
     stmt->SetData(5, uint16(zone));
     stmt->SetData(6, guid.GetCounter());
 
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, guid.GetCounter());
 }
 
 void Player::SavePositionInDB(WorldLocation const& loc, uint16 zoneId, ObjectGuid guid, CharacterDatabaseTransaction trans)
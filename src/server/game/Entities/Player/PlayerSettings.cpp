@@ -26,6 +26,7 @@
 void Player::_LoadCharacterSettings(PreparedQueryResult result)
 {
     m_charSettingsMap.clear();
+    m_charSettingsChanged.clear();
 
     if (!sWorld->getBoolConfig(CONFIG_PLAYER_SETTINGS_ENABLED))
     {
@@ -88,7 +89,7 @@ PlayerSetting Player::GetPlayerSetting(std::string source, uint8 index)
     return itr->second[index];
 }
 
-void Player::_SavePlayerSettings(CharacterDatabaseTransaction trans)
+void Player::_SavePlayerSettings(CharacterDatabaseTransaction trans, bool fullSave)
 {
     if (!sWorld->getBoolConfig(CONFIG_PLAYER_SETTINGS_ENABLED))
     {
@@ -97,6 +98,11 @@ void Player::_SavePlayerSettings(CharacterDatabaseTransaction trans)
 
     for (auto& itr : m_charSettingsMap)
     {
+        if (!fullSave && !m_charSettingsChanged.count(itr.first))
+        {
+            continue;
+        }
+
         std::ostringstream data;
 
         for (auto& setting : itr.second)
@@ -110,6 +116,8 @@ void Player::_SavePlayerSettings(CharacterDatabaseTransaction trans)
         stmt->SetData(2, data.str());
         trans->Append(stmt);
     }
+
+    m_charSettingsChanged.clear();
 }
 
 void Player::UpdatePlayerSetting(std::string source, uint8 index, uint32 value)
@@ -117,6 +125,8 @@ void Player::UpdatePlayerSetting(std::string source, uint8 index, uint32 value)
     auto itr = m_charSettingsMap.find(source);
     uint8 size = index + 1;
 
+    m_charSettingsChanged.insert(source);
+
     if (itr == m_charSettingsMap.end())
     {
         // Settings not found, initialize a new entry.
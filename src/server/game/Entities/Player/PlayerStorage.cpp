@@ -4870,6 +4870,7 @@ void Player::_LoadEntryPointData(PreparedQueryResult result)
     m_entryPointData.taxiPath[0] = fields[5].Get<uint32>();
     m_entryPointData.taxiPath[1] = fields[6].Get<uint32>();
     m_entryPointData.mountSpell = fields[7].Get<uint32>();
+    m_savedEntryPointData = m_entryPointData;
 }
 
 bool Player::LoadPositionFromDB(uint32& mapid, float& x, float& y, float& z, float& o, bool& in_flight, ObjectGuid::LowType guid)
@@ -4907,7 +4908,7 @@ void Player::SetHomebind(WorldLocation const& loc, uint32 areaId)
     stmt->SetData (3, m_homebindY);
     stmt->SetData (4, m_homebindZ);
     stmt->SetData(5, GetGUID().GetCounter());
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, GetGUID().GetCounter());
 }
 
 bool Player::isBeingLoaded() const
@@ -4967,7 +4968,7 @@ bool Player::LoadFromDB(ObjectGuid playerGuid, CharacterDatabaseQueryHolder cons
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ADD_AT_LOGIN_FLAG);
         stmt->SetData(0, uint16(AT_LOGIN_RENAME));
         stmt->SetData(1, guid);
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, guid);
         return false;
     }
 
@@ -7016,7 +7017,7 @@ bool Player::_LoadHomeBind(PreparedQueryResult result)
         {
             CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PLAYER_HOMEBIND);
             stmt->SetData(0, GetGUID().GetCounter());
-            CharacterDatabase.Execute(stmt);
+            CharacterDatabase.Execute(stmt, GetGUID().GetCounter());
         }
     }
 
@@ -7035,7 +7036,7 @@ bool Player::_LoadHomeBind(PreparedQueryResult result)
         stmt->SetData (3, m_homebindX);
         stmt->SetData (4, m_homebindY);
         stmt->SetData (5, m_homebindZ);
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, GetGUID().GetCounter());
     }
 
     LOG_DEBUG("entities.player", "Setting player home position - mapid: {}, areaid: {}, X: {}, Y: {}, Z: {}",
@@ -7047,13 +7048,16 @@ bool Player::_LoadHomeBind(PreparedQueryResult result)
 /***                   SAVE SYSTEM                     ***/
 /*********************************************************/
 
+std::atomic<uint64> Player::_saveCount(0);
+std::atomic<uint64> Player::_saveStatements(0);
+
 void Player::SaveToDB(bool create, bool logout)
 {
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
 
     SaveToDB(trans, create, logout);
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetGUID().GetCounter());
 }
 
 void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logout)
@@ -7081,12 +7085,17 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logo
     if (!create)
         sScriptMgr->OnPlayerSave(this);
 
+    std::size_t statementsBefore = trans->GetSize();
+
+    // sections without per row states compare against what they wrote last time, unless a full save is forced
+    bool fullSave = create || (logout && sWorld->getBoolConfig(CONFIG_PLAYER_SAVE_FULL_ON_LOGOUT));
+
     _SaveCharacter(create, trans);
 
     if (m_mailsUpdated)                                     //save mails only when needed
         _SaveMail(trans);
 
-    _SaveEntryPoint(trans);
+    _SaveEntryPoint(trans, fullSave);
     _SaveInventory(trans);
     _SaveQuestStatus(trans);
     _SaveDailyQuestStatus(trans);
@@ -7095,7 +7104,7 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logo
     _SaveMonthlyQuestStatus(trans);
     _SaveTalents(trans);
     _SaveSpells(trans);
-    _SaveSpellCooldowns(trans, logout);
+    _SaveSpellCooldowns(trans, logout, fullSave);
     _SaveActions(trans);
     _SaveAuras(trans, logout);
     _SaveSkills(trans);
@@ -7104,19 +7113,30 @@ void Player::SaveToDB(CharacterDatabaseTransaction trans, bool create, bool logo
     _SaveEquipmentSets(trans);
     GetSession()->SaveTutorialsData(trans);                 // changed only while character in game
     _SaveGlyphs(trans);
-    _SaveInstanceTimeRestrictions(trans);
-    _SavePlayerSettings(trans);
+    _SaveInstanceTimeRestrictions(trans, fullSave);
+    _SavePlayerSettings(trans, fullSave);
 
     // check if stats should only be saved on logout
     // save stats can be out of transaction
     if (m_session->isLogingOut() || !sWorld->getBoolConfig(CONFIG_STATS_SAVE_ONLY_ON_LOGOUT))
         _SaveStats(trans);
 
+    std::size_t statements = trans->GetSize() - statementsBefore;
+    _saveCount.fetch_add(1, std::memory_order_relaxed);
+    _saveStatements.fetch_add(statements, std::memory_order_relaxed);
+    LOG_DEBUG("entities.player", "Player {} saved with {} statements{}", m_name, statements, fullSave ? " (full save)" : "");
+
     // save pet (hunter pet level and experience and all type pets health/mana).
     if (Pet* pet = GetPet())
         pet->SavePetToDB(PET_SAVE_AS_CURRENT);
 }
 
+void Player::GetSaveStats(uint64& saves, uint64& statements)
+{
+    saves = _saveCount.load(std::memory_order_relaxed);
+    statements = _saveStatements.load(std::memory_order_relaxed);
+}
+
 // fast save function for item/money cheating preventing - save only inventory and money state
 void Player::SaveInventoryAndGoldToDB(CharacterDatabaseTransaction trans)
 {
@@ -7695,16 +7715,10 @@ void Player::_SaveSpells(CharacterDatabaseTransaction trans)
 {
     CharacterDatabasePreparedStatement* stmt = nullptr;
 
-    for (PlayerSpellMap::iterator itr = m_spells.begin(); itr != m_spells.end();)
+    // Delete statements for removed / updated spells first, so the inserts below form one run the
+    // database layer can send as multi-row statements
+    for (PlayerSpellMap::const_iterator itr = m_spells.begin(); itr != m_spells.end(); ++itr)
     {
-        // xinef: skip temporary spells
-        if (itr->second->State == PLAYERSPELL_TEMPORARY)
-        {
-            ++itr;
-            continue;
-        }
-
-        // xinef: Delete statement for removed / updated spell
         if (itr->second->State == PLAYERSPELL_REMOVED || itr->second->State == PLAYERSPELL_CHANGED)
         {
             stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SPELL_BY_SPELL);
@@ -7712,6 +7726,16 @@ void Player::_SaveSpells(CharacterDatabaseTransaction trans)
             stmt->SetData(1, itr->first);
             trans->Append(stmt);
         }
+    }
+
+    for (PlayerSpellMap::iterator itr = m_spells.begin(); itr != m_spells.end();)
+    {
+        // xinef: skip temporary spells
+        if (itr->second->State == PLAYERSPELL_TEMPORARY)
+        {
+            ++itr;
+            continue;
+        }
 
         // xinef: insert statement for new / updated spell
         if (itr->second->State == PLAYERSPELL_NEW || itr->second->State == PLAYERSPELL_CHANGED)
@@ -38,6 +38,7 @@
 #include "Vehicle.h"
 #include "Weather.h"
 #include "WeatherMgr.h"
+#include "WhoListCacheMgr.h"
 #include "WorldState.h"
 #include "WorldStatePackets.h"
 
@@ -1271,6 +1272,8 @@ void Player::UpdateZone(uint32 newZone, uint32 newArea, bool force)
                                       // just area change, works strange...
         if (Guild* guild = GetGuild())
             guild->UpdateMemberData(this, GUILD_MEMBER_DATA_ZONEID, newZone);
+
+        sWhoListCacheMgr->ScheduleUpdate(GetGUID());
     }
 
     GetMap()->UpdatePlayerZoneStats(m_zoneUpdateId, newZone);
@@ -1636,35 +1639,35 @@ void Player::UpdateObjectVisibility(bool forced, bool fromUpdate)
 }
 
 template <class T>
-inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, T* target,
+inline void UpdateVisibilityOf_helper(Player* player, T* target,
                                       std::vector<Unit*>& /*v*/)
 {
-    s64.insert(target->GetGUID());
+    player->AddClientGUID(target);
 }
 
 template <>
-inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, GameObject* target,
+inline void UpdateVisibilityOf_helper(Player* player, GameObject* target,
                                       std::vector<Unit*>& /*v*/)
 {
     // @HACK: This is to prevent objects like deeprun tram from disappearing
     // when player moves far from its spawn point while riding it
     if ((target->GetGOInfo()->type != GAMEOBJECT_TYPE_TRANSPORT))
-        s64.insert(target->GetGUID());
+        player->AddClientGUID(target);
 }
 
 template <>
-inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, Creature* target,
+inline void UpdateVisibilityOf_helper(Player* player, Creature* target,
                                       std::vector<Unit*>& v)
 {
-    s64.insert(target->GetGUID());
+    player->AddClientGUID(target);
     v.push_back(target);
 }
 
 template <>
-inline void UpdateVisibilityOf_helper(GuidUnorderedSet& s64, Player* target,
+inline void UpdateVisibilityOf_helper(Player* player, Player* target,
                                       std::vector<Unit*>& v)
 {
-    s64.insert(target->GetGUID());
+    player->AddClientGUID(target);
     v.push_back(target);
 }
 
@@ -1692,16 +1695,20 @@ void Player::UpdateVisibilityOf(T* target, UpdateData& data,
         {
             BeforeVisibilityDestroy<T>(target, this);
 
-            target->BuildOutOfRangeUpdateBlock(&data);
-            m_clientGUIDs.erase(target->GetGUID());
+            if (!GetSession()->IsHeadless())
+                target->BuildOutOfRangeUpdateBlock(&data);
+            RemoveClientGUID(target);
         }
     }
     else
     {
         if (CanSeeOrDetect(target, false, true))
         {
-            target->BuildCreateUpdateBlockForPlayer(&data, this);
-            UpdateVisibilityOf_helper(m_clientGUIDs, target, visibleNow);
+            if (GetSession()->IsHeadless())
+                WorldSession::CountHeadlessPacketAvoided();
+            else
+                target->BuildCreateUpdateBlockForPlayer(&data, this);
+            UpdateVisibilityOf_helper(this, target, visibleNow);
         }
     }
 }
@@ -1727,7 +1734,7 @@ void Player::UpdateVisibilityOf(WorldObject* target)
                 BeforeVisibilityDestroy<Creature>(target->ToCreature(), this);
 
             target->DestroyForPlayer(this);
-            m_clientGUIDs.erase(target->GetGUID());
+            RemoveClientGUID(target);
         }
     }
     else
@@ -1735,7 +1742,7 @@ void Player::UpdateVisibilityOf(WorldObject* target)
         if (CanSeeOrDetect(target, false, true))
         {
             target->SendUpdateToPlayer(this);
-            m_clientGUIDs.insert(target->GetGUID());
+            AddClientGUID(target);
 
             // target aura duration for caster show only if target exist at
             // caster client send data at target visibility change (adding to
@@ -1820,9 +1827,9 @@ void Player::UpdateForQuestWorldObjects()
                 {
                     //! This code doesn't look right, but it was logically converted to condition system to do the exact
                     //! same thing it did before. It definitely needs to be overlooked for intended functionality.
-                    ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(obj->GetEntry(), _itr->second.spellId);
+                    ConditionSpan conds = sConditionMgr->GetConditionsForSpellClickEvent(obj->GetEntry(), _itr->second.spellId);
                     bool buildUpdateBlock = false;
-                    for (ConditionList::const_iterator jtr = conds.begin(); jtr != conds.end() && !buildUpdateBlock; ++jtr)
+                    for (ConditionSpan::iterator jtr = conds.begin(); jtr != conds.end() && !buildUpdateBlock; ++jtr)
                         if ((*jtr)->ConditionType == CONDITION_QUESTREWARDED || (*jtr)->ConditionType == CONDITION_QUESTTAKEN)
                             buildUpdateBlock = true;
 
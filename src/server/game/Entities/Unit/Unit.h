@@ -1289,6 +1289,8 @@ public:
     void _RemoveNoStackAurasDueToAura(Aura* aura);
     bool _IsNoStackAuraDueToAura(Aura* appliedAura, Aura* existingAura) const;
     void _RegisterAuraEffect(AuraEffect* aurEff, bool apply);
+    /// Drops the cached modifier totals of an aura type, must be called whenever the amount of a registered effect changes
+    void InvalidateAuraModifierCache(AuraType auratype) const;
 
     // m_ownedAuras container management
     AuraMap&       GetOwnedAuras()       { return m_ownedAuras; }
@@ -2081,6 +2083,30 @@ protected:
     uint32 m_removedAurasCount;
 
     AuraEffectList m_modAuras[TOTAL_AURAS];
+
+    // results of the GetTotalAuraModifier/Multiplier and GetMax*AuraModifier families, built on first use
+    struct AuraModifierTotals
+    {
+        int32 Total = 0;
+        float Multiplier = 1.0f;
+        int32 MaxPositive = 0;
+        int32 MaxNegative = 0;
+
+        bool operator==(AuraModifierTotals const& right) const = default;
+    };
+
+    struct AuraModifierCache
+    {
+        bool Valid = false;
+        AuraModifierTotals Totals;
+        std::vector<std::pair<uint32 /*miscMask*/, AuraModifierTotals>> ByMiscMask;
+    };
+
+    AuraModifierTotals const& GetAuraModifierTotals(AuraType auratype) const;
+    AuraModifierTotals const& GetAuraModifierTotalsByMiscMask(AuraType auratype, uint32 miscMask) const;
+    AuraModifierTotals BuildAuraModifierTotals(AuraType auratype, uint32 miscMask) const;
+
+    mutable std::unordered_map<uint32 /*AuraType*/, AuraModifierCache> m_auraModifierCache;
     AuraList m_scAuras;                        // casted singlecast auras
     AuraApplicationList m_interruptableAuras;  // auras which have interrupt mask applied on unit
     AuraStateAurasMap m_auraStateAuras;        // Used for improve performance of aura state checks on aura apply/remove
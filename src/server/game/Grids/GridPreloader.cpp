@@ -0,0 +1,177 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridPreloader.h"
+#include "GridTerrainStore.h"
+#include "Log.h"
+#include "MapTree.h"
+#include "StringFormat.h"
+#include "World.h"
+#include <array>
+#include <fstream>
+
+namespace
+{
+    // Prepared grids nobody asked for within this time are dropped again
+    constexpr Milliseconds PREPARED_GRID_EXPIRY = 30s;
+
+    // Reads a file once so the synchronous vmap/mmap tile load on the map thread hits the page cache
+    void WarmFile(std::string const& fileName)
+    {
+        std::ifstream file(fileName, std::ios::binary);
+        if (!file)
+            return;
+
+        std::array<char, 64 * 1024> buffer;
+        while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0)
+            ;
+    }
+}
+
+GridPreloader* GridPreloader::instance()
+{
+    static GridPreloader instance;
+    return &instance;
+}
+
+void GridPreloader::Initialize(std::size_t threadCount)
+{
+    _dataPath = sWorld->GetDataPath();
+    _cancelationToken = false;
+    _nextExpiryCheck = std::chrono::steady_clock::now() + PREPARED_GRID_EXPIRY;
+
+    _workers.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+        _workers.emplace_back(&GridPreloader::WorkerThread, this);
+
+    LOG_INFO("server.loading", "Grid preloader started with {} thread(s)", threadCount);
+}
+
+void GridPreloader::Unload()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _cancelationToken = true;
+        _condition.notify_all();
+    }
+
+    for (std::thread& worker : _workers)
+        if (worker.joinable())
+            worker.join();
+
+    _workers.clear();
+    _queue.clear();
+    _grids.clear();
+}
+
+void GridPreloader::Request(uint32 mapId, uint32 gridX, uint32 gridY)
+{
+    if (!IsActive())
+        return;
+
+    uint32 const key = MakeKey(mapId, gridX, gridY);
+
+    std::lock_guard<std::mutex> guard(_lock);
+    RemoveExpiredGrids();
+
+    if (!_grids.try_emplace(key).second)
+        return;
+
+    _queue.push_back(key);
+    _condition.notify_one();
+}
+
+bool GridPreloader::TakeTerrainData(uint32 mapId, uint32 gridX, uint32 gridY, std::shared_ptr<GridTerrainData>& terrainData, TerrainMapDataReadResult& result)
+{
+    if (!IsActive())
+        return false;
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    auto itr = _grids.find(MakeKey(mapId, gridX, gridY));
+    if (itr == _grids.end() || !itr->second.Ready)
+        return false;
+
+    terrainData = std::move(itr->second.TerrainData);
+    result = itr->second.Result;
+    _grids.erase(itr);
+    return true;
+}
+
+void GridPreloader::WorkerThread()
+{
+    for (;;)
+    {
+        uint32 key;
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+            _condition.wait(guard, [this] { return _cancelationToken || !_queue.empty(); });
+            if (_cancelationToken)
+                return;
+
+            key = _queue.front();
+            _queue.pop_front();
+        }
+
+        PrepareGrid(key);
+    }
+}
+
+void GridPreloader::PrepareGrid(uint32 key)
+{
+    uint32 const mapId = key >> 16;
+    uint32 const gridX = (key >> 8) & 0xFF;
+    uint32 const gridY = key & 0xFF;
+
+    // Terrain is memory mapped, touch its pages so the first lookups on the map thread do not fault them in
+    TerrainMapDataReadResult result;
+    std::shared_ptr<GridTerrainData> terrainData = sGridTerrainStore->Get(mapId, gridX, gridY, result);
+    if (terrainData)
+        terrainData->PageIn();
+
+    WarmFile(_dataPath + "vmaps/" + VMAP::StaticMapTree::getTileFileName(mapId, gridX, gridY));
+    WarmFile(Acore::StringFormat("{}mmaps/{:03}{:02}{:02}.mmtile", _dataPath, mapId, gridX, gridY));
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    // Dropped by Unload or expiry while loading
+    auto itr = _grids.find(key);
+    if (itr == _grids.end())
+        return;
+
+    itr->second.TerrainData = std::move(terrainData);
+    itr->second.Result = result;
+    itr->second.ReadyTime = std::chrono::steady_clock::now();
+    itr->second.Ready = true;
+}
+
+void GridPreloader::RemoveExpiredGrids()
+{
+    TimePoint now = std::chrono::steady_clock::now();
+    if (now < _nextExpiryCheck)
+        return;
+
+    _nextExpiryCheck = now + PREPARED_GRID_EXPIRY;
+
+    for (auto itr = _grids.begin(); itr != _grids.end();)
+    {
+        if (itr->second.Ready && now - itr->second.ReadyTime >= PREPARED_GRID_EXPIRY)
+            itr = _grids.erase(itr);
+        else
+            ++itr;
+    }
+}
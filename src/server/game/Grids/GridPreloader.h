@@ -0,0 +1,95 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_GRID_PRELOADER_H
+#define ACORE_GRID_PRELOADER_H
+
+#include "Define.h"
+#include "Duration.h"
+#include "GridTerrainData.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Reads the terrain of base map grids on background threads before a player reaches them.
+ *
+ * Maps request the grids lying ahead of their moving players, the workers map the .map file through the
+ * GridTerrainStore, page it in and read the matching vmap and mmap tiles once so the map thread finds them
+ * in the OS file cache. GridTerrainLoader takes the prepared terrain when the grid is finally created, everything
+ * else (vmap/mmap managers, spawning the grid objects) stays on the map thread.
+ */
+class AC_GAME_API GridPreloader
+{
+public:
+    static GridPreloader* instance();
+
+    void Initialize(std::size_t threadCount);
+    void Unload();
+    [[nodiscard]] bool IsActive() const { return !_workers.empty(); }
+
+    /// Queues the terrain of a base map grid, ignored if it is already queued or prepared
+    void Request(uint32 mapId, uint32 gridX, uint32 gridY);
+
+    /// Hands over prepared terrain of a grid, returns false if the grid has to be loaded synchronously
+    bool TakeTerrainData(uint32 mapId, uint32 gridX, uint32 gridY, std::shared_ptr<GridTerrainData>& terrainData, TerrainMapDataReadResult& result);
+
+    /// Counts grid terrain loads of base maps for the grid_loads_* metrics
+    void CountGridLoad(bool prefetched) { (prefetched ? _prefetchedLoads : _syncLoads).fetch_add(1, std::memory_order_relaxed); }
+    [[nodiscard]] uint64 GetPrefetchedLoads() const { return _prefetchedLoads.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64 GetSyncLoads() const { return _syncLoads.load(std::memory_order_relaxed); }
+
+private:
+    GridPreloader() = default;
+    ~GridPreloader() = default;
+
+    struct PreparedGrid
+    {
+        std::shared_ptr<GridTerrainData> TerrainData;
+        TerrainMapDataReadResult Result = TerrainMapDataReadResult::NotFound;
+        TimePoint ReadyTime;
+        bool Ready = false;
+    };
+
+    static uint32 MakeKey(uint32 mapId, uint32 gridX, uint32 gridY) { return (mapId << 16) | (gridX << 8) | gridY; }
+
+    void WorkerThread();
+    void PrepareGrid(uint32 key);
+    void RemoveExpiredGrids();
+
+    std::string _dataPath;
+    std::vector<std::thread> _workers;
+    std::deque<uint32> _queue;
+    std::unordered_map<uint32 /*key*/, PreparedGrid> _grids;   // queued and prepared grids
+    TimePoint _nextExpiryCheck;
+    bool _cancelationToken = false;
+    std::mutex _lock;
+    std::condition_variable _condition;
+
+    std::atomic<uint64> _prefetchedLoads{0};
+    std::atomic<uint64> _syncLoads{0};
+};
+
+#define sGridPreloader GridPreloader::instance()
+
+#endif
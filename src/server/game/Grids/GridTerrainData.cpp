@@ -3,6 +3,9 @@
 #include "GridTerrainData.h"
 #include "Log.h"
 #include "MapDefines.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstring>
 #include <filesystem>
 #include <G3D/Ray.h>
 
@@ -14,6 +17,8 @@ GridTerrainData::GridTerrainData()
     _gridGetHeight = &GridTerrainData::getHeightFromFlat;
 }
 
+GridTerrainData::~GridTerrainData() = default;
+
 TerrainMapDataReadResult GridTerrainData::Load(std::string const& mapFileName)
 {
     // Check if file exists, we do this first as we need to
@@ -21,14 +26,22 @@ TerrainMapDataReadResult GridTerrainData::Load(std::string const& mapFileName)
     if (!std::filesystem::exists(mapFileName))
         return TerrainMapDataReadResult::NotFound;
 
-    // Start the input stream and check for any errors
-    std::ifstream fileStream(mapFileName, std::ios::binary);
-    if (fileStream.fail())
+    // Map the file, the tables below point into it instead of being copied to the heap.
+    // The file handle is closed again once the region is mapped, only the mapping itself stays
+    try
+    {
+        boost::interprocess::file_mapping file(mapFileName.c_str(), boost::interprocess::read_only);
+        _region = std::make_unique<boost::interprocess::mapped_region>(file, boost::interprocess::read_only);
+    }
+    catch (std::exception const& e)
+    {
+        LOG_DEBUG("maps", "Unable to map file '{}': {}", mapFileName, e.what());
         return TerrainMapDataReadResult::ReadError;
+    }
 
     // Read the map header
     map_fileheader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)))
+    if (!ReadStruct(0, GetMappedSize(), header))
         return TerrainMapDataReadResult::ReadError;
 
     // Check for valid map and version magics
@@ -36,51 +49,112 @@ TerrainMapDataReadResult GridTerrainData::Load(std::string const& mapFileName)
         return TerrainMapDataReadResult::InvalidMagic;
 
     // Load area data
-    if (header.areaMapOffset && !LoadAreaData(fileStream, header.areaMapOffset))
+    if (header.areaMapOffset && !LoadAreaData(header.areaMapOffset, header.areaMapSize))
         return TerrainMapDataReadResult::InvalidAreaData;
 
     // Load height data
-    if (header.heightMapOffset && !LoadHeightData(fileStream, header.heightMapOffset))
+    if (header.heightMapOffset && !LoadHeightData(header.heightMapOffset, header.heightMapSize))
         return TerrainMapDataReadResult::InvalidHeightData;
 
     // Load liquid data
-    if (header.liquidMapOffset && !LoadLiquidData(fileStream, header.liquidMapOffset))
+    if (header.liquidMapOffset && !LoadLiquidData(header.liquidMapOffset, header.liquidMapSize))
         return TerrainMapDataReadResult::InvalidLiquidData;
 
     // Load hole data
-    if (header.holesSize && !LoadHolesData(fileStream, header.holesOffset))
+    if (header.holesSize && !LoadHolesData(header.holesOffset, header.holesSize))
         return TerrainMapDataReadResult::InvalidHoleData;
 
     return TerrainMapDataReadResult::Success;
 }
 
-bool GridTerrainData::LoadAreaData(std::ifstream& fileStream, uint32 const offset)
+std::size_t GridTerrainData::GetMappedSize() const
+{
+    return _region ? _region->get_size() : 0;
+}
+
+void GridTerrainData::PageIn() const
+{
+    if (!_region)
+        return;
+
+    std::size_t const pageSize = boost::interprocess::mapped_region::get_page_size();
+    char const* data = GetMappedData();
+    char volatile sink = 0;
+    for (std::size_t offset = 0; offset < GetMappedSize(); offset += pageSize)
+        sink = sink + data[offset];
+}
+
+char const* GridTerrainData::GetMappedData() const
+{
+    return static_cast<char const*>(_region->get_address());
+}
+
+std::size_t GridTerrainData::GetSectionEnd(uint32 const offset, uint32 const size) const
+{
+    // A section must lie within the file, reads are then limited to the section itself
+    if (std::size_t(offset) + size > GetMappedSize())
+        return 0;
+
+    return std::size_t(offset) + size;
+}
+
+template<class T>
+bool GridTerrainData::ReadStruct(std::size_t offset, std::size_t end, T& value) const
+{
+    if (offset + sizeof(T) > end)
+        return false;
+
+    std::memcpy(&value, GetMappedData() + offset, sizeof(T));
+    return true;
+}
+
+template<class T>
+std::span<T const> GridTerrainData::MapArray(std::size_t offset, std::size_t end, std::size_t count)
+{
+    // The spans have exactly the size of the former fixed arrays, the lookups below index them in range
+    std::size_t const size = count * sizeof(T);
+    if (!count || offset + size > end)
+        return {};
+
+    char const* data = GetMappedData() + offset;
+    if (reinterpret_cast<std::uintptr_t>(data) % alignof(T) == 0)
+        return { reinterpret_cast<T const*>(data), count };
+
+    // Sections following 8 bit height data start at odd offsets, copy those instead of reading unaligned
+    std::unique_ptr<uint64[]>& copy = _unalignedCopies.emplace_back(std::make_unique<uint64[]>((size + sizeof(uint64) - 1) / sizeof(uint64)));
+    std::memcpy(copy.get(), data, size);
+    return { reinterpret_cast<T const*>(copy.get()), count };
+}
+
+bool GridTerrainData::LoadAreaData(uint32 const offset, uint32 const size)
 {
-    fileStream.seekg(offset);
+    std::size_t const end = GetSectionEnd(offset, size);
 
     map_areaHeader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.fourcc != MapAreaMagic.asUInt)
+    if (!ReadStruct(offset, end, header) || header.fourcc != MapAreaMagic.asUInt)
         return false;
 
     _loadedAreaData = std::make_unique<LoadedAreaData>();
     _loadedAreaData->gridArea = header.gridArea;
     if (!(header.flags & MAP_AREA_NO_AREA))
     {
-        _loadedAreaData->areaMap = std::make_unique<LoadedAreaData::AreaMapType>();
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedAreaData->areaMap.get()), sizeof(LoadedAreaData::AreaMapType)))
+        _loadedAreaData->areaMap = MapArray<uint16>(offset + sizeof(header), end, 16 * 16);
+        if (_loadedAreaData->areaMap.empty())
             return false;
     }
     return true;
 }
 
-bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const offset)
+bool GridTerrainData::LoadHeightData(uint32 const offset, uint32 const size)
 {
-    fileStream.seekg(offset);
+    std::size_t const end = GetSectionEnd(offset, size);
 
     map_heightHeader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.fourcc != MapHeightMagic.asUInt)
+    if (!ReadStruct(offset, end, header) || header.fourcc != MapHeightMagic.asUInt)
         return false;
 
+    std::size_t dataOffset = offset + sizeof(header);
+
     _loadedHeightData = std::make_unique<LoadedHeightData>();
     _loadedHeightData->gridHeight = header.gridHeight;
     if (!(header.flags & MAP_HEIGHT_NO_HEIGHT))
@@ -88,30 +162,36 @@ bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const off
         if ((header.flags & MAP_HEIGHT_AS_INT16))
         {
             _loadedHeightData->uint16HeightData = std::make_unique<LoadedHeightData::Uint16HeightData>();
-            if (!fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint16HeightData->v9), sizeof(_loadedHeightData->uint16HeightData->v9))
-                || !fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint16HeightData->v8), sizeof(_loadedHeightData->uint16HeightData->v8)))
+            _loadedHeightData->uint16HeightData->v9 = MapArray<uint16>(dataOffset, end, 129 * 129);
+            _loadedHeightData->uint16HeightData->v8 = MapArray<uint16>(dataOffset + _loadedHeightData->uint16HeightData->v9.size_bytes(), end, 128 * 128);
+            if (_loadedHeightData->uint16HeightData->v9.empty() || _loadedHeightData->uint16HeightData->v8.empty())
                 return false;
 
+            dataOffset += (129 * 129 + 128 * 128) * sizeof(uint16);
             _loadedHeightData->uint16HeightData->gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 65535;
             _gridGetHeight = &GridTerrainData::getHeightFromUint16;
         }
         else if ((header.flags & MAP_HEIGHT_AS_INT8))
         {
             _loadedHeightData->uint8HeightData = std::make_unique<LoadedHeightData::Uint8HeightData>();
-            if (!fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint8HeightData->v9), sizeof(_loadedHeightData->uint8HeightData->v9))
-                || !fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->uint8HeightData->v8), sizeof(_loadedHeightData->uint8HeightData->v8)))
+            _loadedHeightData->uint8HeightData->v9 = MapArray<uint8>(dataOffset, end, 129 * 129);
+            _loadedHeightData->uint8HeightData->v8 = MapArray<uint8>(dataOffset + _loadedHeightData->uint8HeightData->v9.size_bytes(), end, 128 * 128);
+            if (_loadedHeightData->uint8HeightData->v9.empty() || _loadedHeightData->uint8HeightData->v8.empty())
                 return false;
 
+            dataOffset += (129 * 129 + 128 * 128) * sizeof(uint8);
             _loadedHeightData->uint8HeightData->gridIntHeightMultiplier = (header.gridMaxHeight - header.gridHeight) / 255;
             _gridGetHeight = &GridTerrainData::getHeightFromUint8;
         }
         else
         {
             _loadedHeightData->floatHeightData = std::make_unique<LoadedHeightData::FloatHeightData>();
-            if (!fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->floatHeightData->v9), sizeof(_loadedHeightData->floatHeightData->v9))
-                || !fileStream.read(reinterpret_cast<char*>(&_loadedHeightData->floatHeightData->v8), sizeof(_loadedHeightData->floatHeightData->v8)))
+            _loadedHeightData->floatHeightData->v9 = MapArray<float>(dataOffset, end, 129 * 129);
+            _loadedHeightData->floatHeightData->v8 = MapArray<float>(dataOffset + _loadedHeightData->floatHeightData->v9.size_bytes(), end, 128 * 128);
+            if (_loadedHeightData->floatHeightData->v9.empty() || _loadedHeightData->floatHeightData->v8.empty())
                 return false;
 
+            dataOffset += (129 * 129 + 128 * 128) * sizeof(float);
             _gridGetHeight = &GridTerrainData::getHeightFromFloat;
         }
     }
@@ -122,8 +202,7 @@ bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const off
     {
         std::array<int16, 9> maxHeights;
         std::array<int16, 9> minHeights;
-        if (!fileStream.read(reinterpret_cast<char*>(maxHeights.data()), sizeof(maxHeights)) ||
-            !fileStream.read(reinterpret_cast<char*>(minHeights.data()), sizeof(minHeights)))
+        if (!ReadStruct(dataOffset, end, maxHeights) || !ReadStruct(dataOffset + sizeof(maxHeights), end, minHeights))
             return false;
 
         static uint32 constexpr indices[8][3] =
@@ -163,14 +242,16 @@ bool GridTerrainData::LoadHeightData(std::ifstream& fileStream, uint32 const off
     return true;
 }
 
-bool GridTerrainData::LoadLiquidData(std::ifstream& fileStream, uint32 const offset)
+bool GridTerrainData::LoadLiquidData(uint32 const offset, uint32 const size)
 {
-    fileStream.seekg(offset);
+    std::size_t const end = GetSectionEnd(offset, size);
 
     map_liquidHeader header;
-    if (!fileStream.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.fourcc != MapLiquidMagic.asUInt)
+    if (!ReadStruct(offset, end, header) || header.fourcc != MapLiquidMagic.asUInt)
         return false;
 
+    std::size_t dataOffset = offset + sizeof(header);
+
     _loadedLiquidData = std::make_unique<LoadedLiquidData>();
     _loadedLiquidData->liquidGlobalEntry = header.liquidType;
     _loadedLiquidData->liquidGlobalFlags = header.liquidFlags;
@@ -182,33 +263,27 @@ bool GridTerrainData::LoadLiquidData(std::ifstream& fileStream, uint32 const off
 
     if (!(header.flags & MAP_LIQUID_NO_TYPE))
     {
-        _loadedLiquidData->liquidEntry = std::make_unique<LoadedLiquidData::LiquidEntryType>();
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedLiquidData->liquidEntry.get()), sizeof(LoadedLiquidData::LiquidEntryType)))
-            return false;
-
-        _loadedLiquidData->liquidFlags = std::make_unique<LoadedLiquidData::LiquidFlagsType>();
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedLiquidData->liquidFlags.get()), sizeof(LoadedLiquidData::LiquidFlagsType)))
+        _loadedLiquidData->liquidEntry = MapArray<uint16>(dataOffset, end, 16 * 16);
+        dataOffset += 16 * 16 * sizeof(uint16);
+        _loadedLiquidData->liquidFlags = MapArray<uint8>(dataOffset, end, 16 * 16);
+        dataOffset += 16 * 16 * sizeof(uint8);
+        if (_loadedLiquidData->liquidEntry.empty() || _loadedLiquidData->liquidFlags.empty())
             return false;
     }
     if (!(header.flags & MAP_LIQUID_NO_HEIGHT))
     {
-        _loadedLiquidData->liquidMap = std::make_unique<LoadedLiquidData::LiquidMapType>();
-        _loadedLiquidData->liquidMap->resize(_loadedLiquidData->liquidWidth * _loadedLiquidData->liquidHeight);
-        if (!fileStream.read(reinterpret_cast<char*>(_loadedLiquidData->liquidMap->data()), _loadedLiquidData->liquidMap->size() * sizeof(float)))
+        _loadedLiquidData->liquidMap = MapArray<float>(dataOffset, end, _loadedLiquidData->liquidWidth * _loadedLiquidData->liquidHeight);
+        if (_loadedLiquidData->liquidMap.empty())
             return false;
     }
     return true;
 }
 
-bool GridTerrainData::LoadHolesData(std::ifstream& fileStream, uint32 const offset)
+bool GridTerrainData::LoadHolesData(uint32 const offset, uint32 const size)
 {
-    fileStream.seekg(offset);
-
     _loadedHoleData = std::make_unique<LoadedHoleData>();
-    if (!fileStream.read(reinterpret_cast<char*>(&_loadedHoleData->holes), sizeof(_loadedHoleData->holes)))
-        return false;
-
-    return true;
+    _loadedHoleData->holes = MapArray<uint16>(offset, GetSectionEnd(offset, size), 16 * 16);
+    return !_loadedHoleData->holes.empty();
 }
 
 uint16 GridTerrainData::getArea(float x, float y) const
@@ -216,14 +291,14 @@ uint16 GridTerrainData::getArea(float x, float y) const
     if (!_loadedAreaData)
         return 0;
 
-    if (!_loadedAreaData->areaMap)
+    if (_loadedAreaData->areaMap.empty())
         return _loadedAreaData->gridArea;
 
     x = 16 * (32 - x / SIZE_OF_GRIDS);
     y = 16 * (32 - y / SIZE_OF_GRIDS);
     int lx = (int)x & 15;
     int ly = (int)y & 15;
-    return _loadedAreaData->areaMap->at(lx * 16 + ly);
+    return _loadedAreaData->areaMap[lx * 16 + ly];
 }
 
 float GridTerrainData::getHeightFromFlat(float /*x*/, float /*y*/) const
@@ -338,7 +413,7 @@ float GridTerrainData::getHeightFromUint8(float x, float y) const
         return INVALID_HEIGHT;
 
     int32 a, b, c;
-    uint8* V9_h1_ptr = &_loadedHeightData->uint8HeightData->v9[x_int * 128 + x_int + y_int];
+    uint8 const* V9_h1_ptr = &_loadedHeightData->uint8HeightData->v9[x_int * 128 + x_int + y_int];
     if (x + y < 1)
     {
         if (x > y)
@@ -408,7 +483,7 @@ float GridTerrainData::getHeightFromUint16(float x, float y) const
         return INVALID_HEIGHT;
 
     int32 a, b, c;
-    uint16* V9_h1_ptr = &_loadedHeightData->uint16HeightData->v9[x_int * 128 + x_int + y_int];
+    uint16 const* V9_h1_ptr = &_loadedHeightData->uint16HeightData->v9[x_int * 128 + x_int + y_int];
     if (x + y < 1)
     {
         if (x > y)
@@ -509,7 +584,7 @@ float GridTerrainData::getLiquidLevel(float x, float y) const
     if (!_loadedLiquidData)
         return INVALID_HEIGHT;
 
-    if (!_loadedLiquidData->liquidMap)
+    if (_loadedLiquidData->liquidMap.empty())
         return _loadedLiquidData->liquidLevel;
 
     x = MAP_RESOLUTION * (32 - x / SIZE_OF_GRIDS);
@@ -523,7 +598,7 @@ float GridTerrainData::getLiquidLevel(float x, float y) const
     if (cy_int < 0 || cy_int >= _loadedLiquidData->liquidWidth)
         return INVALID_HEIGHT;
 
-    return _loadedLiquidData->liquidMap->at(cx_int * _loadedLiquidData->liquidWidth + cy_int);
+    return _loadedLiquidData->liquidMap[cx_int * _loadedLiquidData->liquidWidth + cy_int];
 }
 
 // Get water state on map
@@ -534,7 +609,7 @@ LiquidData const GridTerrainData::GetLiquidData(float x, float y, float z, float
         return liquidData;
 
     // Check water type (if no water return)
-    if (_loadedLiquidData->liquidGlobalFlags || _loadedLiquidData->liquidFlags)
+    if (_loadedLiquidData->liquidGlobalFlags || !_loadedLiquidData->liquidFlags.empty())
     {
         // Get cell
         float cx = MAP_RESOLUTION * (32 - x / SIZE_OF_GRIDS);
@@ -545,8 +620,8 @@ LiquidData const GridTerrainData::GetLiquidData(float x, float y, float z, float
 
         // Check water type in cell
         int idx = (x_int >> 3) * 16 + (y_int >> 3);
-        uint8 type = _loadedLiquidData->liquidFlags ? _loadedLiquidData->liquidFlags->at(idx) : _loadedLiquidData->liquidGlobalFlags;
-        uint32 entry = _loadedLiquidData->liquidEntry ? _loadedLiquidData->liquidEntry->at(idx) : _loadedLiquidData->liquidGlobalEntry;
+        uint8 type = !_loadedLiquidData->liquidFlags.empty() ? _loadedLiquidData->liquidFlags[idx] : _loadedLiquidData->liquidGlobalFlags;
+        uint32 entry = !_loadedLiquidData->liquidEntry.empty() ? _loadedLiquidData->liquidEntry[idx] : _loadedLiquidData->liquidGlobalEntry;
         if (LiquidTypeEntry const* liquidEntry = sLiquidTypeStore.LookupEntry(entry))
         {
             type &= MAP_LIQUID_TYPE_DARK_WATER;
@@ -584,7 +659,7 @@ LiquidData const GridTerrainData::GetLiquidData(float x, float y, float z, float
             if (lx_int >= 0 && lx_int < _loadedLiquidData->liquidHeight && ly_int >= 0 && ly_int < _loadedLiquidData->liquidWidth)
             {
                 // Get water level
-                float liquid_level = _loadedLiquidData->liquidMap ? _loadedLiquidData->liquidMap->at(lx_int * _loadedLiquidData->liquidWidth + ly_int) : _loadedLiquidData->liquidLevel;
+                float liquid_level = !_loadedLiquidData->liquidMap.empty() ? _loadedLiquidData->liquidMap[lx_int * _loadedLiquidData->liquidWidth + ly_int] : _loadedLiquidData->liquidLevel;
                 // Get ground level
                 float ground_level = getHeight(x, y);
 
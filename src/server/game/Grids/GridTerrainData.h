@@ -19,9 +19,17 @@
 #define GRID_TERRAIN_DATA_H
 
 #include "Common.h"
+#include <array>
 #include <fstream>
 #include <G3D/Plane.h>
 #include <memory>
+#include <span>
+#include <vector>
+
+namespace boost::interprocess
+{
+    class mapped_region;
+}
 
 #define MAX_HEIGHT            100000.0f                     // can be use for find ground height at surface
 #define INVALID_HEIGHT       -100000.0f                     // for check, must be equal to VMAP_INVALID_HEIGHT, real value for unknown height is VMAP_INVALID_HEIGHT_VALUE
@@ -113,12 +121,12 @@ struct map_liquidHeader
 // Loaded map data structures
 // ******************************************
 
+// Tables are views into the memory mapped .map file, see GridTerrainData::MapArray
+
 struct LoadedAreaData
 {
-    typedef std::array<uint16, 16 * 16> AreaMapType;
-
     uint16 gridArea;
-    std::unique_ptr<AreaMapType> areaMap;
+    std::span<uint16 const> areaMap;                // 16 * 16
 };
 
 struct LoadedHeightData
@@ -127,31 +135,22 @@ struct LoadedHeightData
 
     struct Uint16HeightData
     {
-        typedef std::array<uint16, 129 * 129> V9Type;
-        typedef std::array<uint16, 128 * 128> V8Type;
-
-        V9Type v9;
-        V8Type v8;
+        std::span<uint16 const> v9;                 // 129 * 129
+        std::span<uint16 const> v8;                 // 128 * 128
         float gridIntHeightMultiplier;
     };
 
     struct Uint8HeightData
     {
-        typedef std::array<uint8, 129 * 129> V9Type;
-        typedef std::array<uint8, 128 * 128> V8Type;
-
-        V9Type v9;
-        V8Type v8;
+        std::span<uint8 const> v9;                  // 129 * 129
+        std::span<uint8 const> v8;                  // 128 * 128
         float gridIntHeightMultiplier;
     };
 
     struct FloatHeightData
     {
-        typedef std::array<float, 129 * 129> V9Type;
-        typedef std::array<float, 128 * 128> V8Type;
-
-        V9Type v9;
-        V8Type v8;
+        std::span<float const> v9;                  // 129 * 129
+        std::span<float const> v8;                  // 128 * 128
     };
 
     float gridHeight;
@@ -163,10 +162,6 @@ struct LoadedHeightData
 
 struct LoadedLiquidData
 {
-    typedef std::array<uint16, 16 * 16> LiquidEntryType;
-    typedef std::array<uint8, 16 * 16> LiquidFlagsType;
-    typedef std::vector<float> LiquidMapType;
-
     uint16 liquidGlobalEntry;
     uint8 liquidGlobalFlags;
     uint8 liquidOffX;
@@ -174,16 +169,14 @@ struct LoadedLiquidData
     uint8 liquidWidth;
     uint8 liquidHeight;
     float liquidLevel;
-    std::unique_ptr<LiquidEntryType> liquidEntry;
-    std::unique_ptr<LiquidFlagsType> liquidFlags;
-    std::unique_ptr<LiquidMapType> liquidMap;
+    std::span<uint16 const> liquidEntry;            // 16 * 16
+    std::span<uint8 const> liquidFlags;             // 16 * 16
+    std::span<float const> liquidMap;               // liquidWidth * liquidHeight
 };
 
 struct LoadedHoleData
 {
-    typedef std::array<uint16, 16 * 16> HolesType;
-
-    HolesType holes;
+    std::span<uint16 const> holes;                  // 16 * 16
 };
 
 enum LiquidStatus
@@ -220,10 +213,22 @@ enum class TerrainMapDataReadResult
 
 class GridTerrainData
 {
-    bool LoadAreaData(std::ifstream& fileStream, uint32 const offset);
-    bool LoadHeightData(std::ifstream& fileStream, uint32 const offset);
-    bool LoadLiquidData(std::ifstream& fileStream, uint32 const offset);
-    bool LoadHolesData(std::ifstream& fileStream, uint32 const offset);
+    bool LoadAreaData(uint32 const offset, uint32 const size);
+    bool LoadHeightData(uint32 const offset, uint32 const size);
+    bool LoadLiquidData(uint32 const offset, uint32 const size);
+    bool LoadHolesData(uint32 const offset, uint32 const size);
+
+    char const* GetMappedData() const;
+    std::size_t GetSectionEnd(uint32 const offset, uint32 const size) const;
+    template<class T>
+    bool ReadStruct(std::size_t offset, std::size_t end, T& value) const;
+    template<class T>
+    std::span<T const> MapArray(std::size_t offset, std::size_t end, std::size_t count);
+
+    // The file stays mapped while the grid exists, pages are read in by the OS on first access.
+    // No file handle is kept open, so loaded grids do not count against the descriptor limit
+    std::unique_ptr<boost::interprocess::mapped_region> _region;
+    std::vector<std::unique_ptr<uint64[]>> _unalignedCopies;
 
     std::unique_ptr<LoadedAreaData> _loadedAreaData;
     std::unique_ptr<LoadedHeightData> _loadedHeightData;
@@ -242,9 +247,15 @@ class GridTerrainData
 
 public:
     GridTerrainData();
-    ~GridTerrainData() { };
+    ~GridTerrainData();
     TerrainMapDataReadResult Load(std::string const& mapFileName);
 
+    /// Size of the mapped .map file
+    [[nodiscard]] std::size_t GetMappedSize() const;
+
+    /// Touches every page of the mapped file so it is resident before the first lookup
+    void PageIn() const;
+
     uint16 getArea(float x, float y) const;
     inline float getHeight(float x, float y) const { return (this->*_gridGetHeight)(x, y); }
     float getMinHeight(float x, float y) const;
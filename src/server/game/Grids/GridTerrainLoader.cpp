@@ -1,5 +1,7 @@
 #include "DisableMgr.h"
+#include "GridPreloader.h"
 #include "GridTerrainLoader.h"
+#include "GridTerrainStore.h"
 #include "MMapFactory.h"
 #include "MMapMgr.h"
 #include "ScriptMgr.h"
@@ -29,17 +31,20 @@ void GridTerrainLoader::LoadMap()
         return;
     }
 
-    // map file name
-    std::string const mapFileName = Acore::StringFormat("{}maps/{:03}{:02}{:02}.map", sWorld->GetDataPath(), _map->GetId(), _grid.GetX(), _grid.GetY());
+    // loading data, prepared by the GridPreloader if a player was heading here
+    std::shared_ptr<GridTerrainData> terrainData;
+    TerrainMapDataReadResult loadResult;
+    bool const prefetched = sGridPreloader->TakeTerrainData(_map->GetId(), _grid.GetX(), _grid.GetY(), terrainData, loadResult);
+    if (!prefetched)
+        terrainData = sGridTerrainStore->Get(_map->GetId(), _grid.GetX(), _grid.GetY(), loadResult);
 
-    // loading data
-    LOG_DEBUG("maps", "Loading map {}", mapFileName);
-    std::unique_ptr<GridTerrainData> terrainData = std::make_unique<GridTerrainData>();
-    TerrainMapDataReadResult loadResult = terrainData->Load(mapFileName);
-    if (loadResult == TerrainMapDataReadResult::Success)
+    sGridPreloader->CountGridLoad(prefetched);
+
+    if (terrainData)
         _grid.SetTerrainData(std::move(terrainData));
     else
     {
+        std::string const mapFileName = Acore::StringFormat("{}maps/{:03}{:02}{:02}.map", sWorld->GetDataPath(), _map->GetId(), _grid.GetX(), _grid.GetY());
         if (loadResult == TerrainMapDataReadResult::InvalidMagic)
             LOG_ERROR("maps", "Map file '{}' is from an incompatible clientversion. Please recreate using the mapextractor.", mapFileName);
         else
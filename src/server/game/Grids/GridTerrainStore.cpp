@@ -0,0 +1,133 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "GridTerrainStore.h"
+#include "Log.h"
+#include "StringConvert.h"
+#include "StringFormat.h"
+#include "Tokenize.h"
+#include "World.h"
+
+GridTerrainStore* GridTerrainStore::instance()
+{
+    static GridTerrainStore instance;
+    return &instance;
+}
+
+void GridTerrainStore::Initialize()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    _dataPath = sWorld->GetDataPath();
+    _pinnedMaps.clear();
+    _pinnedGrids.clear();
+
+    std::string pinnedMaps(sWorld->getStringConfig(CONFIG_TERRAIN_PINNED_MAPS));
+    for (std::string_view mapId : Acore::Tokenize(pinnedMaps, ',', false))
+        if (Optional<uint32> id = Acore::StringTo<uint32>(mapId))
+            _pinnedMaps.insert(*id);
+}
+
+std::shared_ptr<GridTerrainData> GridTerrainStore::Get(uint32 mapId, uint32 gridX, uint32 gridY, TerrainMapDataReadResult& result)
+{
+    uint32 const key = MakeKey(mapId, gridX, gridY);
+
+    std::promise<LoadResult> loadPromise;
+    std::shared_future<LoadResult> pendingLoad;
+    bool loader = false;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+
+        auto itr = _grids.find(key);
+        if (itr != _grids.end())
+        {
+            if (std::shared_ptr<GridTerrainData> terrainData = itr->second.lock())
+            {
+                result = TerrainMapDataReadResult::Success;
+                return terrainData;
+            }
+        }
+
+        // Another thread is already reading this grid, wait for it instead of opening the file twice
+        auto loading = _loadingGrids.find(key);
+        if (loading != _loadingGrids.end())
+            pendingLoad = loading->second;
+        else
+        {
+            pendingLoad = loadPromise.get_future().share();
+            _loadingGrids[key] = pendingLoad;
+            loader = true;
+        }
+    }
+
+    if (!loader)
+    {
+        LoadResult const& loaded = pendingLoad.get();
+        result = loaded.second;
+        return loaded.first;
+    }
+
+    // Opening and mapping the file happens outside the lock so loads of other grids are not held up by it
+    std::string const mapFileName = Acore::StringFormat("{}maps/{:03}{:02}{:02}.map", _dataPath, mapId, gridX, gridY);
+    LOG_DEBUG("maps", "Loading map {}", mapFileName);
+
+    std::shared_ptr<GridTerrainData> terrainData = std::make_shared<GridTerrainData>();
+    result = terrainData->Load(mapFileName);
+    if (result != TerrainMapDataReadResult::Success)
+        terrainData.reset();
+
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+
+        if (terrainData)
+        {
+            _grids[key] = terrainData;
+            if (IsPinned(mapId))
+                _pinnedGrids[key] = terrainData;
+        }
+        else
+            _grids.erase(key);
+
+        _loadingGrids.erase(key);
+    }
+
+    loadPromise.set_value({ terrainData, result });
+
+    if (terrainData && IsPinned(mapId))
+        terrainData->PageIn();
+
+    return terrainData;
+}
+
+void GridTerrainStore::GetStats(uint32& gridCount, uint64& mappedBytes)
+{
+    gridCount = 0;
+    mappedBytes = 0;
+
+    std::lock_guard<std::mutex> guard(_lock);
+    for (auto itr = _grids.begin(); itr != _grids.end();)
+    {
+        if (std::shared_ptr<GridTerrainData> terrainData = itr->second.lock())
+        {
+            ++gridCount;
+            mappedBytes += terrainData->GetMappedSize();
+            ++itr;
+        }
+        else
+            itr = _grids.erase(itr);
+    }
+}
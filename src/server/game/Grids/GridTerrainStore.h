@@ -0,0 +1,70 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_GRID_TERRAIN_STORE_H
+#define ACORE_GRID_TERRAIN_STORE_H
+
+#include "Define.h"
+#include "GridTerrainData.h"
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+/**
+ * Process wide cache of memory mapped grid terrain keyed by map id and grid coordinates.
+ *
+ * Every grid of a map id shares one read-only GridTerrainData for as long as any map (or the
+ * GridPreloader) holds it, so reloading a grid or creating another instance does not read the
+ * .map file again. Grids of pinned maps are kept mapped and resident once loaded.
+ */
+class AC_GAME_API GridTerrainStore
+{
+public:
+    static GridTerrainStore* instance();
+
+    void Initialize();
+
+    /// Returns the terrain of a grid, loading it if no map holds it at the moment. Thread safe
+    std::shared_ptr<GridTerrainData> Get(uint32 mapId, uint32 gridX, uint32 gridY, TerrainMapDataReadResult& result);
+
+    [[nodiscard]] bool IsPinned(uint32 mapId) const { return _pinnedMaps.count(mapId) > 0; }
+
+    /// Number of grids currently mapped and the total size of their files
+    void GetStats(uint32& gridCount, uint64& mappedBytes);
+
+private:
+    GridTerrainStore() = default;
+    ~GridTerrainStore() = default;
+
+    static uint32 MakeKey(uint32 mapId, uint32 gridX, uint32 gridY) { return (mapId << 16) | (gridX << 8) | gridY; }
+
+    using LoadResult = std::pair<std::shared_ptr<GridTerrainData>, TerrainMapDataReadResult>;
+
+    std::string _dataPath;
+    std::unordered_set<uint32> _pinnedMaps;
+    std::unordered_map<uint32 /*key*/, std::weak_ptr<GridTerrainData>> _grids;
+    std::unordered_map<uint32 /*key*/, std::shared_ptr<GridTerrainData>> _pinnedGrids;
+    std::unordered_map<uint32 /*key*/, std::shared_future<LoadResult>> _loadingGrids; // grids being loaded outside the lock
+    std::mutex _lock;
+};
+
+#define sGridTerrainStore GridTerrainStore::instance()
+
+#endif
@@ -71,11 +71,9 @@ void VisibleNotifier::SendToSelf()
 
     for (GuidUnorderedSet::const_iterator it = vis_guids.begin(); it != vis_guids.end(); ++it)
     {
-        if (WorldObject* obj = ObjectAccessor::GetWorldObject(i_player, *it))
-        {
-            if (i_largeOnly != obj->IsVisibilityOverridden())
-                continue;
-        }
+        WorldObject* obj = ObjectAccessor::GetWorldObject(i_player, *it);
+        if (obj && i_largeOnly != obj->IsVisibilityOverridden())
+            continue;
 
         // pussywizard: static transports are removed only in RemovePlayerFromMap and here if can no longer detect (eg. phase changed)
         if ((*it).IsTransport())
@@ -83,6 +81,9 @@ void VisibleNotifier::SendToSelf()
                 if (i_player.CanSeeOrDetect(staticTrans, false, true))
                     continue;
 
+        if (obj)
+            obj->RemoveObserver(&i_player);
+
         i_player.m_clientGUIDs.erase(*it);
         i_data.AddOutOfRangeGUID(*it);
 
@@ -100,6 +100,7 @@ namespace Acore
     {
         WorldObject const* i_source;
         WorldPacket const* i_message;
+        SharedWorldPacketPtr i_sharedMessage;   // payload queued on every recipient socket, created by the first one
         uint32 i_phaseMask;
         float i_distSq;
         TeamId teamId;
@@ -125,7 +126,7 @@ namespace Acore
             if (!player->HaveAtClient(i_source))
                 return;
 
-            player->GetSession()->SendPacket(i_message);
+            player->GetSession()->SendPacket(i_message, i_sharedMessage);
         }
     };
 
@@ -133,6 +134,7 @@ namespace Acore
     {
         Unit* i_source;
         WorldPacket* i_message;
+        SharedWorldPacketPtr i_sharedMessage;
         uint32 i_phaseMask;
         float i_distSq;
         MessageDistDelivererToHostile(Unit* src, WorldPacket* msg, float dist)
@@ -150,7 +152,7 @@ namespace Acore
             if (player == i_source || !player->HaveAtClient(i_source) || player->IsFriendlyTo(i_source))
                 return;
 
-            player->GetSession()->SendPacket(i_message);
+            player->GetSession()->SendPacket(i_message, i_sharedMessage);
         }
     };
 
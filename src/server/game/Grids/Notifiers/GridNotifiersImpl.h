@@ -534,6 +534,13 @@ void Acore::PlayerLastSearcher<Check>::Visit(PlayerMapType& m)
 template<class Builder>
 void Acore::LocalizedPacketDo<Builder>::operator()(Player* p)
 {
+    // do not build a locale nobody reads
+    if (p->GetSession()->CanSkipPacketBuild())
+    {
+        WorldSession::CountHeadlessPacketAvoided();
+        return;
+    }
+
     LocaleConstant loc_idx = p->GetSession()->GetSessionDbLocaleIndex();
     uint32 cache_idx = loc_idx + 1;
     WorldPacket* data;
@@ -559,6 +566,13 @@ void Acore::LocalizedPacketDo<Builder>::operator()(Player* p)
 template<class Builder>
 void Acore::LocalizedPacketListDo<Builder>::operator()(Player* p)
 {
+    // do not build a locale nobody reads
+    if (p->GetSession()->CanSkipPacketBuild())
+    {
+        WorldSession::CountHeadlessPacketAvoided();
+        return;
+    }
+
     LocaleConstant loc_idx = p->GetSession()->GetSessionDbLocaleIndex();
     uint32 cache_idx = loc_idx + 1;
     WorldPacketList* data_list;
@@ -33,6 +33,7 @@
 #include "Player.h"
 #include "ScriptMgr.h"
 #include "SocialMgr.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WorldSession.h"
 #include <boost/iterator/counting_iterator.hpp>
@@ -181,7 +182,7 @@ void Guild::EventLogEntry::SaveToDB(CharacterDatabaseTransaction trans) const
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GUILD_EVENTLOG);
     stmt->SetData(0, m_guildId);
     stmt->SetData(1, m_guid);
-    CharacterDatabase.ExecuteOrAppend(trans, stmt);
+    CharacterDatabase.ExecuteOrAppend(trans, stmt, Guild::GetShardKey(m_guildId));
 
     uint8 index = 0;
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_GUILD_EVENTLOG);
@@ -192,7 +193,7 @@ void Guild::EventLogEntry::SaveToDB(CharacterDatabaseTransaction trans) const
     stmt->SetData(++index, m_playerGuid2.GetCounter());
     stmt->SetData (++index, m_newRank);
     stmt->SetData(++index, m_timestamp);
-    CharacterDatabase.ExecuteOrAppend(trans, stmt);
+    CharacterDatabase.ExecuteOrAppend(trans, stmt, Guild::GetShardKey(m_guildId));
 }
 
 void Guild::EventLogEntry::WritePacket(WorldPackets::Guild::GuildEventLogQueryResults& packet) const
@@ -218,7 +219,7 @@ void Guild::BankEventLogEntry::SaveToDB(CharacterDatabaseTransaction trans) cons
     stmt->SetData(  index, m_guildId);
     stmt->SetData(++index, m_guid);
     stmt->SetData (++index, m_bankTabId);
-    CharacterDatabase.ExecuteOrAppend(trans, stmt);
+    CharacterDatabase.ExecuteOrAppend(trans, stmt, Guild::GetShardKey(m_guildId));
 
     index = 0;
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_GUILD_BANK_EVENTLOG);
@@ -231,7 +232,7 @@ void Guild::BankEventLogEntry::SaveToDB(CharacterDatabaseTransaction trans) cons
     stmt->SetData(++index, m_itemStackCount);
     stmt->SetData (++index, m_destTabId);
     stmt->SetData(++index, m_timestamp);
-    CharacterDatabase.ExecuteOrAppend(trans, stmt);
+    CharacterDatabase.ExecuteOrAppend(trans, stmt, Guild::GetShardKey(m_guildId));
 }
 
 void Guild::BankEventLogEntry::WritePacket(WorldPackets::Guild::GuildBankLogQueryResults& packet) const
@@ -280,7 +281,7 @@ void Guild::RankInfo::SaveToDB(CharacterDatabaseTransaction trans) const
     stmt->SetData(2, m_name);
     stmt->SetData(3, m_rights);
     stmt->SetData(4, m_bankMoneyPerDay);
-    CharacterDatabase.ExecuteOrAppend(trans, stmt);
+    CharacterDatabase.ExecuteOrAppend(trans, stmt, Guild::GetShardKey(m_guildId));
 }
 
 void Guild::RankInfo::CreateMissingTabsIfNeeded(uint8 tabs, CharacterDatabaseTransaction trans, bool logOnCreate /* = false */)
@@ -319,7 +320,7 @@ void Guild::RankInfo::SetName(std::string_view name)
     stmt->SetData(0, m_name);
     stmt->SetData (1, m_rankId);
     stmt->SetData(2, m_guildId);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, Guild::GetShardKey(m_guildId));
 }
 
 void Guild::RankInfo::SetRights(uint32 rights)
@@ -336,7 +337,7 @@ void Guild::RankInfo::SetRights(uint32 rights)
     stmt->SetData(0, m_rights);
     stmt->SetData (1, m_rankId);
     stmt->SetData(2, m_guildId);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, Guild::GetShardKey(m_guildId));
 }
 
 void Guild::RankInfo::SetBankMoneyPerDay(uint32 money)
@@ -353,7 +354,7 @@ void Guild::RankInfo::SetBankMoneyPerDay(uint32 money)
     stmt->SetData(0, money);
     stmt->SetData (1, m_rankId);
     stmt->SetData(2, m_guildId);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, Guild::GetShardKey(m_guildId));
 }
 
 void Guild::RankInfo::SetBankTabSlotsAndRights(GuildBankRightsAndSlots rightsAndSlots, bool saveToDB)
@@ -372,7 +373,7 @@ void Guild::RankInfo::SetBankTabSlotsAndRights(GuildBankRightsAndSlots rightsAnd
         stmt->SetData (2, m_rankId);
         stmt->SetData (3, guildBR.GetRights());
         stmt->SetData(4, guildBR.GetSlots());
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, Guild::GetShardKey(m_guildId));
     }
 }
 
@@ -411,7 +412,7 @@ bool Guild::BankTab::LoadItemFromDB(Field* fields)
         stmt->SetData(0, m_guildId);
         stmt->SetData (1, m_tabId);
         stmt->SetData (2, slotId);
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, Guild::GetShardKey(m_guildId));
 
         delete pItem;
         return false;
@@ -449,7 +450,7 @@ void Guild::BankTab::SetInfo(std::string_view name, std::string_view icon)
     stmt->SetData(1, m_icon);
     stmt->SetData(2, m_guildId);
     stmt->SetData (3, m_tabId);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, Guild::GetShardKey(m_guildId));
 }
 
 void Guild::BankTab::SetText(std::string_view text)
@@ -464,7 +465,7 @@ void Guild::BankTab::SetText(std::string_view text)
     stmt->SetData(0, m_text);
     stmt->SetData(1, m_guildId);
     stmt->SetData (2, m_tabId);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, Guild::GetShardKey(m_guildId));
 }
 
 // Sets/removes contents of specified slot.
@@ -480,7 +481,7 @@ bool Guild::BankTab::SetItem(CharacterDatabaseTransaction trans, uint8 slotId, I
     stmt->SetData(0, m_guildId);
     stmt->SetData (1, m_tabId);
     stmt->SetData (2, slotId);
-    CharacterDatabase.ExecuteOrAppend(trans, stmt);
+    CharacterDatabase.ExecuteOrAppend(trans, stmt, Guild::GetShardKey(m_guildId));
 
     if (item)
     {
@@ -489,7 +490,7 @@ bool Guild::BankTab::SetItem(CharacterDatabaseTransaction trans, uint8 slotId, I
         stmt->SetData (1, m_tabId);
         stmt->SetData (2, slotId);
         stmt->SetData(3, item->GetGUID().GetCounter());
-        CharacterDatabase.ExecuteOrAppend(trans, stmt);
+        CharacterDatabase.ExecuteOrAppend(trans, stmt, Guild::GetShardKey(m_guildId));
 
         item->SetGuidValue(ITEM_FIELD_CONTAINED, ObjectGuid::Empty);
         item->SetGuidValue(ITEM_FIELD_OWNER, ObjectGuid::Empty);
@@ -549,7 +550,7 @@ void Guild::Member::SetPublicNote(std::string_view publicNote)
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_MEMBER_PNOTE);
     stmt->SetData(0, m_publicNote);
     stmt->SetData(1, m_guid.GetCounter());
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, Guild::GetShardKey(m_guildId));
 }
 
 void Guild::Member::SetOfficerNote(std::string_view officerNote)
@@ -562,7 +563,7 @@ void Guild::Member::SetOfficerNote(std::string_view officerNote)
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_MEMBER_OFFNOTE);
     stmt->SetData(0, m_officerNote);
     stmt->SetData(1, m_guid.GetCounter());
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, Guild::GetShardKey(m_guildId));
 }
 
 void Guild::Member::ChangeRank(uint8 newRank)
@@ -576,7 +577,7 @@ void Guild::Member::ChangeRank(uint8 newRank)
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_MEMBER_RANK);
     stmt->SetData (0, newRank);
     stmt->SetData(1, m_guid.GetCounter());
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, Guild::GetShardKey(m_guildId));
 }
 
 void Guild::Member::UpdateLogoutTime()
@@ -592,7 +593,7 @@ void Guild::Member::SaveToDB(CharacterDatabaseTransaction trans) const
     stmt->SetData (2, m_rankId);
     stmt->SetData(3, m_publicNote);
     stmt->SetData(4, m_officerNote);
-    CharacterDatabase.ExecuteOrAppend(trans, stmt);
+    CharacterDatabase.ExecuteOrAppend(trans, stmt, Guild::GetShardKey(m_guildId));
 }
 
 // Loads member's data from database.
@@ -658,7 +659,7 @@ void Guild::Member::UpdateBankWithdrawValue(CharacterDatabaseTransaction trans,
         stmt->SetData(i, withdraw);
     }
 
-    CharacterDatabase.ExecuteOrAppend(trans, stmt);
+    CharacterDatabase.ExecuteOrAppend(trans, stmt, Guild::GetShardKey(m_guildId));
 }
 
 void Guild::Member::ResetValues()
@@ -707,7 +708,7 @@ void EmblemInfo::SaveToDB(uint32 guildId) const
     stmt->SetData(3, m_borderColor);
     stmt->SetData(4, m_backgroundColor);
     stmt->SetData(5, guildId);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, Guild::GetShardKey(guildId));
 }
 
 // MoveItemData
@@ -1089,7 +1090,7 @@ bool Guild::Create(Player* pLeader, std::string_view name)
     stmt->SetData(++index, m_bankMoney);
     trans->Append(stmt);
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetShardKey(m_id));
     _CreateDefaultGuildRanks(pLeaderSession->GetSessionDbLocaleIndex()); // Create default ranks
     bool ret = AddMember(m_leaderGuid, GR_GUILDMASTER);                  // Add guildmaster
 
@@ -1151,7 +1152,7 @@ void Guild::Disband()
     stmt->SetData(0, m_id);
     trans->Append(stmt);
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetShardKey(m_id));
     sGuildMgr->RemoveGuild(m_id);
 }
 
@@ -1196,7 +1197,13 @@ bool Guild::SetName(std::string_view const& name)
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_NAME);
     stmt->SetData(0, m_name);
     stmt->SetData(1, GetId());
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, GetShardKey(m_id));
+
+    // the who list keeps its own copy of the guild name
+    for (auto& [guid, member] : m_members)
+        if (member.IsOnline())
+            sWhoListCacheMgr->ScheduleUpdate(member.GetGUID());
+
     return true;
 }
 
@@ -1286,7 +1293,7 @@ void Guild::HandleSetMOTD(WorldSession* session, std::string_view motd)
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_MOTD);
         stmt->SetData(0, m_motd);
         stmt->SetData(1, m_id);
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, GetShardKey(m_id));
 
         _BroadcastEvent(GE_MOTD, ObjectGuid::Empty, m_motd);
     }
@@ -1307,7 +1314,7 @@ void Guild::HandleSetInfo(WorldSession* session, std::string_view info)
         CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_INFO);
         stmt->SetData(0, m_info);
         stmt->SetData(1, m_id);
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, GetShardKey(m_id));
     }
 }
 
@@ -1677,12 +1684,12 @@ void Guild::HandleRemoveRank(WorldSession* session, uint8 rankId)
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GUILD_BANK_RIGHTS_FOR_RANK);
     stmt->SetData(0, m_id);
     stmt->SetData(1, rankId);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, GetShardKey(m_id));
     // Delete rank
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GUILD_LOWEST_RANK);
     stmt->SetData(0, m_id);
     stmt->SetData(1, rankId);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, GetShardKey(m_id));
 
     // match what the sql statement does
     m_ranks.erase(m_ranks.begin() + rankId, m_ranks.end());
@@ -1710,7 +1717,7 @@ void Guild::HandleMemberDepositMoney(WorldSession* session, uint32 amount)
     player->SaveGoldToDB(trans);
     _LogBankEvent(trans, GUILD_BANK_LOG_DEPOSIT_MONEY, uint8(0), player->GetGUID(), amount);
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetShardKey(m_id), player->GetGUID().GetCounter());
 
     std::string aux = Acore::Impl::ByteArrayToHexStr(reinterpret_cast<uint8*>(&m_bankMoney), 8, true);
     _BroadcastEvent(GE_BANK_MONEY_SET, ObjectGuid::Empty, aux.c_str());
@@ -1760,7 +1767,7 @@ bool Guild::HandleMemberWithdrawMoney(WorldSession* session, uint32 amount, bool
 
     // Log guild bank event
     _LogBankEvent(trans, repair ? GUILD_BANK_LOG_REPAIR_MONEY : GUILD_BANK_LOG_WITHDRAW_MONEY, uint8(0), player->GetGUID(), amount);
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetShardKey(m_id), player->GetGUID().GetCounter());
 
     if (amount > 10 * GOLD)     // sender_acc = 0 (guild has no account), sender_guid = Guild id, sender_name = Guild name
         CharacterDatabase.Execute("INSERT INTO log_money VALUES({}, {}, \"{}\", \"{}\", {}, \"{}\", {}, \"(guild, members: {}, new amount: {}, leader guid low: {}, withdrawer level: {})\", NOW(), {})",
@@ -2099,7 +2106,7 @@ bool Guild::Validate()
             {
                 CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
                 rankInfo->CreateMissingTabsIfNeeded(_GetPurchasedTabsSize(), trans, true);
-                CharacterDatabase.CommitTransaction(trans);
+                CharacterDatabase.CommitTransaction(trans, GetShardKey(m_id));
             }
         }
     }
@@ -2363,7 +2370,7 @@ bool Guild::ChangeMemberRank(ObjectGuid guid, uint8 newRank)
                 CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_LEADER);
                 stmt->SetData(0, m_leaderGuid.GetCounter());
                 stmt->SetData(1, m_id);
-                CharacterDatabase.Execute(stmt);
+                CharacterDatabase.Execute(stmt, GetShardKey(m_id));
             }
 
             return true;
@@ -2431,18 +2438,18 @@ void Guild::_CreateNewBankTab()
     for (auto& m_rank : m_ranks)
         m_rank.CreateMissingTabsIfNeeded(tabId, trans, false);
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetShardKey(m_id));
 }
 
 void Guild::_CreateDefaultGuildRanks(LocaleConstant loc)
 {
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GUILD_RANKS);
     stmt->SetData(0, m_id);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, GetShardKey(m_id));
 
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GUILD_BANK_RIGHTS);
     stmt->SetData(0, m_id);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, GetShardKey(m_id));
 
     _CreateRank(sObjectMgr->GetAcoreString(LANG_GUILD_MASTER,   loc), GR_RIGHT_ALL);
     _CreateRank(sObjectMgr->GetAcoreString(LANG_GUILD_OFFICER,  loc), GR_RIGHT_ALL);
@@ -2464,7 +2471,7 @@ bool Guild::_CreateRank(std::string_view name, uint32 rights)
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     info.CreateMissingTabsIfNeeded(_GetPurchasedTabsSize(), trans);
     info.SaveToDB(trans);
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetShardKey(m_id));
 
     return true;
 }
@@ -2529,7 +2536,7 @@ void Guild::_SetLeaderGUID(Member& pLeader)
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_GUILD_LEADER);
     stmt->SetData(0, m_leaderGuid.GetCounter());
     stmt->SetData(1, m_id);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, GetShardKey(m_id));
 }
 
 void Guild::_SetRankBankMoneyPerDay(uint8 rankId, uint32 moneyPerDay)
@@ -2653,7 +2660,7 @@ inline void Guild::_LogEvent(GuildEventLogTypes eventType, ObjectGuid playerGuid
 {
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     m_eventLog.AddEvent(trans, m_id, m_eventLog.GetNextGUID(), eventType, playerGuid1, playerGuid2, newRank);
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetShardKey(m_id));
 
     sScriptMgr->OnGuildEvent(this, uint8(eventType), playerGuid1.GetCounter(), playerGuid2.GetCounter(), newRank);
 }
@@ -2786,7 +2793,7 @@ bool Guild::_DoItemsMove(MoveItemData* pSrc, MoveItemData* pDest, bool sendError
     if (swap)
         pSrc->StoreItem(trans, pDestItem);
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, GetShardKey(m_id), pSrc->GetPlayer()->GetGUID().GetCounter());
     return true;
 }
 
@@ -621,6 +621,7 @@ private:
         Item* GetItem(bool isCloned = false) const { return isCloned ? m_pClonedItem : m_pItem; }
         uint8 GetContainer() const { return m_container; }
         uint8 GetSlotId() const { return m_slotId; }
+        Player* GetPlayer() const { return m_pPlayer; }
 
     protected:
         virtual InventoryResult CanStore(Item* pItem, bool swap) = 0;
@@ -685,6 +686,8 @@ public:
 
     // Getters
     uint32 GetId() const { return m_id; }
+    // Key that orders async writes to the rows of one guild, see DatabaseShardKeyType
+    static uint64 GetShardKey(uint32 guildId) { return MakeDatabaseShardKey(DatabaseShardKeyType::Guild, guildId); }
     ObjectGuid GetLeaderGUID() const { return m_leaderGuid; }
     std::string const& GetName() const { return m_name; }
     std::string const& GetMOTD() const { return m_motd; }
@@ -317,7 +317,7 @@ void WorldSession::HandleAuctionSellItem(WorldPacket& recvData)
             item->SaveToDB(trans);
             AH->SaveToDB(trans);
             _player->SaveInventoryAndGoldToDB(trans);
-            CharacterDatabase.CommitTransaction(trans);
+            CharacterDatabase.CommitTransaction(trans, AH->GetShardKey(), _player->GetGUID().GetCounter());
 
             SendAuctionCommandResult(AH->Id, AUCTION_SELL_ITEM, ERR_AUCTION_OK);
 
@@ -363,7 +363,7 @@ void WorldSession::HandleAuctionSellItem(WorldPacket& recvData)
                     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
                     item2->DeleteFromInventoryDB(trans);
                     item2->DeleteFromDB(trans);
-                    CharacterDatabase.CommitTransaction(trans);
+                    CharacterDatabase.CommitTransaction(trans, _player->GetGUID().GetCounter());
                     delete item2;
                 }
                 else // Item stack count is bigger than required count, update item stack count and save to database - cloned item will be used for auction
@@ -379,7 +379,7 @@ void WorldSession::HandleAuctionSellItem(WorldPacket& recvData)
             newItem->SaveToDB(trans);
             AH->SaveToDB(trans);
             _player->SaveInventoryAndGoldToDB(trans);
-            CharacterDatabase.CommitTransaction(trans);
+            CharacterDatabase.CommitTransaction(trans, AH->GetShardKey(), _player->GetGUID().GetCounter());
 
             SendAuctionCommandResult(AH->Id, AUCTION_SELL_ITEM, ERR_AUCTION_OK);
 
@@ -458,6 +458,8 @@ void WorldSession::HandleAuctionPlaceBid(WorldPacket& recvData)
         return;
     }
 
+    // the auction is gone after a buyout, its row is still written under its own key
+    uint64 const auctionKey = auction->GetShardKey();
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
 
     if (price < auction->buyout || auction->buyout == 0)
@@ -520,7 +522,7 @@ void WorldSession::HandleAuctionPlaceBid(WorldPacket& recvData)
         auctionHouse->RemoveAuction(auction);
     }
     player->SaveInventoryAndGoldToDB(trans);
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, auctionKey, player->GetGUID().GetCounter());
 }
 
 //this void is called when auction_owner cancels his auction
@@ -584,7 +586,7 @@ void WorldSession::HandleAuctionRemoveItem(WorldPacket& recvData)
 
     player->SaveInventoryAndGoldToDB(trans);
     auction->DeleteFromDB(trans);
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, auction->GetShardKey(), player->GetGUID().GetCounter());
 
     sAuctionMgr->RemoveAItem(auction->item_guid);
     auctionHouse->RemoveAuction(auction);
@@ -55,6 +55,7 @@
 #include "Tokenize.h"
 #include "Transport.h"
 #include "Util.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
@@ -781,7 +782,8 @@ void WorldSession::HandlePlayerLoginOpcode(WorldPacket& recvData)
         return;
     }
 
-    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder)).AfterComplete([this](SQLQueryHolderBase const& holder)
+    // same lane as the saves of the character, a relog must see the data written at logout
+    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder, playerGuid.GetCounter())).AfterComplete([this](SQLQueryHolderBase const& holder)
     {
         HandlePlayerLoginFromDB(static_cast<LoginQueryHolder const&>(holder));
     });
@@ -904,7 +906,7 @@ void WorldSession::HandlePlayerLoginFromDB(LoginQueryHolder const& holder)
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_CHAR_ONLINE);
     stmt->SetData(0, pCurrChar->GetGUID().GetCounter());
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, pCurrChar->GetGUID().GetCounter());
 
     LoginDatabasePreparedStatement* loginStmt = LoginDatabase.GetPreparedStatement(LOGIN_UPD_ACCOUNT_ONLINE);
     loginStmt->SetData(0, GetAccountId());
@@ -1117,6 +1119,7 @@ void WorldSession::HandlePlayerLoginFromDB(LoginQueryHolder const& holder)
     }
 
     sScriptMgr->OnPlayerLogin(pCurrChar);
+    sWhoListCacheMgr->ScheduleUpdate(pCurrChar->GetGUID());
 
     if (pCurrChar->HasAtLoginFlag(AT_LOGIN_FIRST))
     {
@@ -1175,7 +1178,7 @@ void WorldSession::HandlePlayerLoginToCharInWorld(Player* pCurrChar)
     pCurrChar->GetMap()->SendInitTransports(pCurrChar);
     pCurrChar->GetMap()->SendInitSelf(pCurrChar);
     pCurrChar->GetMap()->SendZoneDynamicInfo(pCurrChar);
-    pCurrChar->m_clientGUIDs.clear();
+    pCurrChar->ClearClientGUIDs();
     pCurrChar->UpdateObjectVisibility(false);
 
     pCurrChar->CleanupChannels();
@@ -1399,14 +1402,14 @@ void WorldSession::HandleCharRenameCallBack(std::shared_ptr<CharacterRenameInfo>
     stmt->SetData(0, renameInfo->Name);
     stmt->SetData(1, atLoginFlags);
     stmt->SetData(2, guidLow);
-    CharacterDatabase.Execute(stmt);
+    CharacterDatabase.Execute(stmt, guidLow);
 
     // Removed declined name from db
     if (sWorld->getBoolConfig(CONFIG_DECLINED_NAMES_USED))
     {
         stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_DECLINED_NAME);
         stmt->SetData(0, guidLow);
-        CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt, guidLow);
     }
 
     LOG_INFO("entities.player.character", "Account: {} (IP: {}), Character [{}] (guid: {}) Changed name to: {}", GetAccountId(), GetRemoteAddress(), oldName, guidLow, renameInfo->Name);
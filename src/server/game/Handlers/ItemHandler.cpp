@@ -1105,7 +1105,7 @@ void WorldSession::SendListInventory(ObjectGuid vendorGuid, uint32 vendorEntry)
                     continue;
                 }
 
-                ConditionList conditions = sConditionMgr->GetConditionsForNpcVendorEvent(vendor->GetEntry(), item->item);
+                ConditionSpan conditions = sConditionMgr->GetConditionsForNpcVendorEvent(vendor->GetEntry(), item->item);
                 if (!sConditionMgr->IsObjectMeetToConditions(_player, vendor, conditions))
                 {
                     LOG_DEBUG("network", "SendListInventory: conditions not met for creature entry {} item {}", vendor->GetEntry(), item->item);
@@ -1393,7 +1393,7 @@ void WorldSession::HandleWrapItemOpcode(WorldPacket& recvData)
     // after save it will be impossible to remove the item from the queue
     _player->SaveInventoryAndGoldToDB(trans);
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, _player->GetGUID().GetCounter());
 
     uint32 count = 1;
     _player->DestroyItemCount(gift, count, true);
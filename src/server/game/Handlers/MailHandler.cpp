@@ -341,7 +341,7 @@ void WorldSession::HandleSendMail(WorldPacket& recvData)
     .SendMailTo(trans, MailReceiver(receive, receiverGuid.GetCounter()), MailSender(player), body.empty() ? MAIL_CHECK_MASK_COPIED : MAIL_CHECK_MASK_HAS_BODY, deliver_delay);
 
     player->SaveInventoryAndGoldToDB(trans);
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, player->GetGUID().GetCounter(), receiverGuid.GetCounter());
 }
 
 //called when mail is read
@@ -470,7 +470,7 @@ void WorldSession::HandleMailReturnToSender(WorldPacket& recvData)
         draft.AddMoney(m->money).SendReturnToSender(GetAccountId(), m->receiver, m->sender, trans);
     }
 
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, player->GetGUID().GetCounter());
 
     delete m;                                               //we can deallocate old mail
     player->SendMailResult(mailId, MAIL_RETURNED_TO_SENDER, MAIL_OK);
@@ -579,7 +579,7 @@ void WorldSession::HandleMailTakeItem(WorldPacket& recvData)
 
         player->SaveInventoryAndGoldToDB(trans);
         player->_SaveMail(trans);
-        CharacterDatabase.CommitTransaction(trans);
+        CharacterDatabase.CommitTransaction(trans, player->GetGUID().GetCounter());
 
         player->SendMailResult(mailId, MAIL_ITEM_TAKEN, MAIL_OK, 0, itemLowGuid, count);
     }
@@ -622,7 +622,7 @@ void WorldSession::HandleMailTakeMoney(WorldPacket& recvData)
     CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
     player->SaveGoldToDB(trans);
     player->_SaveMail(trans);
-    CharacterDatabase.CommitTransaction(trans);
+    CharacterDatabase.CommitTransaction(trans, player->GetGUID().GetCounter());
 }
 
 //called when player lists his received mails
@@ -285,8 +285,21 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
     data << uint32(matchCount);         // placeholder, count of players matching criteria
     data << uint32(displaycount);       // placeholder, count of players displayed
 
-    for (auto const& target : sWhoListCacheMgr->GetWhoList())
+    WhoListQuery query;
+    query.LevelMin = levelMin;
+    query.LevelMax = levelMax;
+    query.RaceMask = racemask;
+    query.ClassMask = classmask;
+    query.ZoneIds.assign(zoneids.begin(), zoneids.begin() + zonesCount);
+    query.PlayerName = wpacketPlayerName;
+
+    // level, class, race, zone and player name are matched by the who list indexes
+    std::vector<WhoListPlayerInfo const*> targets;
+    sWhoListCacheMgr->GetWhoList().Search(query, targets);
+
+    for (WhoListPlayerInfo const* targetInfo : targets)
     {
+        WhoListPlayerInfo const& target = *targetInfo;
         if (AccountMgr::IsPlayerAccount(security))
         {
             // player can see member of other team only if CONFIG_ALLOW_TWO_SIDE_WHO_LIST
@@ -309,53 +322,13 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
             continue;
         }
 
-        // check if target's level is in level range
         uint8 lvl = target.GetLevel();
-        if (lvl < levelMin || lvl > levelMax)
-        {
-            continue;
-        }
-
-        // check if class matches classmask
         uint8 class_ = target.GetClass();
-        if (!(classmask & (1 << class_)))
-        {
-            continue;
-        }
-
-        // check if race matches racemask
         uint32 race = target.GetRace();
-        if (!(racemask & (1 << race)))
-        {
-            continue;
-        }
-
         uint32 playerZoneId = target.GetZoneId();
         uint8 gender = target.GetGender();
 
-        bool showZones = true;
-        for (uint32 i = 0; i < zonesCount; ++i)
-        {
-            if (zoneids[i] == playerZoneId)
-            {
-                showZones = true;
-                break;
-            }
-
-            showZones = false;
-        }
-
-        if (!showZones)
-        {
-            continue;
-        }
-
         std::wstring const& wideplayername = target.GetWidePlayerName();
-        if (!(wpacketPlayerName.empty() || wideplayername.find(wpacketPlayerName) != std::wstring::npos))
-        {
-            continue;
-        }
-
         std::wstring const& wideguildname = target.GetWideGuildName();
         if (!(wpacketGuildName.empty() || wideguildname.find(wpacketGuildName) != std::wstring::npos))
         {
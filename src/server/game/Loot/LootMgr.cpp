@@ -2036,7 +2036,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
         {
             if ((*i)->itemid == uint32(cond->SourceEntry))
             {
-                (*i)->conditions.push_back(cond);
+                sConditionMgr->AddToConditionList((*i)->conditions, cond);
                 return true;
             }
         }
@@ -2057,7 +2057,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
                 {
                     if ((*i)->itemid == uint32(cond->SourceEntry))
                     {
-                        (*i)->conditions.push_back(cond);
+                        sConditionMgr->AddToConditionList((*i)->conditions, cond);
                         return true;
                     }
                 }
@@ -2070,7 +2070,7 @@ bool LootTemplate::addConditionItem(Condition* cond)
                 {
                     if ((*i)->itemid == uint32(cond->SourceEntry))
                     {
-                        (*i)->conditions.push_back(cond);
+                        sConditionMgr->AddToConditionList((*i)->conditions, cond);
                         return true;
                     }
                 }
@@ -24,6 +24,7 @@
 #include "GameTime.h"
 #include "Geometry.h"
 #include "GridNotifiers.h"
+#include "GridPreloader.h"
 #include "Group.h"
 #include "InstanceScript.h"
 #include "IVMapMgr.h"
@@ -33,6 +34,7 @@
 #include "Metric.h"
 #include "MiscPackets.h"
 #include "MMapFactory.h"
+#include "MoveSpline.h"
 #include "Object.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
@@ -75,12 +77,13 @@ Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
     _mapGridManager(this), i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
     m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
     _instanceResetPeriod(0), m_activeNonPlayersIter(m_activeNonPlayers.end()),
-    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id))
+    _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id)), _lastUpdateDuration(0)
 {
     m_parentMap = (_parent ? _parent : this);
 
     _zonePlayerCountMap.clear();
     _updatableObjectListRecheckTimer.SetInterval(UPDATABLE_OBJECT_LIST_RECHECK_TIMER);
+    _gridPreloadTimer.SetInterval(GRID_PRELOAD_TIMER);
 
     //lets initialize visibility distance for map
     Map::InitVisibilityDistance();
@@ -364,7 +367,7 @@ bool Map::AddPlayerToMap(Player* player)
     SendInitSelf(player);
     SendZoneDynamicInfo(player);
 
-    player->m_clientGUIDs.clear();
+    player->ClearClientGUIDs();
     player->UpdateObjectVisibility(false);
 
     if (player->IsAlive())
@@ -602,6 +605,13 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 
     UpdateNonPlayerObjects(t_diff);
 
+    _gridPreloadTimer.Update(t_diff);
+    if (_gridPreloadTimer.Passed())
+    {
+        PreloadGridsAhead();
+        _gridPreloadTimer.Reset();
+    }
+
     SendObjectUpdates();
 
     ///- Process necessary scripts
@@ -672,6 +682,76 @@ void Map::UpdateNonPlayerObjects(uint32 const diff)
     }
 }
 
+void Map::PreloadGridsAhead()
+{
+    if (!sGridPreloader->IsActive() || Instanceable() || _mapGridManager.IsGridsFullyCreated())
+        return;
+
+    float const lookAhead = float(sWorld->getIntConfig(CONFIG_GRID_PRELOAD_LOOKAHEAD));
+    float const step = SIZE_OF_GRIDS / 2;
+
+    for (MapRefMgr::iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
+    {
+        Player* player = itr->GetSource();
+        if (!player || !player->IsInWorld() || player->GetTransport())
+            continue;
+
+        if (!player->movespline->Finalized())
+        {
+            // Server controlled movement (flight paths, bots): follow the path points up to the look ahead time
+            Movement::MoveSpline::MySpline const& spline = player->movespline->_Spline();
+            int32 const lookAheadTime = player->movespline->timePassed() + int32(lookAhead * IN_MILLISECONDS);
+            for (int32 i = player->movespline->_currentSplineIdx() + 1; i <= spline.last(); ++i)
+            {
+                G3D::Vector3 const& point = spline.getPoint(i);
+                PreloadGridsAround(point.x, point.y);
+
+                if (spline.length(i) >= lookAheadTime)
+                    break;
+            }
+        }
+        else if (player->isMoving())
+        {
+            // Client controlled movement: assume the player keeps direction and speed
+            float const distance = player->GetSpeed(player->IsFlying() ? MOVE_FLIGHT : MOVE_RUN) * lookAhead;
+            float const angle = player->GetOrientation();
+            for (float travelled = step; ; travelled += step)
+            {
+                travelled = std::min(travelled, distance);
+                PreloadGridsAround(player->GetPositionX() + travelled * std::cos(angle), player->GetPositionY() + travelled * std::sin(angle));
+
+                if (travelled >= distance)
+                    break;
+            }
+        }
+    }
+}
+
+void Map::PreloadGridsAround(float x, float y)
+{
+    if (!std::isfinite(x) || !std::isfinite(y))
+        return;
+
+    // Grids are created for everything in visibility range, plus one cell of margin
+    float const radius = GetVisibilityRange() + SIZE_OF_GRID_CELL;
+
+    float minX = x - radius, maxX = x + radius;
+    float minY = y - radius, maxY = y + radius;
+    Acore::NormalizeMapCoord(minX);
+    Acore::NormalizeMapCoord(maxX);
+    Acore::NormalizeMapCoord(minY);
+    Acore::NormalizeMapCoord(maxY);
+
+    // Grid coordinates grow towards negative world coordinates
+    GridCoord const low = Acore::ComputeGridCoord(maxX, maxY);
+    GridCoord const high = Acore::ComputeGridCoord(minX, minY);
+
+    for (uint32 gridX = low.x_coord; gridX <= high.x_coord; ++gridX)
+        for (uint32 gridY = low.y_coord; gridY <= high.y_coord; ++gridY)
+            if (!_mapGridManager.IsGridCreated(gridX, gridY))
+                sGridPreloader->Request(GetId(), gridX, gridY);
+}
+
 void Map::AddObjectToPendingUpdateList(WorldObject* obj)
 {
     if (!obj->CanBeAddedToMapUpdateList())
@@ -1747,6 +1827,8 @@ void Map::SendRemoveTransports(Player* player)
         if ((*it).IsTransport())
         {
             transData.AddOutOfRangeGUID(*it);
+            if (GameObject* transport = GetGameObject(*it))
+                transport->RemoveObserver(player);
             it = player->m_clientGUIDs.erase(it);
         }
         else
@@ -1775,6 +1857,7 @@ void Map::SendObjectUpdates()
     WorldPacket packet;                                     // here we allocate a std::vector with a size of 0x10000
     for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end(); ++iter)
     {
+        // Headless sessions never get update blocks built, see WorldObjectChangeAccumulator
         if (!sScriptMgr->OnPlayerbotCheckUpdatesToSend(iter->first))
         {
             iter->second.Clear();
@@ -1944,8 +2027,9 @@ uint32 Map::GetPlayersCountExceptGMs() const
 
 void Map::SendToPlayers(WorldPacket const* data) const
 {
+    SharedWorldPacketPtr sharedData;
     for (MapRefMgr::const_iterator itr = m_mapRefMgr.begin(); itr != m_mapRefMgr.end(); ++itr)
-        itr->GetSource()->GetSession()->SendPacket(data);
+        itr->GetSource()->GetSession()->SendPacket(data, sharedData);
 }
 
 template<class T>
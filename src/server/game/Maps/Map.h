@@ -87,6 +87,7 @@ struct ScriptAction
 #define DEFAULT_HEIGHT_SEARCH     50.0f                     // default search distance to find height at nearby locations
 #define MIN_UNLOAD_DELAY      1                             // immediate unload
 #define UPDATABLE_OBJECT_LIST_RECHECK_TIMER 30 * IN_MILLISECONDS // Time to recheck update object list
+#define GRID_PRELOAD_TIMER 1 * IN_MILLISECONDS // Time to predict the grids moving players are heading to
 
 struct PositionFullTerrainStatus
 {
@@ -499,6 +500,10 @@ public:
 
     virtual std::string GetDebugInfo() const;
 
+    // Duration of the previous Update(), used by MapUpdater to start the most expensive maps first
+    [[nodiscard]] std::chrono::nanoseconds GetLastUpdateDuration() const { return _lastUpdateDuration; }
+    void SetLastUpdateDuration(std::chrono::nanoseconds duration) { _lastUpdateDuration = duration; }
+
     uint32 GetCreatedGridsCount();
     uint32 GetLoadedGridsCount();
     uint32 GetCreatedCellsInGridCount(uint16 const x, uint16 const y);
@@ -609,6 +614,10 @@ private:
 
     void UpdateNonPlayerObjects(uint32 const diff);
 
+    // Background terrain loading of continent grids ahead of moving players (MapUpdate.GridPreload.*)
+    void PreloadGridsAhead();
+    void PreloadGridsAround(float x, float y);
+
     void _AddObjectToUpdateList(WorldObject* obj);
     void _RemoveObjectFromUpdateList(WorldObject* obj);
 
@@ -643,6 +652,10 @@ private:
     UpdatableObjectList _updatableObjectList;
     PendingAddUpdatableObjectList _pendingAddUpdatableObjectList;
     IntervalTimer _updatableObjectListRecheckTimer;
+
+    IntervalTimer _gridPreloadTimer;
+
+    std::chrono::nanoseconds _lastUpdateDuration;
 };
 
 enum InstanceResetMethod
@@ -19,7 +19,9 @@
 #include "Chat.h"
 #include "DatabaseEnv.h"
 #include "GridDefines.h"
+#include "GridPreloader.h"
 #include "GridTerrainLoader.h"
+#include "GridTerrainStore.h"
 #include "Group.h"
 #include "InstanceSaveMgr.h"
 #include "LFGMgr.h"
@@ -29,6 +31,7 @@
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Opcodes.h"
+#include "PathfindingService.h"
 #include "Player.h"
 #include "ScriptMgr.h"
 #include "Transport.h"
@@ -59,6 +62,14 @@ void MapMgr::Initialize()
     // Start mtmaps if needed
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    sGridTerrainStore->Initialize();
+
+    if (uint32 preloadThreads = sWorld->getIntConfig(CONFIG_GRID_PRELOAD_THREADS))
+        sGridPreloader->Initialize(preloadThreads);
+
+    if (uint32 pathfindingThreads = sWorld->getIntConfig(CONFIG_PATHFINDING_THREADS))
+        sPathfindingService->Initialize(pathfindingThreads);
 }
 
 void MapMgr::InitializeVisibilityDistanceInfo()
@@ -335,6 +346,12 @@ void MapMgr::UnloadAll()
 
     if (m_updater.activated())
         m_updater.deactivate();
+
+    if (sGridPreloader->IsActive())
+        sGridPreloader->Unload();
+
+    if (sPathfindingService->IsActive())
+        sPathfindingService->Unload();
 }
 
 void MapMgr::GetNumInstances(uint32& dungeons, uint32& battlegrounds, uint32& arenas)
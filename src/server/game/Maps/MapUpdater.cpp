@@ -20,64 +20,27 @@
 #include "LFGMgr.h"
 #include "Map.h"
 #include "Metric.h"
+#include <algorithm>
+#include <limits>
 
-class UpdateRequest
+namespace
 {
-public:
-    UpdateRequest() = default;
-    virtual ~UpdateRequest() = default;
-
-    virtual void call() = 0;
-};
-
-class MapUpdateRequest : public UpdateRequest
-{
-public:
-    MapUpdateRequest(Map& m, MapUpdater& u, uint32 d, uint32 sd)
-        : m_map(m), m_updater(u), m_diff(d), s_diff(sd)
-    {
-    }
-
-    void call() override
-    {
-        METRIC_TIMER("map_update_time_diff", METRIC_TAG("map_id", std::to_string(m_map.GetId())));
-        m_map.Update(m_diff, s_diff);
-        m_updater.update_finished();
-    }
-
-private:
-    Map& m_map;
-    MapUpdater& m_updater;
-    uint32 m_diff;
-    uint32 s_diff;
-};
-
-class LFGUpdateRequest : public UpdateRequest
-{
-public:
-    LFGUpdateRequest(MapUpdater& u, uint32 d) : m_updater(u), m_diff(d) {}
-
-    void call() override
-    {
-        sLFGMgr->Update(m_diff, 1);
-        m_updater.update_finished();
-    }
-private:
-    MapUpdater& m_updater;
-    uint32 m_diff;
-};
+    // Index of the MapUpdater worker running on this thread, none for threads outside of the pool
+    thread_local std::size_t CurrentWorkerIndex = std::numeric_limits<std::size_t>::max();
+}
 
-MapUpdater::MapUpdater() : pending_requests(0), _cancelationToken(false)
+MapUpdater::MapUpdater() : _queuedRequests(0), pending_requests(0), _cancelationToken(false), _lastLfgUpdateTime(0)
 {
 }
 
 void MapUpdater::activate(std::size_t num_threads)
 {
-    _workerThreads.reserve(num_threads);
+    _workers.reserve(num_threads);
     for (std::size_t i = 0; i < num_threads; ++i)
-    {
-        _workerThreads.push_back(std::thread(&MapUpdater::WorkerThread, this));
-    }
+        _workers.push_back(std::make_unique<Worker>());
+
+    for (std::size_t i = 0; i < num_threads; ++i)
+        _workers[i]->Thread = std::thread(&MapUpdater::WorkerThread, this, i);
 }
 
 void MapUpdater::deactivate()
@@ -86,49 +49,84 @@ void MapUpdater::deactivate()
 
     wait();  // This is where we wait for tasks to complete
 
-    _queue.Cancel();  // Cancel the queue to prevent further task processing
+    {
+        std::lock_guard<std::mutex> guard(_queueLock);
+        _queueCondition.notify_all();  // Wake up idle workers so they see the cancellation
+    }
 
     // Join all worker threads
-    for (auto& thread : _workerThreads)
+    for (std::unique_ptr<Worker>& worker : _workers)
     {
-        if (thread.joinable())
+        if (worker->Thread.joinable())
         {
-            thread.join();
+            worker->Thread.join();
         }
     }
 }
 
 void MapUpdater::wait()
 {
-    std::unique_lock<std::mutex> guard(_lock);  // Guard lock for safe waiting
+    DispatchBatch();
 
-    // Wait until there are no pending requests
-    _condition.wait(guard, [this] {
-        return pending_requests.load(std::memory_order_acquire) == 0
-            || _cancelationToken.load(std::memory_order_acquire);//修复crash
-    });
+    {
+        std::unique_lock<std::mutex> guard(_lock);  // Guard lock for safe waiting
+
+        // Wait until there are no pending requests
+        _condition.wait(guard, [this] {
+            return pending_requests.load(std::memory_order_acquire) == 0
+                || _cancelationToken.load(std::memory_order_acquire);//修复crash
+        });
+    }
+
+    LogWorkerTimes();
 }
 
-void MapUpdater::schedule_task(UpdateRequest* request)
+void MapUpdater::schedule_task(UpdateRequest&& request)
 {
     // Atomic increment for pending_requests
     pending_requests.fetch_add(1, std::memory_order_release);
-    _queue.Push(request);
+
+    if (CurrentWorkerIndex >= _workers.size())
+    {
+        _batch.push_back(std::move(request));
+        return;
+    }
+
+    // Scheduled from inside the pool (instances, map regions), keep it local, idle workers will steal it
+    {
+        Worker& worker = *_workers[CurrentWorkerIndex];
+        std::lock_guard<std::mutex> guard(worker.Lock);
+        worker.Queue.push_back(std::move(request));
+    }
+
+    _queuedRequests.fetch_add(1, std::memory_order_release);
+    std::lock_guard<std::mutex> guard(_queueLock);
+    _queueCondition.notify_one();
 }
 
 void MapUpdater::schedule_update(Map& map, uint32 diff, uint32 s_diff)
 {
-    schedule_task(new MapUpdateRequest(map, *this, diff, s_diff));
+    UpdateRequest request;
+    request.RequestType = UpdateRequest::Type::Map;
+    request.UpdatedMap = &map;
+    request.Diff = diff;
+    request.SDiff = s_diff;
+    request.ExpectedCost = map.GetLastUpdateDuration();
+    schedule_task(std::move(request));
 }
 
 void MapUpdater::schedule_lfg_update(uint32 diff)
 {
-    schedule_task(new LFGUpdateRequest(*this, diff));
+    UpdateRequest request;
+    request.RequestType = UpdateRequest::Type::Lfg;
+    request.Diff = diff;
+    request.ExpectedCost = std::chrono::nanoseconds(_lastLfgUpdateTime.load(std::memory_order_relaxed));
+    schedule_task(std::move(request));
 }
 
 bool MapUpdater::activated()
 {
-    return !_workerThreads.empty();
+    return !_workers.empty();
 }
 
 void MapUpdater::update_finished()
@@ -142,22 +140,136 @@ void MapUpdater::update_finished()
     }
 }
 
-void MapUpdater::WorkerThread()
+void MapUpdater::DispatchBatch()
+{
+    if (_batch.empty())
+        return;
+
+    // Longest expected first, each to the worker with the least expected work so far
+    std::stable_sort(_batch.begin(), _batch.end(), [](UpdateRequest const& left, UpdateRequest const& right)
+    {
+        return left.ExpectedCost > right.ExpectedCost;
+    });
+
+    for (std::unique_ptr<Worker>& worker : _workers)
+        worker->AssignedCost = std::chrono::nanoseconds::zero();
+
+    for (UpdateRequest& request : _batch)
+    {
+        Worker* target = _workers.front().get();
+        for (std::unique_ptr<Worker>& worker : _workers)
+            if (worker->AssignedCost < target->AssignedCost)
+                target = worker.get();
+
+        // Never-updated maps count as one millisecond so they still spread over the workers
+        target->AssignedCost += std::max<std::chrono::nanoseconds>(request.ExpectedCost, 1ms);
+
+        std::lock_guard<std::mutex> guard(target->Lock);
+        target->Queue.push_back(std::move(request));
+    }
+
+    _queuedRequests.fetch_add(int(_batch.size()), std::memory_order_release);
+    _batch.clear();
+
+    std::lock_guard<std::mutex> guard(_queueLock);
+    _queueCondition.notify_all();
+}
+
+bool MapUpdater::PopRequest(std::size_t workerIndex, UpdateRequest& request)
+{
+    // Own queue first in queue order, then steal the longest expected request of another worker
+    for (std::size_t i = 0; i < _workers.size(); ++i)
+    {
+        Worker& worker = *_workers[(workerIndex + i) % _workers.size()];
+        std::lock_guard<std::mutex> guard(worker.Lock);
+        if (worker.Queue.empty())
+            continue;
+
+        auto itr = worker.Queue.begin();
+        if (i != 0)
+        {
+            itr = std::max_element(worker.Queue.begin(), worker.Queue.end(), [](UpdateRequest const& left, UpdateRequest const& right)
+            {
+                return left.ExpectedCost < right.ExpectedCost;
+            });
+        }
+
+        request = std::move(*itr);
+        worker.Queue.erase(itr);
+        _queuedRequests.fetch_sub(1, std::memory_order_acq_rel);
+        return true;
+    }
+
+    return false;
+}
+
+void MapUpdater::Execute(UpdateRequest& request)
+{
+    switch (request.RequestType)
+    {
+        case UpdateRequest::Type::Map:
+        {
+            METRIC_TIMER("map_update_time_diff", METRIC_TAG("map_id", std::to_string(request.UpdatedMap->GetId())));
+            TimePoint start = std::chrono::steady_clock::now();
+            request.UpdatedMap->Update(request.Diff, request.SDiff);
+            request.UpdatedMap->SetLastUpdateDuration(std::chrono::steady_clock::now() - start);
+            break;
+        }
+        case UpdateRequest::Type::Lfg:
+        {
+            TimePoint start = std::chrono::steady_clock::now();
+            sLFGMgr->Update(request.Diff, 1);
+            _lastLfgUpdateTime.store(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count(), std::memory_order_relaxed);
+            break;
+        }
+    }
+
+    update_finished();
+}
+
+void MapUpdater::LogWorkerTimes()
+{
+    for (std::size_t i = 0; i < _workers.size(); ++i)
+    {
+        int64 busy = _workers[i]->BusyTime.exchange(0, std::memory_order_relaxed);
+        int64 idle = _workers[i]->IdleTime.exchange(0, std::memory_order_relaxed);
+
+        METRIC_VALUE("map_updater_busy_time", std::chrono::nanoseconds(busy), METRIC_TAG("worker", std::to_string(i)));
+        METRIC_VALUE("map_updater_idle_time", std::chrono::nanoseconds(idle), METRIC_TAG("worker", std::to_string(i)));
+    }
+}
+
+void MapUpdater::WorkerThread(std::size_t workerIndex)
 {
     LoginDatabase.WarnAboutSyncQueries(true);
     CharacterDatabase.WarnAboutSyncQueries(true);
     WorldDatabase.WarnAboutSyncQueries(true);
 
+    CurrentWorkerIndex = workerIndex;
+    Worker& worker = *_workers[workerIndex];
+
     while (!_cancelationToken)
     {
-        UpdateRequest* request = nullptr;
-
-        _queue.WaitAndPop(request);  // Wait for and pop a request from the queue
-
-        if (!_cancelationToken && request)
+        UpdateRequest request;
+        if (!PopRequest(workerIndex, request))
         {
-            request->call();  // Execute the request
-            delete request;  // Clean up after processing
+            TimePoint idleStart = std::chrono::steady_clock::now();
+            {
+                std::unique_lock<std::mutex> guard(_queueLock);
+                _queueCondition.wait(guard, [this] {
+                    return _queuedRequests.load(std::memory_order_acquire) > 0
+                        || _cancelationToken.load(std::memory_order_acquire);
+                });
+            }
+            worker.IdleTime.fetch_add((std::chrono::steady_clock::now() - idleStart).count(), std::memory_order_relaxed);
+            continue;
         }
+
+        if (_cancelationToken)
+            break;
+
+        TimePoint busyStart = std::chrono::steady_clock::now();
+        Execute(request);  // Execute the request
+        worker.BusyTime.fetch_add((std::chrono::steady_clock::now() - busyStart).count(), std::memory_order_relaxed);
     }
 }
@@ -19,21 +19,46 @@
 #define _MAP_UPDATER_H_INCLUDED
 
 #include "Define.h"
-#include "PCQueue.h"
+#include "Duration.h"
 #include <condition_variable>
+#include <deque>
 #include <thread>
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 class Map;
-class UpdateRequest;
 
+/// Update task stored by value in the worker queues, so scheduling never allocates a request object
+struct UpdateRequest
+{
+    enum class Type : uint8
+    {
+        Map,
+        Lfg
+    };
+
+    Type RequestType = Type::Map;
+    Map* UpdatedMap = nullptr;
+    uint32 Diff = 0;
+    uint32 SDiff = 0;
+    std::chrono::nanoseconds ExpectedCost = std::chrono::nanoseconds::zero();
+};
+
+/**
+ * Runs map and LFG updates on a pool of worker threads.
+ *
+ * Requests scheduled from outside the pool are collected until wait() and then handed out longest expected
+ * first (the previous update duration of the same map), always to the worker with the least work assigned.
+ * Requests scheduled by a worker go to its own queue. Idle workers steal from the other queues.
+ */
 class MapUpdater
 {
 public:
     MapUpdater();
     ~MapUpdater() = default;
 
-    void schedule_task(UpdateRequest* request);
     void schedule_update(Map& map, uint32 diff, uint32 s_diff);
     void schedule_lfg_update(uint32 diff);
     void wait();
@@ -43,11 +68,31 @@ public:
     void update_finished();
 
 private:
-    void WorkerThread();
-    ProducerConsumerQueue<UpdateRequest*> _queue;
+    struct Worker
+    {
+        std::mutex Lock;
+        std::deque<UpdateRequest> Queue;
+        std::thread Thread;
+        std::chrono::nanoseconds AssignedCost = std::chrono::nanoseconds::zero();
+        std::atomic<int64> BusyTime{0};
+        std::atomic<int64> IdleTime{0};
+    };
+
+    void schedule_task(UpdateRequest&& request);
+    void DispatchBatch();
+    bool PopRequest(std::size_t workerIndex, UpdateRequest& request);
+    void Execute(UpdateRequest& request);
+    void LogWorkerTimes();
+    void WorkerThread(std::size_t workerIndex);
+
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::vector<UpdateRequest> _batch;      // requests scheduled from outside the pool, dispatched on wait()
+    std::atomic<int> _queuedRequests;       // requests sitting in a worker queue
     std::atomic<int> pending_requests;  // Use std::atomic for pending_requests to avoid lock contention
     std::atomic<bool> _cancelationToken;  // Atomic flag for cancellation to avoid race conditions
-    std::vector<std::thread> _workerThreads;
+    std::atomic<int64> _lastLfgUpdateTime;  // nanoseconds, written by the worker running the lfg update
+    std::mutex _queueLock;
+    std::condition_variable _queueCondition;
     std::mutex _lock; // Mutex and condition variable for synchronization
     std::condition_variable _condition;
 };
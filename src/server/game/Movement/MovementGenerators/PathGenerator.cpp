@@ -24,13 +24,16 @@
 #include "MMapMgr.h"
 #include "Map.h"
 #include "Metric.h"
+#include "PathfindingService.h"
+#include "World.h"
 
  ////////////////// PathGenerator //////////////////
 PathGenerator::PathGenerator(WorldObject const* owner) :
     _polyLength(0), _type(PATHFIND_BLANK), _useStraightPath(false), _forceDestination(false),
-    _slopeCheck(false), _pointPathLimit(MAX_POINT_PATH_LENGTH), _useRaycast(false),
+    _slopeCheck(false), _pointPathLimit(MAX_POINT_PATH_LENGTH), _pathLengthLimited(false), _useRaycast(false),
+    _useHierarchicalPath(sWorld->getBoolConfig(CONFIG_MMAPS_HIERARCHICAL)), _requestAsync(false),
     _endPosition(G3D::Vector3::zero()), _source(owner), _navMesh(nullptr),
-    _navMeshQuery(nullptr)
+    _navMeshQuery(nullptr), _tileGraph(nullptr)
 {
     memset(_pathPolyRefs, 0, sizeof(_pathPolyRefs));
 
@@ -40,6 +43,7 @@ PathGenerator::PathGenerator(WorldObject const* owner) :
         MMAP::MMapMgr* mmap = MMAP::MMapFactory::createOrGetMMapMgr();
         _navMesh = mmap->GetNavMesh(mapId);
         _navMeshQuery = mmap->GetNavMeshQuery(mapId, _source->GetInstanceId());
+        _tileGraph = mmap->GetTileGraph(mapId);
     }
 
     CreateFilter();
@@ -62,6 +66,70 @@ bool PathGenerator::CalculatePath(float destX, float destY, float destZ, bool fo
     return CalculatePath(x, y, z, destX, destY, destZ, forceDest);
 }
 
+bool PathGenerator::CalculatePathAsync(float destX, float destY, float destZ, bool forceDest)
+{
+    // a newer destination replaces the path still being built
+    _pendingPath = {};
+
+    float x, y, z;
+    _source->GetPosition(x, y, z);
+    if (!_navMesh || !_navMeshQuery)
+    {
+        return false;
+    }
+
+    _requestAsync = true;
+    bool result = CalculatePath(x, y, z, destX, destY, destZ, forceDest);
+    _requestAsync = false;
+    return result;
+}
+
+bool PathGenerator::CollectPendingPath()
+{
+    if (!_pendingPath.valid() || _pendingPath.wait_for(0s) != std::future_status::ready)
+        return false;
+
+    PathResult result = _pendingPath.get();
+
+    // the unit kept following its previous spline while the path was built, start from where it is now
+    G3D::Vector3 currentPosition;
+    _source->GetPosition(currentPosition.x, currentPosition.y, currentPosition.z);
+    if (Dist3DSqr(currentPosition, _startPosition) > ASYNC_PATH_MAX_START_DRIFT * ASYNC_PATH_MAX_START_DRIFT)
+    {
+        // too far from the searched start for the first segment to stay on the mesh, build it again here
+        CalculatePath(currentPosition.x, currentPosition.y, currentPosition.z, _endPosition.x, _endPosition.y, _endPosition.z, _forceDestination);
+        return true;
+    }
+
+    SetStartPosition(currentPosition);
+
+    switch (result.Type)
+    {
+        case PATHFIND_BLANK:
+            // the workers could not decide it without the unit
+            BuildPolyPath(_startPosition, _endPosition);
+            break;
+        case PATHFIND_NOPATH:
+            BuildShortcut();
+            _type = PATHFIND_NOPATH;
+            break;
+        case PATHFIND_SHORT:
+            BuildShortcut();
+            _type = PathType(_type | PATHFIND_SHORT);
+            break;
+        default:
+            // the poly corridor stays with the worker
+            _polyLength = 0;
+            _type = result.Type;
+            _pathPoints = std::move(result.Points);
+            _pathPoints[0] = currentPosition;
+            FinalizePointPath();
+            break;
+    }
+
+    return true;
+}
+
 bool PathGenerator::CalculatePath(float x, float y, float z, float destX, float destY, float destZ, bool forceDest)
 {
     if (!Acore::IsValidMapCoord(destX, destY, destZ) || !Acore::IsValidMapCoord(x, y, z))
@@ -78,10 +146,10 @@ bool PathGenerator::CalculatePath(float x, float y, float z, float destX, float
     _forceDestination = forceDest;
 
     // make sure navMesh works - we can run on map w/o mmap
-    // check if the start and end point have a .mmtile loaded (can we pass via not loaded tile on the way?)
+    // check if the start point has a .mmtile loaded
     Unit const* _sourceUnit = _source->ToUnit();
     if (!_navMesh || !_navMeshQuery || (_sourceUnit && _sourceUnit->HasUnitState(UNIT_STATE_IGNORE_PATHFINDING)) ||
-        !HaveTile(start) || !HaveTile(dest))
+        !HaveTile(start))
     {
         BuildShortcut();
         _type = PathType(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH);
@@ -90,10 +158,47 @@ bool PathGenerator::CalculatePath(float x, float y, float z, float destX, float
 
     UpdateFilter();
 
+    // destinations beyond the path length limit, possibly in tiles that are not loaded yet, follow the tile graph
+    // unless the caller limited the length, such a path always exceeds the limit and has to end up as PATHFIND_SHORT
+    float const maxPathLength = _pointPathLimit * SMOOTH_PATH_STEP_SIZE;
+    if (_useHierarchicalPath && _tileGraph && !_useRaycast && !_pathLengthLimited &&
+        (dest - start).squaredLength() > maxPathLength * maxPathLength &&
+        BuildHierarchicalPath(start, dest))
+        return true;
+
+    // the end point needs a .mmtile loaded too (can we pass via not loaded tile on the way?)
+    if (!HaveTile(dest))
+    {
+        BuildShortcut();
+        _type = PathType(PATHFIND_NORMAL | PATHFIND_NOT_USING_PATH);
+        return true;
+    }
+
+    if (_requestAsync && RequestPolyPath(start, dest))
+        return true;
+
     BuildPolyPath(start, dest);
     return true;
 }
 
+bool PathGenerator::RequestPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos)
+{
+    // raycasts and slope checks need the unit
+    if (!sPathfindingService->IsActive() || _useRaycast || _slopeCheck)
+        return false;
+
+    PathRequest request;
+    request.MapId = _source->GetMapId();
+    request.Start = startPos;
+    request.End = endPos;
+    request.Filter = _filter;
+    request.StraightPath = _useStraightPath;
+    request.PointPathLimit = _pointPathLimit;
+
+    _pendingPath = sPathfindingService->Submit(std::move(request));
+    return true;
+}
+
 dtPolyRef PathGenerator::GetPathPolyByPosition(dtPolyRef const* polyPath, uint32 polyPathSize, float const* point, float* distance) const
 {
     if (!polyPath || !polyPathSize)
@@ -522,6 +627,134 @@ void PathGenerator::BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 con
     BuildPointPath(startPoint, endPoint);
 }
 
+bool PathGenerator::BuildHierarchicalPath(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos)
+{
+    float distToStartPoly;
+    float startPoint[VERTEX_SIZE] = { startPos.y, startPos.z, startPos.x };
+    float endPoint[VERTEX_SIZE] = { endPos.y, endPos.z, endPos.x };
+
+    dtPolyRef startPoly = GetPolyByLocation(startPoint, &distToStartPoly);
+    if (startPoly == INVALID_POLYREF || distToStartPoly > 7.0f)
+        return false;
+
+    // the end tile may not be loaded, then aim for its largest island
+    int32 endNode = -1;
+    if (HaveTile(endPos))
+    {
+        float distToEndPoly;
+        dtPolyRef endPoly = GetPolyByLocation(endPoint, &distToEndPoly);
+        if (endPoly != INVALID_POLYREF)
+            endNode = _tileGraph->GetNode(*_navMesh, endPoly);
+    }
+
+    if (endNode < 0)
+        endNode = _tileGraph->GetLargestNodeAt(*_navMesh, endPoint);
+
+    int32 startNode = _tileGraph->GetNode(*_navMesh, startPoly);
+    if (startNode < 0 || endNode < 0)
+        return false;
+
+    std::vector<G3D::Vector3> waypoints; // detour coordinates
+    if (!_tileGraph->FindRoute(startNode, endNode, waypoints))
+        return false;
+
+    waypoints.emplace_back(endPoint[0], endPoint[1], endPoint[2]);
+
+    Movement::PointsArray pathPoints;
+    pathPoints.push_back(startPos);
+
+    float windowStart[VERTEX_SIZE];
+    dtVcopy(windowStart, startPoint);
+    dtPolyRef windowStartPoly = startPoly;
+    bool complete = false;
+
+    for (std::size_t next = 0; pathPoints.size() < MAX_HIERARCHICAL_PATH_LENGTH;)
+    {
+        // refine up to the farthest waypoint within a grid, so every search stays small
+        std::size_t target = next;
+        while (target + 1 < waypoints.size() &&
+            dtVdist2D(windowStart, &waypoints[target + 1].x) < SIZE_OF_GRIDS)
+            ++target;
+
+        float targetPoint[VERTEX_SIZE];
+        dtVcopy(targetPoint, &waypoints[target].x);
+
+        // stop at the first tile that is not loaded, the rest is built once the unit gets there
+        if (!HaveTile(G3D::Vector3(targetPoint[2], targetPoint[0], targetPoint[1])))
+            break;
+
+        float extents[VERTEX_SIZE] = { 3.0f, 5.0f, 3.0f };
+        float closestPoint[VERTEX_SIZE];
+        dtPolyRef targetPoly = INVALID_POLYREF;
+        if (dtStatusFailed(_navMeshQuery->findNearestPoly(targetPoint, extents, &_filter, &targetPoly, closestPoint)) ||
+            targetPoly == INVALID_POLYREF)
+            break;
+
+        dtPolyRef polys[HIERARCHICAL_WINDOW_POLYS];
+        int polyCount = 0;
+        dtStatus dtResult = _navMeshQuery->findPath(windowStartPoly, targetPoly, windowStart, closestPoint, &_filter,
+            polys, &polyCount, HIERARCHICAL_WINDOW_POLYS);
+        if (dtStatusFailed(dtResult) || !polyCount)
+            break;
+
+        float corners[MAX_POINT_PATH_LENGTH * VERTEX_SIZE];
+        dtPolyRef cornerPolys[MAX_POINT_PATH_LENGTH];
+        int cornerCount = 0;
+        dtResult = _navMeshQuery->findStraightPath(windowStart, closestPoint, polys, polyCount, corners, nullptr, cornerPolys,
+            &cornerCount, MAX_POINT_PATH_LENGTH);
+        if (dtStatusFailed(dtResult) || cornerCount < 2)
+            break;
+
+        // first corner is the window start, which is already part of the path
+        for (int i = 1; i < cornerCount && pathPoints.size() < MAX_HIERARCHICAL_PATH_LENGTH; ++i)
+            pathPoints.emplace_back(corners[i * VERTEX_SIZE + 2], corners[i * VERTEX_SIZE], corners[i * VERTEX_SIZE + 1]);
+
+        // the corners did not fit, go on towards the same waypoint from the last one, on the polygon it enters
+        if (dtStatusDetail(dtResult, DT_BUFFER_TOO_SMALL))
+        {
+            if (cornerPolys[cornerCount - 1] == INVALID_POLYREF)
+                break;
+
+            dtVcopy(windowStart, &corners[(cornerCount - 1) * VERTEX_SIZE]);
+            windowStartPoly = cornerPolys[cornerCount - 1];
+            continue;
+        }
+
+        if (polys[polyCount - 1] != targetPoly)
+            break;
+
+        if (target + 1 == waypoints.size())
+        {
+            complete = true;
+            break;
+        }
+
+        dtVcopy(windowStart, &corners[(cornerCount - 1) * VERTEX_SIZE]);
+        windowStartPoly = targetPoly;
+        next = target + 1;
+    }
+
+    // a forced destination needs the whole way, leave partial paths to the old behaviour
+    if (pathPoints.size() < 2 || (!complete && _forceDestination))
+        return false;
+
+    // the corridors of the windows are not kept
+    _polyLength = 0;
+    _pathPoints = std::move(pathPoints);
+    NormalizePath();
+
+    SetActualEndPosition(_pathPoints.back());
+    _type = complete ? PATHFIND_NORMAL : PATHFIND_INCOMPLETE;
+
+    if (complete && _forceDestination && !InRange(GetEndPosition(), GetActualEndPosition(), 1.0f, 1.0f))
+    {
+        SetActualEndPosition(GetEndPosition());
+        _pathPoints.push_back(GetEndPosition());
+    }
+
+    return true;
+}
+
 void PathGenerator::BuildPointPath(const float* startPoint, const float* endPoint)
 {
     float pathPoints[MAX_POINT_PATH_LENGTH * VERTEX_SIZE];
@@ -603,10 +836,15 @@ void PathGenerator::BuildPointPath(const float* startPoint, const float* endPoin
     for (uint32 i = 0; i < pointCount; ++i)
         _pathPoints[i] = G3D::Vector3(pathPoints[i * VERTEX_SIZE + 2], pathPoints[i * VERTEX_SIZE], pathPoints[i * VERTEX_SIZE + 1]);
 
+    FinalizePointPath();
+}
+
+void PathGenerator::FinalizePointPath()
+{
     NormalizePath();
 
     // first point is always our current location - we need the next one
-    SetActualEndPosition(_pathPoints[pointCount - 1]);
+    SetActualEndPosition(_pathPoints.back());
 
     // force the given destination, if needed
     if (_forceDestination &&
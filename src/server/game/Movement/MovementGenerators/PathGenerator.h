@@ -25,6 +25,7 @@
 #include "MoveSplineInitArgs.h"
 #include "SharedDefines.h"
 #include <G3D/Vector3.h>
+#include <future>
 
 class Unit;
 class WorldObject;
@@ -35,8 +36,14 @@ class WorldObject;
 #define MAX_PATH_LENGTH         74
 #define MAX_POINT_PATH_LENGTH   74
 
+// long paths built along the tile graph, refined one window of about a grid at a time
+#define MAX_HIERARCHICAL_PATH_LENGTH    256
+#define HIERARCHICAL_WINDOW_POLYS       256
+
 #define SMOOTH_PATH_STEP_SIZE   4.0f
 #define SMOOTH_PATH_SLOP        0.3f
+// an async path is moved onto the unit's current position if it drifted at most this far while the path was built
+#define ASYNC_PATH_MAX_START_DRIFT  SMOOTH_PATH_STEP_SIZE
 #define DISALLOW_TIME_AFTER_FAIL    3 // secs
 #define VERTEX_SIZE       3
 #define INVALID_POLYREF   0
@@ -55,6 +62,13 @@ enum PathType
     PATHFIND_FARFROMPOLY       = PATHFIND_FARFROMPOLY_START | PATHFIND_FARFROMPOLY_END, // start or end positions are far from the mmap poligon
 };
 
+// Path built by the PathfindingService, in world coordinates with the start point first
+struct PathResult
+{
+    PathType Type = PATHFIND_BLANK;     // PATHFIND_BLANK: has to be built on the map thread
+    Movement::PointsArray Points;
+};
+
 class PathGenerator
 {
     public:
@@ -65,6 +79,14 @@ class PathGenerator
         // return: true if new path was calculated, false otherwise (no change needed)
         bool CalculatePath(float destX, float destY, float destZ, bool forceDest = false);
         bool CalculatePath(float x, float y, float z, float destX, float destY, float destZ, bool forceDest);
+        // Same as CalculatePath, but the navmesh search runs on the PathfindingService workers if they are active.
+        // Results that need no search are available right away, otherwise HasPendingPath() is true until
+        // CollectPendingPath() takes the path on a later update.
+        bool CalculatePathAsync(float destX, float destY, float destZ, bool forceDest = false);
+        [[nodiscard]] bool HasPendingPath() const { return _pendingPath.valid(); }
+        // return: true if the requested path is ready and available through GetPath()
+        bool CollectPendingPath();
+
         [[nodiscard]] bool IsInvalidDestinationZ(Unit const* target) const;
         [[nodiscard]] bool IsWalkableClimb(float const* v1, float const* v2) const;
         [[nodiscard]] bool IsWalkableClimb(float x, float y, float z, float destX, float destY, float destZ) const;
@@ -79,8 +101,15 @@ class PathGenerator
         // when set, it skips paths with too high slopes (doesn't work with StraightPath enabled)
         void SetSlopeCheck(bool checkSlope) { _slopeCheck = checkSlope; }
         void SetUseStraightPath(bool useStraightPath) { _useStraightPath = useStraightPath; }
-        void SetPathLengthLimit(float distance) { _pointPathLimit = std::min<uint32>(uint32(distance/SMOOTH_PATH_STEP_SIZE), MAX_POINT_PATH_LENGTH); }
+        void SetPathLengthLimit(float distance)
+        {
+            _pointPathLimit = std::min<uint32>(uint32(distance/SMOOTH_PATH_STEP_SIZE), MAX_POINT_PATH_LENGTH);
+            _pathLengthLimited = true;
+        }
         void SetUseRaycast(bool useRaycast) { _useRaycast = useRaycast; }
+        // when set, paths beyond the default path length limit follow the map tile graph if the map has one,
+        // paths with a limit from SetPathLengthLimit never do
+        void SetUseHierarchicalPath(bool useHierarchicalPath) { _useHierarchicalPath = useHierarchicalPath; }
 
         // result getters
         [[nodiscard]] G3D::Vector3 const& GetStartPosition() const { return _startPosition; }
@@ -138,7 +167,11 @@ class PathGenerator
         bool _forceDestination; // when set, we will always arrive at given point
         bool _slopeCheck;       // when set, it skips paths with too high slopes (doesn't work with _useStraightPath)
         uint32 _pointPathLimit; // limit point path size; min(this, MAX_POINT_PATH_LENGTH)
+        bool _pathLengthLimited; // _pointPathLimit was set by the caller
         bool _useRaycast;       // use raycast if true for a straight line path
+        bool _useHierarchicalPath; // use the tile graph for paths longer than the path length limit
+        bool _requestAsync;     // set while CalculatePathAsync runs, the poly path is left to the PathfindingService
+        std::future<PathResult> _pendingPath;
 
         G3D::Vector3 _startPosition;        // {x, y, z} of current location
         G3D::Vector3 _endPosition;          // {x, y, z} of the destination
@@ -147,6 +180,7 @@ class PathGenerator
         WorldObject const* const _source;       // the object that is moving
         dtNavMesh const* _navMesh;              // the nav mesh
         dtNavMeshQuery const* _navMeshQuery;    // the nav mesh query used to find the path
+        MMAP::TileGraph const* _tileGraph;      // tile connectivity of the map, if generated
 
         dtQueryFilterExt _filter;  // use single filter for all movements, update it when needed
 
@@ -164,7 +198,10 @@ class PathGenerator
         [[nodiscard]] bool HaveTile(G3D::Vector3 const& p) const;
 
         void BuildPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos);
+        bool BuildHierarchicalPath(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos);
+        bool RequestPolyPath(G3D::Vector3 const& startPos, G3D::Vector3 const& endPos);
         void BuildPointPath(float const* startPoint, float const* endPoint);
+        void FinalizePointPath();
         void BuildShortcut();
 
         [[nodiscard]] NavTerrain GetNavTerrain(float x, float y, float z) const;
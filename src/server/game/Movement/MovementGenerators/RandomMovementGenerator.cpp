@@ -32,6 +32,102 @@ RandomMovementGenerator<T>::~RandomMovementGenerator() { }
 
 template RandomMovementGenerator<Creature>::~RandomMovementGenerator();
 
+template<>
+bool RandomMovementGenerator<Creature>::_acceptGroundPath(Creature* creature, uint8 newPoint, G3D::Vector3 const& destination, bool pathFound)
+{
+    uint16 pathIdx = uint16(_currentPoint * RANDOM_POINTS_NUMBER + newPoint);
+    auto rejectPoint = [&]()
+    {
+        std::vector<uint8>& validPoints = _validPointsVector[_currentPoint];
+        auto itr = std::find(validPoints.begin(), validPoints.end(), newPoint);
+        if (itr != validPoints.end())
+            validPoints.erase(itr);
+
+        _preComputedPaths.erase(pathIdx);
+        return false;
+    };
+
+    if (!pathFound || (_pathGenerator->GetPathType() & PATHFIND_NOPATH))
+        return rejectPoint();
+
+    // generated path is too long
+    float pathLen = _pathGenerator->getPathLength();
+    if (pathLen * pathLen > creature->GetExactDistSq(destination.x, destination.y, destination.z) * MAX_PATH_LENGHT_FACTOR * MAX_PATH_LENGHT_FACTOR)
+        return rejectPoint();
+
+    Movement::PointsArray& finalPath = _preComputedPaths[pathIdx];
+    finalPath = _pathGenerator->GetPath();
+
+    // no valid path
+    if (finalPath.size() < 2)
+        return rejectPoint();
+
+    Map* map = creature->GetMap();
+    Movement::PointsArray::iterator itr = finalPath.begin();
+    Movement::PointsArray::iterator itrNext = finalPath.begin() + 1;
+    float zDiff, distDiff;
+
+    for (; itrNext != finalPath.end(); ++itr, ++itrNext)
+    {
+        distDiff = std::sqrt(((*itr).x - (*itrNext).x) * ((*itr).x - (*itrNext).x) + ((*itr).y - (*itrNext).y) * ((*itr).y - (*itrNext).y));
+        zDiff = std::fabs((*itr).z - (*itrNext).z);
+
+        // Xinef: tree climbing, cut as much as we can
+        if (zDiff > 2.0f ||
+                (G3D::fuzzyNe(zDiff, 0.0f) && distDiff / zDiff < 2.15f)) // ~25˚
+            return rejectPoint();
+
+        if (!map->isInLineOfSight((*itr).x, (*itr).y, (*itr).z + 2.f, (*itrNext).x, (*itrNext).y, (*itrNext).z + 2.f, creature->GetPhaseMask(),
+            LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::Nothing))
+            return rejectPoint();
+    }
+
+    return true;
+}
+
+template<>
+void RandomMovementGenerator<Creature>::_moveToPoint(Creature* creature, uint8 newPoint)
+{
+    uint16 pathIdx = uint16(_currentPoint * RANDOM_POINTS_NUMBER + newPoint);
+    Movement::PointsArray& finalPath = _preComputedPaths[pathIdx];
+
+    _currentPoint = newPoint;
+    G3D::Vector3& finalPoint = finalPath[finalPath.size() - 1];
+    _currDestPosition.Relocate(finalPoint.x, finalPoint.y, finalPoint.z);
+
+    creature->AddUnitState(UNIT_STATE_ROAMING_MOVE);
+    bool walk = true;
+    switch (creature->GetMovementTemplate().GetRandom())
+    {
+    case CreatureRandomMovementType::CanRun:
+        walk = creature->IsWalking();
+        break;
+    case CreatureRandomMovementType::AlwaysRun:
+        walk = false;
+        break;
+    default:
+        break;
+    }
+
+    Movement::MoveSplineInit init(creature);
+    init.MovebyPath(finalPath);
+    init.SetWalk(walk);
+    init.Launch();
+
+    ++_moveCount;
+    if (roll_chance_i((int32) _moveCount * 25 + 10))
+    {
+        _moveCount = 0;
+        _nextMoveTime.Reset(urand(4000, 8000));
+    }
+    if (sWorld->getBoolConfig(CONFIG_DONT_CACHE_RANDOM_MOVEMENT_PATHS))
+        _preComputedPaths.erase(pathIdx);
+
+    //Call for creature group update
+    if (creature->GetFormation() && creature->GetFormation()->GetLeader() == creature)
+        creature->GetFormation()->LeaderMoveTo(finalPoint.x, finalPoint.y, finalPoint.z, 0);
+}
+
 template<>
 void RandomMovementGenerator<Creature>::_setRandomLocation(Creature* creature)
 {
@@ -73,7 +169,6 @@ void RandomMovementGenerator<Creature>::_setRandomLocation(Creature* creature)
     Movement::PointsArray& finalPath = _preComputedPaths[pathIdx];
     if (finalPath.empty())
     {
-        Map* map = creature->GetMap();
         float x = _destinationPoints[newPoint].x, y = _destinationPoints[newPoint].y, z = _destinationPoints[newPoint].z;
         // invalid coordinates
         if (!Acore::IsValidMapCoord(x, y))
@@ -139,98 +234,21 @@ void RandomMovementGenerator<Creature>::_setRandomLocation(Creature* creature)
             else
                 _pathGenerator->Clear();
 
-            bool result = _pathGenerator->CalculatePath(x, y, levelZ, false);
-            if (result && !(_pathGenerator->GetPathType() & PATHFIND_NOPATH))
+            bool result = _pathGenerator->CalculatePathAsync(x, y, levelZ, false);
+            if (result && _pathGenerator->HasPendingPath())
             {
-                // generated path is too long
-                float pathLen = _pathGenerator->getPathLength();
-                if (pathLen * pathLen > creature->GetExactDistSq(x, y, levelZ) * MAX_PATH_LENGHT_FACTOR * MAX_PATH_LENGHT_FACTOR)
-                {
-                    _validPointsVector[_currentPoint].erase(randomIter);
-                    _preComputedPaths.erase(pathIdx);
-                    return;
-                }
-
-                finalPath = _pathGenerator->GetPath();
-                Movement::PointsArray::iterator itr = finalPath.begin();
-                Movement::PointsArray::iterator itrNext = finalPath.begin() + 1;
-                float zDiff, distDiff;
-
-                for (; itrNext != finalPath.end(); ++itr, ++itrNext)
-                {
-                    distDiff = std::sqrt(((*itr).x - (*itrNext).x) * ((*itr).x - (*itrNext).x) + ((*itr).y - (*itrNext).y) * ((*itr).y - (*itrNext).y));
-                    zDiff = std::fabs((*itr).z - (*itrNext).z);
-
-                    // Xinef: tree climbing, cut as much as we can
-                    if (zDiff > 2.0f ||
-                            (G3D::fuzzyNe(zDiff, 0.0f) && distDiff / zDiff < 2.15f)) // ~25˚
-                    {
-                        _validPointsVector[_currentPoint].erase(randomIter);
-                        _preComputedPaths.erase(pathIdx);
-                        return;
-                    }
-
-                    if (!map->isInLineOfSight((*itr).x, (*itr).y, (*itr).z + 2.f, (*itrNext).x, (*itrNext).y, (*itrNext).z + 2.f, creature->GetPhaseMask(),
-                        LINEOFSIGHT_ALL_CHECKS, VMAP::ModelIgnoreFlags::Nothing))
-                    {
-                        _validPointsVector[_currentPoint].erase(randomIter);
-                        _preComputedPaths.erase(pathIdx);
-                        return;
-                    }
-                }
-
-                // no valid path
-                if (finalPath.size() < 2)
-                {
-                    _validPointsVector[_currentPoint].erase(randomIter);
-                    _preComputedPaths.erase(pathIdx);
-                    return;
-                }
-            }
-            else
-            {
-                _validPointsVector[_currentPoint].erase(randomIter);
-                _preComputedPaths.erase(pathIdx);
+                // DoUpdate picks the path up once the pathfinding workers built it
+                _pendingPoint = newPoint;
+                _pendingDestination = G3D::Vector3(x, y, levelZ);
                 return;
             }
-        }
-    }
-
-    _currentPoint = newPoint;
-    G3D::Vector3& finalPoint = finalPath[finalPath.size() - 1];
-    _currDestPosition.Relocate(finalPoint.x, finalPoint.y, finalPoint.z);
-
-    creature->AddUnitState(UNIT_STATE_ROAMING_MOVE);
-    bool walk = true;
-    switch (creature->GetMovementTemplate().GetRandom())
-    {
-    case CreatureRandomMovementType::CanRun:
-        walk = creature->IsWalking();
-        break;
-    case CreatureRandomMovementType::AlwaysRun:
-        walk = false;
-        break;
-    default:
-        break;
-    }
-
-    Movement::MoveSplineInit init(creature);
-    init.MovebyPath(finalPath);
-    init.SetWalk(walk);
-    init.Launch();
 
-    ++_moveCount;
-    if (roll_chance_i((int32) _moveCount * 25 + 10))
-    {
-        _moveCount = 0;
-        _nextMoveTime.Reset(urand(4000, 8000));
+            if (!_acceptGroundPath(creature, newPoint, G3D::Vector3(x, y, levelZ), result))
+                return;
+        }
     }
-    if (sWorld->getBoolConfig(CONFIG_DONT_CACHE_RANDOM_MOVEMENT_PATHS))
-        _preComputedPaths.erase(pathIdx);
 
-    //Call for creature group update
-    if (creature->GetFormation() && creature->GetFormation()->GetLeader() == creature)
-        creature->GetFormation()->LeaderMoveTo(finalPoint.x, finalPoint.y, finalPoint.z, 0);
+    _moveToPoint(creature, newPoint);
 }
 
 template<>
@@ -257,6 +275,7 @@ void RandomMovementGenerator<Creature>::DoInitialize(Creature* creature)
         }
     }
 
+    _pendingPoint = RANDOM_POINTS_NUMBER;
     creature->AddUnitState(UNIT_STATE_ROAMING | UNIT_STATE_ROAMING_MOVE);
 }
 
@@ -291,6 +310,19 @@ bool RandomMovementGenerator<Creature>::DoUpdate(Creature* creature, const uint3
         return true;
     }
 
+    if (_pendingPoint != RANDOM_POINTS_NUMBER)
+    {
+        if (_pathGenerator->CollectPendingPath())
+        {
+            uint8 newPoint = _pendingPoint;
+            _pendingPoint = RANDOM_POINTS_NUMBER;
+            if (_acceptGroundPath(creature, newPoint, _pendingDestination, true))
+                _moveToPoint(creature, newPoint);
+        }
+
+        return true;
+    }
+
     if (creature->movespline->Finalized())
     {
         _nextMoveTime.Update(diff);
@@ -32,7 +32,7 @@ template<class T>
 class RandomMovementGenerator : public MovementGeneratorMedium< T, RandomMovementGenerator<T> >
 {
 public:
-    RandomMovementGenerator(float wanderDistance = 0.0f) : _nextMoveTime(0), _moveCount(0), _wanderDistance(wanderDistance), _pathGenerator(nullptr), _currentPoint(RANDOM_POINTS_NUMBER)
+    RandomMovementGenerator(float wanderDistance = 0.0f) : _nextMoveTime(0), _moveCount(0), _wanderDistance(wanderDistance), _pathGenerator(nullptr), _currentPoint(RANDOM_POINTS_NUMBER), _pendingPoint(RANDOM_POINTS_NUMBER)
     {
         _initialPosition.Relocate(0.0f, 0.0f, 0.0f, 0.0f);
         _destinationPoints.reserve(RANDOM_POINTS_NUMBER);
@@ -59,6 +59,9 @@ public:
     MovementGeneratorType GetMovementGeneratorType() { return RANDOM_MOTION_TYPE; }
 
 private:
+    bool _acceptGroundPath(T*, uint8 newPoint, G3D::Vector3 const& destination, bool pathFound);
+    void _moveToPoint(T*, uint8 newPoint);
+
     TimeTrackerSmall _nextMoveTime;
     uint8 _moveCount;
     float _wanderDistance;
@@ -67,6 +70,8 @@ private:
     std::vector<uint8> _validPointsVector[RANDOM_POINTS_NUMBER + 1];
     uint8 _currentPoint;
     std::map<uint16, Movement::PointsArray> _preComputedPaths;
+    uint8 _pendingPoint;                // wander point of the path the pathfinding workers are building, RANDOM_POINTS_NUMBER if none
+    G3D::Vector3 _pendingDestination;
     Position _initialPosition, _currDestPosition;
 };
 #endif
@@ -141,8 +141,9 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
         }
     }
 
-    // if we're done moving, we want to clean up
-    if (owner->HasUnitState(UNIT_STATE_CHASE_MOVE) && owner->movespline->Finalized())
+    // if we're done moving, we want to clean up - unless the next path is still being built
+    bool const pathPending = i_path && i_path->HasPendingPath();
+    if (owner->HasUnitState(UNIT_STATE_CHASE_MOVE) && owner->movespline->Finalized() && !pathPending)
     {
         i_recalculateTravel = false;
         i_path = nullptr;
@@ -168,6 +169,16 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
             i_leashExtensionTimer.Reset(cOwner->GetAttackTime(BASE_ATTACK));
     }
 
+    // the path requested from the pathfinding workers arrived, start following it
+    if (pathPending)
+    {
+        if (i_path->CollectPendingPath())
+            LaunchPath(owner, target, true, i_shortenPendingPath, maxTarget);
+
+        // keep following the previous path meanwhile
+        return true;
+    }
+
     // if the target moved, we have to consider whether to adjust
     if (!_lastTargetPosition || target->GetPosition() != _lastTargetPosition.value() || mutualChase != _mutualChase || !owner->IsWithinLOSInMap(target))
     {
@@ -234,54 +245,68 @@ bool ChaseMovementGenerator<T>::DoUpdate(T* owner, uint32 time_diff)
             if (owner->IsHovering())
                 owner->UpdateAllowedPositionZ(x, y, z);
 
-            bool success = i_path->CalculatePath(x, y, z, forceDest);
-            if (!success || i_path->GetPathType() & PATHFIND_NOPATH)
+            bool success = i_path->CalculatePathAsync(x, y, z, forceDest);
+            if (success && i_path->HasPendingPath())
             {
-                if (cOwner)
-                {
-                    cOwner->SetCannotReachTarget(target->GetGUID());
-                }
-
-                owner->StopMoving();
+                i_shortenPendingPath = shortenPath;
                 return true;
             }
 
-            if (shortenPath)
-                i_path->ShortenPathUntilDist(G3D::Vector3(x, y, z), maxTarget);
+            LaunchPath(owner, target, success, shortenPath, maxTarget);
+        }
+    }
 
-            if (cOwner)
-            {
-                cOwner->SetCannotReachTarget();
-            }
+    return true;
+}
 
-            bool walk = false;
-            if (cOwner && !cOwner->IsPet())
-            {
-                switch (cOwner->GetMovementTemplate().GetChase())
-                {
-                case CreatureChaseMovementType::CanWalk:
-                    walk = owner->IsWalking();
-                    break;
-                case CreatureChaseMovementType::AlwaysWalk:
-                    walk = true;
-                    break;
-                default:
-                    break;
-                }
-            }
+template<class T>
+void ChaseMovementGenerator<T>::LaunchPath(T* owner, Unit* target, bool pathFound, bool shortenPath, float maxTarget)
+{
+    Creature* cOwner = owner->ToCreature();
+
+    if (!pathFound || i_path->GetPathType() & PATHFIND_NOPATH)
+    {
+        if (cOwner)
+        {
+            cOwner->SetCannotReachTarget(target->GetGUID());
+        }
+
+        owner->StopMoving();
+        return;
+    }
+
+    if (shortenPath)
+        i_path->ShortenPathUntilDist(i_path->GetEndPosition(), maxTarget);
 
-            owner->AddUnitState(UNIT_STATE_CHASE_MOVE);
-            i_recalculateTravel = true;
+    if (cOwner)
+    {
+        cOwner->SetCannotReachTarget();
+    }
 
-            Movement::MoveSplineInit init(owner);
-            init.MovebyPath(i_path->GetPath());
-            init.SetFacing(target);
-            init.SetWalk(walk);
-            init.Launch();
+    bool walk = false;
+    if (cOwner && !cOwner->IsPet())
+    {
+        switch (cOwner->GetMovementTemplate().GetChase())
+        {
+        case CreatureChaseMovementType::CanWalk:
+            walk = owner->IsWalking();
+            break;
+        case CreatureChaseMovementType::AlwaysWalk:
+            walk = true;
+            break;
+        default:
+            break;
         }
     }
 
-    return true;
+    owner->AddUnitState(UNIT_STATE_CHASE_MOVE);
+    i_recalculateTravel = true;
+
+    Movement::MoveSplineInit init(owner);
+    init.MovebyPath(i_path->GetPath());
+    init.SetFacing(target);
+    init.SetWalk(walk);
+    init.Launch();
 }
 
 //-----------------------------------------------//
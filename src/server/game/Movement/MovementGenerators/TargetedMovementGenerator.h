@@ -59,10 +59,13 @@ public:
     bool HasLostTarget(Unit* unit) const { return unit->GetVictim() != this->GetTarget(); }
 
 private:
+    void LaunchPath(T* owner, Unit* target, bool pathFound, bool shortenPath, float maxTarget);
+
     TimeTrackerSmall i_leashExtensionTimer;
     std::unique_ptr<PathGenerator> i_path;
     TimeTrackerSmall i_recheckDistance;
     bool i_recalculateTravel;
+    bool i_shortenPendingPath = false;
 
     Optional<Position> _lastTargetPosition;
     Optional<ChaseRange> const _range;
@@ -0,0 +1,204 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PathfindingService.h"
+#include "DetourCommon.h"
+#include "Log.h"
+#include "MMapFactory.h"
+#include "MMapMgr.h"
+#include <shared_mutex>
+
+PathfindingService* PathfindingService::instance()
+{
+    static PathfindingService instance;
+    return &instance;
+}
+
+void PathfindingService::Initialize(std::size_t threadCount)
+{
+    _cancelationToken = false;
+
+    _workers.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i)
+        _workers.emplace_back(&PathfindingService::WorkerThread, this);
+
+    LOG_INFO("server.loading", "Pathfinding service started with {} thread(s)", threadCount);
+}
+
+void PathfindingService::Unload()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _cancelationToken = true;
+        _condition.notify_all();
+    }
+
+    for (std::thread& worker : _workers)
+        if (worker.joinable())
+            worker.join();
+
+    _workers.clear();
+
+    // units still waiting build their paths themselves
+    for (QueuedRequest& queued : _queue)
+        queued.Result.set_value(PathResult());
+
+    _queue.clear();
+}
+
+std::future<PathResult> PathfindingService::Submit(PathRequest&& request)
+{
+    QueuedRequest queued;
+    queued.Request = std::move(request);
+    queued.SubmitTime = std::chrono::steady_clock::now();
+    std::future<PathResult> result = queued.Result.get_future();
+
+    std::lock_guard<std::mutex> guard(_lock);
+    _queue.push_back(std::move(queued));
+    _condition.notify_one();
+    return result;
+}
+
+std::size_t PathfindingService::GetQueueSize()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    return _queue.size();
+}
+
+Microseconds PathfindingService::TakeAverageLatency()
+{
+    uint64 const paths = _finishedPaths.exchange(0, std::memory_order_relaxed);
+    uint64 const latency = _totalLatency.exchange(0, std::memory_order_relaxed);
+    return Microseconds(paths ? latency / paths : 0);
+}
+
+void PathfindingService::WorkerThread()
+{
+    std::unordered_map<uint32 /*mapId*/, WorkerQuery> queries;
+
+    for (;;)
+    {
+        QueuedRequest queued;
+        {
+            std::unique_lock<std::mutex> guard(_lock);
+            _condition.wait(guard, [this] { return _cancelationToken || !_queue.empty(); });
+            if (_cancelationToken)
+                break;
+
+            queued = std::move(_queue.front());
+            _queue.pop_front();
+        }
+
+        queued.Result.set_value(BuildPath(queued.Request, queries));
+
+        _totalLatency.fetch_add(std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - queued.SubmitTime).count(), std::memory_order_relaxed);
+        _finishedPaths.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    for (auto& [mapId, query] : queries)
+        dtFreeNavMeshQuery(query.Query);
+}
+
+PathResult PathfindingService::BuildPath(PathRequest const& request, std::unordered_map<uint32, WorkerQuery>& queries)
+{
+    // a PATHFIND_BLANK result makes the requesting PathGenerator build the path on the map thread
+    PathResult result;
+
+    MMAP::MMapMgr* mmap = MMAP::MMapFactory::createOrGetMMapMgr();
+    std::shared_lock<std::shared_mutex> lock(mmap->GetNavMeshLock());
+
+    dtNavMesh const* navMesh = mmap->GetNavMesh(request.MapId);
+    if (!navMesh)
+        return result;
+
+    WorkerQuery& workerQuery = queries[request.MapId];
+    if (workerQuery.NavMesh != navMesh)
+    {
+        if (!workerQuery.Query)
+            workerQuery.Query = dtAllocNavMeshQuery();
+
+        if (dtStatusFailed(workerQuery.Query->init(navMesh, 1024)))
+        {
+            LOG_ERROR("maps", "PathfindingService: Failed to initialize dtNavMeshQuery for mapId {:03}", request.MapId);
+            workerQuery.NavMesh = nullptr;
+            return result;
+        }
+
+        workerQuery.NavMesh = navMesh;
+    }
+
+    dtNavMeshQuery const* query = workerQuery.Query;
+
+    float startPoint[VERTEX_SIZE] = { request.Start.y, request.Start.z, request.Start.x };
+    float endPoint[VERTEX_SIZE] = { request.End.y, request.End.z, request.End.x };
+
+    float extents[VERTEX_SIZE] = { 3.0f, 5.0f, 3.0f };
+    float startClosest[VERTEX_SIZE], endClosest[VERTEX_SIZE];
+    dtPolyRef startPoly = INVALID_POLYREF, endPoly = INVALID_POLYREF;
+    if (dtStatusFailed(query->findNearestPoly(startPoint, extents, &request.Filter, &startPoly, startClosest)) || startPoly == INVALID_POLYREF ||
+        dtStatusFailed(query->findNearestPoly(endPoint, extents, &request.Filter, &endPoly, endClosest)) || endPoly == INVALID_POLYREF)
+        return result;
+
+    // points away from the mesh need the unit to choose between a shortcut and a partial path
+    if (dtVdist(startClosest, startPoint) > 7.0f || dtVdist(endClosest, endPoint) > 7.0f)
+        return result;
+
+    dtPolyRef polys[MAX_PATH_LENGTH];
+    int polyCount = 0;
+    if (dtStatusFailed(query->findPath(startPoly, endPoly, startPoint, endPoint, &request.Filter, polys, &polyCount, MAX_PATH_LENGTH)) || !polyCount)
+    {
+        result.Type = PATHFIND_NOPATH;
+        return result;
+    }
+
+    result.Type = PATHFIND_NORMAL;
+    if (polys[polyCount - 1] != endPoly)
+    {
+        // the search ran out of polygons, get as close as the last one allows
+        query->closestPointOnPoly(polys[polyCount - 1], endPoint, endPoint, nullptr);
+        result.Type = PATHFIND_INCOMPLETE;
+    }
+
+    // a point on every polygon edge crossing keeps long segments on the mesh surface
+    float pathPoints[MAX_POINT_PATH_LENGTH * VERTEX_SIZE];
+    int pointCount = 0;
+    dtStatus dtResult = query->findStraightPath(startPoint, endPoint, polys, polyCount, pathPoints, nullptr, nullptr, &pointCount,
+        request.PointPathLimit, request.StraightPath ? 0 : DT_STRAIGHTPATH_ALL_CROSSINGS);
+
+    // start and end are very close to each other
+    if (polyCount == 1 && pointCount == 1)
+    {
+        dtVcopy(&pathPoints[1 * VERTEX_SIZE], endPoint);
+        pointCount++;
+    }
+    else if (pointCount < 2 || dtStatusFailed(dtResult))
+    {
+        result.Type = PATHFIND_NOPATH;
+        return result;
+    }
+    else if (uint32(pointCount) >= request.PointPathLimit)
+    {
+        result.Type = PATHFIND_SHORT;
+        return result;
+    }
+
+    result.Points.resize(pointCount);
+    for (int i = 0; i < pointCount; ++i)
+        result.Points[i] = G3D::Vector3(pathPoints[i * VERTEX_SIZE + 2], pathPoints[i * VERTEX_SIZE], pathPoints[i * VERTEX_SIZE + 1]);
+
+    return result;
+}
@@ -0,0 +1,98 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_PATHFINDING_SERVICE_H
+#define ACORE_PATHFINDING_SERVICE_H
+
+#include "Define.h"
+#include "Duration.h"
+#include "PathGenerator.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+struct PathRequest
+{
+    uint32 MapId = 0;
+    G3D::Vector3 Start;
+    G3D::Vector3 End;
+    dtQueryFilterExt Filter;
+    bool StraightPath = false;
+    uint32 PointPathLimit = MAX_POINT_PATH_LENGTH;
+};
+
+/**
+ * Builds navmesh paths on background threads.
+ *
+ * PathGenerator::CalculatePathAsync prepares everything that needs the unit or its map on the map
+ * thread and submits the remaining detour work here. Every worker owns one dtNavMeshQuery per
+ * navmesh and holds MMapMgr::GetNavMeshLock() shared while querying, so tiles can still be loaded
+ * and unloaded by the maps. Results are picked up by the map thread on a later update.
+ */
+class AC_GAME_API PathfindingService
+{
+public:
+    static PathfindingService* instance();
+
+    void Initialize(std::size_t threadCount);
+    void Unload();
+    [[nodiscard]] bool IsActive() const { return !_workers.empty(); }
+
+    std::future<PathResult> Submit(PathRequest&& request);
+
+    [[nodiscard]] std::size_t GetQueueSize();
+    /// Average time from submitting to finishing a path, for the paths finished since the last call
+    Microseconds TakeAverageLatency();
+
+private:
+    PathfindingService() = default;
+    ~PathfindingService() = default;
+
+    struct QueuedRequest
+    {
+        PathRequest Request;
+        std::promise<PathResult> Result;
+        TimePoint SubmitTime;
+    };
+
+    struct WorkerQuery
+    {
+        dtNavMesh const* NavMesh = nullptr;
+        dtNavMeshQuery* Query = nullptr;
+    };
+
+    void WorkerThread();
+    static PathResult BuildPath(PathRequest const& request, std::unordered_map<uint32 /*mapId*/, WorkerQuery>& queries);
+
+    std::vector<std::thread> _workers;
+    std::deque<QueuedRequest> _queue;
+    bool _cancelationToken = false;
+    std::mutex _lock;
+    std::condition_variable _condition;
+
+    std::atomic<uint64> _finishedPaths{0};
+    std::atomic<uint64> _totalLatency{0};   // microseconds
+};
+
+#define sPathfindingService PathfindingService::instance()
+
+#endif
@@ -103,3 +103,8 @@ void ScriptMgr::OnPlayerbotLogoutBots()
         script->OnPlayerbotLogoutBots();
     });
 }
+
+bool ScriptMgr::HasPlayerbotScripts() const
+{
+    return !ScriptRegistry<PlayerbotScript>::ScriptPointerList.empty();
+}
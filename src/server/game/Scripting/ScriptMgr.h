@@ -167,7 +167,7 @@ public: /* Unloading */
     void Unload();
 
 public: /* SpellScriptLoader */
-    void CreateSpellScripts(uint32 spellId, std::list<SpellScript*>& scriptVector);
+    void CreateSpellScripts(uint32 spellId, std::vector<SpellScript*>& scriptVector);
     void CreateAuraScripts(uint32 spellId, std::list<AuraScript*>& scriptVector);
     void CreateSpellScriptLoaders(uint32 spellId, std::vector<std::pair<SpellScriptLoader*, std::multimap<uint32, uint32>::iterator>>& scriptVector);
 
@@ -744,6 +744,7 @@ public: /* PlayerbotScript */
     void OnPlayerbotUpdateSessions(Player* player);
     void OnPlayerbotLogout(Player* player);
     void OnPlayerbotLogoutBots();
+    [[nodiscard]] bool HasPlayerbotScripts() const;
 
 public: /* TicketScript */
 
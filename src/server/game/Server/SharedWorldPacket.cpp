@@ -0,0 +1,162 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SharedWorldPacket.h"
+#include "Log.h"
+#include "World.h"
+#include "zlib.h"
+#include <vector>
+
+namespace
+{
+    std::mutex CompressionStatsLock;
+    std::vector<std::shared_ptr<PacketCompressionStats>> CompressionStats;
+
+    /// Deflate stream and output buffer kept alive for the lifetime of a network thread, reset between packets
+    struct DeflateContext
+    {
+        DeflateContext() : Stats(std::make_shared<PacketCompressionStats>())
+        {
+            std::lock_guard<std::mutex> guard(CompressionStatsLock);
+            CompressionStats.push_back(Stats);
+        }
+
+        ~DeflateContext()
+        {
+            if (Level)
+                deflateEnd(&Stream);
+        }
+
+        DeflateContext(DeflateContext const&) = delete;
+        DeflateContext& operator=(DeflateContext const&) = delete;
+
+        bool Prepare(int level)
+        {
+            if (Level == level)
+            {
+                int z_res = deflateReset(&Stream);
+                if (z_res == Z_OK)
+                    return true;
+
+                LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateReset) Error code: {} ({})", z_res, zError(z_res));
+            }
+
+            if (Level)
+                deflateEnd(&Stream);
+
+            Level = 0;
+            Stream.zalloc = (alloc_func)0;
+            Stream.zfree = (free_func)0;
+            Stream.opaque = (voidpf)0;
+
+            int z_res = deflateInit(&Stream, level);
+            if (z_res != Z_OK)
+            {
+                LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflateInit) Error code: {} ({})", z_res, zError(z_res));
+                return false;
+            }
+
+            Level = level;
+            return true;
+        }
+
+        z_stream Stream{};
+        int Level = 0;
+        std::vector<uint8> Buffer;
+        std::shared_ptr<PacketCompressionStats> Stats;
+    };
+
+    thread_local DeflateContext ThreadDeflateContext;
+
+    /// Compresses src into the reusable buffer of the calling thread, returns the compressed size or 0 on failure
+    uint32 CompressBuff(DeflateContext& context, uint8 const* src, uint32 src_size)
+    {
+        // default Z_BEST_SPEED (1)
+        if (!context.Prepare(sWorld->getIntConfig(CONFIG_COMPRESSION)))
+            return 0;
+
+        uLong bound = deflateBound(&context.Stream, src_size);
+        if (context.Buffer.size() < bound)
+            context.Buffer.resize(bound);
+
+        z_stream& c_stream = context.Stream;
+        c_stream.next_out = (Bytef*)context.Buffer.data();
+        c_stream.avail_out = (uInt)context.Buffer.size();
+        c_stream.next_in = (Bytef*)src;
+        c_stream.avail_in = (uInt)src_size;
+
+        int z_res = deflate(&c_stream, Z_FINISH);
+        if (z_res != Z_STREAM_END)
+        {
+            LOG_ERROR("entities.object", "Can't compress update packet (zlib: deflate should report Z_STREAM_END instead {} ({})", z_res, zError(z_res));
+            return 0;
+        }
+
+        return c_stream.total_out;
+    }
+}
+
+std::vector<std::shared_ptr<PacketCompressionStats const>> SharedWorldPacket::GetCompressionStats()
+{
+    std::lock_guard<std::mutex> guard(CompressionStatsLock);
+    return { CompressionStats.begin(), CompressionStats.end() };
+}
+
+WorldPacket const& SharedWorldPacket::GetSendPacket()
+{
+    if (_packet.GetOpcode() != SMSG_UPDATE_OBJECT)
+        return _packet;
+
+    std::call_once(_compressFlag, &SharedWorldPacket::Compress, this);
+    return _compressed ? _compressedPacket : _packet;
+}
+
+void SharedWorldPacket::Compress()
+{
+    _compressed = CompressUpdatePacket(_packet, _compressedPacket);
+}
+
+bool SharedWorldPacket::CompressUpdatePacket(WorldPacket const& packet, WorldPacket& compressed)
+{
+    if (packet.GetOpcode() != SMSG_UPDATE_OBJECT)
+        return false;
+
+    DeflateContext& context = ThreadDeflateContext;
+
+    if (packet.size() <= sWorld->getIntConfig(CONFIG_COMPRESSION_MIN_SIZE))
+    {
+        ++context.Stats->SkippedPackets;
+        return false;
+    }
+
+    TimePoint start = std::chrono::steady_clock::now();
+
+    uint32 pSize = packet.size();
+    uint32 destsize = CompressBuff(context, packet.contents(), pSize);
+    if (destsize == 0)
+        return false;
+
+    compressed.Initialize(SMSG_COMPRESSED_UPDATE_OBJECT, destsize + sizeof(uint32));
+    compressed << uint32(pSize);
+    compressed.append(context.Buffer.data(), destsize);
+
+    ++context.Stats->Packets;
+    context.Stats->BytesIn += pSize;
+    context.Stats->BytesOut += destsize + sizeof(uint32);
+    context.Stats->Time += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
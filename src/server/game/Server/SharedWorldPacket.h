@@ -0,0 +1,71 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SHAREDWORLDPACKET_H
+#define _SHAREDWORLDPACKET_H
+
+#include "WorldPacket.h"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/// Update object compression counters of one network thread
+struct PacketCompressionStats
+{
+    std::atomic<uint64> Packets{0};
+    std::atomic<uint64> SkippedPackets{0};  // update objects below Compression.MinSize
+    std::atomic<uint64> BytesIn{0};
+    std::atomic<uint64> BytesOut{0};
+    std::atomic<uint64> Time{0};            // nanoseconds spent in deflate
+};
+
+/// Immutable payload of an outgoing packet, queued on any number of sockets without being copied.
+/// Packets that need compression are compressed once, by the first socket writing them, and every
+/// other recipient reuses the result. Only the header encryption stays per socket.
+class AC_GAME_API SharedWorldPacket
+{
+public:
+    explicit SharedWorldPacket(WorldPacket const& packet) : _packet(packet) { }
+    explicit SharedWorldPacket(WorldPacket&& packet) : _packet(std::move(packet)) { }
+
+    SharedWorldPacket(SharedWorldPacket const&) = delete;
+    SharedWorldPacket& operator=(SharedWorldPacket const&) = delete;
+
+    [[nodiscard]] WorldPacket const& GetPacket() const { return _packet; }
+
+    /// Packet as written to the socket, compressed when needed. Safe to call from several network threads.
+    [[nodiscard]] WorldPacket const& GetSendPacket();
+
+    /// Counters of every thread that compressed packets so far, in order of first use
+    static std::vector<std::shared_ptr<PacketCompressionStats const>> GetCompressionStats();
+
+    /// Compresses an update object into compressed, returns false when it's below Compression.MinSize or not an update object
+    static bool CompressUpdatePacket(WorldPacket const& packet, WorldPacket& compressed);
+
+private:
+    void Compress();
+
+    WorldPacket _packet;
+    WorldPacket _compressedPacket;
+    std::once_flag _compressFlag;
+    bool _compressed = false;
+};
+
+typedef std::shared_ptr<SharedWorldPacket> SharedWorldPacketPtr;
+
+#endif
@@ -47,6 +47,7 @@
 #include "Transport.h"
 #include "Tokenize.h"
 #include "Vehicle.h"
+#include "WhoListCacheMgr.h"
 #include "WardenWin.h"
 #include "World.h"
 #include "WorldGlobals.h"
@@ -103,6 +104,18 @@ bool WorldSessionFilter::Process(WorldPacket* packet)
     return !player->IsInWorld();
 }
 
+std::atomic<uint64> WorldSession::_headlessPacketsAvoided(0);
+
+void WorldSession::CountHeadlessPacketAvoided()
+{
+    _headlessPacketsAvoided.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool WorldSession::CanSkipPacketBuild() const
+{
+    return IsHeadless() && !sScriptMgr->HasPlayerbotScripts();
+}
+
 /// WorldSession constructor
 WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldSocket> sock, AccountTypes sec, uint8 expansion,
     time_t mute_time, LocaleConstant locale, uint32 recruiter, bool isARecruiter, bool skipQueue, uint32 TotalTime, bool isBot) :
@@ -136,7 +149,8 @@ WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldS
     _timeSyncClockDeltaQueue(6),
     _timeSyncClockDelta(0),
     _pendingTimeSyncRequests(),
-    _isBot(isBot)
+    _isBot(isBot),
+    _headless(!sock && isBot && sWorld->getBoolConfig(CONFIG_HEADLESS_BOT_SESSIONS))
 {
     memset(m_Tutorials, 0, sizeof(m_Tutorials));
 
@@ -229,17 +243,39 @@ ObjectGuid::LowType WorldSession::GetGuidLow() const
 
 /// Send a packet to the client
 void WorldSession::SendPacket(WorldPacket const* packet)
+{
+    if (PrepareSendPacket(packet))
+        m_Socket->SendPacket(*packet);
+}
+
+void WorldSession::SendPacket(WorldPacket const* packet, SharedWorldPacketPtr& sharedPacket)
+{
+    if (!PrepareSendPacket(packet))
+        return;
+
+    if (!sharedPacket)
+        sharedPacket = std::make_shared<SharedWorldPacket>(*packet);
+
+    m_Socket->SendPacket(sharedPacket);
+}
+
+bool WorldSession::PrepareSendPacket(WorldPacket const* packet)
 {
     if (packet->GetOpcode() == NULL_OPCODE)
     {
         LOG_ERROR("network.opcode", "{} send NULL_OPCODE", GetPlayerInfo());
-        return;
+        return false;
     }
 
     sScriptMgr->OnPlayerbotPacketSent(GetPlayer(), packet);
 
     if (!m_Socket)
-        return;
+    {
+        if (IsHeadless())
+            CountHeadlessPacketAvoided();
+
+        return false;
+    }
 
 #if defined(ACORE_DEBUG)
     // Code for network use statistic
@@ -277,12 +313,7 @@ void WorldSession::SendPacket(WorldPacket const* packet)
     }
 #endif                                                      // !ACORE_DEBUG
 
-    if (!sScriptMgr->CanPacketSend(this, *packet))
-    {
-        return;
-    }
-
-    m_Socket->SendPacket(*packet);
+    return sScriptMgr->CanPacketSend(this, *packet);
 }
 
 /// Add an incoming packet to the queue
@@ -764,6 +795,8 @@ void WorldSession::LogoutPlayer(bool save)
         uint32 statementParam = GetAccountId();
         sScriptMgr->OnDatabaseSelectIndexLogout(_player, statementIndex, statementParam);
 
+        sWhoListCacheMgr->ScheduleUpdate(_player->GetGUID());
+
         //! Remove the player from the world
         // the player may not be in the world when logging out
         // e.g if he got disconnected during a transfer to another map
@@ -32,6 +32,7 @@
 #include "QueryHolder.h"
 #include "Packet.h"
 #include "SharedDefines.h"
+#include "SharedWorldPacket.h"
 #include "World.h"
 #include <map>
 #include <memory>
@@ -366,6 +367,8 @@ public:
     void WriteMovementInfo(WorldPacket* data, MovementInfo* mi);
 
     void SendPacket(WorldPacket const* packet);
+    /// Broadcast variant: the first recipient with a socket creates sharedPacket, later ones queue the same payload
+    void SendPacket(WorldPacket const* packet, SharedWorldPacketPtr& sharedPacket);
     void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName* declinedName);
     void SendPartyResult(PartyOperation operation, std::string const& member, PartyResult res, uint32 val = 0);
 
@@ -1121,6 +1124,18 @@ public:                                                 // opcodes handlers
         return _isBot;
     }
 
+    /// Socketless session whose outgoing packets nobody reads. Update blocks for it are not built and its packets
+    /// only reach the script hooks, never a socket.
+    [[nodiscard]] bool IsHeadless() const { return _headless; }
+    void SetHeadless(bool headless) { _headless = headless && !m_Socket; }
+
+    /// Headless and no playerbot script listens to the packets, so broadcasts for it do not need to be built at all
+    [[nodiscard]] bool CanSkipPacketBuild() const;
+
+    /// Packets and update blocks skipped because their receiver was headless, since startup
+    static uint64 GetHeadlessPacketsAvoided() { return _headlessPacketsAvoided.load(std::memory_order_relaxed); }
+    static void CountHeadlessPacketAvoided();
+
 private:
     void ProcessQueryCallbacks();
 
@@ -1165,6 +1180,9 @@ private:
 
     bool recoveryItem(Item* pItem);
 
+    /// Common checks and hooks of SendPacket, true when the packet has to go to the socket
+    bool PrepareSendPacket(WorldPacket const* packet);
+
     // logging helper
     void LogUnexpectedOpcode(WorldPacket* packet, char const* status, const char* reason);
     void LogUnprocessedTail(WorldPacket* packet);
@@ -1231,6 +1249,9 @@ private:
     uint32 _timeSyncTimer;
 
     bool _isBot;
+    bool _headless;
+
+    static std::atomic<uint64> _headlessPacketsAvoided;
 
     WorldSession(WorldSession const& right) = delete;
     WorldSession& operator=(WorldSession const& right) = delete;
@@ -21,6 +21,7 @@
 #include "AuthCrypt.h"
 #include "Common.h"
 #include "MPSCQueue.h"
+#include "SharedWorldPacket.h"
 #include "Socket.h"
 #include "Util.h"
 #include "WorldPacket.h"
@@ -29,23 +30,40 @@
 
 using boost::asio::ip::tcp;
 
-class EncryptableAndCompressiblePacket : public WorldPacket
+/// Socket queue entry, owns a copy of a packet sent to this socket only or refers to a payload shared with the queues of other sockets
+class EncryptableAndCompressiblePacket
 {
 public:
-    EncryptableAndCompressiblePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt)
+    EncryptableAndCompressiblePacket(WorldPacket const& packet, bool encrypt) : _packet(packet), _encrypt(encrypt)
+    {
+        SocketQueueLink.store(nullptr, std::memory_order_relaxed);
+    }
+
+    EncryptableAndCompressiblePacket(SharedWorldPacketPtr packet, bool encrypt) : _sharedPacket(std::move(packet)), _encrypt(encrypt)
     {
         SocketQueueLink.store(nullptr, std::memory_order_relaxed);
     }
 
     bool NeedsEncryption() const { return _encrypt; }
 
-    bool NeedsCompression() const { return GetOpcode() == SMSG_UPDATE_OBJECT && size() > 100; }
+    /// Payload to write, compressed when needed
+    WorldPacket const& GetPacket()
+    {
+        if (_sharedPacket)
+            return _sharedPacket->GetSendPacket();
+
+        WorldPacket compressed;
+        if (SharedWorldPacket::CompressUpdatePacket(_packet, compressed))
+            _packet = std::move(compressed);
 
-    void CompressIfNeeded();
+        return _packet;
+    }
 
     std::atomic<EncryptableAndCompressiblePacket*> SocketQueueLink;
 
 private:
+    WorldPacket _packet;
+    SharedWorldPacketPtr _sharedPacket;
     bool _encrypt;
 };
 
@@ -82,6 +100,7 @@ public:
     bool Update() override;
 
     void SendPacket(WorldPacket const& packet);
+    void SendPacket(SharedWorldPacketPtr const& packet);
 
     void SetSendBufferSize(std::size_t sendBufferSize) { _sendBufferSize = sendBufferSize; }
 
@@ -445,6 +445,26 @@ int32 AuraEffect::GetMiscValue() const
     return m_spellInfo->Effects[m_effIndex].MiscValue;
 }
 
+void AuraEffect::SetAmount(int32 amount)
+{
+    m_amount = amount;
+    m_canBeRecalculated = false;
+    InvalidateTargetModifierCaches();
+}
+
+void AuraEffect::SetEnabled(bool enabled)
+{
+    m_isAuraEnabled = enabled;
+    InvalidateTargetModifierCaches();
+}
+
+void AuraEffect::InvalidateTargetModifierCaches()
+{
+    // targets cache the totals of registered effects, see Unit::GetTotalAuraModifier
+    for (auto const& [guid, aurApp] : GetBase()->GetApplicationMap())
+        aurApp->GetTarget()->InvalidateAuraModifierCache(GetAuraType());
+}
+
 AuraType AuraEffect::GetAuraType() const
 {
     return (AuraType)m_spellInfo->Effects[m_effIndex].ApplyAuraName;
@@ -734,7 +754,10 @@ void AuraEffect::ChangeAmount(int32 newAmount, bool mark, bool onStackOrReapply)
     if (handleMask & AURA_EFFECT_HANDLE_CHANGE_AMOUNT)
     {
         if (!mark)
+        {
             m_amount = newAmount;
+            InvalidateTargetModifierCaches();
+        }
         else
             SetAmount(newAmount);
         CalculateSpellMod();
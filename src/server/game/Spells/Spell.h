@@ -23,6 +23,7 @@
 #include "LootMgr.h"
 #include "PathGenerator.h"
 #include "SharedDefines.h"
+#include "SpellAllocator.h"
 #include "SpellInfo.h"
 #include "Unit.h"
 
@@ -267,6 +268,8 @@ struct TargetInfo
     int32  damage;
 };
 
+typedef std::list<TargetInfo, SpellPoolAllocator<TargetInfo, SPELL_ALLOCATION_UNIT_TARGET>> TargetInfoList;
+
 static const uint32 SPELL_INTERRUPT_NONPLAYER = 32747;
 
 struct TriggeredByAuraSpellData
@@ -291,6 +294,9 @@ public:
     Spell(Unit* caster, SpellInfo const* info, TriggerCastFlags triggerFlags, ObjectGuid originalCasterGUID = ObjectGuid::Empty, bool skipCheck = false);
     ~Spell();
 
+    static void* operator new(std::size_t size) { return SpellAllocator::Allocate(size, SPELL_ALLOCATION_SPELL); }
+    static void operator delete(void* ptr, std::size_t size) { SpellAllocator::Deallocate(ptr, size); }
+
     void EffectNULL(SpellEffIndex effIndex);
     void EffectUnused(SpellEffIndex effIndex);
     void EffectDistract(SpellEffIndex effIndex);
@@ -588,7 +594,7 @@ public:
 
     // xinef: moved to public
     void LoadScripts();
-    std::list<TargetInfo>* GetUniqueTargetInfo() { return &m_UniqueTargetInfo; }
+    TargetInfoList* GetUniqueTargetInfo() { return &m_UniqueTargetInfo; }
 
     [[nodiscard]] uint32 GetTriggeredByAuraTickNumber() const { return m_triggeredByAuraSpell.tickNumber; }
 
@@ -683,7 +689,7 @@ public:
     // *****************************************
     // Spell target subsystem
     // *****************************************
-    std::list<TargetInfo> m_UniqueTargetInfo;
+    TargetInfoList m_UniqueTargetInfo;
     uint8 m_channelTargetEffectMask;                        // Mask req. alive targets
 
     struct GOTargetInfo
@@ -693,14 +699,16 @@ public:
         uint8  effectMask: 8;
         bool   processed: 1;
     };
-    std::list<GOTargetInfo> m_UniqueGOTargetInfo;
+    typedef std::list<GOTargetInfo, SpellPoolAllocator<GOTargetInfo, SPELL_ALLOCATION_GO_TARGET>> GOTargetInfoList;
+    GOTargetInfoList m_UniqueGOTargetInfo;
 
     struct ItemTargetInfo
     {
         Item*  item;
         uint8 effectMask;
     };
-    std::list<ItemTargetInfo> m_UniqueItemInfo;
+    typedef std::list<ItemTargetInfo, SpellPoolAllocator<ItemTargetInfo, SPELL_ALLOCATION_ITEM_TARGET>> ItemTargetInfoList;
+    ItemTargetInfoList m_UniqueItemInfo;
 
     SpellDestination m_destTargets[MAX_SPELL_EFFECTS];
 
@@ -742,7 +750,7 @@ public:
     void CallScriptObjectTargetSelectHandlers(WorldObject*& target, SpellEffIndex effIndex, SpellImplicitTargetInfo const& targetType);
     void CallScriptDestinationTargetSelectHandlers(SpellDestination& target, SpellEffIndex effIndex, SpellImplicitTargetInfo const& targetType);
     bool CheckScriptEffectImplicitTargets(uint32 effIndex, uint32 effIndexToCheck);
-    std::list<SpellScript*> m_loadedScripts;
+    std::vector<SpellScript*> m_loadedScripts;
 
     struct HitTriggerSpell
     {
@@ -754,7 +762,7 @@ public:
 
     bool CanExecuteTriggersOnHit(uint8 effMask, SpellInfo const* triggeredByAura = nullptr) const;
     void PrepareTriggersExecutedOnHit();
-    typedef std::list<HitTriggerSpell> HitTriggerSpellList;
+    typedef std::vector<HitTriggerSpell> HitTriggerSpellList;
     HitTriggerSpellList m_hitTriggerSpells;
 
     // effect helpers
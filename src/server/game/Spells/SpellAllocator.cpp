@@ -0,0 +1,147 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SpellAllocator.h"
+#include <array>
+#include <mutex>
+
+namespace
+{
+    constexpr std::size_t SIZE_CLASS_GRANULARITY = 16;
+    constexpr std::size_t MAX_POOLED_SIZE = 16 * 1024;
+    constexpr std::size_t MAX_SIZE_CLASSES = MAX_POOLED_SIZE / SIZE_CLASS_GRANULARITY;
+    constexpr std::size_t MAX_CACHED_BYTES_PER_CLASS = 1024 * 1024; // released blocks above this go back to the heap
+
+    std::mutex AllocationStatsLock;
+    std::vector<std::shared_ptr<SpellAllocationStats>> AllocationStats;
+
+    struct FreeBlock
+    {
+        FreeBlock* Next;
+    };
+
+    struct SpellAllocationPool
+    {
+        SpellAllocationPool() : Stats(std::make_shared<SpellAllocationStats>())
+        {
+            std::lock_guard<std::mutex> guard(AllocationStatsLock);
+            AllocationStats.push_back(Stats);
+        }
+
+        ~SpellAllocationPool();
+
+        SpellAllocationPool(SpellAllocationPool const&) = delete;
+        SpellAllocationPool& operator=(SpellAllocationPool const&) = delete;
+
+        std::array<FreeBlock*, MAX_SIZE_CLASSES> FreeLists{};
+        std::array<std::size_t, MAX_SIZE_CLASSES> CachedBytes{};
+        std::shared_ptr<SpellAllocationStats> Stats;
+    };
+
+    // set once the pool of the thread is gone, spells destroyed later by other thread_local or static destructors go straight to the heap
+    thread_local bool ThreadPoolDestroyed = false;
+    thread_local SpellAllocationPool ThreadPool;
+
+    SpellAllocationPool::~SpellAllocationPool()
+    {
+        ThreadPoolDestroyed = true;
+
+        for (FreeBlock* block : FreeLists)
+        {
+            while (block)
+            {
+                FreeBlock* next = block->Next;
+                ::operator delete(block);
+                block = next;
+            }
+        }
+    }
+
+    inline std::size_t GetSizeClass(std::size_t size)
+    {
+        return (size - 1) / SIZE_CLASS_GRANULARITY;
+    }
+}
+
+void* SpellAllocator::Allocate(std::size_t size, SpellAllocationKind kind)
+{
+    if (size == 0 || size > MAX_POOLED_SIZE || ThreadPoolDestroyed)
+        return ::operator new(size);
+
+    SpellAllocationPool& pool = ThreadPool;
+    std::size_t sizeClass = GetSizeClass(size);
+    if (FreeBlock* block = pool.FreeLists[sizeClass])
+    {
+        pool.FreeLists[sizeClass] = block->Next;
+        pool.CachedBytes[sizeClass] -= (sizeClass + 1) * SIZE_CLASS_GRANULARITY;
+        pool.Stats->Pooled[kind].fetch_add(1, std::memory_order_relaxed);
+        return block;
+    }
+
+    pool.Stats->Heap[kind].fetch_add(1, std::memory_order_relaxed);
+    // allocate the full size class so the block can serve any request of the class later on
+    return ::operator new((sizeClass + 1) * SIZE_CLASS_GRANULARITY);
+}
+
+void SpellAllocator::Deallocate(void* ptr, std::size_t size) noexcept
+{
+    if (!ptr)
+        return;
+
+    if (size == 0 || size > MAX_POOLED_SIZE || ThreadPoolDestroyed)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    SpellAllocationPool& pool = ThreadPool;
+    std::size_t sizeClass = GetSizeClass(size);
+    std::size_t blockSize = (sizeClass + 1) * SIZE_CLASS_GRANULARITY;
+    if (pool.CachedBytes[sizeClass] + blockSize > MAX_CACHED_BYTES_PER_CLASS)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    FreeBlock* block = static_cast<FreeBlock*>(ptr);
+    block->Next = pool.FreeLists[sizeClass];
+    pool.FreeLists[sizeClass] = block;
+    pool.CachedBytes[sizeClass] += blockSize;
+}
+
+std::vector<std::shared_ptr<SpellAllocationStats const>> SpellAllocator::GetStats()
+{
+    std::lock_guard<std::mutex> guard(AllocationStatsLock);
+    return { AllocationStats.begin(), AllocationStats.end() };
+}
+
+char const* SpellAllocator::GetKindName(SpellAllocationKind kind)
+{
+    switch (kind)
+    {
+        case SPELL_ALLOCATION_SPELL:
+            return "spell";
+        case SPELL_ALLOCATION_UNIT_TARGET:
+            return "unit_target";
+        case SPELL_ALLOCATION_GO_TARGET:
+            return "go_target";
+        case SPELL_ALLOCATION_ITEM_TARGET:
+            return "item_target";
+        default:
+            return "unknown";
+    }
+}
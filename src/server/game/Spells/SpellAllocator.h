@@ -0,0 +1,102 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_SPELL_ALLOCATOR_H
+#define ACORE_SPELL_ALLOCATOR_H
+
+#include "Define.h"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+/**
+ * Recycles the memory of Spell objects and the nodes of their target lists.
+ *
+ * Every thread keeps free lists of released blocks sorted by size, so a map thread casting thousands of spells
+ * per second reuses the blocks of its previous casts instead of going to the global heap each time. Blocks are
+ * plain operator new allocations: a spell released on another thread (delayed events, world thread cleanup)
+ * simply joins the free list of that thread.
+ */
+enum SpellAllocationKind
+{
+    SPELL_ALLOCATION_SPELL          = 0,
+    SPELL_ALLOCATION_UNIT_TARGET    = 1,
+    SPELL_ALLOCATION_GO_TARGET      = 2,
+    SPELL_ALLOCATION_ITEM_TARGET    = 3,
+    MAX_SPELL_ALLOCATION_KINDS
+};
+
+/// Allocation counters of one thread
+struct SpellAllocationStats
+{
+    std::atomic<uint64> Pooled[MAX_SPELL_ALLOCATION_KINDS] = { };    // served from the free lists
+    std::atomic<uint64> Heap[MAX_SPELL_ALLOCATION_KINDS] = { };      // free list empty, taken from operator new
+};
+
+namespace SpellAllocator
+{
+    AC_GAME_API void* Allocate(std::size_t size, SpellAllocationKind kind);
+    AC_GAME_API void Deallocate(void* ptr, std::size_t size) noexcept;
+
+    /// Counters of every thread that allocated spells so far, in order of first use
+    AC_GAME_API std::vector<std::shared_ptr<SpellAllocationStats const>> GetStats();
+
+    AC_GAME_API char const* GetKindName(SpellAllocationKind kind);
+}
+
+/// Standard allocator for node based containers owned by a Spell, single elements go through the thread free lists
+template<class T, SpellAllocationKind Kind>
+class SpellPoolAllocator
+{
+public:
+    typedef T value_type;
+
+    template<class U>
+    struct rebind
+    {
+        typedef SpellPoolAllocator<U, Kind> other;
+    };
+
+    SpellPoolAllocator() noexcept = default;
+    template<class U>
+    SpellPoolAllocator(SpellPoolAllocator<U, Kind> const&) noexcept { }
+
+    T* allocate(std::size_t n)
+    {
+        if (n == 1)
+            return static_cast<T*>(SpellAllocator::Allocate(sizeof(T), Kind));
+
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t n) noexcept
+    {
+        if (n == 1)
+            SpellAllocator::Deallocate(ptr, sizeof(T));
+        else
+            ::operator delete(ptr);
+    }
+
+    template<class U>
+    bool operator==(SpellPoolAllocator<U, Kind> const&) const noexcept { return true; }
+    template<class U>
+    bool operator!=(SpellPoolAllocator<U, Kind> const&) const noexcept { return false; }
+};
+
+#endif
@@ -139,6 +139,12 @@ public:
 
     void operator()(Player* player)
     {
+        if (player->GetSession()->CanSkipPacketBuild())
+        {
+            WorldSession::CountHeadlessPacketAvoided();
+            return;
+        }
+
         LocaleConstant loc_idx = player->GetSession()->GetSessionDbLocaleIndex();
         WorldPacket* messageTemplate;
         std::size_t whisperGUIDpos;
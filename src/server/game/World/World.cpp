@@ -900,7 +900,7 @@ void World::SetInitialWorldSettings()
     // our speed up
     _timers[WUPDATE_5_SECS].SetInterval(5 * IN_MILLISECONDS);
 
-    _timers[WUPDATE_WHO_LIST].SetInterval(5 * IN_MILLISECONDS); // update who list cache every 5 seconds
+    _timers[WUPDATE_WHO_LIST].SetInterval(5 * IN_MILLISECONDS); // check who list cache for unscheduled changes every 5 seconds
 
     _mail_expire_check_timer = GameTime::GetGameTime() + 6h;
 
@@ -1117,11 +1117,15 @@ void World::Update(uint32 diff)
     }
 
     ///- Update Who List Cache
-    if (_timers[WUPDATE_WHO_LIST].Passed())
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update who list"));
-        _timers[WUPDATE_WHO_LIST].Reset();
         sWhoListCacheMgr->Update();
+
+        if (_timers[WUPDATE_WHO_LIST].Passed())
+        {
+            _timers[WUPDATE_WHO_LIST].Reset();
+            sWhoListCacheMgr->Resync();
+        }
     }
 
     {
@@ -142,6 +142,7 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_DURABILITY_LOSS_IN_PVP, "DurabilityLoss.InPvP", false);
 
     SetConfigValue<uint32>(CONFIG_COMPRESSION, "Compression", 1, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value > 0 && value < 10; }, "> 0 && < 10");
+    SetConfigValue<uint32>(CONFIG_COMPRESSION_MIN_SIZE, "Compression.MinSize", 100);
 
     SetConfigValue<bool>(CONFIG_ADDON_CHANNEL, "AddonChannel", true);
     SetConfigValue<bool>(CONFIG_CLEAN_CHARACTER_DB, "CleanCharacterDB", false);
@@ -160,6 +161,7 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<uint32>(CONFIG_INTERVAL_SAVE, "PlayerSaveInterval", 900000);
     SetConfigValue<uint32>(CONFIG_INTERVAL_DISCONNECT_TOLERANCE, "DisconnectToleranceInterval", 0);
     SetConfigValue<bool>(CONFIG_STATS_SAVE_ONLY_ON_LOGOUT, "PlayerSave.Stats.SaveOnlyOnLogout", true);
+    SetConfigValue<bool>(CONFIG_PLAYER_SAVE_FULL_ON_LOGOUT, "PlayerSave.FullSaveOnLogout", true);
 
     SetConfigValue<uint32>(CONFIG_MIN_LEVEL_STAT_SAVE, "PlayerSave.Stats.MinLevel", 0, ConfigValueCache::Reloadable::Yes, [](uint32 const& value) { return value < MAX_LEVEL; }, "< MAX_LEVEL");
 
@@ -530,6 +532,10 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_SHOW_MUTE_IN_WORLD, "ShowMuteInWorld", false);
     SetConfigValue<bool>(CONFIG_SHOW_BAN_IN_WORLD, "ShowBanInWorld", false);
     SetConfigValue<uint32>(CONFIG_NUMTHREADS, "MapUpdate.Threads", 1);
+    SetConfigValue<bool>(CONFIG_HEADLESS_BOT_SESSIONS, "HeadlessBotSessions", false);
+    SetConfigValue<uint32>(CONFIG_GRID_PRELOAD_THREADS, "MapUpdate.GridPreload.Threads", 0, ConfigValueCache::Reloadable::No);
+    SetConfigValue<uint32>(CONFIG_GRID_PRELOAD_LOOKAHEAD, "MapUpdate.GridPreload.LookAhead", 10);
+    SetConfigValue<std::string>(CONFIG_TERRAIN_PINNED_MAPS, "Terrain.PinnedMaps", "", ConfigValueCache::Reloadable::No);
     SetConfigValue<uint32>(CONFIG_MAX_RESULTS_LOOKUP_COMMANDS, "Command.LookupMaxResults", 0);
 
     // Warden
@@ -566,6 +572,8 @@ void WorldConfig::BuildConfigCache()
     SetConfigValue<bool>(CONFIG_PDUMP_NO_PATHS, "PlayerDump.DisallowPaths", true);
     SetConfigValue<bool>(CONFIG_PDUMP_NO_OVERWRITE, "PlayerDump.DisallowOverwrite", true);
     SetConfigValue<bool>(CONFIG_ENABLE_MMAPS, "MoveMaps.Enable", true);
+    SetConfigValue<bool>(CONFIG_MMAPS_HIERARCHICAL, "MoveMaps.Hierarchical.Enable", false);
+    SetConfigValue<uint32>(CONFIG_PATHFINDING_THREADS, "MoveMaps.Async.Threads", 0, ConfigValueCache::Reloadable::No);
 
     // Wintergrasp
     SetConfigValue<uint32>(CONFIG_WINTERGRASP_ENABLE, "Wintergrasp.Enable", 1);
@@ -628,6 +636,8 @@ void WorldConfig::BuildConfigCache()
     //Debug
     SetConfigValue<bool>(CONFIG_DEBUG_BATTLEGROUND, "Debug.Battleground", false);
     SetConfigValue<bool>(CONFIG_DEBUG_ARENA, "Debug.Arena", false);
+    SetConfigValue<bool>(CONFIG_DEBUG_VISIBILITY_INDEX, "Debug.VisibilityIndex", false);
+    SetConfigValue<bool>(CONFIG_DEBUG_AURA_MODIFIER_CACHE, "Debug.AuraModifierCache", false);
 
     SetConfigValue<uint32>(CONFIG_GM_LEVEL_CHANNEL_MODERATION, "Channel.ModerationGMLevel", 1);
 
@@ -27,6 +27,7 @@ enum ServerConfigs
     CONFIG_ALLOW_PLAYER_COMMANDS,
     CONFIG_CLEAN_CHARACTER_DB,
     CONFIG_STATS_SAVE_ONLY_ON_LOGOUT,
+    CONFIG_PLAYER_SAVE_FULL_ON_LOGOUT,
     CONFIG_ALLOW_TWO_SIDE_ACCOUNTS,
     CONFIG_ALLOW_TWO_SIDE_INTERACTION_CALENDAR,
     CONFIG_ALLOW_TWO_SIDE_INTERACTION_CHAT,
@@ -98,6 +99,8 @@ enum ServerConfigs
     CONFIG_PDUMP_NO_PATHS,
     CONFIG_PDUMP_NO_OVERWRITE,
     CONFIG_ENABLE_MMAPS,
+    CONFIG_MMAPS_HIERARCHICAL,
+    CONFIG_PATHFINDING_THREADS,
     CONFIG_ENABLE_LOGIN_AFTER_DC,
     CONFIG_DONT_CACHE_RANDOM_MOVEMENT_PATHS,
     CONFIG_QUEST_IGNORE_AUTO_ACCEPT,
@@ -119,6 +122,8 @@ enum ServerConfigs
     CONFIG_ITEMDELETE_VENDOR,
     CONFIG_DEBUG_BATTLEGROUND,
     CONFIG_DEBUG_ARENA,
+    CONFIG_DEBUG_VISIBILITY_INDEX,
+    CONFIG_DEBUG_AURA_MODIFIER_CACHE,
     CONFIG_DUNGEON_ACCESS_REQUIREMENTS_PORTAL_CHECK_ILVL,
     CONFIG_DUNGEON_ACCESS_REQUIREMENTS_LFG_DBC_LEVEL_OVERRIDE,
     CONFIG_REGEN_HP_CANNOT_REACH_TARGET_IN_RAID,
@@ -158,6 +163,7 @@ enum ServerConfigs
     CONFIG_RESPAWN_DYNAMICRATE_GAMEOBJECT,
     CONFIG_RESPAWN_DYNAMICRATE_CREATURE,
     CONFIG_COMPRESSION,
+    CONFIG_COMPRESSION_MIN_SIZE,
     CONFIG_INTERVAL_MAPUPDATE,
     CONFIG_INTERVAL_CHANGEWEATHER,
     CONFIG_INTERVAL_DISCONNECT_TOLERANCE,
@@ -291,6 +297,10 @@ enum ServerConfigs
     CONFIG_PVP_TOKEN_COUNT,
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_NUMTHREADS,
+    CONFIG_HEADLESS_BOT_SESSIONS,
+    CONFIG_GRID_PRELOAD_THREADS,
+    CONFIG_GRID_PRELOAD_LOOKAHEAD,
+    CONFIG_TERRAIN_PINNED_MAPS,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_TELEPORT_TIMEOUT_NEAR,
@@ -21,6 +21,7 @@
 #include "Channel.h"
 #include "Chat.h"
 #include "CommandScript.h"
+#include "ConditionMgr.h"
 #include "GridNotifiersImpl.h"
 #include "LFGMgr.h"
 #include "Language.h"
@@ -99,7 +100,8 @@ public:
             { "objectcount",    HandleDebugObjectCountCommand,         SEC_ADMINISTRATOR, Console::Yes},
             { "dummy",          HandleDebugDummyCommand,               SEC_ADMINISTRATOR, Console::No },
             { "mapdata",        HandleDebugMapDataCommand,             SEC_ADMINISTRATOR, Console::No },
-            { "boundary",       HandleDebugBoundaryCommand,            SEC_ADMINISTRATOR, Console::No }
+            { "boundary",       HandleDebugBoundaryCommand,            SEC_ADMINISTRATOR, Console::No },
+            { "conditions",     HandleDebugConditionsCommand,          SEC_ADMINISTRATOR, Console::No }
         };
         static ChatCommandTable commandTable =
         {
@@ -1403,6 +1405,43 @@ public:
 
         return true;
     }
+
+    // evaluates every loaded condition list against the player and the selected target
+    static bool HandleDebugConditionsCommand(ChatHandler* handler, Optional<uint32> iterationsArg)
+    {
+        Player* player = handler->GetPlayer();
+        if (!player)
+            return false;
+
+        WorldObject* target = handler->getSelectedObject();
+        if (!target)
+            target = player;
+
+        uint32 iterations = std::clamp<uint32>(iterationsArg.value_or(10), 1, 1000);
+
+        std::vector<ConditionSpan> lists = sConditionMgr->GetAllConditionLists();
+        std::size_t conditionCount = 0;
+        for (ConditionSpan conditions : lists)
+            conditionCount += conditions.size();
+
+        uint64 metCount = 0;
+        auto startTime = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < iterations; ++i)
+        {
+            for (ConditionSpan conditions : lists)
+            {
+                ConditionSourceInfo info = ConditionSourceInfo(player, target, player->GetVictim());
+                if (sConditionMgr->IsObjectMeetToConditions(info, conditions))
+                    ++metCount;
+            }
+        }
+
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+        uint64 evaluations = uint64(iterations) * lists.size();
+        handler->PSendSysMessage("Conditions benchmark: {} lists with {} conditions, {} evaluations in {} us ({} ns each), {} met",
+            lists.size(), conditionCount, evaluations, elapsed.count() / 1000, evaluations ? elapsed.count() / evaluations : 0, metCount);
+        return true;
+    }
 };
 
 void AddSC_debug_commandscript()
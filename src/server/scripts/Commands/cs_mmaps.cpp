@@ -45,6 +45,7 @@ public:
     {
         static ChatCommandTable mmapCommandTable =
         {
+            { "benchmark",   HandleMmapBenchmarkCommand,   SEC_ADMINISTRATOR, Console::No },
             { "loadedtiles", HandleMmapLoadedTilesCommand, SEC_ADMINISTRATOR, Console::No },
             { "loc",         HandleMmapLocCommand,         SEC_ADMINISTRATOR, Console::No },
             { "path",        HandleMmapPathCommand,        SEC_ADMINISTRATOR, Console::No },
@@ -259,6 +260,69 @@ public:
         return true;
     }
 
+    static bool HandleMmapBenchmarkCommand(ChatHandler* handler)
+    {
+        Player* player = handler->GetSession()->GetPlayer();
+        MMAP::MMapMgr* manager = MMAP::MMapFactory::createOrGetMMapMgr();
+        if (!manager->GetNavMesh(player->GetMapId()))
+        {
+            handler->PSendSysMessage("NavMesh not loaded for current map.");
+            return true;
+        }
+
+        if (!manager->GetTileGraph(player->GetMapId()))
+            handler->PSendSysMessage("No tile graph for current map, hierarchical paths fall back to the regular ones.");
+
+        // fixed set of long distance destinations around the player
+        std::vector<G3D::Vector3> destinations;
+        for (float distance : { 500.0f, 1000.0f, 2000.0f })
+        {
+            for (uint32 i = 0; i < 8; ++i)
+            {
+                float angle = i * float(M_PI) / 4.0f;
+                float x = player->GetPositionX() + distance * std::cos(angle);
+                float y = player->GetPositionY() + distance * std::sin(angle);
+                if (!Acore::IsValidMapCoord(x, y))
+                    continue;
+
+                float z = player->GetMap()->GetHeight(player->GetPhaseMask(), x, y, MAX_HEIGHT);
+                if (z <= INVALID_HEIGHT)
+                    z = player->GetPositionZ();
+
+                destinations.emplace_back(x, y, z);
+            }
+        }
+
+        handler->PSendSysMessage("mmap benchmark: {} destinations up to 2000 yards away", destinations.size());
+
+        for (bool hierarchical : { false, true })
+        {
+            uint32 completePaths = 0;
+            uint32 pointCount = 0;
+            float pathLength = 0.0f;
+
+            auto startTime = std::chrono::steady_clock::now();
+            for (G3D::Vector3 const& destination : destinations)
+            {
+                PathGenerator path(player);
+                path.SetUseHierarchicalPath(hierarchical);
+                path.CalculatePath(destination.x, destination.y, destination.z);
+
+                if (path.GetPathType() == PATHFIND_NORMAL)
+                    ++completePaths;
+
+                pointCount += path.GetPath().size();
+                pathLength += path.getPathLength();
+            }
+
+            auto elapsed = std::chrono::duration_cast<Microseconds>(std::chrono::steady_clock::now() - startTime);
+            handler->PSendSysMessage("{}: {} us, {} complete paths, {} points, {:.1f} yards overall",
+                hierarchical ? "Hierarchical" : "Regular", elapsed.count(), completePaths, pointCount, pathLength);
+        }
+
+        return true;
+    }
+
     static bool HandleMmapTestArea(ChatHandler* handler)
     {
         float radius = 40.0f;
@@ -17,6 +17,7 @@
 
 #include "AchievementMgr.h"
 #include "AuctionHouseMgr.h"
+#include "AuctionHouseSearcher.h"
 #include "AutobroadcastMgr.h"
 #include "BattlegroundMgr.h"
 #include "Chat.h"
@@ -1118,6 +1119,7 @@ public:
     {
         LOG_INFO("server.loading", "Reloading Item Template Locale ... ");
         sObjectMgr->LoadItemLocales();
+        sAuctionMgr->GetAuctionHouseSearcher()->ClearItemNames();
         handler->SendGlobalGMSysMessage("DB table `item_template_locale` reloaded.");
         return true;
     }
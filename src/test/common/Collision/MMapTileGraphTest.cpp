@@ -0,0 +1,187 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MMapTileGraph.h"
+#include "DetourNavMeshBuilder.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    constexpr float TILE_SIZE = 10.0f;
+    constexpr int NVP = 6;
+    // neighbour encoding of recast poly meshes, as taken by dtCreateNavMeshData
+    constexpr unsigned short NULL_IDX = 0xffff;
+    constexpr unsigned short PORTAL_NEG_X = 0x8000 | 0;
+    constexpr unsigned short PORTAL_POS_X = 0x8000 | 2;
+
+    struct TestPoly
+    {
+        std::vector<unsigned short> Verts;
+        std::vector<unsigned short> Neis;
+    };
+
+    void AddTile(dtNavMesh* navMesh, int tileX, std::vector<unsigned short> const& verts, std::vector<TestPoly> const& polys)
+    {
+        std::vector<unsigned short> polyData(polys.size() * NVP * 2, NULL_IDX);
+        for (std::size_t i = 0; i < polys.size(); ++i)
+        {
+            for (std::size_t v = 0; v < polys[i].Verts.size(); ++v)
+            {
+                polyData[i * NVP * 2 + v] = polys[i].Verts[v];
+                polyData[i * NVP * 2 + NVP + v] = polys[i].Neis[v];
+            }
+        }
+
+        std::vector<unsigned short> flags(polys.size(), 1);
+        std::vector<unsigned char> areas(polys.size(), 0);
+
+        dtNavMeshCreateParams params;
+        memset(&params, 0, sizeof(params));
+        params.verts = verts.data();
+        params.vertCount = int(verts.size() / 3);
+        params.polys = polyData.data();
+        params.polyFlags = flags.data();
+        params.polyAreas = areas.data();
+        params.polyCount = int(polys.size());
+        params.nvp = NVP;
+        params.walkableHeight = 2.0f;
+        params.walkableRadius = 0.5f;
+        params.walkableClimb = 1.0f;
+        params.tileX = tileX;
+        params.tileY = 0;
+        params.bmin[0] = tileX * TILE_SIZE;
+        params.bmax[0] = (tileX + 1) * TILE_SIZE;
+        params.bmax[1] = 1.0f;
+        params.bmax[2] = TILE_SIZE;
+        params.cs = 1.0f;
+        params.ch = 1.0f;
+        params.buildBvTree = true;
+
+        unsigned char* data = nullptr;
+        int dataSize = 0;
+        ASSERT_TRUE(dtCreateNavMeshData(&params, &data, &dataSize));
+        ASSERT_FALSE(dtStatusFailed(navMesh->addTile(data, dataSize, DT_TILE_FREE_DATA, 0, nullptr)));
+    }
+
+    // Three tiles in a row, the middle one has two connected polygons and an island nobody can reach
+    dtNavMesh* CreateNavMesh()
+    {
+        dtNavMeshParams params;
+        memset(&params, 0, sizeof(params));
+        params.tileWidth = TILE_SIZE;
+        params.tileHeight = TILE_SIZE;
+        params.maxTiles = 8;
+        params.maxPolys = 16;
+
+        dtNavMesh* navMesh = dtAllocNavMesh();
+        EXPECT_FALSE(dtStatusFailed(navMesh->init(&params)));
+
+        std::vector<unsigned short> const quad = { 0, 0, 0,  0, 0, 5,  10, 0, 5,  10, 0, 0 };
+        TestPoly const border = { { 0, 1, 2, 3 }, { PORTAL_NEG_X, NULL_IDX, PORTAL_POS_X, NULL_IDX } };
+        AddTile(navMesh, 0, quad, { border });
+        AddTile(navMesh, 2, quad, { border });
+
+        std::vector<unsigned short> const middle =
+        {
+            0, 0, 0,  5, 0, 0,  10, 0, 0,
+            0, 0, 5,  5, 0, 5,  10, 0, 5,
+            0, 0, 7,  10, 0, 7,  0, 0, 10,  10, 0, 10
+        };
+        AddTile(navMesh, 1, middle,
+        {
+            { { 0, 3, 4, 1 }, { PORTAL_NEG_X, NULL_IDX, 1, NULL_IDX } },
+            { { 1, 4, 5, 2 }, { 0, NULL_IDX, PORTAL_POS_X, NULL_IDX } },
+            { { 6, 8, 9, 7 }, { NULL_IDX, NULL_IDX, NULL_IDX, NULL_IDX } }
+        });
+
+        return navMesh;
+    }
+
+    int32 NodeAt(MMAP::TileGraph const& graph, dtNavMesh const& navMesh, float x, float z)
+    {
+        dtMeshTile const* tile = navMesh.getTileAt(int(x / TILE_SIZE), 0, 0);
+        if (!tile)
+            return -1;
+
+        for (int i = 0; i < tile->header->polyCount; ++i)
+        {
+            dtPoly const& poly = tile->polys[i];
+            float const* v0 = &tile->verts[poly.verts[0] * 3];
+            float const* v2 = &tile->verts[poly.verts[2] * 3];
+            if (x >= std::min(v0[0], v2[0]) && x <= std::max(v0[0], v2[0]) && z >= std::min(v0[2], v2[2]) && z <= std::max(v0[2], v2[2]))
+                return graph.GetNode(navMesh, navMesh.getPolyRefBase(tile) | dtPolyRef(i));
+        }
+
+        return -1;
+    }
+}
+
+TEST(MMapTileGraphTest, BuildsIslandsAndPortals)
+{
+    dtNavMesh* navMesh = CreateNavMesh();
+
+    MMAP::TileGraph graph;
+    graph.Build(*navMesh);
+
+    // the two connected polygons of the middle tile share a node, the unreachable one gets its own
+    EXPECT_EQ(graph.GetNodeCount(), 4u);
+    EXPECT_EQ(graph.GetEdgeCount(), 4u);
+    EXPECT_EQ(NodeAt(graph, *navMesh, 12.0f, 2.0f), NodeAt(graph, *navMesh, 18.0f, 2.0f));
+    EXPECT_NE(NodeAt(graph, *navMesh, 12.0f, 2.0f), NodeAt(graph, *navMesh, 12.0f, 8.0f));
+
+    std::vector<G3D::Vector3> portals;
+    ASSERT_TRUE(graph.FindRoute(NodeAt(graph, *navMesh, 2.0f, 2.0f), NodeAt(graph, *navMesh, 28.0f, 2.0f), portals));
+    ASSERT_EQ(portals.size(), 2u);
+    EXPECT_FLOAT_EQ(portals[0].x, 10.0f);
+    EXPECT_FLOAT_EQ(portals[1].x, 20.0f);
+
+    EXPECT_FALSE(graph.FindRoute(NodeAt(graph, *navMesh, 2.0f, 2.0f), NodeAt(graph, *navMesh, 12.0f, 8.0f), portals));
+
+    float const pos[3] = { 15.0f, 0.0f, 5.0f };
+    EXPECT_EQ(graph.GetLargestNodeAt(*navMesh, pos), NodeAt(graph, *navMesh, 12.0f, 2.0f));
+
+    dtFreeNavMesh(navMesh);
+}
+
+TEST(MMapTileGraphTest, SaveAndLoad)
+{
+    dtNavMesh* navMesh = CreateNavMesh();
+
+    MMAP::TileGraph graph;
+    graph.Build(*navMesh);
+
+    boost::filesystem::path fileName = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("%%%%%%.mmgraph");
+    ASSERT_TRUE(graph.Save(fileName.string()));
+
+    MMAP::TileGraph loaded;
+    ASSERT_TRUE(loaded.Load(fileName.string()));
+    boost::filesystem::remove(fileName);
+
+    EXPECT_EQ(loaded.GetNodeCount(), graph.GetNodeCount());
+    EXPECT_EQ(loaded.GetEdgeCount(), graph.GetEdgeCount());
+
+    std::vector<G3D::Vector3> portals;
+    EXPECT_TRUE(loaded.FindRoute(NodeAt(loaded, *navMesh, 2.0f, 2.0f), NodeAt(loaded, *navMesh, 28.0f, 2.0f), portals));
+    EXPECT_EQ(portals.size(), 2u);
+
+    dtFreeNavMesh(navMesh);
+}
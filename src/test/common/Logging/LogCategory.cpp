@@ -0,0 +1,86 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Config.h"
+#include "Log.h"
+#include "gtest/gtest.h"
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+
+class LogCategoryTest : public testing::Test {
+protected:
+    void SetUp() override {
+        auto tempFile = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("deleteme.ini");
+        confFilePath = tempFile.string();
+
+        std::ofstream iniStream(confFilePath);
+        iniStream << "[test]\n";
+        iniStream << "Appender.Console = 1,6,0\n";
+        iniStream << "Logger.root = 2,Console\n";
+        iniStream << "Logger.test = 4,Console\n";
+        iniStream << "Logger.test.quiet = 0,Console\n";
+        iniStream.close();
+
+        sConfigMgr->Configure(confFilePath, std::vector<std::string>());
+        sConfigMgr->LoadAppConfigs();
+        sLog->LoadFromConfig();
+    }
+
+    void TearDown() override {
+        sLog->Close();
+        std::remove(confFilePath.c_str());
+    }
+
+    std::string confFilePath;
+};
+
+TEST_F(LogCategoryTest, MatchesShouldLog)
+{
+    LogCategory child("test.child.grandchild");
+    LogCategory quiet("test.quiet");
+    LogCategory unknown("unknown");
+
+    for (LogCategory const* category : { &child, &quiet, &unknown })
+        for (uint8 level = LOG_LEVEL_FATAL; level <= LOG_LEVEL_TRACE; ++level)
+            EXPECT_EQ(category->ShouldLog(LogLevel(level)), sLog->ShouldLog(category->GetType(), LogLevel(level))) << category->GetType() << " " << uint32(level);
+
+    EXPECT_TRUE(child.ShouldLog(LOG_LEVEL_INFO));
+    EXPECT_FALSE(child.ShouldLog(LOG_LEVEL_DEBUG));
+    EXPECT_FALSE(quiet.ShouldLog(LOG_LEVEL_FATAL));
+    EXPECT_TRUE(unknown.ShouldLog(LOG_LEVEL_ERROR));
+}
+
+TEST_F(LogCategoryTest, FollowsSetLogLevel)
+{
+    LogCategory category("test.child");
+    EXPECT_FALSE(category.ShouldLog(LOG_LEVEL_TRACE));
+
+    ASSERT_TRUE(sLog->SetLogLevel("test", LOG_LEVEL_TRACE));
+    EXPECT_TRUE(category.ShouldLog(LOG_LEVEL_TRACE));
+
+    ASSERT_TRUE(sLog->SetLogLevel("test", LOG_LEVEL_DISABLED));
+    EXPECT_FALSE(category.ShouldLog(LOG_LEVEL_FATAL));
+
+    // a reload starts from the config again
+    sLog->LoadFromConfig();
+    EXPECT_TRUE(category.ShouldLog(LOG_LEVEL_INFO));
+    EXPECT_FALSE(category.ShouldLog(LOG_LEVEL_DEBUG));
+
+    sLog->Close();
+    EXPECT_FALSE(category.ShouldLog(LOG_LEVEL_FATAL));
+}
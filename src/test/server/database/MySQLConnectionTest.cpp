@@ -0,0 +1,78 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MySQLConnection.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    bool Split(std::string_view sql, uint32 paramCount)
+    {
+        std::string_view head, tuple;
+        return MySQLConnection::SplitRowTuple(sql, paramCount, head, tuple);
+    }
+}
+
+TEST(MySQLConnectionTest, SplitsRowTuple)
+{
+    std::string_view head, tuple;
+    ASSERT_TRUE(MySQLConnection::SplitRowTuple("INSERT INTO character_spell (guid, spell, specMask) VALUES (?, ?, ?)", 3, head, tuple));
+    EXPECT_EQ(head, "INSERT INTO character_spell (guid, spell, specMask) VALUES ");
+    EXPECT_EQ(tuple, "(?, ?, ?)");
+
+    ASSERT_TRUE(MySQLConnection::SplitRowTuple("  replace into `character_settings` (`guid`, `source`, `data`) values(?,?,?) ;\n", 3, head, tuple));
+    EXPECT_EQ(head, "replace into `character_settings` (`guid`, `source`, `data`) values");
+    EXPECT_EQ(tuple, "(?,?,?)");
+}
+
+TEST(MySQLConnectionTest, RejectsQuotedCommas)
+{
+    EXPECT_FALSE(Split("INSERT INTO t (a, b) VALUES (?, 'x,y')", 1));
+    EXPECT_FALSE(Split("INSERT INTO t (a, b) VALUES (?, \"x,y\")", 1));
+    EXPECT_FALSE(Split("INSERT INTO t (a, b, c) VALUES (?, ',', ?)", 2));
+}
+
+TEST(MySQLConnectionTest, RejectsParenthesesInStrings)
+{
+    EXPECT_FALSE(Split("INSERT INTO t (a, b) VALUES (?, ')')", 1));
+    EXPECT_FALSE(Split("INSERT INTO t (a, b) VALUES (?, '(')", 1));
+    EXPECT_FALSE(Split("INSERT INTO t (a, b) VALUES ('(', ?)", 1));
+    EXPECT_FALSE(Split("INSERT INTO t (a, b) VALUES (?, '(?)')", 2));
+}
+
+TEST(MySQLConnectionTest, RequiresEveryPlaceholderInTheTuple)
+{
+    // placeholder count must match the statement
+    EXPECT_FALSE(Split("INSERT INTO t (a, b) VALUES (?, ?)", 3));
+    EXPECT_FALSE(Split("INSERT INTO t (a, b) VALUES (?, ?)", 1));
+
+    // a '?' inside a literal is no placeholder
+    EXPECT_FALSE(Split("INSERT INTO t (a, b) VALUES (?, '?')", 2));
+
+    // function calls make the tuple ambiguous
+    EXPECT_FALSE(Split("INSERT INTO t (a, b) VALUES (?, UNIX_TIMESTAMP())", 1));
+    EXPECT_FALSE(Split("INSERT INTO t (a, b) VALUES (?, FROM_UNIXTIME(?))", 2));
+}
+
+TEST(MySQLConnectionTest, RejectsOtherStatements)
+{
+    EXPECT_FALSE(Split("DELETE FROM t WHERE a IN (?)", 1));
+    EXPECT_FALSE(Split("UPDATE t SET a = ? WHERE b = (?)", 2));
+    EXPECT_FALSE(Split("INSERT INTO t (a, b) VALUES (?, ?) ON DUPLICATE KEY UPDATE b = ?", 3));
+    EXPECT_FALSE(Split("INSERT INTO t (a) SELECT a FROM u WHERE b IN (?)", 1));
+    EXPECT_FALSE(Split("INSERT INTO t (a, b) VALUES (?, ?), (?, ?)", 4));
+}
@@ -0,0 +1,212 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "AuctionHouseSearcher.h"
+#include "WorldMock.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <random>
+
+using namespace testing;
+
+namespace
+{
+    void MockWorld()
+    {
+        auto worldMock = new NiceMock<WorldMock>();
+        ON_CALL(*worldMock, GetAvailableDbcLocale(_)).WillByDefault(Return(LOCALE_enUS));
+        sWorld.reset(worldMock);
+    }
+
+    AuctionHouseSearchInfo MakeSearchInfo()
+    {
+        AuctionHouseSearchInfo searchInfo;
+        searchInfo.listfrom = 0;
+        searchInfo.levelmin = 0;
+        searchInfo.levelmax = 0;
+        searchInfo.usable = false;
+        searchInfo.inventoryType = 0xffffffff;
+        searchInfo.itemClass = 0xffffffff;
+        searchInfo.itemSubClass = 0xffffffff;
+        searchInfo.quality = 0xffffffff;
+        searchInfo.getAll = false;
+        return searchInfo;
+    }
+
+    AuctionSortInfo MakeSortInfo(AuctionSortOrder sortOrder, bool isDesc)
+    {
+        AuctionSortInfo sortInfo;
+        sortInfo.sortOrder = sortOrder;
+        sortInfo.isDesc = isDesc;
+        return sortInfo;
+    }
+
+    AuctionSearchListRequest MakeRequest(AuctionHouseSearchInfo searchInfo)
+    {
+        AuctionHousePlayerInfo playerInfo;
+        playerInfo.loc_idx = LOCALE_enUS;
+        return AuctionSearchListRequest(AuctionHouseFaction::Neutral, std::move(searchInfo), std::move(playerInfo));
+    }
+
+    // what the searcher sent before the indexes existed
+    std::vector<uint32> ScanPage(AuctionSearchIndex const& index, AuctionSearchListRequest const& request, uint32& totalCount)
+    {
+        SortableAuctionEntriesList auctions;
+        for (auto const& [auctionId, auction] : index.GetAuctions())
+            if (AuctionSearchIndex::Matches(*auction, request))
+                auctions.push_back(auction.get());
+
+        std::sort(auctions.begin(), auctions.end(), AuctionSorter(&request.searchInfo.sorting, request.playerInfo.loc_idx, index.GetWorker()));
+
+        std::vector<uint32> page;
+        for (std::size_t i = request.searchInfo.listfrom; i < auctions.size() && page.size() < MAX_AUCTIONS_PER_PAGE; ++i)
+            page.push_back(auctions[i]->Id);
+
+        totalCount = auctions.size();
+        return page;
+    }
+
+    std::vector<uint32> SearchPage(AuctionSearchIndex& index, AuctionSearchListRequest const& request, uint32& totalCount)
+    {
+        SortableAuctionEntriesList auctions;
+        totalCount = index.SearchPage(request, auctions);
+
+        std::vector<uint32> page;
+        for (SearchableAuctionEntry const* auction : auctions)
+            page.push_back(auction->Id);
+
+        return page;
+    }
+}
+
+TEST(AuctionSearchIndexTest, InternsItemNames)
+{
+    MockWorld();
+
+    ItemTemplate proto;
+    proto.ItemId = 1;
+    proto.Name1 = "Heavy Silk Bandage";
+
+    AuctionItemNameTable names;
+    std::shared_ptr<AuctionItemName const> name = names.GetName(&proto, 0);
+    EXPECT_EQ(names.GetName(&proto, 0), name);
+    EXPECT_NE(names.GetName(&proto, -5), name);
+    EXPECT_EQ(name->Get(LOCALE_enUS), L"heavy silk bandage");
+    EXPECT_EQ(name->Get(LOCALE_deDE), L"heavy silk bandage");
+}
+
+TEST(AuctionSearchIndexTest, MatchesScan)
+{
+    MockWorld();
+    std::mt19937 random(1234);
+
+    std::vector<ItemTemplate> templates(200);
+    for (uint32 i = 0; i < templates.size(); ++i)
+    {
+        templates[i].ItemId = i + 1;
+        templates[i].Class = random() % 4;
+        templates[i].SubClass = random() % 3;
+        templates[i].InventoryType = random() % 2 ? INVTYPE_CHEST : (random() % 2 ? INVTYPE_ROBE : INVTYPE_FEET);
+        templates[i].Quality = random() % MAX_ITEM_QUALITY;
+        templates[i].RequiredLevel = random() % 81;
+        for (uint32 length = 4 + i % 6; templates[i].Name1.size() < length;)
+            templates[i].Name1 += char('a' + random() % 5);
+    }
+
+    AuctionItemNameTable names;
+
+    // the index belongs to the second of two workers, the bids of the first one must stay untouched
+    uint32 const workerCount = 2;
+    uint32 const worker = 1;
+
+    AuctionSearchIndex index;
+    index.SetWorker(worker);
+    auto addAuction = [&](uint32 id)
+    {
+        std::shared_ptr<SearchableAuctionEntry> auction = std::make_shared<SearchableAuctionEntry>();
+        auction->Id = id;
+        auction->buyout = id * 7919 % 100003;               // unique, so the orderings have no ties
+        auction->bids.assign(workerCount, { 0, ObjectGuid::Empty });
+        auction->startbid = 1;
+        auction->item.itemTemplate = &templates[random() % templates.size()];
+        auction->item.itemName = names.GetName(auction->item.itemTemplate, 0);
+
+        index.Add(auction);
+    };
+
+    for (uint32 id = 1; id <= 20000; ++id)
+        addAuction(id);
+
+    std::vector<AuctionSearchListRequest> requests;
+    AuctionHouseSearchInfo searchInfo = MakeSearchInfo();
+    searchInfo.sorting.push_back(MakeSortInfo(AUCTION_SORT_BUYOUT_2, false));
+    requests.push_back(MakeRequest(searchInfo));            // presorted ordering
+
+    searchInfo.listfrom = 150;
+    searchInfo.itemClass = 2;
+    requests.push_back(MakeRequest(searchInfo));
+
+    searchInfo.listfrom = 0;
+    searchInfo.inventoryType = INVTYPE_CHEST;
+    searchInfo.quality = 3;
+    searchInfo.levelmin = 10;
+    searchInfo.levelmax = 40;
+    requests.push_back(MakeRequest(searchInfo));            // only the window of the matches is sorted
+
+    searchInfo = MakeSearchInfo();
+    searchInfo.wsearchedname = L"abc";
+    searchInfo.sorting.push_back(MakeSortInfo(AUCTION_SORT_BUYOUT_2, true));
+    requests.push_back(MakeRequest(searchInfo));
+
+    searchInfo.wsearchedname = L"zzz";
+    requests.push_back(MakeRequest(searchInfo));
+
+    // the orderings have to follow auctions being added, sold and outbid
+    for (int round = 0; round < 2; ++round)
+    {
+        for (AuctionSearchListRequest const& request : requests)
+        {
+            uint32 scanCount = 0, searchCount = 0;
+            EXPECT_EQ(SearchPage(index, request, searchCount), ScanPage(index, request, scanCount));
+            EXPECT_EQ(searchCount, scanCount);
+        }
+
+        for (uint32 id = 1; id <= 20000; id += 5)
+            index.Remove(id);
+
+        for (uint32 id = 20001; id <= 22000; ++id)
+            addAuction(id);
+    }
+
+    AuctionHouseSearchInfo bidSearchInfo = MakeSearchInfo();
+    bidSearchInfo.sorting.push_back(MakeSortInfo(AUCTION_SORT_BID, true));
+    AuctionSearchListRequest bidRequest = MakeRequest(bidSearchInfo);
+
+    uint32 totalCount = 0;
+    std::vector<uint32> page = SearchPage(index, bidRequest, totalCount);
+    ASSERT_FALSE(page.empty());
+
+    uint32 const outbidId = page.back();
+    index.UpdateBid(outbidId, 1000000, ObjectGuid::Empty);
+    page = SearchPage(index, bidRequest, totalCount);
+    EXPECT_EQ(page.front(), outbidId);
+
+    SearchableAuctionEntry const& outbid = *index.GetAuctions().at(outbidId);
+    EXPECT_EQ(outbid.bids[worker].bid, 1000000u);
+    EXPECT_EQ(outbid.bids[0].bid, 0u);
+}
@@ -0,0 +1,138 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WhoListCacheMgr.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <random>
+
+namespace
+{
+    WhoListPlayerInfo MakePlayer(uint32 counter, std::wstring const& name, uint8 level, uint8 clss, uint8 race, uint32 zoneId)
+    {
+        std::string narrowName(name.begin(), name.end());
+        return WhoListPlayerInfo(ObjectGuid::Create<HighGuid::Player>(counter), TEAM_ALLIANCE, SEC_PLAYER, level, clss, race, zoneId, 0, true, 0,
+            name, L"", narrowName, "");
+    }
+
+    // what the who handler matched before the indexes existed
+    std::vector<ObjectGuid> ScanPlayers(WhoListIndex const& index, WhoListQuery const& query)
+    {
+        std::vector<ObjectGuid> result;
+        index.ForEach([&](WhoListPlayerInfo const& info)
+        {
+            if (info.GetLevel() < query.LevelMin || info.GetLevel() > query.LevelMax)
+                return;
+
+            if (!(query.ClassMask & (1 << info.GetClass())) || !(query.RaceMask & (1 << info.GetRace())))
+                return;
+
+            if (!query.ZoneIds.empty() && std::find(query.ZoneIds.begin(), query.ZoneIds.end(), info.GetZoneId()) == query.ZoneIds.end())
+                return;
+
+            if (!query.PlayerName.empty() && info.GetWidePlayerName().find(query.PlayerName) == std::wstring::npos)
+                return;
+
+            result.push_back(info.GetGuid());
+        });
+
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    std::vector<ObjectGuid> SearchPlayers(WhoListIndex const& index, WhoListQuery const& query)
+    {
+        std::vector<WhoListPlayerInfo const*> players;
+        index.Search(query, players);
+
+        std::vector<ObjectGuid> result;
+        for (WhoListPlayerInfo const* info : players)
+            result.push_back(info->GetGuid());
+
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+}
+
+TEST(WhoListIndexTest, UpdateAndRemove)
+{
+    WhoListIndex index;
+    index.Update(MakePlayer(1, L"arthas", 10, CLASS_PALADIN, RACE_HUMAN, 12));
+    index.Update(MakePlayer(2, L"jaina", 20, CLASS_MAGE, RACE_HUMAN, 12));
+
+    WhoListQuery query;
+    query.PlayerName = L"tha";
+    EXPECT_EQ(SearchPlayers(index, query).size(), 1u);
+
+    // moving to another level and zone leaves the old buckets
+    index.Update(MakePlayer(1, L"arthas", 80, CLASS_DEATH_KNIGHT, RACE_HUMAN, 65));
+    query = WhoListQuery();
+    query.LevelMin = 1;
+    query.LevelMax = 70;
+    EXPECT_EQ(SearchPlayers(index, query).size(), 1u);
+    query.LevelMax = 80;
+    query.ZoneIds = { 65 };
+    EXPECT_EQ(SearchPlayers(index, query).size(), 1u);
+
+    index.Remove(ObjectGuid::Create<HighGuid::Player>(1));
+    EXPECT_EQ(index.GetSize(), 1u);
+    EXPECT_TRUE(SearchPlayers(index, query).empty());
+
+    query = WhoListQuery();
+    query.PlayerName = L"arthas";
+    EXPECT_TRUE(SearchPlayers(index, query).empty());
+}
+
+TEST(WhoListIndexTest, MatchesScan)
+{
+    std::mt19937 random(1234);
+    std::uniform_int_distribution<uint32> letter(0, 5);
+
+    WhoListIndex index;
+    for (uint32 i = 1; i <= 10000; ++i)
+    {
+        std::wstring name;
+        for (uint32 length = 4 + i % 8; name.size() < length;)
+            name += wchar_t(L'a' + letter(random));
+
+        index.Update(MakePlayer(i, name, uint8(1 + random() % 80), uint8(1 + random() % 11), uint8(1 + random() % 11), random() % 20));
+    }
+
+    // players logging out and changing level or zone after the index was built
+    for (uint32 i = 1; i <= 10000; i += 7)
+    {
+        WhoListPlayerInfo const* info = index.Find(ObjectGuid::Create<HighGuid::Player>(i));
+        ASSERT_NE(info, nullptr);
+        if (i % 2)
+            index.Remove(info->GetGuid());
+        else
+            index.Update(MakePlayer(i, info->GetWidePlayerName(), uint8(1 + random() % 80), info->GetClass(), info->GetRace(), random() % 20));
+    }
+
+    std::vector<WhoListQuery> queries(6);
+    queries[1].LevelMin = 70;
+    queries[1].LevelMax = 80;
+    queries[2].ZoneIds = { 3, 3, 7 };
+    queries[3].PlayerName = L"abc";
+    queries[4].PlayerName = L"fe";
+    queries[4].ClassMask = 1 << CLASS_MAGE;
+    queries[5].PlayerName = L"zzz";
+
+    for (WhoListQuery const& query : queries)
+        EXPECT_EQ(SearchPlayers(index, query), ScanPlayers(index, query));
+}
@@ -0,0 +1,68 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "LFGMgr.h"
+#include "LFGQueue.h"
+#include "gtest/gtest.h"
+
+#include <random>
+
+using namespace lfg;
+
+TEST(LFGQueueRolesTest, SinglePlayers)
+{
+    LfgRolesMap roles;
+    roles[ObjectGuid::Create<HighGuid::Player>(1)] = PLAYER_ROLE_TANK | PLAYER_ROLE_LEADER;
+    EXPECT_EQ(LFGQueueRoles::GetRoleMask(roles), 1 << 8);
+
+    roles[ObjectGuid::Create<HighGuid::Player>(2)] = PLAYER_ROLE_TANK | PLAYER_ROLE_HEALER;
+    EXPECT_EQ(LFGQueueRoles::GetRoleMask(roles), 1 << 12);
+
+    roles[ObjectGuid::Create<HighGuid::Player>(3)] = PLAYER_ROLE_NONE;
+    EXPECT_EQ(LFGQueueRoles::GetRoleMask(roles), 0);
+}
+
+TEST(LFGQueueRolesTest, MatchesCheckGroupRoles)
+{
+    std::mt19937 random(1234);
+    uint8 const roleChoices[] = { PLAYER_ROLE_TANK, PLAYER_ROLE_HEALER, PLAYER_ROLE_DAMAGE, PLAYER_ROLE_DAMAGE,
+        PLAYER_ROLE_TANK | PLAYER_ROLE_DAMAGE, PLAYER_ROLE_HEALER | PLAYER_ROLE_DAMAGE, PLAYER_ROLE_TANK | PLAYER_ROLE_HEALER | PLAYER_ROLE_DAMAGE };
+
+    for (uint32 i = 0; i < 5000; ++i)
+    {
+        // up to five players split into queue entries of one or more players
+        uint32 const players = 2 + random() % 4;
+        std::vector<LfgRolesMap> entries(1 + random() % players);
+        LfgRolesMap allRoles;
+        for (uint32 player = 0; player < players; ++player)
+        {
+            ObjectGuid guid = ObjectGuid::Create<HighGuid::Player>(player + 1);
+            uint8 role = roleChoices[random() % std::size(roleChoices)] | (random() % 4 ? 0 : PLAYER_ROLE_LEADER);
+            entries[player % entries.size()][guid] = role;
+            allRoles[guid] = role;
+        }
+
+        LfgRoleMask mask = LFGQueueRoles::GetRoleMask(entries[0]);
+        for (std::size_t entry = 1; entry < entries.size(); ++entry)
+            mask = LFGQueueRoles::CombineRoleMasks(mask, LFGQueueRoles::GetRoleMask(entries[entry]));
+
+        uint8 const roleCheckResult = LFGMgr::CheckGroupRoles(allRoles);
+        EXPECT_EQ(mask != 0, roleCheckResult != 0);
+        if (roleCheckResult)
+            EXPECT_TRUE(mask & (1 << roleCheckResult));
+    }
+}
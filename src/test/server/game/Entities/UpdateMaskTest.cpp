@@ -0,0 +1,216 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "Object.h"
+#include "UpdateFieldFlags.h"
+#include "UpdateMask.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+namespace
+{
+    // Client layout built one bit at a time, the way the byte per field mask used to write it
+    ByteBuffer BuildReferencePacket(std::vector<bool> const& bits)
+    {
+        ByteBuffer data;
+        uint32 blockCount = (bits.size() + UpdateMask::CLIENT_UPDATE_MASK_BITS - 1) / UpdateMask::CLIENT_UPDATE_MASK_BITS;
+        for (uint32 i = 0; i < blockCount; ++i)
+        {
+            uint32 maskPart = 0;
+            for (uint32 j = 0; j < UpdateMask::CLIENT_UPDATE_MASK_BITS; ++j)
+            {
+                uint32 index = i * UpdateMask::CLIENT_UPDATE_MASK_BITS + j;
+                if (index < bits.size() && bits[index])
+                    maskPart |= 1 << j;
+            }
+
+            data << maskPart;
+        }
+
+        return data;
+    }
+
+    void CheckFieldCount(uint32 count)
+    {
+        UpdateMask mask;
+        mask.SetCount(count);
+
+        std::vector<bool> bits(count);
+        for (uint32 index = 0; index < count; index += 3)
+        {
+            mask.SetBit(index);
+            bits[index] = true;
+        }
+
+        mask.SetBit(count - 1);
+        bits[count - 1] = true;
+        mask.UnsetBit(0);
+        bits[0] = false;
+
+        ByteBuffer packet;
+        mask.AppendToPacket(&packet);
+        ByteBuffer reference = BuildReferencePacket(bits);
+
+        ASSERT_EQ(packet.size(), reference.size());
+        EXPECT_TRUE(std::equal(packet.contents(), packet.contents() + packet.size(), reference.contents()));
+
+        std::vector<uint32> visited;
+        mask.ForEachSetBit([&](uint32 index) { visited.push_back(index); });
+
+        std::vector<uint32> expected;
+        for (uint32 index = 0; index < count; ++index)
+        {
+            EXPECT_EQ(mask.GetBit(index), bits[index]);
+            if (bits[index])
+                expected.push_back(index);
+        }
+
+        EXPECT_EQ(visited, expected);
+        EXPECT_EQ(mask.GetSetBitCount(), expected.size());
+    }
+
+    class UpdateMaskTestObject : public Object
+    {
+    public:
+        UpdateMaskTestObject(TypeID typeId, uint16 typeMask, uint16 valuesCount)
+        {
+            m_objectTypeId = typeId;
+            m_objectType |= typeMask;
+            m_valuesCount = valuesCount;
+            _InitValues();
+        }
+
+        void BuildMask(uint8 updateType, uint32 const* flags, uint32 visibleFlag, UpdateMask& updateMask, uint32 forcedFlag) const
+        {
+            BuildValuesUpdateMask(updateType, flags, visibleFlag, updateMask, forcedFlag);
+        }
+
+        // Fields selected one at a time, the way BuildValuesUpdate did before the masks were built by block
+        std::vector<bool> BuildReferenceBits(uint8 updateType, uint32 const* flags, uint32 visibleFlag, uint32 forcedFlag) const
+        {
+            std::vector<bool> bits(m_valuesCount);
+            for (uint16 index = 0; index < m_valuesCount; ++index)
+                bits[index] = ((_fieldNotifyFlags | forcedFlag) & flags[index]) ||
+                    ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index] != 0) && (flags[index] & visibleFlag));
+
+            return bits;
+        }
+
+    protected:
+        void AddToObjectUpdate() override { }
+        void RemoveFromObjectUpdate() override { }
+    };
+
+    void CheckObjectMasks(UpdateMaskTestObject& object, uint16 valuesCount, uint32 const* flags, std::vector<uint32> const& visibleFlags)
+    {
+        for (uint16 index = 0; index < valuesCount; index += 5)
+            object.SetUInt32Value(index, index + 1);
+
+        object.ClearUpdateMask(false);
+        for (uint16 index = 1; index < valuesCount; index += 7)
+            object.SetUInt32Value(index, index * 3);
+
+        for (uint8 updateType : { UPDATETYPE_VALUES, UPDATETYPE_CREATE_OBJECT })
+        {
+            for (uint32 visibleFlag : visibleFlags)
+            {
+                uint32 forcedFlag = visibleFlag & UF_FLAG_SPECIAL_INFO;
+
+                UpdateMask mask;
+                object.BuildMask(updateType, flags, visibleFlag, mask, forcedFlag);
+
+                ByteBuffer packet;
+                mask.AppendToPacket(&packet);
+                ByteBuffer reference = BuildReferencePacket(object.BuildReferenceBits(updateType, flags, visibleFlag, forcedFlag));
+
+                ASSERT_EQ(packet.size(), reference.size());
+                EXPECT_TRUE(std::equal(packet.contents(), packet.contents() + packet.size(), reference.contents()))
+                    << "update type " << uint32(updateType) << " visible flag " << visibleFlag;
+            }
+        }
+    }
+}
+
+TEST(UpdateMaskTest, UnitFieldLayout)
+{
+    CheckFieldCount(UNIT_END);
+}
+
+TEST(UpdateMaskTest, PlayerFieldLayout)
+{
+    CheckFieldCount(PLAYER_END);
+}
+
+TEST(UpdateMaskTest, SetBlockIgnoresBitsPastFieldCount)
+{
+    UpdateMask mask;
+    mask.SetCount(UNIT_END);
+
+    uint32 lastBlock = mask.GetBlockCount() - 1;
+    mask.SetBlock(lastBlock, ~uint32(0));
+
+    EXPECT_EQ(mask.GetSetBitCount(), UNIT_END - lastBlock * UpdateMask::CLIENT_UPDATE_MASK_BITS);
+    EXPECT_TRUE(mask.GetBit(UNIT_END - 1));
+}
+
+TEST(UpdateMaskTest, ClearAndMerge)
+{
+    UpdateMask left;
+    left.SetCount(PLAYER_END);
+    left.SetBit(5);
+
+    UpdateMask right;
+    right.SetCount(UNIT_END);
+    right.SetBit(UNIT_END - 1);
+
+    left |= right;
+    EXPECT_TRUE(left.GetBit(5));
+    EXPECT_TRUE(left.GetBit(UNIT_END - 1));
+
+    left &= right;
+    EXPECT_FALSE(left.GetBit(5));
+    EXPECT_TRUE(left.GetBit(UNIT_END - 1));
+
+    left.Clear();
+    EXPECT_TRUE(left.IsEmpty());
+}
+
+TEST(UpdateMaskTest, FieldFlagMasksMatchFlagTable)
+{
+    UpdateFieldFlagMasks const& masks = UpdateFieldFlagMasks::Get(UnitUpdateFieldFlags);
+    uint32 const visibleFlag = UF_FLAG_PUBLIC | UF_FLAG_PARTY_MEMBER;
+
+    for (uint32 index = 0; index < PLAYER_END; ++index)
+    {
+        uint32 block = index / UpdateMask::CLIENT_UPDATE_MASK_BITS;
+        uint32 bit = index % UpdateMask::CLIENT_UPDATE_MASK_BITS;
+        EXPECT_EQ(((masks.GetBlock(visibleFlag, block) >> bit) & 1) != 0, (UnitUpdateFieldFlags[index] & visibleFlag) != 0) << "field " << index;
+    }
+}
+
+TEST(UpdateMaskTest, PlayerValuesMaskMatchesFieldByFieldLayout)
+{
+    UpdateMaskTestObject player(TYPEID_PLAYER, TYPEMASK_UNIT | TYPEMASK_PLAYER, PLAYER_END);
+    CheckObjectMasks(player, PLAYER_END, UnitUpdateFieldFlags, { UF_FLAG_PUBLIC, UF_FLAG_PUBLIC | UF_FLAG_PARTY_MEMBER | UF_FLAG_SPECIAL_INFO,
+        UF_FLAG_PUBLIC | UF_FLAG_PRIVATE | UF_FLAG_OWNER | UF_FLAG_SPECIAL_INFO });
+}
+
+TEST(UpdateMaskTest, ItemValuesMaskMatchesFieldByFieldLayout)
+{
+    UpdateMaskTestObject item(TYPEID_ITEM, TYPEMASK_ITEM, ITEM_END);
+    CheckObjectMasks(item, ITEM_END, ItemUpdateFieldFlags, { UF_FLAG_PUBLIC, UF_FLAG_PUBLIC | UF_FLAG_OWNER | UF_FLAG_ITEM_OWNER });
+}
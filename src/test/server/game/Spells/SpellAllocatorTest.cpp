@@ -0,0 +1,91 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SpellAllocator.h"
+#include "gtest/gtest.h"
+
+#include <list>
+#include <thread>
+
+namespace
+{
+    uint64 GetPooled(SpellAllocationKind kind)
+    {
+        uint64 total = 0;
+        for (std::shared_ptr<SpellAllocationStats const> const& stats : SpellAllocator::GetStats())
+            total += stats->Pooled[kind].load();
+        return total;
+    }
+
+    uint64 GetHeap(SpellAllocationKind kind)
+    {
+        uint64 total = 0;
+        for (std::shared_ptr<SpellAllocationStats const> const& stats : SpellAllocator::GetStats())
+            total += stats->Heap[kind].load();
+        return total;
+    }
+}
+
+TEST(SpellAllocatorTest, ReusesReleasedBlocks)
+{
+    void* first = SpellAllocator::Allocate(200, SPELL_ALLOCATION_SPELL);
+    SpellAllocator::Deallocate(first, 200);
+
+    uint64 pooled = GetPooled(SPELL_ALLOCATION_SPELL);
+
+    // any size of the same 16 byte class gets the block back
+    void* second = SpellAllocator::Allocate(193, SPELL_ALLOCATION_SPELL);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(GetPooled(SPELL_ALLOCATION_SPELL), pooled + 1);
+    SpellAllocator::Deallocate(second, 193);
+}
+
+TEST(SpellAllocatorTest, ListNodesCountedPerKind)
+{
+    typedef std::list<uint64, SpellPoolAllocator<uint64, SPELL_ALLOCATION_GO_TARGET>> TargetList;
+
+    uint64 heap = GetHeap(SPELL_ALLOCATION_GO_TARGET);
+    uint64 pooled = GetPooled(SPELL_ALLOCATION_GO_TARGET);
+    {
+        TargetList targets(8, 0);
+        EXPECT_EQ(GetHeap(SPELL_ALLOCATION_GO_TARGET) + GetPooled(SPELL_ALLOCATION_GO_TARGET), heap + pooled + 8);
+    }
+
+    // second cast of the same size reuses every node of the first one
+    uint64 heapAfterFirst = GetHeap(SPELL_ALLOCATION_GO_TARGET);
+    TargetList targets(8, 0);
+    EXPECT_EQ(GetHeap(SPELL_ALLOCATION_GO_TARGET), heapAfterFirst);
+}
+
+TEST(SpellAllocatorTest, ReleaseOnAnotherThread)
+{
+    void* block = SpellAllocator::Allocate(64, SPELL_ALLOCATION_UNIT_TARGET);
+    std::thread([block]()
+    {
+        SpellAllocator::Deallocate(block, 64);
+        // now owned by the free list of this thread
+        EXPECT_EQ(SpellAllocator::Allocate(64, SPELL_ALLOCATION_UNIT_TARGET), block);
+        SpellAllocator::Deallocate(block, 64);
+    }).join();
+}
+
+TEST(SpellAllocatorTest, LargeBlocksBypassPool)
+{
+    void* block = SpellAllocator::Allocate(64 * 1024, SPELL_ALLOCATION_SPELL);
+    ASSERT_NE(block, nullptr);
+    SpellAllocator::Deallocate(block, 64 * 1024);
+}
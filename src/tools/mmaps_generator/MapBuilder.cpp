@@ -18,6 +18,7 @@
 #include "MapBuilder.h"
 #include "IntermediateValues.h"
 #include "MapDefines.h"
+#include "MMapTileGraph.h"
 #include "MapTree.h"
 #include "ModelInstance.h"
 #include "PathCommon.h"
@@ -239,6 +240,20 @@ namespace MMAP
             delete builder;
 
         m_tileBuilders.clear();
+
+        // all tiles are on disk now, the graph needs every tile of a map at once
+        if (mapID)
+        {
+            buildTileGraph(*mapID);
+        }
+        else
+        {
+            for (TileList::iterator it = m_tiles.begin(); it != m_tiles.end(); ++it)
+            {
+                if (!shouldSkipMap(it->m_mapId))
+                    buildTileGraph(it->m_mapId);
+            }
+        }
     }
 
     /**************************************************************************/
@@ -585,6 +600,76 @@ namespace MMAP
         fclose(file);
     }
 
+    /**************************************************************************/
+    void MapBuilder::buildTileGraph(uint32 mapID)
+    {
+        std::set<uint32>* tiles = getTileList(mapID);
+        if (tiles->empty())
+            return;
+
+        char fileName[255];
+        sprintf(fileName, "mmaps/%03u.mmap", mapID);
+
+        dtNavMeshParams params;
+        FILE* file = fopen(fileName, "rb");
+        if (!file)
+            return;
+
+        size_t count = fread(&params, sizeof(dtNavMeshParams), 1, file);
+        fclose(file);
+        if (count != 1)
+            return;
+
+        dtNavMesh* navMesh = dtAllocNavMesh();
+        if (dtStatusFailed(navMesh->init(&params)))
+        {
+            printf("[Map %03i] Failed creating navmesh for the tile graph!\n", mapID);
+            dtFreeNavMesh(navMesh);
+            return;
+        }
+
+        for (unsigned int tile : *tiles)
+        {
+            uint32 tileX, tileY;
+            StaticMapTree::unpackTileID(tile, tileX, tileY);
+
+            sprintf(fileName, "mmaps/%03u%02i%02i.mmtile", mapID, tileY, tileX);
+            file = fopen(fileName, "rb");
+            if (!file)
+                continue; // tile without any geometry
+
+            MmapTileHeader header;
+            if (fread(&header, sizeof(MmapTileHeader), 1, file) != 1 || header.mmapMagic != MMAP_MAGIC ||
+                header.dtVersion != uint32(DT_NAVMESH_VERSION) || header.mmapVersion != MMAP_VERSION)
+            {
+                fclose(file);
+                continue;
+            }
+
+            unsigned char* data = (unsigned char*)dtAlloc(header.size, DT_ALLOC_PERM);
+            if (fread(data, header.size, 1, file) != 1 ||
+                dtStatusFailed(navMesh->addTile(data, header.size, DT_TILE_FREE_DATA, 0, nullptr)))
+                dtFree(data);
+
+            fclose(file);
+        }
+
+        TileGraph graph;
+        graph.Build(*navMesh);
+        dtFreeNavMesh(navMesh);
+
+        sprintf(fileName, "mmaps/%03u.mmgraph", mapID);
+        if (!graph.Save(fileName))
+        {
+            char message[1024];
+            sprintf(message, "[Map %03i] Failed to write %s!\n", mapID, fileName);
+            perror(message);
+            return;
+        }
+
+        printf("[Map %03i] Tile graph with %u nodes and %u edges written\n", mapID, uint32(graph.GetNodeCount()), uint32(graph.GetEdgeCount()));
+    }
+
     /**************************************************************************/
     void TileBuilder::buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY,
                                       MeshData& meshData, float bmin[3], float bmax[3],
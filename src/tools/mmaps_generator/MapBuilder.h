@@ -174,6 +174,8 @@ namespace MMAP
         std::set<uint32>* getTileList(uint32 mapID);
 
         void buildNavMesh(uint32 mapID, dtNavMesh*& navMesh);
+        // loads all written mmtiles of the map and writes its tile connectivity graph
+        void buildTileGraph(uint32 mapID);
 
         void getTileBounds(uint32 tileX, uint32 tileY,
                            float* verts, int vertCount,